@@ -0,0 +1,170 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Benchmark measuring the memory bandwidth per socket achieved by the threads of the OpenMP backend for the different thread pinning policies.
+ * @details The data points are created by a single thread (like in the data set parser), i.e., are located on a single NUMA node.
+ *          If the threads are pinned, the data points are copied to the NUMA nodes of the threads owning the respective kernel matrix rows.
+ *          Usage: `plssvm-benchmark-openmp-numa [num_data_points [num_features [num_repetitions]]]`; the number of threads and the places can be controlled
+ *          using `OMP_NUM_THREADS` and `OMP_PLACES`.
+ */
+
+#include "plssvm/backends/OpenMP/parallel.hpp"        // plssvm::openmp::{parallel_region, first_touch_copy}
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"      // plssvm::openmp::{calculate_kernel_row_range, device_kernel_rbf}
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"  // plssvm::openmp::thread_pinning
+
+#include "fmt/core.h"                                 // fmt::format, fmt::print
+#include "fmt/ostream.h"                              // can use fmt using operator<< overloads
+
+#include "omp.h"                                      // omp_get_thread_num, omp_get_num_threads, omp_get_max_threads
+
+#if defined(__linux__)
+    #include <sched.h>                                // sched_getcpu
+#endif
+
+#include <algorithm>                                  // std::max
+#include <chrono>                                     // std::chrono::{steady_clock, duration}
+#include <cstddef>                                    // std::size_t
+#include <fstream>                                    // std::ifstream
+#include <map>                                        // std::map
+#include <numeric>                                    // std::accumulate
+#include <random>                                     // std::mt19937, std::uniform_real_distribution
+#include <string>                                     // std::stoul
+#include <vector>                                     // std::vector
+
+namespace {
+
+/**
+ * @brief Return the socket (physical package) of the CPU the calling thread is currently running on.
+ * @return the socket; `0` if it can't be determined (`[[nodiscard]]`)
+ */
+[[nodiscard]] int current_socket() {
+#if defined(__linux__)
+    const int cpu = sched_getcpu();
+    if (cpu >= 0) {
+        std::ifstream in{ fmt::format("/sys/devices/system/cpu/cpu{}/topology/physical_package_id", cpu) };
+        int socket = 0;
+        if (in >> socket) {
+            return socket;
+        }
+    }
+#endif
+    return 0;
+}
+
+/**
+ * @brief The measurements of a single thread or socket.
+ */
+struct measurement {
+    /// The number of threads.
+    int num_threads{ 0 };
+    /// The number of bytes read.
+    std::size_t num_bytes{ 0 };
+    /// The time needed to read the bytes in seconds.
+    double seconds{ 0.0 };
+};
+
+/**
+ * @brief Repeatedly read the data points owned by each thread (see plssvm::openmp::calculate_kernel_row_range) and aggregate the measurements per socket.
+ * @param[in] data the data points
+ * @param[in] pinning the thread pinning policy
+ * @param[in] num_repetitions the number of times the data points are read
+ * @return the measurements per socket (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::map<int, measurement> stream_owned_data_points(const std::vector<std::vector<double>> &data, const plssvm::openmp::thread_pinning pinning, const std::size_t num_repetitions) {
+    std::vector<measurement> thread_measurements(static_cast<std::size_t>(omp_get_max_threads()));
+    std::vector<int> thread_sockets(thread_measurements.size());
+    double checksum = 0.0;
+
+    plssvm::openmp::parallel_region(pinning, [&]() {
+        const int thread = omp_get_thread_num();
+        const auto [first, last] = plssvm::openmp::calculate_kernel_row_range(0, data.size(), thread, omp_get_num_threads());
+        thread_sockets[thread] = current_socket();
+
+        // all threads start reading at the same time
+        #pragma omp barrier
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        double sum = 0.0;
+        for (std::size_t rep = 0; rep < num_repetitions; ++rep) {
+            for (std::size_t i = first; i < last; ++i) {
+                sum = std::accumulate(data[i].cbegin(), data[i].cend(), sum);
+            }
+        }
+        const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+
+        thread_measurements[thread] = measurement{ 1, num_repetitions * (last - first) * data.front().size() * sizeof(double), std::chrono::duration<double>(end_time - start_time).count() };
+        #pragma omp atomic
+        checksum += sum;
+    });
+
+    // aggregate the measurements per socket: the threads on a socket read concurrently
+    std::map<int, measurement> socket_measurements{};
+    for (std::size_t thread = 0; thread < thread_measurements.size(); ++thread) {
+        measurement &socket = socket_measurements[thread_sockets[thread]];
+        socket.num_threads += thread_measurements[thread].num_threads;
+        socket.num_bytes += thread_measurements[thread].num_bytes;
+        socket.seconds = std::max(socket.seconds, thread_measurements[thread].seconds);
+    }
+
+    // use the checksum such that the reads can't be optimized away
+    if (checksum == 0.0) {
+        fmt::print("checksum: {}\n", checksum);
+    }
+    return socket_measurements;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    // parse the optional command line arguments
+    const std::size_t num_data_points = argc > 1 ? std::stoul(argv[1]) : 16384;
+    const std::size_t num_features = argc > 2 ? std::stoul(argv[2]) : 1024;
+    const std::size_t num_repetitions = argc > 3 ? std::stoul(argv[3]) : 20;
+
+    // create the data points using a single thread like in the data set parser
+    std::mt19937 gen{ 42 };
+    std::uniform_real_distribution<double> dist{ -1.0, 1.0 };
+    std::vector<std::vector<double>> data(num_data_points, std::vector<double>(num_features));
+    for (std::vector<double> &data_point : data) {
+        for (double &feature : data_point) {
+            feature = dist(gen);
+        }
+    }
+
+    fmt::print("Benchmarking {} data points with {} features using {} OpenMP threads.\n\n", num_data_points, num_features, omp_get_max_threads());
+
+    for (const plssvm::openmp::thread_pinning pinning : { plssvm::openmp::thread_pinning::none, plssvm::openmp::thread_pinning::close, plssvm::openmp::thread_pinning::spread }) {
+        // the data points are only placed on the NUMA nodes of the threads if the threads are pinned
+        std::vector<std::vector<double>> first_touch_data{};
+        if (pinning != plssvm::openmp::thread_pinning::none) {
+            first_touch_data = plssvm::openmp::first_touch_copy<double>(data, pinning);
+        }
+        const std::vector<std::vector<double>> &used_data = first_touch_data.empty() ? data : first_touch_data;
+
+        fmt::print("thread pinning: {}\n", pinning);
+
+        // measure the memory bandwidth per socket reading the data points owned by the threads
+        const std::map<int, measurement> socket_measurements = stream_owned_data_points(used_data, pinning, num_repetitions);
+        double total_bandwidth = 0.0;
+        for (const auto &[socket, m] : socket_measurements) {
+            const double bandwidth = static_cast<double>(m.num_bytes) / m.seconds / 1e9;
+            total_bandwidth += bandwidth;
+            fmt::print("  socket {}: {:4} threads, {:8.2f} GB/s\n", socket, m.num_threads, bandwidth);
+        }
+        fmt::print("  total:    {:4} threads, {:8.2f} GB/s\n", omp_get_max_threads(), total_bandwidth);
+
+        // measure the runtime of a kernel matrix-vector multiplication using the rbf kernel
+        const std::vector<double> q(num_data_points - 1, 0.0);
+        const std::vector<double> d(num_data_points - 1, 1.0);
+        std::vector<double> ret(num_data_points - 1, 0.0);
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        plssvm::openmp::device_kernel_rbf(q, ret, d, used_data, 1.0, 1.0, 1.0, 0, num_data_points - 1, 1.0 / static_cast<double>(num_features), {}, pinning);
+        const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+        fmt::print("  kernel matrix-vector multiplication: {:.3f} s\n\n", std::chrono::duration<double>(end_time - start_time).count());
+    }
+
+    return 0;
+}
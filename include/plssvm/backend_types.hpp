@@ -77,7 +77,7 @@ std::istream &operator>>(std::istream &in, backend_type &backend);
 /// @cond Doxygen_suppress
 // clang-format off
 // Forward declare all possible C-SVMs.
-namespace openmp { class csvm; }
+namespace openmp { class csvm; class device_csvm; }
 namespace cuda { class csvm; }
 namespace hip { class csvm; }
 namespace opencl { class csvm; }
@@ -101,6 +101,14 @@ struct csvm_to_backend_type<openmp::csvm> {
     /// The enum value representing the OpenMP backend.
     static constexpr backend_type value = backend_type::openmp;
 };
+/**
+ * @brief Sets the `value` to `plssvm::backend_type::openmp` for the OpenMP multi-device C-SVM.
+ */
+template <>
+struct csvm_to_backend_type<openmp::device_csvm> {
+    /// The enum value representing the OpenMP backend.
+    static constexpr backend_type value = backend_type::openmp;
+};
 /**
  * @brief Sets the `value` to `plssvm::backend_type::cuda` for the CUDA C-SVM.
  */
@@ -0,0 +1,66 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines CUDA functions for the vector operations used in the CG algorithm, such that its state can stay resident on the device.
+ */
+
+#ifndef PLSSVM_BACKENDS_CUDA_CG_KERNEL_HPP_
+#define PLSSVM_BACKENDS_CUDA_CG_KERNEL_HPP_
+#pragma once
+
+#include "plssvm/constants.hpp"  // plssvm::kernel_index_type
+
+namespace plssvm::cuda {
+
+/**
+ * @brief Calculates `y = alpha * x + y`.
+ * @tparam real_type the type of the data
+ * @param[in] alpha the scaling factor of @p x
+ * @param[in] x the vector to add
+ * @param[in,out] y the result vector
+ * @param[in] size the number of values to update
+ */
+template <typename real_type>
+__global__ void device_kernel_axpy(const real_type alpha, const real_type *x, real_type *y, const kernel_index_type size);
+
+/**
+ * @brief Calculates `y = x + beta * y`.
+ * @tparam real_type the type of the data
+ * @param[in] x the vector to add
+ * @param[in] beta the scaling factor of @p y
+ * @param[in,out] y the result vector
+ * @param[in] size the number of values to update
+ */
+template <typename real_type>
+__global__ void device_kernel_xpby(const real_type *x, const real_type beta, real_type *y, const kernel_index_type size);
+
+/**
+ * @brief Calculates the partial sums of the dot product `x^T * y`, one for each block.
+ * @details The block size must be `THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE`.
+ * @tparam real_type the type of the data
+ * @param[in] x the first vector
+ * @param[in] y the second vector
+ * @param[out] partial_sums the partial sums of each block
+ * @param[in] size the number of values used in the dot product
+ */
+template <typename real_type>
+__global__ void device_kernel_dot(const real_type *x, const real_type *y, real_type *partial_sums, const kernel_index_type size);
+
+/**
+ * @brief Sums up the first @p size @p partial_sums using a single block and stores the result in `partial_sums[0]`.
+ * @details The block size must be `THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE`.
+ * @tparam real_type the type of the data
+ * @param[in,out] partial_sums the partial sums to reduce
+ * @param[in] size the number of partial sums
+ */
+template <typename real_type>
+__global__ void device_kernel_sum(real_type *partial_sums, const kernel_index_type size);
+
+}  // namespace plssvm::cuda
+
+#endif  // PLSSVM_BACKENDS_CUDA_CG_KERNEL_HPP_
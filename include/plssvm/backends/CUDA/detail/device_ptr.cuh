@@ -15,6 +15,9 @@
 
 #include "plssvm/backends/gpu_device_ptr.hpp"  // plssvm::detail::gpu_device_ptr
 
+// forward declare the CUDA event type (cudaEvent_t) such that this header can be included without the CUDA runtime headers
+struct CUevent_st;
+
 namespace plssvm::cuda::detail {
 
 /**
@@ -36,6 +39,7 @@ class device_ptr : public ::plssvm::detail::gpu_device_ptr<T, int> {
     using base_type::fill;
     using base_type::copy_to_device;
     using base_type::copy_to_host;
+    using base_type::copy_to_device_async;
 
     using typename base_type::const_host_pointer_type;
     using typename base_type::device_pointer_type;
@@ -64,7 +68,7 @@ class device_ptr : public ::plssvm::detail::gpu_device_ptr<T, int> {
     /**
      * @copydoc plssvm::detail::gpu_device_ptr::gpu_device_ptr(plssvm::detail::gpu_device_ptr &&)
      */
-    device_ptr(device_ptr &&other) noexcept = default;
+    device_ptr(device_ptr &&other) noexcept;
 
     /**
      * @copydoc plssvm::detail::gpu_device_ptr::operator=(const plssvm::detail::gpu_device_ptr &)
@@ -73,7 +77,7 @@ class device_ptr : public ::plssvm::detail::gpu_device_ptr<T, int> {
     /**
      * @copydoc plssvm::detail::gpu_device_ptr::operator=(plssvm::detail::gpu_device_ptr &&)
      */
-    device_ptr &operator=(device_ptr &&other) noexcept = default;
+    device_ptr &operator=(device_ptr &&other) noexcept;
 
     /**
      * @copydoc plssvm::detail::gpu_device_ptr::~gpu_device_ptr()
@@ -96,6 +100,19 @@ class device_ptr : public ::plssvm::detail::gpu_device_ptr<T, int> {
      * @copydoc plssvm::detail::gpu_device_ptr::copy_to_host(host_pointer_type, size_type, size_type) const
      */
     void copy_to_host(host_pointer_type buffer, size_type pos, size_type count) const override;
+    /**
+     * @copydoc plssvm::detail::gpu_device_ptr::copy_to_device_async(const_host_pointer_type, size_type, size_type)
+     * @details The copy is enqueued in the non-blocking transfer stream of the device (see plssvm::cuda::detail::get_transfer_stream()).
+     */
+    void copy_to_device_async(const_host_pointer_type data_to_copy, size_type pos, size_type count) override;
+    /**
+     * @copydoc plssvm::detail::gpu_device_ptr::wait_for_async_copies()
+     */
+    void wait_for_async_copies() const override;
+
+  private:
+    /// The CUDA event recorded after the last asynchronous copy to this device_ptr (lazily created).
+    CUevent_st *copy_event_{ nullptr };
 };
 
 extern template class device_ptr<float>;
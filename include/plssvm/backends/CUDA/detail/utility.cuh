@@ -13,6 +13,8 @@
 #define PLSSVM_BACKENDS_CUDA_DETAIL_UTILITY_HPP_
 #pragma once
 
+#include <cstddef>  // std::size_t
+
 /**
  * @def PLSSVM_CUDA_ERROR_CHECK
  * @brief Macro used for error checking CUDA runtime functions.
@@ -55,6 +57,23 @@ void peek_at_last_error();
  */
 void device_synchronize(int device);
 
+/**
+ * @brief Returns the number of bytes of free memory on the CUDA @p device.
+ * @param[in] device the CUDA device to query
+ * @throws plssvm::cuda::backend_exception if the given device ID is smaller than 0 or greater or equal than the available number of devices
+ * @return the free device memory in bytes (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t get_device_memory(int device);
+
+/**
+ * @brief Returns the stream used for asynchronous copies to the CUDA @p device.
+ * @details The stream is created on first use as non-blocking stream, i.e., the copies can overlap with the kernels running in the default stream.
+ * @param[in] device the CUDA device
+ * @throws plssvm::cuda::backend_exception if the given device ID is smaller than 0 or greater or equal than the available number of devices
+ * @return the transfer stream (`[[nodiscard]]`)
+ */
+[[nodiscard]] cudaStream_t get_transfer_stream(int device);
+
 }  // namespace plssvm::cuda::detail
 
 #endif  // PLSSVM_BACKENDS_CUDA_DETAIL_UTILITY_HPP_
\ No newline at end of file
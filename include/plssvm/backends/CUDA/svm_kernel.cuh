@@ -37,7 +37,7 @@ __global__ void device_kernel_linear(const real_type *q, real_type *ret, const r
 
 /**
  * @brief Calculates the C-SVM kernel using the polynomial kernel function.
- * @details Currently only single GPU execution is supported.
+ * @details Supports multi-GPU execution by splitting the rows of the implicit kernel matrix across the devices.
  * @tparam real_type the type of the data
  * @param[in] q the `q` vector
  * @param[out] ret the result vector
@@ -51,13 +51,14 @@ __global__ void device_kernel_linear(const real_type *q, real_type *ret, const r
  * @param[in] degree the degree parameter used in the polynomial kernel function
  * @param[in] gamma the gamma parameter used in the polynomial kernel function
  * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+ * @param[in] row_offset the first row of the implicit kernel matrix the current device is responsible for
  */
 template <typename real_type>
-__global__ void device_kernel_polynomial(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const int degree, const real_type gamma, const real_type coef0);
+__global__ void device_kernel_polynomial(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const int degree, const real_type gamma, const real_type coef0, const kernel_index_type row_offset);
 
 /**
  * @brief Calculates the C-SVM kernel using the radial basis function kernel function.
- * @details Currently only single GPU execution is supported.
+ * @details Supports multi-GPU execution by splitting the rows of the implicit kernel matrix across the devices.
  * @tparam real_type the type of the data
  * @param[in] q the `q` vector
  * @param[out] ret the result vector
@@ -69,9 +70,10 @@ __global__ void device_kernel_polynomial(const real_type *q, real_type *ret, con
  * @param[in] num_cols the number of rows in the data matrix
  * @param[in] add denotes whether the values are added or subtracted from the result vector
  * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] row_offset the first row of the implicit kernel matrix the current device is responsible for
  */
 template <typename real_type>
-__global__ void device_kernel_rbf(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const real_type gamma);
+__global__ void device_kernel_rbf(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const real_type gamma, const kernel_index_type row_offset);
 
 }  // namespace plssvm::cuda
 
@@ -0,0 +1,123 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines HIP functions for the vector operations used in the CG algorithm, such that its state can stay resident on the device.
+ */
+
+#ifndef PLSSVM_BACKENDS_HIP_CG_KERNEL_HPP_
+#define PLSSVM_BACKENDS_HIP_CG_KERNEL_HPP_
+#pragma once
+
+#include "hip/hip_runtime.h"
+#include "hip/hip_runtime_api.h"
+
+#include "plssvm/constants.hpp"  // plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE
+
+namespace plssvm::hip {
+
+/**
+ * @brief Calculates `y = alpha * x + y`.
+ * @tparam real_type the type of the data
+ * @param[in] alpha the scaling factor of @p x
+ * @param[in] x the vector to add
+ * @param[in,out] y the result vector
+ * @param[in] size the number of values to update
+ */
+template <typename real_type>
+__global__ void device_kernel_axpy(const real_type alpha, const real_type *x, real_type *y, const kernel_index_type size) {
+    const kernel_index_type index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index < size) {
+        y[index] += alpha * x[index];
+    }
+}
+
+/**
+ * @brief Calculates `y = x + beta * y`.
+ * @tparam real_type the type of the data
+ * @param[in] x the vector to add
+ * @param[in] beta the scaling factor of @p y
+ * @param[in,out] y the result vector
+ * @param[in] size the number of values to update
+ */
+template <typename real_type>
+__global__ void device_kernel_xpby(const real_type *x, const real_type beta, real_type *y, const kernel_index_type size) {
+    const kernel_index_type index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index < size) {
+        y[index] = x[index] + beta * y[index];
+    }
+}
+
+/**
+ * @brief Calculates the partial sums of the dot product `x^T * y`, one for each block.
+ * @details The block size must be `THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE`.
+ * @tparam real_type the type of the data
+ * @param[in] x the first vector
+ * @param[in] y the second vector
+ * @param[out] partial_sums the partial sums of each block
+ * @param[in] size the number of values used in the dot product
+ */
+template <typename real_type>
+__global__ void device_kernel_dot(const real_type *x, const real_type *y, real_type *partial_sums, const kernel_index_type size) {
+    __shared__ real_type block_sums[THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE];
+    const kernel_index_type thread_id = threadIdx.x;
+    const kernel_index_type block_size = blockDim.x;
+
+    // grid-stride loop: each thread accumulates multiple values if the vectors are larger than the grid
+    real_type temp{ 0.0 };
+    for (kernel_index_type i = blockIdx.x * block_size + thread_id; i < size; i += gridDim.x * block_size) {
+        temp += x[i] * y[i];
+    }
+    block_sums[thread_id] = temp;
+
+    // tree-based reduction in shared memory
+    for (kernel_index_type stride = 1; stride < block_size; stride *= 2) {
+        __syncthreads();
+        if (thread_id % (2 * stride) == 0 && thread_id + stride < block_size) {
+            block_sums[thread_id] += block_sums[thread_id + stride];
+        }
+    }
+    if (thread_id == 0) {
+        partial_sums[blockIdx.x] = block_sums[0];
+    }
+}
+
+/**
+ * @brief Sums up the first @p size @p partial_sums using a single block and stores the result in `partial_sums[0]`.
+ * @details The block size must be `THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE`.
+ * @tparam real_type the type of the data
+ * @param[in,out] partial_sums the partial sums to reduce
+ * @param[in] size the number of partial sums
+ */
+template <typename real_type>
+__global__ void device_kernel_sum(real_type *partial_sums, const kernel_index_type size) {
+    __shared__ real_type block_sums[THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE];
+    const kernel_index_type thread_id = threadIdx.x;
+    const kernel_index_type block_size = blockDim.x;
+
+    real_type temp{ 0.0 };
+    for (kernel_index_type i = thread_id; i < size; i += block_size) {
+        temp += partial_sums[i];
+    }
+    block_sums[thread_id] = temp;
+
+    // tree-based reduction in shared memory
+    // note: all partial sums have been read before the first barrier, i.e., the result may overwrite them
+    for (kernel_index_type stride = 1; stride < block_size; stride *= 2) {
+        __syncthreads();
+        if (thread_id % (2 * stride) == 0 && thread_id + stride < block_size) {
+            block_sums[thread_id] += block_sums[thread_id + stride];
+        }
+    }
+    if (thread_id == 0) {
+        partial_sums[0] = block_sums[0];
+    }
+}
+
+}  // namespace plssvm::hip
+
+#endif  // PLSSVM_BACKENDS_HIP_CG_KERNEL_HPP_
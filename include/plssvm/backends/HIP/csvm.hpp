@@ -125,6 +125,10 @@ class csvm : public ::plssvm::detail::gpu_csvm<detail::device_ptr, int> {
      * @copydoc plssvm::detail::gpu_csvm::device_synchronize
      */
     void device_synchronize(const queue_type &queue) const final;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::get_device_memory
+     */
+    [[nodiscard]] std::size_t get_device_memory(const queue_type &queue) const final;
 
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_q_kernel
@@ -142,16 +146,16 @@ class csvm : public ::plssvm::detail::gpu_csvm<detail::device_ptr, int> {
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_svm_kernel
      */
-    void run_svm_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<float> &params, const device_ptr_type<float> &q_d, device_ptr_type<float> &r_d, const device_ptr_type<float> &x_d, const device_ptr_type<float> &data_d, float QA_cost, float add, std::size_t num_data_points_padded, std::size_t num_features) const final { this->run_svm_kernel_impl(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, num_data_points_padded, num_features); }
+    void run_svm_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<float> &params, const device_ptr_type<float> &q_d, device_ptr_type<float> &r_d, const device_ptr_type<float> &x_d, const device_ptr_type<float> &data_d, float QA_cost, float add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const final { this->run_svm_kernel_impl(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, num_data_points_padded, num_features, row_offset); }
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_svm_kernel
      */
-    void run_svm_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<double> &params, const device_ptr_type<double> &q_d, device_ptr_type<double> &r_d, const device_ptr_type<double> &x_d, const device_ptr_type<double> &data_d, double QA_cost, double add, std::size_t num_data_points_padded, std::size_t num_features) const final { this->run_svm_kernel_impl(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, num_data_points_padded, num_features); }
+    void run_svm_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<double> &params, const device_ptr_type<double> &q_d, device_ptr_type<double> &r_d, const device_ptr_type<double> &x_d, const device_ptr_type<double> &data_d, double QA_cost, double add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const final { this->run_svm_kernel_impl(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, num_data_points_padded, num_features, row_offset); }
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_svm_kernel
      */
     template <typename real_type>
-    void run_svm_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, real_type QA_cost, real_type add, std::size_t num_data_points_padded, std::size_t num_features) const;
+    void run_svm_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, real_type QA_cost, real_type add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const;
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_w_kernel
      */
@@ -178,6 +182,58 @@ class csvm : public ::plssvm::detail::gpu_csvm<detail::device_ptr, int> {
      */
     template <typename real_type>
     void run_predict_kernel_impl(const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, device_ptr_type<real_type> &out_d, const device_ptr_type<real_type> &alpha_d, const device_ptr_type<real_type> &point_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, std::size_t num_support_vectors, std::size_t num_predict_points, std::size_t num_features) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_axpy_kernel
+     */
+    void run_axpy_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, float alpha, const device_ptr_type<float> &x_d, device_ptr_type<float> &y_d, std::size_t size) const final { this->run_axpy_kernel_impl(device, range, alpha, x_d, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_axpy_kernel
+     */
+    void run_axpy_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, double alpha, const device_ptr_type<double> &x_d, device_ptr_type<double> &y_d, std::size_t size) const final { this->run_axpy_kernel_impl(device, range, alpha, x_d, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_axpy_kernel
+     */
+    template <typename real_type>
+    void run_axpy_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, real_type alpha, const device_ptr_type<real_type> &x_d, device_ptr_type<real_type> &y_d, std::size_t size) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_xpby_kernel
+     */
+    void run_xpby_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<float> &x_d, float beta, device_ptr_type<float> &y_d, std::size_t size) const final { this->run_xpby_kernel_impl(device, range, x_d, beta, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_xpby_kernel
+     */
+    void run_xpby_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<double> &x_d, double beta, device_ptr_type<double> &y_d, std::size_t size) const final { this->run_xpby_kernel_impl(device, range, x_d, beta, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_xpby_kernel
+     */
+    template <typename real_type>
+    void run_xpby_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, real_type beta, device_ptr_type<real_type> &y_d, std::size_t size) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_dot_kernel
+     */
+    void run_dot_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<float> &x_d, const device_ptr_type<float> &y_d, device_ptr_type<float> &partial_sums_d, std::size_t size) const final { this->run_dot_kernel_impl(device, range, x_d, y_d, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_dot_kernel
+     */
+    void run_dot_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<double> &x_d, const device_ptr_type<double> &y_d, device_ptr_type<double> &partial_sums_d, std::size_t size) const final { this->run_dot_kernel_impl(device, range, x_d, y_d, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_dot_kernel
+     */
+    template <typename real_type>
+    void run_dot_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &y_d, device_ptr_type<real_type> &partial_sums_d, std::size_t size) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_sum_kernel
+     */
+    void run_sum_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<float> &partial_sums_d, std::size_t size) const final { this->run_sum_kernel_impl(device, range, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_sum_kernel
+     */
+    void run_sum_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<double> &partial_sums_d, std::size_t size) const final { this->run_sum_kernel_impl(device, range, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_sum_kernel
+     */
+    template <typename real_type>
+    void run_sum_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &partial_sums_d, std::size_t size) const;
 
   private:
     /**
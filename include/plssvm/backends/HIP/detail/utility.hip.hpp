@@ -13,7 +13,9 @@
 #define PLSSVM_BACKENDS_HIP_DETAIL_UTILITY_HPP_
 #pragma once
 
-#include "hip/hip_runtime_api.h"  // hipError_t
+#include "hip/hip_runtime_api.h"  // hipError_t, hipStream_t
+
+#include <cstddef>  // std::size_t
 
 /**
  * @def PLSSVM_HIP_ERROR_CHECK
@@ -57,6 +59,23 @@ void peek_at_last_error();
  */
 void device_synchronize(int device);
 
+/**
+ * @brief Returns the number of bytes of free memory on the HIP @p device.
+ * @param[in] device the HIP device to query
+ * @throws plssvm::hip::backend_exception if the given device ID is smaller than 0 or greater or equal than the available number of devices
+ * @return the free device memory in bytes (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t get_device_memory(int device);
+
+/**
+ * @brief Returns the stream used for asynchronous copies to the HIP @p device.
+ * @details The stream is created on first use as non-blocking stream, i.e., the copies can overlap with the kernels running in the default stream.
+ * @param[in] device the HIP device
+ * @throws plssvm::hip::backend_exception if the given device ID is smaller than 0 or greater or equal than the available number of devices
+ * @return the transfer stream (`[[nodiscard]]`)
+ */
+[[nodiscard]] hipStream_t get_transfer_stream(int device);
+
 }  // namespace plssvm::hip::detail
 
 #endif  // PLSSVM_BACKENDS_HIP_DETAIL_UTILITY_HPP_
@@ -0,0 +1,104 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the vector operations used in the CG algorithm using the OpenCL backend, such that its state can stay resident on the device.
+ */
+
+/**
+ * @brief Calculates `y = alpha * x + y`.
+ * @tparam real_type the type of the data
+ * @param[in] alpha the scaling factor of @p x
+ * @param[in] x the vector to add
+ * @param[in,out] y the result vector
+ * @param[in] size the number of values to update
+ */
+__kernel void device_kernel_axpy(const real_type alpha, __global const real_type *x, __global real_type *y, const kernel_index_type size) {
+    const kernel_index_type index = get_global_id(0);
+    if (index < size) {
+        y[index] += alpha * x[index];
+    }
+}
+
+/**
+ * @brief Calculates `y = x + beta * y`.
+ * @tparam real_type the type of the data
+ * @param[in] x the vector to add
+ * @param[in] beta the scaling factor of @p y
+ * @param[in,out] y the result vector
+ * @param[in] size the number of values to update
+ */
+__kernel void device_kernel_xpby(__global const real_type *x, const real_type beta, __global real_type *y, const kernel_index_type size) {
+    const kernel_index_type index = get_global_id(0);
+    if (index < size) {
+        y[index] = x[index] + beta * y[index];
+    }
+}
+
+/**
+ * @brief Calculates the partial sums of the dot product `x^T * y`, one for each work-group.
+ * @details The work-group size must be `THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE`.
+ * @tparam real_type the type of the data
+ * @param[in] x the first vector
+ * @param[in] y the second vector
+ * @param[out] partial_sums the partial sums of each work-group
+ * @param[in] size the number of values used in the dot product
+ */
+__kernel void device_kernel_dot(__global const real_type *x, __global const real_type *y, __global real_type *partial_sums, const kernel_index_type size) {
+    __local real_type block_sums[THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE];
+    const kernel_index_type thread_id = get_local_id(0);
+    const kernel_index_type block_size = get_local_size(0);
+
+    // grid-stride loop: each work-item accumulates multiple values if the vectors are larger than the NDRange
+    real_type temp = 0.0;
+    for (kernel_index_type i = get_global_id(0); i < size; i += get_global_size(0)) {
+        temp += x[i] * y[i];
+    }
+    block_sums[thread_id] = temp;
+
+    // tree-based reduction in local memory
+    for (kernel_index_type stride = 1; stride < block_size; stride *= 2) {
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (thread_id % (2 * stride) == 0 && thread_id + stride < block_size) {
+            block_sums[thread_id] += block_sums[thread_id + stride];
+        }
+    }
+    if (thread_id == 0) {
+        partial_sums[get_group_id(0)] = block_sums[0];
+    }
+}
+
+/**
+ * @brief Sums up the first @p size @p partial_sums using a single work-group and stores the result in `partial_sums[0]`.
+ * @details The work-group size must be `THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE`.
+ * @tparam real_type the type of the data
+ * @param[in,out] partial_sums the partial sums to reduce
+ * @param[in] size the number of partial sums
+ */
+__kernel void device_kernel_sum(__global real_type *partial_sums, const kernel_index_type size) {
+    __local real_type block_sums[THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE];
+    const kernel_index_type thread_id = get_local_id(0);
+    const kernel_index_type block_size = get_local_size(0);
+
+    real_type temp = 0.0;
+    for (kernel_index_type i = thread_id; i < size; i += block_size) {
+        temp += partial_sums[i];
+    }
+    block_sums[thread_id] = temp;
+
+    // tree-based reduction in local memory
+    // note: all partial sums have been read before the first barrier, i.e., the result may overwrite them
+    for (kernel_index_type stride = 1; stride < block_size; stride *= 2) {
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (thread_id % (2 * stride) == 0 && thread_id + stride < block_size) {
+            block_sums[thread_id] += block_sums[thread_id + stride];
+        }
+    }
+    if (thread_id == 0) {
+        partial_sums[0] = block_sums[0];
+    }
+}
@@ -17,9 +17,12 @@
 #include "plssvm/backends/OpenCL/detail/context.hpp"        // plssvm::opencl::detail::context
 #include "plssvm/backends/OpenCL/detail/device_ptr.hpp"     // plssvm::opencl::detail::device_ptr
 #include "plssvm/backends/gpu_csvm.hpp"                     // plssvm::detail::gpu_csvm
-#include "plssvm/parameter.hpp"                             // plssvm::parameter, plssvm::detail::parameter
+#include "plssvm/constants.hpp"                             // plssvm::kernel_index_type
+#include "plssvm/parameter.hpp"                             // plssvm::parameter, plssvm::{opencl_thread_block_size, opencl_internal_block_size}, plssvm::detail::{parameter, has_only_opencl_parameter_named_args_v, get_value_from_named_parameter}
 #include "plssvm/target_platforms.hpp"                      // plssvm::target_platform
 
+#include "igor/igor.hpp"                                    // igor::parser
+
 #include <cstddef>                                          // std::size_t
 #include <type_traits>                                      // std::true_type
 #include <utility>                                          // std::forward
@@ -46,6 +49,8 @@ class csvm : public ::plssvm::detail::gpu_csvm<detail::device_ptr, detail::comma
     using base_type = ::plssvm::detail::gpu_csvm<detail::device_ptr, detail::command_queue>;
 
     using base_type::devices_;
+    using base_type::internal_block_size_;
+    using base_type::thread_block_size_;
 
   public:
     using base_type::device_ptr_type;
@@ -78,8 +83,9 @@ class csvm : public ::plssvm::detail::gpu_csvm<detail::device_ptr, detail::comma
      * @throws plssvm::opencl::backend_exception if the requested target is not available
      * @throws plssvm::opencl::backend_exception if more than one OpenCL context for the requested target was found
      * @throws plssvm::opencl::backend_exception if no device for the requested target was found
+     * @throws plssvm::opencl::backend_exception if the provided thread or internal block size is invalid
      */
-    template <typename... Args, PLSSVM_REQUIRES(::plssvm::detail::has_only_parameter_named_args_v<Args...>)>
+    template <typename... Args, PLSSVM_REQUIRES(::plssvm::detail::has_only_opencl_parameter_named_args_v<Args...>)>
     explicit csvm(Args &&...named_args) :
         csvm{ plssvm::target_platform::automatic, std::forward<Args>(named_args)... } {}
     /**
@@ -90,10 +96,21 @@ class csvm : public ::plssvm::detail::gpu_csvm<detail::device_ptr, detail::comma
      * @throws plssvm::opencl::backend_exception if the requested target is not available
      * @throws plssvm::opencl::backend_exception if more than one OpenCL context for the requested target was found
      * @throws plssvm::opencl::backend_exception if no device for the requested target was found
+     * @throws plssvm::opencl::backend_exception if the provided thread or internal block size is invalid
      */
-    template <typename... Args, PLSSVM_REQUIRES(::plssvm::detail::has_only_parameter_named_args_v<Args...>)>
+    template <typename... Args, PLSSVM_REQUIRES(::plssvm::detail::has_only_opencl_parameter_named_args_v<Args...>)>
     explicit csvm(const target_platform target, Args &&...named_args) :
-        base_type{ std::forward<Args>(named_args)... } {
+        base_type{ named_args... } {
+        // check igor parameter
+        igor::parser parser{ std::forward<Args>(named_args)... };
+
+        // check whether specific block sizes have been requested; they are substituted into the OpenCL kernels before their JIT compilation
+        if constexpr (parser.has(opencl_thread_block_size)) {
+            thread_block_size_ = ::plssvm::detail::get_value_from_named_parameter<kernel_index_type>(parser, opencl_thread_block_size);
+        }
+        if constexpr (parser.has(opencl_internal_block_size)) {
+            internal_block_size_ = ::plssvm::detail::get_value_from_named_parameter<kernel_index_type>(parser, opencl_internal_block_size);
+        }
         this->init(target);
     }
 
@@ -124,6 +141,10 @@ class csvm : public ::plssvm::detail::gpu_csvm<detail::device_ptr, detail::comma
      * @copydoc plssvm::detail::gpu_csvm::device_synchronize
      */
     void device_synchronize(const queue_type &queue) const final;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::get_device_memory
+     */
+    [[nodiscard]] std::size_t get_device_memory(const queue_type &queue) const final;
 
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_q_kernel
@@ -141,16 +162,16 @@ class csvm : public ::plssvm::detail::gpu_csvm<detail::device_ptr, detail::comma
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_svm_kernel
      */
-    void run_svm_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<float> &params, const device_ptr_type<float> &q_d, device_ptr_type<float> &r_d, const device_ptr_type<float> &x_d, const device_ptr_type<float> &data_d, float QA_cost, float add, std::size_t num_data_points_padded, std::size_t num_features) const final { this->run_svm_kernel_impl(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, num_data_points_padded, num_features); }
+    void run_svm_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<float> &params, const device_ptr_type<float> &q_d, device_ptr_type<float> &r_d, const device_ptr_type<float> &x_d, const device_ptr_type<float> &data_d, float QA_cost, float add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const final { this->run_svm_kernel_impl(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, num_data_points_padded, num_features, row_offset); }
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_svm_kernel
      */
-    void run_svm_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<double> &params, const device_ptr_type<double> &q_d, device_ptr_type<double> &r_d, const device_ptr_type<double> &x_d, const device_ptr_type<double> &data_d, double QA_cost, double add, std::size_t num_data_points_padded, std::size_t num_features) const final { this->run_svm_kernel_impl(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, num_data_points_padded, num_features); }
+    void run_svm_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<double> &params, const device_ptr_type<double> &q_d, device_ptr_type<double> &r_d, const device_ptr_type<double> &x_d, const device_ptr_type<double> &data_d, double QA_cost, double add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const final { this->run_svm_kernel_impl(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, num_data_points_padded, num_features, row_offset); }
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_svm_kernel
      */
     template <typename real_type>
-    void run_svm_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, real_type QA_cost, real_type add, std::size_t num_data_points_padded, std::size_t num_features) const;
+    void run_svm_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, real_type QA_cost, real_type add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const;
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_w_kernel
      */
@@ -177,6 +198,58 @@ class csvm : public ::plssvm::detail::gpu_csvm<detail::device_ptr, detail::comma
      */
     template <typename real_type>
     void run_predict_kernel_impl(const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, device_ptr_type<real_type> &out_d, const device_ptr_type<real_type> &alpha_d, const device_ptr_type<real_type> &point_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, std::size_t num_support_vectors, std::size_t num_predict_points, std::size_t num_features) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_axpy_kernel
+     */
+    void run_axpy_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, float alpha, const device_ptr_type<float> &x_d, device_ptr_type<float> &y_d, std::size_t size) const final { this->run_axpy_kernel_impl(device, range, alpha, x_d, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_axpy_kernel
+     */
+    void run_axpy_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, double alpha, const device_ptr_type<double> &x_d, device_ptr_type<double> &y_d, std::size_t size) const final { this->run_axpy_kernel_impl(device, range, alpha, x_d, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_axpy_kernel
+     */
+    template <typename real_type>
+    void run_axpy_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, real_type alpha, const device_ptr_type<real_type> &x_d, device_ptr_type<real_type> &y_d, std::size_t size) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_xpby_kernel
+     */
+    void run_xpby_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<float> &x_d, float beta, device_ptr_type<float> &y_d, std::size_t size) const final { this->run_xpby_kernel_impl(device, range, x_d, beta, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_xpby_kernel
+     */
+    void run_xpby_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<double> &x_d, double beta, device_ptr_type<double> &y_d, std::size_t size) const final { this->run_xpby_kernel_impl(device, range, x_d, beta, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_xpby_kernel
+     */
+    template <typename real_type>
+    void run_xpby_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, real_type beta, device_ptr_type<real_type> &y_d, std::size_t size) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_dot_kernel
+     */
+    void run_dot_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<float> &x_d, const device_ptr_type<float> &y_d, device_ptr_type<float> &partial_sums_d, std::size_t size) const final { this->run_dot_kernel_impl(device, range, x_d, y_d, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_dot_kernel
+     */
+    void run_dot_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<double> &x_d, const device_ptr_type<double> &y_d, device_ptr_type<double> &partial_sums_d, std::size_t size) const final { this->run_dot_kernel_impl(device, range, x_d, y_d, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_dot_kernel
+     */
+    template <typename real_type>
+    void run_dot_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &y_d, device_ptr_type<real_type> &partial_sums_d, std::size_t size) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_sum_kernel
+     */
+    void run_sum_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<float> &partial_sums_d, std::size_t size) const final { this->run_sum_kernel_impl(device, range, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_sum_kernel
+     */
+    void run_sum_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<double> &partial_sums_d, std::size_t size) const final { this->run_sum_kernel_impl(device, range, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_sum_kernel
+     */
+    template <typename real_type>
+    void run_sum_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &partial_sums_d, std::size_t size) const;
 
     /// The available OpenCL contexts for the current target platform with the associated devices.
     std::vector<detail::context> contexts_{};
@@ -188,6 +261,7 @@ class csvm : public ::plssvm::detail::gpu_csvm<detail::device_ptr, detail::comma
      * @throws plssvm::opencl::backend_exception if the requested target is not available
      * @throws plssvm::opencl::backend_exception if more than one OpenCL context for the requested target was found
      * @throws plssvm::opencl::backend_exception if no device for the requested target was found
+     * @throws plssvm::opencl::backend_exception if the thread or internal block size is smaller than 1 or the thread block doesn't fit into a work-group on all devices
      */
     void init(target_platform target);
 };
@@ -23,7 +23,7 @@ namespace plssvm::opencl::detail {
 
 /**
  * @brief RAII wrapper class around a cl_command_queue.
- * @details Also contains the compiled kernels associated with the command queue.
+ * @details Also contains the compiled kernels associated with the command queue and a second cl_command_queue used for asynchronous host to device transfers.
  */
 class command_queue {
   public:
@@ -59,7 +59,7 @@ class command_queue {
     command_queue &operator=(command_queue &&other) noexcept;
 
     /**
-     * @brief Release the cl_command_queue resources on destruction.
+     * @brief Release the cl_command_queue resources (including the transfer queue) on destruction.
      */
     ~command_queue();
 
@@ -95,6 +95,8 @@ class command_queue {
 
     /// The wrapped cl_command_queue.
     cl_command_queue queue{};
+    /// The cl_command_queue used to overlap host to device transfers with the kernels enqueued in `queue`.
+    cl_command_queue transfer_queue{};
     /// All OpenCL device kernel associated with the device corresponding to this command queue using `float` as `real_type`.
     std::map<compute_kernel_name, kernel> float_kernels{};
     /// All OpenCL device kernel associated with the device corresponding to this command queue using `double` as `real_type`.
@@ -16,7 +16,7 @@
 #include "plssvm/backends/OpenCL/detail/command_queue.hpp"  // plssvm::opencl::detail::command_queue
 #include "plssvm/backends/gpu_device_ptr.hpp"               // plssvm::detail::gpu_device_ptr
 
-#include "CL/cl.h"  // cl_mem
+#include "CL/cl.h"  // cl_mem, cl_event
 
 namespace plssvm::opencl::detail {
 
@@ -39,6 +39,7 @@ class device_ptr : public ::plssvm::detail::gpu_device_ptr<T, const command_queu
     using base_type::fill;
     using base_type::copy_to_device;
     using base_type::copy_to_host;
+    using base_type::copy_to_device_async;
 
     using typename base_type::const_host_pointer_type;
     using typename base_type::device_pointer_type;
@@ -65,7 +66,7 @@ class device_ptr : public ::plssvm::detail::gpu_device_ptr<T, const command_queu
     /**
      * @copydoc plssvm::detail::gpu_device_ptr::gpu_device_ptr(plssvm::detail::gpu_device_ptr &&)
      */
-    device_ptr(device_ptr &&other) noexcept = default;
+    device_ptr(device_ptr &&other) noexcept;
 
     /**
      * @copydoc plssvm::detail::gpu_device_ptr::operator=(const plssvm::detail::gpu_device_ptr &)
@@ -74,7 +75,7 @@ class device_ptr : public ::plssvm::detail::gpu_device_ptr<T, const command_queu
     /**
      * @copydoc plssvm::detail::gpu_device_ptr::operator=(plssvm::detail::gpu_device_ptr &&)
      */
-    device_ptr &operator=(device_ptr &&other) noexcept = default;
+    device_ptr &operator=(device_ptr &&other) noexcept;
 
     /**
      * @copydoc plssvm::detail::gpu_device_ptr::~gpu_device_ptr()
@@ -97,6 +98,19 @@ class device_ptr : public ::plssvm::detail::gpu_device_ptr<T, const command_queu
      * @copydoc plssvm::detail::gpu_device_ptr::copy_to_host(host_pointer_type, size_type, size_type) const
      */
     void copy_to_host(host_pointer_type buffer, size_type pos, size_type count) const override;
+    /**
+     * @copydoc plssvm::detail::gpu_device_ptr::copy_to_device_async(const_host_pointer_type, size_type, size_type)
+     * @details The copy is enqueued in the transfer queue of the associated command queue (see plssvm::opencl::detail::command_queue::transfer_queue).
+     */
+    void copy_to_device_async(const_host_pointer_type data_to_copy, size_type pos, size_type count) override;
+    /**
+     * @copydoc plssvm::detail::gpu_device_ptr::wait_for_async_copies()
+     */
+    void wait_for_async_copies() const override;
+
+  private:
+    /// The OpenCL event associated with the last asynchronous copy to this device_ptr.
+    mutable cl_event copy_event_{ nullptr };
 };
 
 extern template class device_ptr<float>;
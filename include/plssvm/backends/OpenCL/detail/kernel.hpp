@@ -29,7 +29,15 @@ enum class compute_kernel_name {
     /// The predict kernel for the linear kernel function.
     w_kernel,
     /// The predict kernels for the polynomial and rbf kernel functions.
-    predict_kernel
+    predict_kernel,
+    /// The `y = alpha * x + y` kernel used in the CG algorithm.
+    axpy_kernel,
+    /// The `y = x + beta * y` kernel used in the CG algorithm.
+    xpby_kernel,
+    /// The kernel calculating the partial sums of a dot product used in the CG algorithm.
+    dot_kernel,
+    /// The kernel summing up the partial sums of a dot product used in the CG algorithm.
+    sum_kernel
 };
 
 /**
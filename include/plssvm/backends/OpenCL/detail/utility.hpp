@@ -17,11 +17,12 @@
 #include "plssvm/backends/OpenCL/detail/context.hpp"        // plssvm::opencl::detail::context
 #include "plssvm/backends/OpenCL/detail/error_code.hpp"     // plssvm::opencl::detail::error_code
 #include "plssvm/backends/OpenCL/detail/kernel.hpp"         // plssvm::opencl::detail::compute_kernel_name
+#include "plssvm/constants.hpp"                             // plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
 #include "plssvm/detail/assert.hpp"                         // PLSSVM_ASSERT
 #include "plssvm/kernel_function_types.hpp"                 // plssvm::kernel_function_type
 #include "plssvm/target_platforms.hpp"                      // plssvm::target_platform
 
-#include "CL/cl.h"                                          // cl_uint, cl_int, clSetKernelArg, clEnqueueNDRangeKernel, clFinish
+#include "CL/cl.h"                                          // cl_uint, cl_int, cl_device_id, clSetKernelArg, clEnqueueNDRangeKernel, clFinish
 
 #include "fmt/core.h"                                       // fmt::format
 
@@ -70,6 +71,20 @@ void device_synchronize(const command_queue &queue);
  */
 [[nodiscard]] std::string get_device_name(const command_queue &queue);
 
+/**
+ * @brief Get the size of the global memory of the device associated with the OpenCL command queue @p queue.
+ * @param[in] queue the OpenCL command queue
+ * @return the global device memory in bytes (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t get_device_memory(const command_queue &queue);
+
+/**
+ * @brief Get the maximum number of work-items in a work-group of the OpenCL device @p device.
+ * @param[in] device the OpenCL device
+ * @return the maximum work-group size (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t get_max_work_group_size(cl_device_id device);
+
 /**
  * @brief Convert the kernel type @p kernel to the device function names and return the plssvm::opencl::detail::compute_kernel_name identifier.
  * @param[in] kernel the kernel type
@@ -94,10 +109,12 @@ void device_synchronize(const command_queue &queue);
  * @param[in] contexts the used OpenCL contexts
  * @param[in] target the target platform
  * @param[in] kernel_names all kernel name for which an OpenCL cl_kernel should be build
+ * @param[in] thread_block_size the number of threads per block dimension substituted for `THREAD_BLOCK_SIZE` in the kernel sources
+ * @param[in] internal_block_size the number of data points per thread dimension substituted for `INTERNAL_BLOCK_SIZE` in the kernel sources
  * @throws plssvm::invalid_file_format_exception if the file couldn't be read using [`std::ifstream::read`](https://en.cppreference.com/w/cpp/io/basic_istream/read)
  * @return the command queues with all necessary kernels (`[[nodiscard]]`)
  */
-[[nodiscard]] std::vector<command_queue> create_command_queues(const std::vector<context> &contexts, target_platform target, const std::vector<std::pair<compute_kernel_name, std::string>> &kernel_names);
+[[nodiscard]] std::vector<command_queue> create_command_queues(const std::vector<context> &contexts, target_platform target, const std::vector<std::pair<compute_kernel_name, std::string>> &kernel_names, kernel_index_type thread_block_size = THREAD_BLOCK_SIZE, kernel_index_type internal_block_size = INTERNAL_BLOCK_SIZE);
 
 /**
  * @brief Set all arguments in the parameter pack @p args for the kernel @p kernel.
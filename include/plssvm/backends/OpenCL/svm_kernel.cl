@@ -100,7 +100,7 @@ __kernel void device_kernel_linear(__global const real_type *q, __global real_ty
 
 /**
  * @brief Calculates the C-SVM kernel using the polynomial kernel function.
- * @details Currently only single GPU execution is supported.
+ * @details Supports multi-GPU execution by splitting the rows of the implicit kernel matrix across the devices.
  * @tparam real_type the type of the data
  * @param[in] q the `q` vector
  * @param[out] ret the result vector
@@ -114,9 +114,10 @@ __kernel void device_kernel_linear(__global const real_type *q, __global real_ty
  * @param[in] degree the degree parameter used in the polynomial kernel function
  * @param[in] gamma the gamma parameter used in the polynomial kernel function
  * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+ * @param[in] row_offset the first row of the implicit kernel matrix the current device is responsible for
  */
-__kernel void device_kernel_polynomial(__global const real_type *q, __global real_type *ret, __global const real_type *d, __global const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const int degree, const real_type gamma, const real_type coef0) {
-    kernel_index_type i = get_group_id(0) * get_local_size(0) * INTERNAL_BLOCK_SIZE;
+__kernel void device_kernel_polynomial(__global const real_type *q, __global real_type *ret, __global const real_type *d, __global const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const int degree, const real_type gamma, const real_type coef0, const kernel_index_type row_offset) {
+    kernel_index_type i = row_offset + get_group_id(0) * get_local_size(0) * INTERNAL_BLOCK_SIZE;
     kernel_index_type j = get_group_id(1) * get_local_size(1) * INTERNAL_BLOCK_SIZE;
 
     __local real_type data_intern_i[THREAD_BLOCK_SIZE][INTERNAL_BLOCK_SIZE];
@@ -180,7 +181,7 @@ __kernel void device_kernel_polynomial(__global const real_type *q, __global rea
 
 /**
  * @brief Calculates the C-SVM kernel using the radial basis function kernel function.
- * @details Currently only single GPU execution is supported.
+ * @details Supports multi-GPU execution by splitting the rows of the implicit kernel matrix across the devices.
  * @tparam real_type the type of the data
  * @param[in] q the `q` vector
  * @param[out] ret the result vector
@@ -192,9 +193,10 @@ __kernel void device_kernel_polynomial(__global const real_type *q, __global rea
  * @param[in] num_cols the number of rows in the data matrix
  * @param[in] add denotes whether the values are added or subtracted from the result vector
  * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] row_offset the first row of the implicit kernel matrix the current device is responsible for
  */
-__kernel void device_kernel_rbf(__global const real_type *q, __global real_type *ret, __global const real_type *d, __global const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const real_type gamma) {
-    kernel_index_type i = get_group_id(0) * get_local_size(0) * INTERNAL_BLOCK_SIZE;
+__kernel void device_kernel_rbf(__global const real_type *q, __global real_type *ret, __global const real_type *d, __global const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const real_type gamma, const kernel_index_type row_offset) {
+    kernel_index_type i = row_offset + get_group_id(0) * get_local_size(0) * INTERNAL_BLOCK_SIZE;
     kernel_index_type j = get_group_id(1) * get_local_size(1) * INTERNAL_BLOCK_SIZE;
 
     __local real_type data_intern_i[THREAD_BLOCK_SIZE][INTERNAL_BLOCK_SIZE];
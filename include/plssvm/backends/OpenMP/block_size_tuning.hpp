@@ -0,0 +1,127 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines functions to auto-tune the block size of the OpenMP kernels and to persist the tuned block sizes in a profile file.
+ */
+
+#ifndef PLSSVM_BACKENDS_OPENMP_BLOCK_SIZE_TUNING_HPP_
+#define PLSSVM_BACKENDS_OPENMP_BLOCK_SIZE_TUNING_HPP_
+#pragma once
+
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"  // plssvm::openmp::thread_pinning
+#include "plssvm/constants.hpp"                       // plssvm::kernel_index_type
+#include "plssvm/kernel_function_types.hpp"           // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                       // plssvm::detail::parameter
+
+#include <cstddef>                                    // std::size_t
+#include <map>                                        // std::map
+#include <optional>                                   // std::optional
+#include <string>                                     // std::string
+#include <string_view>                                // std::string_view
+#include <tuple>                                      // std::tuple
+#include <vector>                                     // std::vector
+
+namespace plssvm::openmp {
+
+/**
+ * @brief Return an identifier of the current machine used to distinguish the entries of a plssvm::openmp::tuning_profile.
+ * @details Consists of the host name and, if available, the CPU model name, e.g., `node01 (AMD EPYC 7742 64-Core Processor)`.
+ * @return the machine identifier (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::string current_machine_name();
+
+/**
+ * @brief The best OpenMP block size per machine, kernel function, and floating point type.
+ * @details The profile can be persisted in a file which is reused in later runs. An example file can look like
+ * @code
+ * # machine;kernel;real_type;block_size
+ * node01 (AMD EPYC 7742 64-Core Processor);rbf;double;32
+ * node01 (AMD EPYC 7742 64-Core Processor);rbf;float;64
+ * @endcode
+ */
+class tuning_profile {
+  public:
+    /**
+     * @brief Default construct an empty tuning profile.
+     */
+    tuning_profile() = default;
+    /**
+     * @brief Read the tuning profile from the file @p filename. If the file doesn't exist, the tuning profile is empty.
+     * @param[in] filename the profile file to read
+     * @throws plssvm::invalid_file_format_exception if an entry doesn't consist of exactly four values separated by `;`
+     * @throws plssvm::invalid_file_format_exception if the kernel function, the floating point type, or the block size of an entry is invalid
+     */
+    explicit tuning_profile(const std::string &filename);
+
+    /**
+     * @brief Return the tuned block size for the @p kernel using the floating point type @p real_type on the @p machine.
+     * @param[in] machine the machine identifier (see plssvm::openmp::current_machine_name)
+     * @param[in] kernel the kernel function
+     * @param[in] real_type the name of the floating point type (`float` or `double`)
+     * @return the block size; `std::nullopt` if no block size has been tuned for this combination yet (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::optional<kernel_index_type> get_block_size(const std::string &machine, kernel_function_type kernel, std::string_view real_type) const;
+    /**
+     * @brief Set the tuned @p block_size for the @p kernel using the floating point type @p real_type on the @p machine overwriting a potentially already existing entry.
+     * @param[in] machine the machine identifier (see plssvm::openmp::current_machine_name)
+     * @param[in] kernel the kernel function
+     * @param[in] real_type the name of the floating point type (`float` or `double`)
+     * @param[in] block_size the tuned block size
+     */
+    void set_block_size(const std::string &machine, kernel_function_type kernel, std::string_view real_type, kernel_index_type block_size);
+    /**
+     * @brief Return the number of entries in this tuning profile.
+     * @return the number of entries (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_entries() const noexcept { return entries_.size(); }
+
+    /**
+     * @brief Write the tuning profile to the file @p filename.
+     * @details The profile is first written to a temporary file which is renamed afterwards, i.e., an already existing profile file remains intact if the process is terminated while writing.
+     * @param[in] filename the profile file to write
+     * @throws plssvm::exception if the profile file couldn't be written
+     */
+    void save(const std::string &filename) const;
+
+  private:
+    /// The tuned block sizes indexed by [machine, kernel function, floating point type].
+    std::map<std::tuple<std::string, kernel_function_type, std::string>, kernel_index_type> entries_{};
+};
+
+/**
+ * @brief Benchmark all plssvm::openmp::supported_block_sizes() on a sample of the @p data and return the fastest one.
+ * @details The sample consists of (at most) @p num_samples data points evenly spread over @p data. Each block size runs the kernel matrix-vector multiplication
+ *          of the sample @p num_repetitions times and the minimal runtime is used.
+ * @tparam real_type the type of the data
+ * @param[in] params the SVM parameters used in the kernel function
+ * @param[in] data the data points
+ * @param[in] pinning the thread pinning policy used in the kernel matrix-vector multiplications
+ * @param[in] num_samples the maximum number of data points used in the benchmarks
+ * @param[in] num_repetitions the number of benchmark runs per block size
+ * @return the fastest block size (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] kernel_index_type tune_block_size(const ::plssvm::detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &data, thread_pinning pinning = thread_pinning::none, std::size_t num_samples = 2048, std::size_t num_repetitions = 3);
+
+/**
+ * @brief Return the block size stored in the profile file @p profile_filename for the current machine, the kernel function in @p params, and `real_type`.
+ * @details If no such entry exists, the block size is tuned using plssvm::openmp::tune_block_size and added to the profile file, i.e., later runs reuse it.
+ * @tparam real_type the type of the data
+ * @param[in] profile_filename the profile file
+ * @param[in] params the SVM parameters used in the kernel function
+ * @param[in] data the data points
+ * @param[in] pinning the thread pinning policy used in the kernel matrix-vector multiplications
+ * @throws plssvm::exception all exceptions thrown in plssvm::openmp::tuning_profile
+ * @return the tuned block size (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] kernel_index_type load_or_tune_block_size(const std::string &profile_filename, const ::plssvm::detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &data, thread_pinning pinning = thread_pinning::none);
+
+}  // namespace plssvm::openmp
+
+#endif  // PLSSVM_BACKENDS_OPENMP_BLOCK_SIZE_TUNING_HPP_
@@ -13,14 +13,31 @@
 #define PLSSVM_BACKENDS_OPENMP_CSVM_HPP_
 #pragma once
 
-#include "plssvm/csvm.hpp"                // plssvm::csvm
-#include "plssvm/detail/type_traits.hpp"  // PLSSVM_REQUIRES
-#include "plssvm/parameter.hpp"           // plssvm::parameter, plssvm::detail::{parameter, has_only_parameter_named_args_v}
-#include "plssvm/target_platforms.hpp"    // plssvm::target_platform
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"  // plssvm::openmp::thread_pinning
+#include "plssvm/backends/OpenMP/thread_scope.hpp"    // plssvm::openmp::thread_scope
+#include "plssvm/constants.hpp"                       // plssvm::kernel_index_type, plssvm::OPENMP_BLOCK_SIZE
+#include "plssvm/csvm.hpp"                            // plssvm::csvm
+#include "plssvm/default_value.hpp"                   // plssvm::default_value, plssvm::default_init
+#include "plssvm/detail/io/binary_data_file.hpp"      // plssvm::detail::io::binary_data_file
+#include "plssvm/detail/logger.hpp"                   // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"      // plssvm::detail::tracking_entry
+#include "plssvm/detail/solver_control.hpp"           // plssvm::detail::solver_control
+#include "plssvm/detail/type_traits.hpp"              // PLSSVM_REQUIRES, plssvm::detail::remove_cvref_t
+#include "plssvm/exceptions/exceptions.hpp"           // plssvm::invalid_parameter_exception
+#include "plssvm/parameter.hpp"                       // plssvm::parameter, plssvm::{openmp_thread_pinning, openmp_num_threads, openmp_cpu_set, openmp_block_size, openmp_tuning_profile}, plssvm::detail::{parameter, has_only_openmp_parameter_named_args_v, get_value_from_named_parameter}
+#include "plssvm/target_platforms.hpp"                // plssvm::target_platform
 
-#include <type_traits>                    // std::true_type
-#include <utility>                        // std::forward, std::pair
-#include <vector>                         // std::vector
+#include "fmt/core.h"                                 // fmt::format
+#include "igor/igor.hpp"                              // igor::parser
+
+#include <chrono>                                     // std::chrono::{steady_clock, time_point, duration_cast, milliseconds}
+#include <cstddef>                                    // std::size_t
+#include <cstdint>                                    // std::uint64_t
+#include <functional>                                 // std::function
+#include <string>                                     // std::string
+#include <type_traits>                                // std::true_type, std::is_same_v
+#include <utility>                                    // std::forward, std::pair
+#include <vector>                                     // std::vector
 
 namespace plssvm {
 
@@ -51,28 +68,66 @@ class csvm : public ::plssvm::csvm {
 
     /**
      * @brief Construct a new C-SVM using the OpenMP backend and the optionally provided @p named_args.
+     * @details Additionally to the SVM parameters, the thread pinning policy can be provided using `openmp_thread_pinning`, the number of threads used in all parallel regions
+     *          of this C-SVM using `openmp_num_threads`, and the CPUs these threads are bound to using `openmp_cpu_set` (see plssvm::openmp::thread_scope).
+     *          The block size of the kernel matrix-vector multiplications can either be provided using `openmp_block_size` or auto-tuned and persisted
+     *          in the profile file provided using `openmp_tuning_profile` (see plssvm::openmp::load_or_tune_block_size).
      * @param[in] named_args the additional optional named-parameters
      * @throws plssvm::exception all exceptions thrown in the base class constructor
      * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
      * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::openmp::backend_exception if the number of threads is negative or the threads can't be bound to the CPU set
+     * @throws plssvm::openmp::backend_exception if both, a thread pinning policy and a CPU set, are provided
+     * @throws plssvm::openmp::backend_exception if the block size isn't one of plssvm::openmp::supported_block_sizes()
      */
-    template <typename... Args, PLSSVM_REQUIRES(detail::has_only_parameter_named_args_v<Args...>)>
+    template <typename... Args, PLSSVM_REQUIRES(detail::has_only_openmp_parameter_named_args_v<Args...>)>
     explicit csvm(Args &&...named_args) :
-        ::plssvm::csvm{ std::forward<Args>(named_args)... } {
-        // the default target is the automatic one
-        this->init(plssvm::target_platform::automatic);
-    }
+        csvm{ plssvm::target_platform::automatic, std::forward<Args>(named_args)... } {}
     /**
      * @brief Construct a new C-SVM using the OpenMP backend on the @p target platform and the optionally provided @p named_args.
+     * @details Additionally to the SVM parameters, the thread pinning policy can be provided using `openmp_thread_pinning`, the number of threads used in all parallel regions
+     *          of this C-SVM using `openmp_num_threads`, and the CPUs these threads are bound to using `openmp_cpu_set` (see plssvm::openmp::thread_scope).
+     *          The block size of the kernel matrix-vector multiplications can either be provided using `openmp_block_size` or auto-tuned and persisted
+     *          in the profile file provided using `openmp_tuning_profile` (see plssvm::openmp::load_or_tune_block_size).
      * @param[in] target the target platform used for this C-SVM
      * @param[in] named_args the additional optional named-parameters
      * @throws plssvm::exception all exceptions thrown in the base class constructor
      * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
      * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::openmp::backend_exception if the number of threads is negative or the threads can't be bound to the CPU set
+     * @throws plssvm::openmp::backend_exception if both, a thread pinning policy and a CPU set, are provided
+     * @throws plssvm::openmp::backend_exception if the block size isn't one of plssvm::openmp::supported_block_sizes()
      */
-    template <typename... Args, PLSSVM_REQUIRES(detail::has_only_parameter_named_args_v<Args...>)>
+    template <typename... Args, PLSSVM_REQUIRES(detail::has_only_openmp_parameter_named_args_v<Args...>)>
     explicit csvm(const target_platform target, Args &&...named_args) :
-        ::plssvm::csvm{ std::forward<Args>(named_args)... } {
+        ::plssvm::csvm{ named_args... } {
+        // check igor parameter
+        igor::parser parser{ std::forward<Args>(named_args)... };
+
+        // check whether a specific thread pinning policy has been requested
+        if constexpr (parser.has(openmp_thread_pinning)) {
+            // compile time check: the value must have the correct type
+            static_assert(std::is_same_v<detail::remove_cvref_t<decltype(parser(openmp_thread_pinning))>, thread_pinning>, "Provided openmp_thread_pinning must be convertible to a plssvm::openmp::thread_pinning!");
+            pinning_ = static_cast<thread_pinning>(parser(openmp_thread_pinning));
+        }
+        // check whether a specific number of threads has been requested
+        if constexpr (parser.has(openmp_num_threads)) {
+            num_threads_ = detail::get_value_from_named_parameter<int>(parser, openmp_num_threads);
+        }
+        // check whether the threads should be bound to specific CPUs
+        if constexpr (parser.has(openmp_cpu_set)) {
+            cpu_set_ = detail::get_value_from_named_parameter<std::vector<int>>(parser, openmp_cpu_set);
+        }
+        // compile time check: the block size can either be provided explicitly or auto-tuned
+        static_assert(!(parser.has(openmp_block_size) && parser.has(openmp_tuning_profile)), "Only one of openmp_block_size and openmp_tuning_profile may be provided!");
+        // check whether a specific block size has been requested
+        if constexpr (parser.has(openmp_block_size)) {
+            block_size_ = detail::get_value_from_named_parameter<kernel_index_type>(parser, openmp_block_size);
+        }
+        // check whether the block size should be auto-tuned
+        if constexpr (parser.has(openmp_tuning_profile)) {
+            tuning_profile_ = detail::get_value_from_named_parameter<std::string>(parser, openmp_tuning_profile);
+        }
         this->init(target);
     }
 
@@ -97,20 +152,109 @@ class csvm : public ::plssvm::csvm {
      */
      ~csvm() override = default;
 
+    /**
+     * @brief Return the thread pinning policy used in this OpenMP SVM.
+     * @return the thread pinning policy (`[[nodiscard]]`)
+     */
+    [[nodiscard]] thread_pinning get_thread_pinning() const noexcept { return pinning_; }
+    /**
+     * @brief Return the number of threads used in all parallel regions of this OpenMP SVM.
+     * @return the number of threads; `0` if the number of threads is determined by the OpenMP runtime (`[[nodiscard]]`)
+     */
+    [[nodiscard]] int get_num_threads() const noexcept { return num_threads_; }
+    /**
+     * @brief Return the CPUs the threads of this OpenMP SVM are bound to.
+     * @return the CPUs; empty if the threads aren't bound to specific CPUs (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::vector<int> &get_cpu_set() const noexcept { return cpu_set_; }
+    /**
+     * @brief Return the block size used in the kernel matrix-vector multiplications of this OpenMP SVM if no tuning profile is used.
+     * @return the block size (`[[nodiscard]]`)
+     */
+    [[nodiscard]] kernel_index_type get_block_size() const noexcept { return block_size_; }
+    /**
+     * @brief Return the profile file storing the auto-tuned block sizes.
+     * @return the profile file; empty if the block size isn't auto-tuned (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const std::string &get_tuning_profile() const noexcept { return tuning_profile_; }
+    /**
+     * @brief Restrict all OpenMP parallel regions started by the calling thread to the number of threads and the CPU set of this OpenMP SVM until the returned scope is destroyed.
+     * @details All parallel regions started by this C-SVM already use its threads. The scope can be used to use the same threads in the remaining parallel regions
+     *          of a training or tuning job running concurrently to others in the same process, e.g., while parsing the data set: `const auto scope = svm.make_thread_scope();`.
+     * @throws plssvm::openmp::backend_exception if the threads can't be bound to the CPU set
+     * @return the RAII guard restoring the previous settings on destruction (`[[nodiscard]]`)
+     */
+    [[nodiscard]] thread_scope make_thread_scope() const { return thread_scope{ num_threads_, cpu_set_ }; }
+
+    /**
+     * @brief Train a C-SVM on the data points stored in the binary data file @p filename (see `plssvm::detail::io::write_binary_data_file`) without loading them into memory at once (out-of-core).
+     * @details The data points are streamed in blocks from the memory mapped file in each kernel matrix-vector multiplication such that at most `memory_budget` bytes are used for the data points.
+     *          While a block is processed, the next one is already read from the file.
+     *          Note that the vectors used in the CG algorithm (a few values per data point) must still fit into memory.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] filename the binary data file containing the data points used to train the SVM
+     * @param[in] labels the labels of the data points; must be mapped to `-1` and `+1`
+     * @param[in] named_args the potential additional parameters (`epsilon`, `max_iter`, `solver`, `iteration_callback`, `time_budget`, `cancellation`, `checkpoint_file`, `checkpoint_interval`, `resume`, and/or `memory_budget`)
+     * @throws plssvm::invalid_parameter_exception if the provided `memory_budget` is zero
+     * @throws plssvm::invalid_parameter_exception if the number of @p labels doesn't match the number of data points in the binary data file
+     * @throws plssvm::exception all exceptions thrown in `plssvm::detail::io::binary_data_file` and `plssvm::csvm::parse_solver_named_args`
+     * @return a pair of [the learned weights, the learned bias rho] (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename... Args>
+    [[nodiscard]] std::pair<std::vector<real_type>, real_type> fit_out_of_core(const std::string &filename, const std::vector<real_type> &labels, Args &&...named_args) const;
+
   protected:
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter); }
+    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter, const detail::solver_control<float> &control) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter, control); }
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter); }
+    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter, const detail::solver_control<double> &control) const override { return this->solve_system_of_linear_equations_impl(params, A, b, eps, max_iter, control); }
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
     template <typename real_type>
-    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter) const;
+    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter, const detail::solver_control<real_type> &control) const;
+    /**
+     * @brief Solves the equation \f$Ax = b\f$ using the Conjugated Gradients algorithm streaming the data points from the binary data file @p A in blocks using at most @p memory_budget bytes.
+     * @details The template parameter `real_type` represents the type of the data points (either `float` or `double`).
+     * @param[in] params the SVM parameters used in the respective kernel functions
+     * @param[in] A the binary data file containing the matrix of the equation \f$Ax = b\f$ (symmetric positive definite)
+     * @param[in] b the right-hand side of the equation \f$Ax = b\f$
+     * @param[in] eps the error tolerance
+     * @param[in] max_iter the maximum number of CG iterations
+     * @param[in] memory_budget the maximum number of bytes used to store the data points in memory
+     * @param[in] control additional information used to control the CG algorithm
+     * @return a pair of [the result vector x, the resulting bias] (`[[nodiscard]]`)
+     */
+    template <typename real_type>
+    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_out_of_core_impl(const detail::parameter<real_type> &params, const detail::io::binary_data_file<real_type> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter, std::size_t memory_budget, const detail::solver_control<real_type> &control) const;
+
+    /**
+     * @brief The type of the kernel matrix-vector multiplication used in the CG algorithm.
+     * @details Must calculate `result += add * A * vec`. If the last parameter is `true`, the multiplication may be performed in single precision.
+     */
+    template <typename real_type>
+    using kernel_matrix_vector_multiplication_type = std::function<void(const std::vector<real_type> &, std::vector<real_type> &, real_type, bool)>;
+    /**
+     * @brief Run the (pipelined) CG algorithm on the already reduced system of linear equations using the @p matrix_vector_multiplication.
+     * @details Implements the common functionality of the in-core and out-of-core training. The template parameter `real_type` represents the type of the data points (either `float` or `double`).
+     * @param[in] params the SVM parameters (only used to validate checkpoints)
+     * @param[in] b the reduced right-hand side of the equation \f$Ax = b\f$
+     * @param[in] data_fingerprint the fingerprint of the data points (only used if checkpoints are written or read)
+     * @param[in] eps the error tolerance
+     * @param[in] max_iter the maximum number of CG iterations
+     * @param[in] control additional information used to control the CG algorithm
+     * @param[in] use_mixed_precision `true` if the kernel matrix-vector multiplications in the CG iterations should be performed in single precision
+     * @param[in] solver_start_time the time the setup of the backend started (used to report the elapsed time to the iteration callback)
+     * @param[in] matrix_vector_multiplication the kernel matrix-vector multiplication
+     * @return the result vector x (`[[nodiscard]]`)
+     */
+    template <typename real_type>
+    [[nodiscard]] std::vector<real_type> conjugate_gradients(const detail::parameter<real_type> &params, const std::vector<real_type> &b, std::uint64_t data_fingerprint, real_type eps, unsigned long long max_iter, const detail::solver_control<real_type> &control, bool use_mixed_precision, std::chrono::steady_clock::time_point solver_start_time, const kernel_matrix_vector_multiplication_type<real_type> &matrix_vector_multiplication) const;
 
     /**
      * @copydoc plssvm::csvm::predict_values
@@ -155,9 +299,41 @@ class csvm : public ::plssvm::csvm {
      * @param[in] data the data points
      * @param[in] QA_cost a value used in the dimensional reduction
      * @param[in] add denotes whether the values are added or subtracted from the result vector
+     * @param[in] stop_requested if provided and returning `true`, the kernel stops early, i.e., @p ret is only partially calculated
+     * @param[in] block_size the block size used in the kernel; `0` if the block size of this C-SVM should be used
      */
     template <typename real_type>
-    void run_device_kernel(const detail::parameter<real_type> &params, const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type add) const;
+    void run_device_kernel(const detail::parameter<real_type> &params, const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type add, const std::function<bool()> &stop_requested = {}, kernel_index_type block_size = 0) const;
+    /**
+     * @brief Select the correct kernel based on the value of plssvm::parameter::kernel_type and run it on the CPU using OpenMP, but only calculate the rows [@p row_begin, @p row_end) of the lower triangular kernel matrix.
+     * @details The template parameter `real_type` represents the type of the data points (either `float` or `double`).
+     *          Summing up the results of disjoint row ranges covering all rows yields the same result as calculating all rows at once.
+     * @param[in] params the SVM parameter used to calculate `q` (e.g., kernel_type)
+     * @param[in] q the `q` vector used in the dimensional reduction
+     * @param[out] ret the result vector
+     * @param[in] d the right-hand side of the equation
+     * @param[in] data the data points
+     * @param[in] QA_cost a value used in the dimensional reduction
+     * @param[in] add denotes whether the values are added or subtracted from the result vector
+     * @param[in] row_begin the first row of the kernel matrix to calculate
+     * @param[in] row_end one past the last row of the kernel matrix to calculate
+     * @param[in] stop_requested if provided and returning `true`, the kernel stops early, i.e., @p ret is only partially calculated
+     * @param[in] block_size the block size used in the kernel; `0` if the block size of this C-SVM should be used
+     */
+    template <typename real_type>
+    void run_device_kernel(const detail::parameter<real_type> &params, const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type add, std::size_t row_begin, std::size_t row_end, const std::function<bool()> &stop_requested = {}, kernel_index_type block_size = 0) const;
+    /**
+     * @brief Select the block size used in the kernel matrix-vector multiplications with the kernel function in @p params on the @p data.
+     * @details If a tuning profile has been provided, the block size is read from it or, if not present, auto-tuned on a sample of the @p data and added to it.
+     *          Otherwise, the block size of this C-SVM is used.
+     *          The template parameter `real_type` represents the type of the data points (either `float` or `double`).
+     * @param[in] params the SVM parameter (e.g., kernel_type)
+     * @param[in] data the data points
+     * @throws plssvm::exception all exceptions thrown in plssvm::openmp::load_or_tune_block_size
+     * @return the block size (`[[nodiscard]]`)
+     */
+    template <typename real_type>
+    [[nodiscard]] kernel_index_type select_block_size(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &data) const;
 
   private:
     /**
@@ -167,8 +343,76 @@ class csvm : public ::plssvm::csvm {
      * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
      */
     void init(target_platform target);
+
+    /// The thread pinning policy used in the kernel matrix-vector multiplications.
+    thread_pinning pinning_{ thread_pinning::none };
+    /// The number of threads used in all parallel regions; `0` if determined by the OpenMP runtime.
+    int num_threads_{ 0 };
+    /// The CPUs the threads are bound to; empty if the threads aren't bound to specific CPUs.
+    std::vector<int> cpu_set_{};
+    /// The block size used in the kernel matrix-vector multiplications if no tuning profile is used.
+    kernel_index_type block_size_{ OPENMP_BLOCK_SIZE };
+    /// The profile file storing the auto-tuned block sizes; empty if the block size isn't auto-tuned.
+    std::string tuning_profile_{};
 };
 
+template <typename real_type, typename... Args>
+std::pair<std::vector<real_type>, real_type> csvm::fit_out_of_core(const std::string &filename, const std::vector<real_type> &labels, Args &&...named_args) const {
+    igor::parser parser{ named_args... };
+
+    // set default values
+    default_value memory_budget_val{ default_init<std::size_t>{ std::size_t{ 1 } << 30 } };  // 1 GiB
+
+    // compile time check: only named parameter are permitted
+    static_assert(!parser.has_unnamed_arguments(), "Can only use named parameter!");
+    // compile time check: each named parameter must only be passed once
+    static_assert(!parser.has_duplicates(), "Can only use each named parameter once!");
+    // compile time check: only some named parameters are allowed; mixed precision isn't supported out-of-core
+    static_assert(!parser.has_other_than(epsilon, max_iter, solver, iteration_callback, time_budget, cancellation, checkpoint_file, checkpoint_interval, resume, memory_budget), "An illegal named parameter has been passed!");
+
+    // compile time/runtime check: the values must have the correct types
+    if constexpr (parser.has(memory_budget)) {
+        // get the value of the provided named parameter
+        memory_budget_val = detail::get_value_from_named_parameter<typename decltype(memory_budget_val)::value_type>(parser, memory_budget);
+        // check if value makes sense
+        if (memory_budget_val == static_cast<typename decltype(memory_budget_val)::value_type>(0)) {
+            throw invalid_parameter_exception{ fmt::format("memory_budget must be greater than 0, but is {}!", memory_budget_val) };
+        }
+    }
+
+    // memory map the data points
+    const detail::io::binary_data_file<real_type> data{ filename };
+    if (labels.size() != data.num_data_points()) {
+        throw invalid_parameter_exception{ fmt::format("The number of labels ({}) must match the number of data points ({}) in the binary data file '{}'!", labels.size(), data.num_data_points(), filename) };
+    }
+    if (data.num_data_points() < 2) {
+        throw invalid_parameter_exception{ fmt::format("The binary data file '{}' must contain at least two data points!", filename) };
+    }
+
+    // parse the named parameters controlling the CG algorithm
+    detail::solver_control<real_type> control{};
+    const auto [epsilon_val, max_iter_val] = parse_solver_named_args(control, data.num_data_points(), std::forward<Args>(named_args)...);
+
+    // set gamma if necessary
+    parameter params = this->get_params();
+    if (params.gamma.is_default()) {
+        // no gamma provided -> use default value which depends on the number of features of the data set
+        params.gamma = 1.0 / data.num_features();
+    }
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    // solve the minimization problem
+    auto result = this->solve_system_of_linear_equations_out_of_core_impl(static_cast<detail::parameter<real_type>>(params), data, labels, epsilon_val, max_iter_val, memory_budget_val.value(), control);
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Solved minimization problem (r = b - Ax) out-of-core using the Conjugate Gradient (CG) methode in {}.\n\n",
+                detail::tracking_entry{ "cg", "total_runtime", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+    return result;
+}
+
 }  // namespace openmp
 
 namespace detail {
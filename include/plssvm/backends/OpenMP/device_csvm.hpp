@@ -0,0 +1,328 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a C-SVM using the OpenMP backend treating groups of CPU threads as separate devices.
+ */
+
+#ifndef PLSSVM_BACKENDS_OPENMP_DEVICE_CSVM_HPP_
+#define PLSSVM_BACKENDS_OPENMP_DEVICE_CSVM_HPP_
+#pragma once
+
+#include "plssvm/backends/OpenMP/device_ptr.hpp"  // plssvm::openmp::device_ptr
+#include "plssvm/backends/gpu_csvm.hpp"           // plssvm::detail::gpu_csvm
+#include "plssvm/detail/type_traits.hpp"          // PLSSVM_REQUIRES
+#include "plssvm/parameter.hpp"                   // plssvm::parameter, plssvm::openmp_num_devices, plssvm::detail::{parameter, has_only_openmp_device_parameter_named_args_v, get_value_from_named_parameter}
+#include "plssvm/target_platforms.hpp"            // plssvm::target_platform
+
+#include "igor/igor.hpp"                          // igor::parser
+
+#include <cstddef>                                // std::size_t
+#include <type_traits>                            // std::true_type
+#include <utility>                                // std::forward
+
+namespace plssvm {
+
+namespace detail {
+
+// forward declare execution_range class
+class execution_range;
+
+}  // namespace detail
+
+namespace openmp {
+
+/**
+ * @brief Return the number of NUMA nodes of the current system.
+ * @details Counts the `/sys/devices/system/node/node*` entries on Linux.
+ * @return the number of NUMA nodes; `1` if the number of NUMA nodes couldn't be determined (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t get_num_numa_nodes();
+
+/**
+ * @brief A C-SVM implementation using OpenMP as backend running the kernels of the GPU backends on the host, where each group of threads is treated as a separate device.
+ * @details Implements the pure virtual functions of plssvm::detail::gpu_csvm, i.e., the work is distributed across the devices exactly as in the GPU backends.
+ *          By default, one device per NUMA node is used and the available OpenMP threads are distributed evenly among the devices.
+ *          The threads of each device are bound close to the thread driving the device, i.e., the devices should be spread across the NUMA nodes
+ *          using, e.g., `OMP_PLACES=cores OMP_PROC_BIND=spread,close`.
+ * @note Enables nested OpenMP parallelism (two active levels) since the kernels on the devices are launched from within a parallel region.
+ */
+class device_csvm : public ::plssvm::detail::gpu_csvm<device_ptr, int> {
+  protected:
+    // protected for the test mock class
+    /// The template base type of the OpenMP multi-device C-SVM class.
+    using base_type = ::plssvm::detail::gpu_csvm<device_ptr, int>;
+
+    using base_type::devices_;
+
+  public:
+    using base_type::device_ptr_type;
+    using typename base_type::queue_type;
+
+    /**
+     * @brief Construct a new multi-device C-SVM using the OpenMP backend with one device per NUMA node and the parameters given through @p params.
+     * @param[in] params struct encapsulating all possible SVM parameters
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     */
+    explicit device_csvm(parameter params = {});
+    /**
+     * @brief Construct a new multi-device C-SVM using the OpenMP backend on the @p target platform with one device per NUMA node and the parameters given through @p params.
+     * @param[in] target the target platform used for this C-SVM
+     * @param[in] params struct encapsulating all possible SVM parameters
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
+     * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     */
+    explicit device_csvm(target_platform target, parameter params = {});
+
+    /**
+     * @brief Construct a new multi-device C-SVM using the OpenMP backend and the optionally provided @p named_args.
+     * @details Additionally to the SVM parameters, the number of devices can be provided using `openmp_num_devices` (default: the number of NUMA nodes).
+     * @param[in] named_args the additional optional named-parameters
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::openmp::backend_exception if the number of devices is zero
+     */
+    template <typename... Args, PLSSVM_REQUIRES(::plssvm::detail::has_only_openmp_device_parameter_named_args_v<Args...>)>
+    explicit device_csvm(Args &&...named_args) :
+        device_csvm{ plssvm::target_platform::automatic, std::forward<Args>(named_args)... } {}
+    /**
+     * @brief Construct a new multi-device C-SVM using the OpenMP backend on the @p target platform and the optionally provided @p named_args.
+     * @details Additionally to the SVM parameters, the number of devices can be provided using `openmp_num_devices` (default: the number of NUMA nodes).
+     * @param[in] target the target platform used for this C-SVM
+     * @param[in] named_args the additional optional named-parameters
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
+     * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::openmp::backend_exception if the number of devices is zero
+     */
+    template <typename... Args, PLSSVM_REQUIRES(::plssvm::detail::has_only_openmp_device_parameter_named_args_v<Args...>)>
+    explicit device_csvm(const target_platform target, Args &&...named_args) :
+        base_type{ named_args... } {
+        this->init(target, parse_num_devices(std::forward<Args>(named_args)...));
+    }
+    /**
+     * @brief Construct a new multi-device C-SVM using the OpenMP backend with the parameters given through @p params overwritten by the optionally provided @p named_args.
+     * @details Additionally to the SVM parameters, the number of devices can be provided using `openmp_num_devices` (default: the number of NUMA nodes).
+     * @param[in] params struct encapsulating all possible SVM parameters
+     * @param[in] named_args the additional optional named-parameters
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::openmp::backend_exception if the number of devices is zero
+     */
+    template <typename... Args, PLSSVM_REQUIRES(::plssvm::detail::has_only_openmp_device_parameter_named_args_v<Args...>)>
+    explicit device_csvm(parameter params, Args &&...named_args) :
+        device_csvm{ plssvm::target_platform::automatic, params, std::forward<Args>(named_args)... } {}
+    /**
+     * @brief Construct a new multi-device C-SVM using the OpenMP backend on the @p target platform with the parameters given through @p params overwritten by the optionally provided @p named_args.
+     * @details Additionally to the SVM parameters, the number of devices can be provided using `openmp_num_devices` (default: the number of NUMA nodes).
+     * @param[in] target the target platform used for this C-SVM
+     * @param[in] params struct encapsulating all possible SVM parameters
+     * @param[in] named_args the additional optional named-parameters
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
+     * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::openmp::backend_exception if the number of devices is zero
+     */
+    template <typename... Args, PLSSVM_REQUIRES(::plssvm::detail::has_only_openmp_device_parameter_named_args_v<Args...>)>
+    explicit device_csvm(const target_platform target, parameter params, Args &&...named_args) :
+        base_type{ params, named_args... } {
+        this->init(target, parse_num_devices(std::forward<Args>(named_args)...));
+    }
+
+    /**
+     * @copydoc plssvm::csvm::csvm(const plssvm::csvm &)
+     */
+    device_csvm(const device_csvm &) = delete;
+    /**
+     * @copydoc plssvm::csvm::csvm(plssvm::csvm &&) noexcept
+     */
+    device_csvm(device_csvm &&) noexcept = default;
+    /**
+     * @copydoc plssvm::csvm::operator=(const plssvm::csvm &)
+     */
+    device_csvm &operator=(const device_csvm &) = delete;
+    /**
+     * @copydoc plssvm::csvm::operator=(plssvm::csvm &&) noexcept
+     */
+    device_csvm &operator=(device_csvm &&) noexcept = default;
+    /**
+     * @brief Default destructor since the copy and move constructors and copy- and move-assignment operators are defined.
+     */
+    ~device_csvm() override = default;
+
+    /**
+     * @brief Return the number of OpenMP threads used by each device.
+     * @return the number of threads per device (`[[nodiscard]]`)
+     */
+    [[nodiscard]] int get_num_threads_per_device() const noexcept { return num_threads_per_device_; }
+
+  protected:
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::device_synchronize
+     * @details All kernels are executed synchronously, i.e., nothing to do.
+     */
+    void device_synchronize(const queue_type &queue) const final;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::get_device_memory
+     * @details All devices share the host memory, i.e., each device is assigned an equal share of the physical memory.
+     */
+    [[nodiscard]] std::size_t get_device_memory(const queue_type &queue) const final;
+
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_q_kernel
+     */
+    void run_q_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<float> &params, device_ptr_type<float> &q_d, const device_ptr_type<float> &data_d, const device_ptr_type<float> &data_last_d, std::size_t num_data_points_padded, std::size_t num_features) const final { this->run_q_kernel_impl(device, range, params, q_d, data_d, data_last_d, num_data_points_padded, num_features); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_q_kernel
+     */
+    void run_q_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<double> &params, device_ptr_type<double> &q_d, const device_ptr_type<double> &data_d, const device_ptr_type<double> &data_last_d, std::size_t num_data_points_padded, std::size_t num_features) const final { this->run_q_kernel_impl(device, range, params, q_d, data_d, data_last_d, num_data_points_padded, num_features); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_q_kernel
+     */
+    template <typename real_type>
+    void run_q_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, device_ptr_type<real_type> &q_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, std::size_t num_data_points_padded, std::size_t num_features) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_svm_kernel
+     */
+    void run_svm_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<float> &params, const device_ptr_type<float> &q_d, device_ptr_type<float> &r_d, const device_ptr_type<float> &x_d, const device_ptr_type<float> &data_d, float QA_cost, float add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const final { this->run_svm_kernel_impl(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, num_data_points_padded, num_features, row_offset); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_svm_kernel
+     */
+    void run_svm_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<double> &params, const device_ptr_type<double> &q_d, device_ptr_type<double> &r_d, const device_ptr_type<double> &x_d, const device_ptr_type<double> &data_d, double QA_cost, double add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const final { this->run_svm_kernel_impl(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, num_data_points_padded, num_features, row_offset); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_svm_kernel
+     */
+    template <typename real_type>
+    void run_svm_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, real_type QA_cost, real_type add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_w_kernel
+     */
+    void run_w_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<float> &w_d, const device_ptr_type<float> &alpha_d, const device_ptr_type<float> &data_d, const device_ptr_type<float> &data_last_d, std::size_t num_data_points, std::size_t num_features) const final { this->run_w_kernel_impl(device, range, w_d, alpha_d, data_d, data_last_d, num_data_points, num_features); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_w_kernel
+     */
+    void run_w_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<double> &w_d, const device_ptr_type<double> &alpha_d, const device_ptr_type<double> &data_d, const device_ptr_type<double> &data_last_d, std::size_t num_data_points, std::size_t num_features) const final { this->run_w_kernel_impl(device, range, w_d, alpha_d, data_d, data_last_d, num_data_points, num_features); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_w_kernel
+     */
+    template <typename real_type>
+    void run_w_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &w_d, const device_ptr_type<real_type> &alpha_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, std::size_t num_data_points, std::size_t num_features) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_predict_kernel
+     */
+    void run_predict_kernel(const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<float> &params, device_ptr_type<float> &out_d, const device_ptr_type<float> &alpha_d, const device_ptr_type<float> &point_d, const device_ptr_type<float> &data_d, const device_ptr_type<float> &data_last_d, std::size_t num_support_vectors, std::size_t num_predict_points, std::size_t num_features) const final { this->run_predict_kernel_impl(range, params, out_d, alpha_d, point_d, data_d, data_last_d, num_support_vectors, num_predict_points, num_features); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_predict_kernel
+     */
+    void run_predict_kernel(const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<double> &params, device_ptr_type<double> &out_d, const device_ptr_type<double> &alpha_d, const device_ptr_type<double> &point_d, const device_ptr_type<double> &data_d, const device_ptr_type<double> &data_last_d, std::size_t num_support_vectors, std::size_t num_predict_points, std::size_t num_features) const final { this->run_predict_kernel_impl(range, params, out_d, alpha_d, point_d, data_d, data_last_d, num_support_vectors, num_predict_points, num_features); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_predict_kernel
+     */
+    template <typename real_type>
+    void run_predict_kernel_impl(const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, device_ptr_type<real_type> &out_d, const device_ptr_type<real_type> &alpha_d, const device_ptr_type<real_type> &point_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, std::size_t num_support_vectors, std::size_t num_predict_points, std::size_t num_features) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_axpy_kernel
+     */
+    void run_axpy_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, float alpha, const device_ptr_type<float> &x_d, device_ptr_type<float> &y_d, std::size_t size) const final { this->run_axpy_kernel_impl(device, range, alpha, x_d, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_axpy_kernel
+     */
+    void run_axpy_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, double alpha, const device_ptr_type<double> &x_d, device_ptr_type<double> &y_d, std::size_t size) const final { this->run_axpy_kernel_impl(device, range, alpha, x_d, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_axpy_kernel
+     */
+    template <typename real_type>
+    void run_axpy_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, real_type alpha, const device_ptr_type<real_type> &x_d, device_ptr_type<real_type> &y_d, std::size_t size) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_xpby_kernel
+     */
+    void run_xpby_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<float> &x_d, float beta, device_ptr_type<float> &y_d, std::size_t size) const final { this->run_xpby_kernel_impl(device, range, x_d, beta, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_xpby_kernel
+     */
+    void run_xpby_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<double> &x_d, double beta, device_ptr_type<double> &y_d, std::size_t size) const final { this->run_xpby_kernel_impl(device, range, x_d, beta, y_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_xpby_kernel
+     */
+    template <typename real_type>
+    void run_xpby_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, real_type beta, device_ptr_type<real_type> &y_d, std::size_t size) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_dot_kernel
+     */
+    void run_dot_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<float> &x_d, const device_ptr_type<float> &y_d, device_ptr_type<float> &partial_sums_d, std::size_t size) const final { this->run_dot_kernel_impl(device, range, x_d, y_d, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_dot_kernel
+     */
+    void run_dot_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<double> &x_d, const device_ptr_type<double> &y_d, device_ptr_type<double> &partial_sums_d, std::size_t size) const final { this->run_dot_kernel_impl(device, range, x_d, y_d, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_dot_kernel
+     */
+    template <typename real_type>
+    void run_dot_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &y_d, device_ptr_type<real_type> &partial_sums_d, std::size_t size) const;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_sum_kernel
+     */
+    void run_sum_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<float> &partial_sums_d, std::size_t size) const final { this->run_sum_kernel_impl(device, range, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_sum_kernel
+     */
+    void run_sum_kernel(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<double> &partial_sums_d, std::size_t size) const final { this->run_sum_kernel_impl(device, range, partial_sums_d, size); }
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_sum_kernel
+     */
+    template <typename real_type>
+    void run_sum_kernel_impl(std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &partial_sums_d, std::size_t size) const;
+
+  private:
+    /**
+     * @brief Initialize all important states related to the OpenMP multi-device C-SVM.
+     * @param[in] target the target platform to use
+     * @param[in] num_devices the number of devices the work is distributed across
+     * @throws plssvm::openmp::backend_exception if the target platform isn't plssvm::target_platform::automatic or plssvm::target_platform::cpu
+     * @throws plssvm::openmp::backend_exception if the plssvm::target_platform::cpu target isn't available
+     * @throws plssvm::openmp::backend_exception if @p num_devices is zero
+     */
+    void init(target_platform target, std::size_t num_devices);
+    /**
+     * @brief Return the number of devices requested via the `openmp_num_devices` named-parameter in @p named_args or the number of NUMA nodes if none was provided.
+     * @param[in] named_args the named-parameters to parse
+     * @return the number of devices (`[[nodiscard]]`)
+     */
+    template <typename... Args>
+    [[nodiscard]] static std::size_t parse_num_devices(Args &&...named_args) {
+        // check igor parameter
+        igor::parser parser{ std::forward<Args>(named_args)... };
+
+        // check whether a specific number of devices has been requested
+        if constexpr (parser.has(openmp_num_devices)) {
+            return ::plssvm::detail::get_value_from_named_parameter<std::size_t>(parser, openmp_num_devices);
+        } else {
+            return get_num_numa_nodes();
+        }
+    }
+
+    /// The number of OpenMP threads used in the kernels of each device.
+    int num_threads_per_device_{ 1 };
+};
+
+}  // namespace openmp
+
+namespace detail {
+
+/**
+ * @brief Sets the `value` to `true` since the multi-device C-SVM using the OpenMP backend is available.
+ */
+template <>
+struct csvm_backend_exists<openmp::device_csvm> : std::true_type {};
+
+}  // namespace detail
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_BACKENDS_OPENMP_DEVICE_CSVM_HPP_
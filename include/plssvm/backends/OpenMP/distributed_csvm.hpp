@@ -0,0 +1,167 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a C-SVM using the OpenMP backend distributing the kernel matrix across multiple MPI processes.
+ */
+
+#ifndef PLSSVM_BACKENDS_OPENMP_DISTRIBUTED_CSVM_HPP_
+#define PLSSVM_BACKENDS_OPENMP_DISTRIBUTED_CSVM_HPP_
+#pragma once
+
+#include "plssvm/backends/OpenMP/csvm.hpp"   // plssvm::openmp::csvm
+#include "plssvm/detail/solver_control.hpp"  // plssvm::detail::solver_control
+#include "plssvm/detail/type_traits.hpp"     // PLSSVM_REQUIRES
+#include "plssvm/parameter.hpp"              // plssvm::parameter, plssvm::detail::{parameter, has_only_openmp_parameter_named_args_v}
+
+#include "mpi.h"                             // MPI_Comm, MPI_COMM_WORLD
+
+#include <cstddef>                           // std::size_t
+#include <type_traits>                       // std::true_type
+#include <utility>                           // std::forward, std::pair
+#include <vector>                            // std::vector
+
+namespace plssvm::openmp {
+
+/**
+ * @brief Calculate the rows [first, last) of the lower triangular kernel matrix with @p num_rows rows assigned to the MPI process @p rank.
+ * @details Since the number of kernel matrix entries in row `i` of the lower triangular matrix is `i + 1`, the row boundaries are chosen such that
+ *          each of the @p num_ranks processes calculates roughly the same number of kernel matrix entries, i.e., the first processes get more rows than the last ones.
+ * @param[in] num_rows the number of rows in the kernel matrix
+ * @param[in] rank the rank of the MPI process
+ * @param[in] num_ranks the total number of MPI processes
+ * @return the row range [first, last) of the MPI process @p rank; may be empty if @p num_ranks is larger than @p num_rows (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::pair<std::size_t, std::size_t> calculate_distributed_row_range(std::size_t num_rows, int rank, int num_ranks) noexcept;
+
+/**
+ * @brief A C-SVM implementation using OpenMP as backend distributing the rows of the implicit kernel matrix across all MPI processes in a communicator.
+ * @details Every MPI process must hold the whole data set and call `fit` with the same arguments.
+ *          In each kernel matrix-vector multiplication, every MPI process only calculates its rows of the kernel matrix using the OpenMP kernel;
+ *          the partial results are summed up using `MPI_Allreduce` such that all processes run the remaining CG algorithm on identical vectors.
+ *          The time budget, the cancellation, and the iteration callback are evaluated collectively, i.e., if one process stops the CG algorithm, all processes stop.
+ *          Checkpoints are only written by the process with rank `0`, but read by all processes, i.e., the checkpoint file must be accessible from all processes.
+ * @note MPI must have been initialized before constructing the C-SVM and the communicator must remain valid for the lifetime of the C-SVM.
+ */
+class distributed_csvm : public csvm {
+  public:
+    /**
+     * @brief Construct a new distributed C-SVM using the OpenMP backend and all MPI processes in `MPI_COMM_WORLD` with the parameters given through @p params.
+     * @param[in] params struct encapsulating all possible SVM parameters
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if MPI hasn't been initialized
+     */
+    explicit distributed_csvm(parameter params = {});
+    /**
+     * @brief Construct a new distributed C-SVM using the OpenMP backend and all MPI processes in the @p communicator with the parameters given through @p params.
+     * @param[in] communicator the MPI processes the kernel matrix is distributed across
+     * @param[in] params struct encapsulating all possible SVM parameters
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if MPI hasn't been initialized
+     */
+    explicit distributed_csvm(MPI_Comm communicator, parameter params = {});
+
+    /**
+     * @brief Construct a new distributed C-SVM using the OpenMP backend and all MPI processes in `MPI_COMM_WORLD` and the optionally provided @p named_args.
+     * @param[in] named_args the additional optional named-parameters
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if MPI hasn't been initialized
+     */
+    template <typename... Args, PLSSVM_REQUIRES(detail::has_only_openmp_parameter_named_args_v<Args...>)>
+    explicit distributed_csvm(Args &&...named_args) :
+        csvm{ std::forward<Args>(named_args)... } {
+        this->init(MPI_COMM_WORLD);
+    }
+    /**
+     * @brief Construct a new distributed C-SVM using the OpenMP backend and all MPI processes in the @p communicator and the optionally provided @p named_args.
+     * @param[in] communicator the MPI processes the kernel matrix is distributed across
+     * @param[in] named_args the additional optional named-parameters
+     * @throws plssvm::exception all exceptions thrown in the base class constructor
+     * @throws plssvm::openmp::backend_exception if MPI hasn't been initialized
+     */
+    template <typename... Args, PLSSVM_REQUIRES(detail::has_only_openmp_parameter_named_args_v<Args...>)>
+    explicit distributed_csvm(MPI_Comm communicator, Args &&...named_args) :
+        csvm{ std::forward<Args>(named_args)... } {
+        this->init(communicator);
+    }
+
+    /**
+     * @copydoc plssvm::csvm::csvm(const plssvm::csvm &)
+     */
+    distributed_csvm(const distributed_csvm &) = delete;
+    /**
+     * @copydoc plssvm::csvm::csvm(plssvm::csvm &&) noexcept
+     */
+    distributed_csvm(distributed_csvm &&) noexcept = default;
+    /**
+     * @copydoc plssvm::csvm::operator=(const plssvm::csvm &)
+     */
+    distributed_csvm &operator=(const distributed_csvm &) = delete;
+    /**
+     * @copydoc plssvm::csvm::operator=(plssvm::csvm &&) noexcept
+     */
+    distributed_csvm &operator=(distributed_csvm &&) noexcept = default;
+    /**
+     * @brief Default destructor since the copy and move constructors and copy- and move-assignment operators are defined.
+     */
+    ~distributed_csvm() override = default;
+
+    /**
+     * @brief Return the rank of this MPI process in the used communicator.
+     * @return the rank (`[[nodiscard]]`)
+     */
+    [[nodiscard]] int rank() const noexcept { return rank_; }
+    /**
+     * @brief Return the number of MPI processes the kernel matrix is distributed across.
+     * @return the number of MPI processes (`[[nodiscard]]`)
+     */
+    [[nodiscard]] int num_ranks() const noexcept { return num_ranks_; }
+
+  protected:
+    /**
+     * @copydoc plssvm::csvm::solve_system_of_linear_equations
+     */
+    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter, const detail::solver_control<float> &control) const override { return this->solve_system_of_linear_equations_distributed_impl(params, A, b, eps, max_iter, control); }
+    /**
+     * @copydoc plssvm::csvm::solve_system_of_linear_equations
+     */
+    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter, const detail::solver_control<double> &control) const override { return this->solve_system_of_linear_equations_distributed_impl(params, A, b, eps, max_iter, control); }
+    /**
+     * @copydoc plssvm::csvm::solve_system_of_linear_equations
+     */
+    template <typename real_type>
+    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_distributed_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter, const detail::solver_control<real_type> &control) const;
+
+  private:
+    /**
+     * @brief Initializes the MPI specific parts of the distributed C-SVM.
+     * @param[in] communicator the MPI processes the kernel matrix is distributed across
+     * @throws plssvm::openmp::backend_exception if MPI hasn't been initialized
+     */
+    void init(MPI_Comm communicator);
+
+    /// The MPI processes the kernel matrix is distributed across.
+    MPI_Comm communicator_{ MPI_COMM_NULL };
+    /// The rank of this MPI process in the communicator.
+    int rank_{ 0 };
+    /// The number of MPI processes in the communicator.
+    int num_ranks_{ 1 };
+};
+
+}  // namespace plssvm::openmp
+
+namespace plssvm::detail {
+
+/**
+ * @brief Sets the `value` to `true` since distributed C-SVMs using the OpenMP backend are available.
+ */
+template <>
+struct csvm_backend_exists<openmp::distributed_csvm> : std::true_type {};
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_BACKENDS_OPENMP_DISTRIBUTED_CSVM_HPP_
@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the kernel functions for the C-SVM using the OpenMP backend streaming the data points from a binary data file (out-of-core).
+ */
+
+#ifndef PLSSVM_BACKENDS_OPENMP_OUT_OF_CORE_KERNEL_HPP_
+#define PLSSVM_BACKENDS_OPENMP_OUT_OF_CORE_KERNEL_HPP_
+#pragma once
+
+#include "plssvm/detail/io/binary_data_file.hpp"  // plssvm::detail::io::binary_data_file
+
+#include <cstddef>                                // std::size_t
+#include <functional>                             // std::function
+#include <vector>                                 // std::vector
+
+namespace plssvm::openmp {
+
+/**
+ * @brief Calculate the number of data points in a single block such that three blocks (one row block and two column blocks used for double buffering) fit into the @p memory_budget.
+ * @param[in] memory_budget the maximum number of bytes used to store the data points in memory
+ * @param[in] num_features the number of features of each data point
+ * @param[in] real_type_size the size of the type of the data in bytes
+ * @return the number of data points in a single block; at least `1` (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t calculate_out_of_core_block_size(std::size_t memory_budget, std::size_t num_features, std::size_t real_type_size) noexcept;
+
+/**
+ * @brief Calculates the `q` vector using the linear C-SVM kernel streaming the data points in blocks of @p block_size data points from the binary data file @p data.
+ * @tparam real_type the type of the data
+ * @param[out] q the calculated `q` vector
+ * @param[in] data the binary data file containing the data points
+ * @param[in] block_size the number of data points loaded into memory at once
+ */
+template <typename real_type>
+void device_kernel_q_out_of_core_linear(std::vector<real_type> &q, const plssvm::detail::io::binary_data_file<real_type> &data, std::size_t block_size);
+
+/**
+ * @brief Calculates the `q` vector using the polynomial C-SVM kernel streaming the data points in blocks of @p block_size data points from the binary data file @p data.
+ * @tparam real_type the type of the data
+ * @param[out] q the calculated `q` vector
+ * @param[in] data the binary data file containing the data points
+ * @param[in] degree the degree parameter used in the polynomial kernel function
+ * @param[in] gamma the gamma parameter used in the polynomial kernel function
+ * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+ * @param[in] block_size the number of data points loaded into memory at once
+ */
+template <typename real_type>
+void device_kernel_q_out_of_core_polynomial(std::vector<real_type> &q, const plssvm::detail::io::binary_data_file<real_type> &data, int degree, real_type gamma, real_type coef0, std::size_t block_size);
+
+/**
+ * @brief Calculates the `q` vector using the radial basis functions C-SVM kernel streaming the data points in blocks of @p block_size data points from the binary data file @p data.
+ * @tparam real_type the type of the data
+ * @param[out] q the calculated `q` vector
+ * @param[in] data the binary data file containing the data points
+ * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] block_size the number of data points loaded into memory at once
+ */
+template <typename real_type>
+void device_kernel_q_out_of_core_rbf(std::vector<real_type> &q, const plssvm::detail::io::binary_data_file<real_type> &data, real_type gamma, std::size_t block_size);
+
+/**
+ * @brief Calculates the C-SVM kernel using the linear kernel function streaming the data points in blocks of @p block_size data points from the binary data file @p data.
+ * @details The next column block is read from the file while the current block is processed (double buffering).
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[out] ret the result vector
+ * @param[in] d the right-hand side of the equation
+ * @param[in] data the binary data file containing the data points
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vector
+ * @param[in] block_size the number of data points loaded into memory at once
+ * @param[in] stop_requested if provided and returning `true`, all remaining blocks are skipped, i.e., @p ret is only partially calculated
+ */
+template <typename real_type>
+void device_kernel_out_of_core_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const plssvm::detail::io::binary_data_file<real_type> &data, real_type QA_cost, real_type cost, real_type add, std::size_t block_size, const std::function<bool()> &stop_requested = {});
+
+/**
+ * @brief Calculates the C-SVM kernel using the polynomial kernel function streaming the data points in blocks of @p block_size data points from the binary data file @p data.
+ * @details The next column block is read from the file while the current block is processed (double buffering).
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[out] ret the result vector
+ * @param[in] d the right-hand side of the equation
+ * @param[in] data the binary data file containing the data points
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vector
+ * @param[in] degree the degree parameter used in the polynomial kernel function
+ * @param[in] gamma the gamma parameter used in the polynomial kernel function
+ * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+ * @param[in] block_size the number of data points loaded into memory at once
+ * @param[in] stop_requested if provided and returning `true`, all remaining blocks are skipped, i.e., @p ret is only partially calculated
+ */
+template <typename real_type>
+void device_kernel_out_of_core_polynomial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const plssvm::detail::io::binary_data_file<real_type> &data, real_type QA_cost, real_type cost, real_type add, int degree, real_type gamma, real_type coef0, std::size_t block_size, const std::function<bool()> &stop_requested = {});
+
+/**
+ * @brief Calculates the C-SVM kernel using the radial basis function kernel function streaming the data points in blocks of @p block_size data points from the binary data file @p data.
+ * @details The next column block is read from the file while the current block is processed (double buffering).
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[out] ret the result vector
+ * @param[in] d the right-hand side of the equation
+ * @param[in] data the binary data file containing the data points
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vector
+ * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] block_size the number of data points loaded into memory at once
+ * @param[in] stop_requested if provided and returning `true`, all remaining blocks are skipped, i.e., @p ret is only partially calculated
+ */
+template <typename real_type>
+void device_kernel_out_of_core_rbf(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const plssvm::detail::io::binary_data_file<real_type> &data, real_type QA_cost, real_type cost, real_type add, real_type gamma, std::size_t block_size, const std::function<bool()> &stop_requested = {});
+
+}  // namespace plssvm::openmp
+
+#endif  // PLSSVM_BACKENDS_OPENMP_OUT_OF_CORE_KERNEL_HPP_
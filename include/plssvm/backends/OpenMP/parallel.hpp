@@ -0,0 +1,86 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Utility functions to start OpenMP parallel regions respecting a thread pinning policy and to place data on the NUMA nodes of the threads using it.
+ * @note Must only be included in translation units compiled with OpenMP support.
+ */
+
+#ifndef PLSSVM_BACKENDS_OPENMP_PARALLEL_HPP_
+#define PLSSVM_BACKENDS_OPENMP_PARALLEL_HPP_
+#pragma once
+
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"      // plssvm::openmp::calculate_kernel_row_range
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"  // plssvm::openmp::thread_pinning
+#include "plssvm/detail/assert.hpp"                   // PLSSVM_ASSERT
+
+#include "omp.h"                                      // omp_get_thread_num, omp_get_num_threads
+
+#include <algorithm>                                  // std::transform
+#include <vector>                                     // std::vector
+
+namespace plssvm::openmp {
+
+/**
+ * @brief Execute @p func in an OpenMP parallel region binding the threads according to the @p pinning policy.
+ * @details Since the `proc_bind` clause only accepts compile time constants, a separate parallel region is necessary for each pinning policy.
+ * @tparam Func the type of the function executed by all threads
+ * @param[in] pinning the thread pinning policy
+ * @param[in] func the function executed by all threads; may contain orphaned worksharing constructs
+ */
+template <typename Func>
+void parallel_region(const thread_pinning pinning, Func &&func) {
+    switch (pinning) {
+        case thread_pinning::none:
+            #pragma omp parallel
+            func();
+            break;
+        case thread_pinning::close:
+            #pragma omp parallel proc_bind(close)
+            func();
+            break;
+        case thread_pinning::spread:
+            #pragma omp parallel proc_bind(spread)
+            func();
+            break;
+    }
+}
+
+/**
+ * @brief Copy the @p data points such that each data point is first touched, i.e., placed on the NUMA node, by the thread that owns its kernel matrix row.
+ * @details The ownership corresponds to the one used in the OpenMP kernels (see plssvm::openmp::calculate_kernel_row_range).
+ *          The last data point, which doesn't have a row in the reduced kernel matrix, is owned by the last thread.
+ * @tparam real_type the type of the copied data points
+ * @tparam data_real_type the type of the original data points
+ * @param[in] data the data points to copy
+ * @param[in] pinning the thread pinning policy; must be the same as the one used in the kernels
+ * @return the copied data points (`[[nodiscard]]`)
+ */
+template <typename real_type, typename data_real_type>
+[[nodiscard]] std::vector<std::vector<real_type>> first_touch_copy(const std::vector<std::vector<data_real_type>> &data, const thread_pinning pinning) {
+    PLSSVM_ASSERT(!data.empty(), "The data must not be empty!");
+
+    std::vector<std::vector<real_type>> result(data.size());
+    parallel_region(pinning, [&]() {
+        const int thread = omp_get_thread_num();
+        const int num_threads = omp_get_num_threads();
+        auto [first, last] = calculate_kernel_row_range(0, data.size() - 1, thread, num_threads);
+        if (thread == num_threads - 1) {
+            last = data.size();
+        }
+        // the memory of each data point is allocated and initialized by the owning thread
+        for (auto i = first; i < last; ++i) {
+            result[i] = std::vector<real_type>(data[i].size());
+            std::transform(data[i].cbegin(), data[i].cend(), result[i].begin(), [](const data_real_type val) { return static_cast<real_type>(val); });
+        }
+    });
+    return result;
+}
+
+}  // namespace plssvm::openmp
+
+#endif  // PLSSVM_BACKENDS_OPENMP_PARALLEL_HPP_
@@ -0,0 +1,61 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines blocked OpenMP functions for predicting the values of multiple data points using the non-linear kernel functions.
+ */
+
+#ifndef PLSSVM_BACKENDS_OPENMP_PREDICT_KERNEL_HPP_
+#define PLSSVM_BACKENDS_OPENMP_PREDICT_KERNEL_HPP_
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <vector>   // std::vector
+
+namespace plssvm::openmp {
+
+/// The number of data points to predict handled together in a single tile.
+constexpr std::size_t PREDICT_POINT_BLOCK_SIZE = 8;
+/// The number of support vectors handled together in a single tile.
+constexpr std::size_t PREDICT_SUPPORT_VECTOR_BLOCK_SIZE = 64;
+/// The number of features of a tile of support vectors loaded at once, i.e., reused by all data points in a tile.
+constexpr std::size_t PREDICT_FEATURE_BLOCK_SIZE = 128;
+
+/**
+ * @brief Adds the alpha-weighted polynomial kernel function values of all @p support_vectors to the values of the @p predict_points in @p out.
+ * @details The data points to predict and the support vectors are split into tiles. The dot products of a tile are calculated like a matrix-matrix
+ *          multiplication using the support vectors packed feature-wise, i.e., each loaded feature of a support vector is reused for all data points in the tile.
+ *          Afterwards, the kernel function and the weighting with @p alpha are applied directly on the tile.
+ * @tparam real_type the type of the data
+ * @param[in,out] out the predicted values; the values for the support vectors are added to the already present values
+ * @param[in] support_vectors the support vectors
+ * @param[in] alpha the weights of the support vectors
+ * @param[in] predict_points the data points to predict
+ * @param[in] degree the degree parameter used in the polynomial kernel function
+ * @param[in] gamma the gamma parameter used in the polynomial kernel function
+ * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+ */
+template <typename real_type>
+void device_kernel_predict_polynomial(std::vector<real_type> &out, const std::vector<std::vector<real_type>> &support_vectors, const std::vector<real_type> &alpha, const std::vector<std::vector<real_type>> &predict_points, int degree, real_type gamma, real_type coef0);
+
+/**
+ * @brief Adds the alpha-weighted radial basis function kernel values of all @p support_vectors to the values of the @p predict_points in @p out.
+ * @details Uses the same tiling as plssvm::openmp::device_kernel_predict_polynomial. The squared euclidean distances are calculated as
+ *          \f$\lVert x \rVert^2 + \lVert y \rVert^2 - 2 \cdot x^T y\f$ using the precalculated squared norms of all support vectors and data points to predict.
+ * @tparam real_type the type of the data
+ * @param[in,out] out the predicted values; the values for the support vectors are added to the already present values
+ * @param[in] support_vectors the support vectors
+ * @param[in] alpha the weights of the support vectors
+ * @param[in] predict_points the data points to predict
+ * @param[in] gamma the gamma parameter used in the rbf kernel function
+ */
+template <typename real_type>
+void device_kernel_predict_rbf(std::vector<real_type> &out, const std::vector<std::vector<real_type>> &support_vectors, const std::vector<real_type> &alpha, const std::vector<std::vector<real_type>> &predict_points, real_type gamma);
+
+}  // namespace plssvm::openmp
+
+#endif  // PLSSVM_BACKENDS_OPENMP_PREDICT_KERNEL_HPP_
@@ -13,10 +13,42 @@
 #define PLSSVM_BACKENDS_OPENMP_SVM_KERNEL_HPP_
 #pragma once
 
-#include <vector>  // std::vector
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"  // plssvm::openmp::thread_pinning
+#include "plssvm/constants.hpp"                       // plssvm::kernel_index_type, plssvm::OPENMP_BLOCK_SIZE
+#include "plssvm/detail/ball_tree.hpp"                // plssvm::detail::ball_tree
+
+#include <cstddef>                                    // std::size_t
+#include <functional>                                 // std::function
+#include <utility>                                    // std::pair
+#include <vector>                                     // std::vector
 
 namespace plssvm::openmp {
 
+/**
+ * @brief Split the rows [@p row_begin, @p row_end) of the lower triangular kernel matrix into @p num_parts consecutive parts and return the rows of the part @p part.
+ * @details Since the number of kernel matrix entries in row `i` of the lower triangular matrix is `i + 1`, the part boundaries are chosen such that
+ *          each part contains roughly the same number of kernel matrix entries, i.e., the first parts contain more rows than the last ones.
+ * @param[in] row_begin the first row to split
+ * @param[in] row_end one past the last row to split
+ * @param[in] part the part to return the rows for
+ * @param[in] num_parts the total number of parts
+ * @return the rows [first, last) of the part @p part; may be empty if @p num_parts is larger than the number of rows (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::pair<std::size_t, std::size_t> calculate_kernel_row_range(std::size_t row_begin, std::size_t row_end, int part, int num_parts) noexcept;
+
+/**
+ * @brief Return all block sizes that can be selected at runtime in the kernel matrix-vector multiplications.
+ * @details The kernels are instantiated for each block size such that the loops over a block have compile-time bounds. Always contains plssvm::OPENMP_BLOCK_SIZE.
+ * @return the supported block sizes in ascending order (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::vector<kernel_index_type> supported_block_sizes();
+/**
+ * @brief Check whether the kernel matrix-vector multiplications can be run using the @p block_size.
+ * @param[in] block_size the block size to check
+ * @return `true` if @p block_size is one of plssvm::openmp::supported_block_sizes(), `false` otherwise (`[[nodiscard]]`)
+ */
+[[nodiscard]] bool is_supported_block_size(kernel_index_type block_size);
+
 /**
  * @brief Calculates the C-SVM kernel using the linear kernel function.
  * @tparam real_type the type of the data
@@ -27,9 +59,31 @@ namespace plssvm::openmp {
  * @param[in] QA_cost he bottom right matrix entry multiplied by cost
  * @param[in] cost 1 / the cost parameter in the C-SVM
  * @param[in] add denotes whether the values are added or subtracted from the result vector
+ * @param[in] stop_requested if provided and returning `true`, all remaining blocks are skipped, i.e., @p ret is only partially calculated
  */
 template <typename real_type>
-void device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add);
+void device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add, const std::function<bool()> &stop_requested = {});
+
+/**
+ * @brief Calculates the contributions of the rows [@p row_begin, @p row_end) of the lower triangular C-SVM kernel matrix using the linear kernel function.
+ * @details Due to the symmetry of the kernel matrix, the entries of @p ret outside of [@p row_begin, @p row_end) are updated too.
+ *          Summing up the results of disjoint row ranges covering all rows yields the same result as calculating all rows at once.
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[out] ret the result vector
+ * @param[in] d the right-hand side of the equation
+ * @param[in] data the data matrix
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vector
+ * @param[in] row_begin the first row of the kernel matrix to calculate
+ * @param[in] row_end one past the last row of the kernel matrix to calculate
+ * @param[in] stop_requested if provided and returning `true`, all remaining blocks are skipped, i.e., @p ret is only partially calculated
+ * @param[in] pinning if not plssvm::openmp::thread_pinning::none, the threads are pinned accordingly and each thread calculates a fixed block of rows (see plssvm::openmp::calculate_kernel_row_range)
+ * @param[in] block_size the number of rows and columns of the kernel matrix calculated in a single block; must be one of plssvm::openmp::supported_block_sizes()
+ */
+template <typename real_type>
+void device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add, std::size_t row_begin, std::size_t row_end, const std::function<bool()> &stop_requested = {}, thread_pinning pinning = thread_pinning::none, kernel_index_type block_size = OPENMP_BLOCK_SIZE);
 
 /**
  * @brief Calculates the C-SVM kernel using the polynomial kernel function.
@@ -44,9 +98,34 @@ void device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type
  * @param[in] degree the degree parameter used in the polynomial kernel function
  * @param[in] gamma the gamma parameter used in the polynomial kernel function
  * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+ * @param[in] stop_requested if provided and returning `true`, all remaining blocks are skipped, i.e., @p ret is only partially calculated
+ */
+template <typename real_type>
+void device_kernel_polynomial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add, int degree, real_type gamma, real_type coef0, const std::function<bool()> &stop_requested = {});
+
+/**
+ * @brief Calculates the contributions of the rows [@p row_begin, @p row_end) of the lower triangular C-SVM kernel matrix using the polynomial kernel function.
+ * @details Due to the symmetry of the kernel matrix, the entries of @p ret outside of [@p row_begin, @p row_end) are updated too.
+ *          Summing up the results of disjoint row ranges covering all rows yields the same result as calculating all rows at once.
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[out] ret the result vector
+ * @param[in] d the right-hand side of the equation
+ * @param[in] data the data matrix
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vector
+ * @param[in] row_begin the first row of the kernel matrix to calculate
+ * @param[in] row_end one past the last row of the kernel matrix to calculate
+ * @param[in] degree the degree parameter used in the polynomial kernel function
+ * @param[in] gamma the gamma parameter used in the polynomial kernel function
+ * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+ * @param[in] stop_requested if provided and returning `true`, all remaining blocks are skipped, i.e., @p ret is only partially calculated
+ * @param[in] pinning if not plssvm::openmp::thread_pinning::none, the threads are pinned accordingly and each thread calculates a fixed block of rows (see plssvm::openmp::calculate_kernel_row_range)
+ * @param[in] block_size the number of rows and columns of the kernel matrix calculated in a single block; must be one of plssvm::openmp::supported_block_sizes()
  */
 template <typename real_type>
-void device_kernel_polynomial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add, int degree, real_type gamma, real_type coef0);
+void device_kernel_polynomial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add, std::size_t row_begin, std::size_t row_end, int degree, real_type gamma, real_type coef0, const std::function<bool()> &stop_requested = {}, thread_pinning pinning = thread_pinning::none, kernel_index_type block_size = OPENMP_BLOCK_SIZE);
 
 /**
  * @brief Calculates the C-SVM kernel using the radial basis function kernel function.
@@ -59,9 +138,54 @@ void device_kernel_polynomial(const std::vector<real_type> &q, std::vector<real_
  * @param[in] cost 1 / the cost parameter in the C-SVM
  * @param[in] add denotes whether the values are added or subtracted from the result vector
  * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] stop_requested if provided and returning `true`, all remaining blocks are skipped, i.e., @p ret is only partially calculated
+ */
+template <typename real_type>
+void device_kernel_rbf(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add, real_type gamma, const std::function<bool()> &stop_requested = {});
+
+/**
+ * @brief Calculates the contributions of the rows [@p row_begin, @p row_end) of the lower triangular C-SVM kernel matrix using the radial basis function kernel function.
+ * @details Due to the symmetry of the kernel matrix, the entries of @p ret outside of [@p row_begin, @p row_end) are updated too.
+ *          Summing up the results of disjoint row ranges covering all rows yields the same result as calculating all rows at once.
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[out] ret the result vector
+ * @param[in] d the right-hand side of the equation
+ * @param[in] data the data matrix
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vector
+ * @param[in] row_begin the first row of the kernel matrix to calculate
+ * @param[in] row_end one past the last row of the kernel matrix to calculate
+ * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] stop_requested if provided and returning `true`, all remaining blocks are skipped, i.e., @p ret is only partially calculated
+ * @param[in] pinning if not plssvm::openmp::thread_pinning::none, the threads are pinned accordingly and each thread calculates a fixed block of rows (see plssvm::openmp::calculate_kernel_row_range)
+ * @param[in] block_size the number of rows and columns of the kernel matrix calculated in a single block; must be one of plssvm::openmp::supported_block_sizes()
+ */
+template <typename real_type>
+void device_kernel_rbf(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add, std::size_t row_begin, std::size_t row_end, real_type gamma, const std::function<bool()> &stop_requested = {}, thread_pinning pinning = thread_pinning::none, kernel_index_type block_size = OPENMP_BLOCK_SIZE);
+
+/**
+ * @brief Approximates the C-SVM kernel using the radial basis function kernel function in near-linear time for data with few features.
+ * @details Instead of calculating all entries of the kernel matrix, the kernel matrix-vector product of each row is calculated as a weighted sum over a ball tree
+ *          built over all data points (see plssvm::detail::ball_tree) with the entries of @p d as weights. Subtrees whose contribution to a row is provably negligible are skipped.
+ *          The remaining terms of the dimensional reduction only depend on the sum of @p d and \f$q^T d\f$ and are calculated exactly.
+ * @tparam real_type the type of the data
+ * @param[in] q the `q` vector
+ * @param[out] ret the result vector
+ * @param[in] d the right-hand side of the equation
+ * @param[in] data the data matrix
+ * @param[in,out] tree the ball tree built over all points in @p data; its weights are replaced by @p d
+ * @param[in] QA_cost the bottom right matrix entry multiplied by cost
+ * @param[in] cost 1 / the cost parameter in the C-SVM
+ * @param[in] add denotes whether the values are added or subtracted from the result vector
+ * @param[in] gamma the gamma parameter used in the rbf kernel function
+ * @param[in] tolerance the maximum absolute error of each entry in @p ret relative to \f$\lVert d \rVert_1\f$
+ * @param[in] stop_requested if provided and returning `true`, all remaining rows are skipped, i.e., @p ret is only partially calculated
+ * @return the maximum absolute error bound of all entries in @p ret (`[[nodiscard]]`)
  */
 template <typename real_type>
-void device_kernel_rbf(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, real_type QA_cost, real_type cost, real_type add, real_type gamma);
+[[nodiscard]] real_type device_kernel_rbf_ball_tree(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, plssvm::detail::ball_tree<real_type> &tree, real_type QA_cost, real_type cost, real_type add, real_type gamma, real_type tolerance, const std::function<bool()> &stop_requested = {});
 
 }  // namespace plssvm::openmp
 
@@ -0,0 +1,52 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines an enumeration holding all possible thread pinning policies of the OpenMP backend.
+ */
+
+#ifndef PLSSVM_BACKENDS_OPENMP_THREAD_PINNING_HPP_
+#define PLSSVM_BACKENDS_OPENMP_THREAD_PINNING_HPP_
+#pragma once
+
+#include <iosfwd>  // forward declare std::ostream and std::istream
+
+namespace plssvm::openmp {
+
+/**
+ * @brief Enum class for all possible thread pinning policies of the OpenMP backend.
+ * @details If the threads are pinned, each thread owns a fixed block of rows of the kernel matrix and the data points are copied such that
+ *          each row is first touched, i.e., placed on the NUMA node, by the thread owning it. The available places can be controlled using `OMP_PLACES`.
+ */
+enum class thread_pinning {
+    /** Don't pin the threads (respects `OMP_PROC_BIND`); the rows of the kernel matrix are dynamically distributed across the threads. */
+    none,
+    /** Pin the threads to consecutive places (OpenMP's `proc_bind(close)`), i.e., fill one socket before using the next one. */
+    close,
+    /** Pin the threads evenly spread across all places (OpenMP's `proc_bind(spread)`), i.e., use all sockets. */
+    spread
+};
+
+/**
+ * @brief Output the @p pinning policy to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the thread pinning policy to
+ * @param[in] pinning the OpenMP thread pinning policy
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, thread_pinning pinning);
+
+/**
+ * @brief Use the input-stream @p in to initialize the @p pinning policy.
+ * @param[in,out] in input-stream to extract the thread pinning policy from
+ * @param[in] pinning the OpenMP thread pinning policy
+ * @return the input-stream
+ */
+std::istream &operator>>(std::istream &in, thread_pinning &pinning);
+
+}  // namespace plssvm::openmp
+
+#endif  // PLSSVM_BACKENDS_OPENMP_THREAD_PINNING_HPP_
@@ -0,0 +1,85 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a RAII guard restricting the OpenMP threads started by the calling thread to a number of threads and a set of CPUs.
+ */
+
+#ifndef PLSSVM_BACKENDS_OPENMP_THREAD_SCOPE_HPP_
+#define PLSSVM_BACKENDS_OPENMP_THREAD_SCOPE_HPP_
+#pragma once
+
+#include <vector>  // std::vector
+
+namespace plssvm::openmp {
+
+/**
+ * @brief RAII guard setting the number of threads and the CPU affinity of all OpenMP parallel regions started by the calling thread during its lifetime.
+ * @details The number of threads is set using `omp_set_num_threads`, which only affects the calling thread, i.e., multiple C-SVMs running concurrently
+ *          in different threads of the same process don't interfere. If a CPU set is given, the i-th OpenMP thread is bound to the `(i % cpu_set.size())`-th CPU.
+ *          Since the OpenMP runtimes reuse the threads of a team for the following parallel regions of the same size, the threads are bound only once.
+ *          The previous number of threads and CPU affinities are restored on destruction.
+ * @note Setting the CPU affinity is currently only supported on Linux.
+ */
+class thread_scope {
+  public:
+    /**
+     * @brief Set the number of OpenMP threads to @p num_threads and bind them to the CPUs in @p cpu_set.
+     * @param[in] num_threads the number of OpenMP threads; if `0`, the size of the @p cpu_set or, if it is empty, the current number of OpenMP threads is used
+     * @param[in] cpu_set the CPUs the OpenMP threads are bound to; if empty, the CPU affinities are left unchanged
+     * @throws plssvm::openmp::backend_exception if @p num_threads is negative
+     * @throws plssvm::openmp::backend_exception if the @p cpu_set isn't empty on a platform other than Linux
+     * @throws plssvm::openmp::backend_exception if a thread can't be bound to a CPU in the @p cpu_set (e.g., the CPU doesn't exist)
+     */
+    explicit thread_scope(int num_threads, std::vector<int> cpu_set = {});
+
+    /**
+     * @brief Delete the copy-constructor since the previous settings must be restored exactly once.
+     */
+    thread_scope(const thread_scope &) = delete;
+    /**
+     * @brief Delete the move-constructor since the previous settings must be restored by the thread that changed them.
+     */
+    thread_scope(thread_scope &&) = delete;
+    /**
+     * @brief Delete the copy-assignment operator since the previous settings must be restored exactly once.
+     */
+    thread_scope &operator=(const thread_scope &) = delete;
+    /**
+     * @brief Delete the move-assignment operator since the previous settings must be restored by the thread that changed them.
+     */
+    thread_scope &operator=(thread_scope &&) = delete;
+    /**
+     * @brief Restore the previous number of OpenMP threads and CPU affinities.
+     */
+    ~thread_scope();
+
+    /**
+     * @brief Return the number of OpenMP threads used in this scope.
+     * @return the number of threads (`[[nodiscard]]`)
+     */
+    [[nodiscard]] int num_threads() const noexcept { return num_threads_; }
+
+  private:
+    /**
+     * @brief Restore the previously saved CPU affinities of all OpenMP threads.
+     */
+    void restore_affinities() noexcept;
+
+    /// The number of OpenMP threads before entering this scope.
+    int previous_num_threads_{ 0 };
+    /// The number of OpenMP threads used in this scope.
+    int num_threads_{ 0 };
+    /// The CPUs the OpenMP threads are bound to.
+    std::vector<int> cpu_set_{};
+    /// The CPUs each OpenMP thread was allowed to run on before entering this scope.
+    std::vector<std::vector<int>> previous_affinities_{};
+};
+
+}  // namespace plssvm::openmp
+
+#endif  // PLSSVM_BACKENDS_OPENMP_THREAD_SCOPE_HPP_
@@ -15,7 +15,7 @@
 
 #include "plssvm/backends/SYCL/DPCPP/detail/queue.hpp"  // plssvm::dpcpp::detail::queue
 
-#include "sycl/sycl.hpp"                                // sycl::queue
+#include "sycl/sycl.hpp"                                // sycl::queue, sycl::property::queue::in_order
 
 #include <utility>                                      // std::forward
 
@@ -23,6 +23,7 @@ namespace plssvm::dpcpp::detail {
 
 /**
  * @brief The PImpl implementation struct encapsulating a single SYCL queue.
+ * @details Additionally contains an in-order SYCL queue (on the same context and device) used for asynchronous host to device transfers.
  */
 struct queue::queue_impl {
     /**
@@ -32,10 +33,13 @@ struct queue::queue_impl {
      */
     template <typename... Args>
     explicit queue_impl(Args... args) :
-        sycl_queue{ std::forward<Args>(args)... } {}
+        sycl_queue{ std::forward<Args>(args)... },
+        transfer_queue{ sycl_queue.get_context(), sycl_queue.get_device(), ::sycl::property::queue::in_order() } {}
 
     /// The wrapped SYCL queue.
     ::sycl::queue sycl_queue;
+    /// The SYCL queue used to overlap host to device transfers with the kernels submitted to `sycl_queue`.
+    ::sycl::queue transfer_queue;
 };
 
 }  // namespace plssvm::dpcpp::detail
@@ -0,0 +1,224 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the vector operations used in the CG algorithm using the SYCL backend, such that its state can stay resident on the device.
+ */
+
+#ifndef PLSSVM_BACKENDS_SYCL_CG_KERNEL_HPP_
+#define PLSSVM_BACKENDS_SYCL_CG_KERNEL_HPP_
+#pragma once
+
+#include "plssvm/constants.hpp"  // plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE
+
+#include "sycl/sycl.hpp"         // sycl::id, sycl::nd_item, sycl::handler, sycl::local_accessor, sycl::range, sycl::group_barrier
+
+namespace plssvm::sycl::detail {
+
+/**
+ * @brief Calculates `y = alpha * x + y`.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class device_kernel_axpy {
+  public:
+    /// The type of the data.
+    using real_type = T;
+
+    /**
+     * @brief Construct a new device kernel calculating `y = alpha * x + y`.
+     * @param[in] alpha the scaling factor of @p x
+     * @param[in] x the vector to add
+     * @param[in,out] y the result vector
+     * @param[in] size the number of values to update
+     */
+    device_kernel_axpy(const real_type alpha, const real_type *x, real_type *y, const kernel_index_type size) :
+        alpha_{ alpha }, x_{ x }, y_{ y }, size_{ size } {}
+
+    /**
+     * @brief Function call operator overload performing the actual calculation.
+     * @param[in] index the [`sycl::id`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#id-class)
+     *                  identifying an instance of the functor executing at each point in a [`sycl::range`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#range-class)
+     */
+    void operator()(::sycl::id<1> index) const {
+        if (index < size_) {
+            y_[index] += alpha_ * x_[index];
+        }
+    }
+
+  private:
+    /// @cond Doxygen_suppress
+    const real_type alpha_;
+    const real_type *x_;
+    real_type *y_;
+    const kernel_index_type size_;
+    /// @endcond
+};
+
+/**
+ * @brief Calculates `y = x + beta * y`.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class device_kernel_xpby {
+  public:
+    /// The type of the data.
+    using real_type = T;
+
+    /**
+     * @brief Construct a new device kernel calculating `y = x + beta * y`.
+     * @param[in] x the vector to add
+     * @param[in] beta the scaling factor of @p y
+     * @param[in,out] y the result vector
+     * @param[in] size the number of values to update
+     */
+    device_kernel_xpby(const real_type *x, const real_type beta, real_type *y, const kernel_index_type size) :
+        x_{ x }, beta_{ beta }, y_{ y }, size_{ size } {}
+
+    /**
+     * @brief Function call operator overload performing the actual calculation.
+     * @param[in] index the [`sycl::id`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#id-class)
+     *                  identifying an instance of the functor executing at each point in a [`sycl::range`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#range-class)
+     */
+    void operator()(::sycl::id<1> index) const {
+        if (index < size_) {
+            y_[index] = x_[index] + beta_ * y_[index];
+        }
+    }
+
+  private:
+    /// @cond Doxygen_suppress
+    const real_type *x_;
+    const real_type beta_;
+    real_type *y_;
+    const kernel_index_type size_;
+    /// @endcond
+};
+
+/**
+ * @brief Calculates the partial sums of the dot product `x^T * y`, one for each work-group.
+ * @details The work-group size must be `THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE`.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class device_kernel_dot {
+  public:
+    /// The type of the data.
+    using real_type = T;
+
+    /**
+     * @brief Construct a new device kernel calculating the partial sums of the dot product `x^T * y`.
+     * @param[in] cgh [`sycl::handler`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#sec:handlerClass) used to allocate the local memory
+     * @param[in] x the first vector
+     * @param[in] y the second vector
+     * @param[out] partial_sums the partial sums of each work-group
+     * @param[in] size the number of values used in the dot product
+     */
+    device_kernel_dot(::sycl::handler &cgh, const real_type *x, const real_type *y, real_type *partial_sums, const kernel_index_type size) :
+        block_sums_{ ::sycl::range<1>{ THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE }, cgh }, x_{ x }, y_{ y }, partial_sums_{ partial_sums }, size_{ size } {}
+
+    /**
+     * @brief Function call operator overload performing the actual calculation.
+     * @param[in] nd_idx the [`sycl::nd_item`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#nditem-class)
+     *                   identifying an instance of the functor executing at each point in a [`sycl::range`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#range-class)
+     */
+    void operator()(::sycl::nd_item<1> nd_idx) const {
+        const kernel_index_type thread_id = nd_idx.get_local_id(0);
+        const kernel_index_type block_size = nd_idx.get_local_range(0);
+
+        // grid-stride loop: each work-item accumulates multiple values if the vectors are larger than the nd_range
+        real_type temp{ 0.0 };
+        for (kernel_index_type i = nd_idx.get_global_id(0); i < size_; i += nd_idx.get_global_range(0)) {
+            temp += x_[i] * y_[i];
+        }
+        block_sums_[thread_id] = temp;
+
+        // tree-based reduction in local memory
+        for (kernel_index_type stride = 1; stride < block_size; stride *= 2) {
+            ::sycl::group_barrier(nd_idx.get_group());
+            if (thread_id % (2 * stride) == 0 && thread_id + stride < block_size) {
+                block_sums_[thread_id] += block_sums_[thread_id + stride];
+            }
+        }
+        if (thread_id == 0) {
+            partial_sums_[nd_idx.get_group_linear_id()] = block_sums_[0];
+        }
+    }
+
+  private:
+    /// Local memory used for the work-group reduction.
+    ::sycl::local_accessor<real_type, 1> block_sums_;
+
+    /// @cond Doxygen_suppress
+    const real_type *x_;
+    const real_type *y_;
+    real_type *partial_sums_;
+    const kernel_index_type size_;
+    /// @endcond
+};
+
+/**
+ * @brief Sums up the first @p size partial sums using a single work-group and stores the result in `partial_sums[0]`.
+ * @details The work-group size must be `THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE`.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class device_kernel_sum {
+  public:
+    /// The type of the data.
+    using real_type = T;
+
+    /**
+     * @brief Construct a new device kernel summing up the partial sums calculated by the plssvm::sycl::detail::device_kernel_dot kernel.
+     * @param[in] cgh [`sycl::handler`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#sec:handlerClass) used to allocate the local memory
+     * @param[in,out] partial_sums the partial sums to reduce
+     * @param[in] size the number of partial sums
+     */
+    device_kernel_sum(::sycl::handler &cgh, real_type *partial_sums, const kernel_index_type size) :
+        block_sums_{ ::sycl::range<1>{ THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE }, cgh }, partial_sums_{ partial_sums }, size_{ size } {}
+
+    /**
+     * @brief Function call operator overload performing the actual calculation.
+     * @param[in] nd_idx the [`sycl::nd_item`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#nditem-class)
+     *                   identifying an instance of the functor executing at each point in a [`sycl::range`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#range-class)
+     */
+    void operator()(::sycl::nd_item<1> nd_idx) const {
+        const kernel_index_type thread_id = nd_idx.get_local_id(0);
+        const kernel_index_type block_size = nd_idx.get_local_range(0);
+
+        real_type temp{ 0.0 };
+        for (kernel_index_type i = thread_id; i < size_; i += block_size) {
+            temp += partial_sums_[i];
+        }
+        block_sums_[thread_id] = temp;
+
+        // tree-based reduction in local memory
+        // note: all partial sums have been read before the first barrier, i.e., the result may overwrite them
+        for (kernel_index_type stride = 1; stride < block_size; stride *= 2) {
+            ::sycl::group_barrier(nd_idx.get_group());
+            if (thread_id % (2 * stride) == 0 && thread_id + stride < block_size) {
+                block_sums_[thread_id] += block_sums_[thread_id + stride];
+            }
+        }
+        if (thread_id == 0) {
+            partial_sums_[0] = block_sums_[0];
+        }
+    }
+
+  private:
+    /// Local memory used for the work-group reduction.
+    ::sycl::local_accessor<real_type, 1> block_sums_;
+
+    /// @cond Doxygen_suppress
+    real_type *partial_sums_;
+    const kernel_index_type size_;
+    /// @endcond
+};
+
+}  // namespace plssvm::sycl::detail
+
+#endif  // PLSSVM_BACKENDS_SYCL_CG_KERNEL_HPP_
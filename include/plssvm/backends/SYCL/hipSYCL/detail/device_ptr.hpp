@@ -37,6 +37,7 @@ class device_ptr : public ::plssvm::detail::gpu_device_ptr<T, queue> {
     using base_type::fill;
     using base_type::copy_to_device;
     using base_type::copy_to_host;
+    using base_type::copy_to_device_async;
 
     using typename base_type::const_host_pointer_type;
     using typename base_type::device_pointer_type;
@@ -95,6 +96,16 @@ class device_ptr : public ::plssvm::detail::gpu_device_ptr<T, queue> {
      * @copydoc plssvm::detail::gpu_device_ptr::copy_to_host(host_pointer_type, size_type, size_type) const
      */
     void copy_to_host(host_pointer_type buffer, size_type pos, size_type count) const override;
+    /**
+     * @copydoc plssvm::detail::gpu_device_ptr::copy_to_device_async(const_host_pointer_type, size_type, size_type)
+     * @details The copy is submitted to the in-order transfer queue associated with the queue of this device_ptr.
+     */
+    void copy_to_device_async(const_host_pointer_type data_to_copy, size_type pos, size_type count) override;
+    /**
+     * @copydoc plssvm::detail::gpu_device_ptr::wait_for_async_copies()
+     * @details Waits for **all** asynchronous copies submitted to the transfer queue associated with the queue of this device_ptr.
+     */
+    void wait_for_async_copies() const override;
 };
 
 extern template class device_ptr<float>;
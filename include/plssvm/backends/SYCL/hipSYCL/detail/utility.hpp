@@ -16,6 +16,7 @@
 #include "plssvm/backends/SYCL/hipSYCL/detail/queue.hpp"  // plssvm::hipsycl::detail::queue (PImpl)
 #include "plssvm/target_platforms.hpp"                    // plssvm::target_platform
 
+#include <cstddef>                                        // std::size_t
 #include <utility>                                        // std::pair
 #include <vector>                                         // std::vector
 
@@ -41,6 +42,13 @@ namespace plssvm::hipsycl::detail {
  */
 void device_synchronize(const queue &q);
 
+/**
+ * @brief Returns the size of the global memory of the device associated with @p q in bytes.
+ * @param[in] q the SYCL queue to query
+ * @return the global device memory in bytes (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::size_t get_device_memory(const queue &q);
+
 /**
  * @brief Get the default SYCL queue.
  * @details Only used in the tests, but **must** be defined and implemented here!
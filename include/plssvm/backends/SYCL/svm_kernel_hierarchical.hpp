@@ -182,7 +182,7 @@ class hierarchical_device_kernel_linear {
 
 /**
  * @brief Calculates the C-SVM kernel using the hierarchical formulation and the polynomial kernel function.
- * @details Currently only single GPU execution is supported.
+ * @details Supports multi-GPU execution by splitting the rows of the implicit kernel matrix across the devices.
  * @tparam T the type of the data
  */
 template <typename T>
@@ -205,9 +205,10 @@ class hierarchical_device_kernel_polynomial {
      * @param[in] degree the degree parameter used in the polynomial kernel function
      * @param[in] gamma the gamma parameter used in the polynomial kernel function
      * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+     * @param[in] row_offset the first row of the implicit kernel matrix the current device is responsible for
      */
-    hierarchical_device_kernel_polynomial(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const int degree, const real_type gamma, const real_type coef0) :
-        q_{ q }, ret_{ ret }, d_{ d }, data_d_{ data_d }, QA_cost_{ QA_cost }, cost_{ cost }, num_rows_{ num_rows }, num_cols_{ num_cols }, add_{ add }, degree_{ degree }, gamma_{ gamma }, coef0_{ coef0 } {}
+    hierarchical_device_kernel_polynomial(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const int degree, const real_type gamma, const real_type coef0, const kernel_index_type row_offset) :
+        q_{ q }, ret_{ ret }, d_{ d }, data_d_{ data_d }, QA_cost_{ QA_cost }, cost_{ cost }, num_rows_{ num_rows }, num_cols_{ num_cols }, add_{ add }, degree_{ degree }, gamma_{ gamma }, coef0_{ coef0 }, row_offset_{ row_offset } {}
 
     /**
      * @brief Function call operator overload performing the actual calculation.
@@ -230,7 +231,7 @@ class hierarchical_device_kernel_polynomial {
         // initialize private variables
         group.parallel_for_work_item([&](::sycl::h_item<2> idx) {
             // indices and diagonal condition
-            private_i(idx) = group[0] * idx.get_local_range(0) * INTERNAL_BLOCK_SIZE;
+            private_i(idx) = row_offset_ + group[0] * idx.get_local_range(0) * INTERNAL_BLOCK_SIZE;
             private_j(idx) = group[1] * idx.get_local_range(1) * INTERNAL_BLOCK_SIZE;
             private_cond(idx) = private_i(idx) >= private_j(idx);
             if (private_cond(idx)) {
@@ -330,12 +331,13 @@ class hierarchical_device_kernel_polynomial {
     const int degree_;
     const real_type gamma_;
     const real_type coef0_;
+    const kernel_index_type row_offset_;
     /// @endcond
 };
 
 /**
  * @brief Calculates the C-SVM kernel using the hierarchical formulation and the radial basis functions kernel function.
- * @details Currently only single GPU execution is supported.
+ * @details Supports multi-GPU execution by splitting the rows of the implicit kernel matrix across the devices.
  * @tparam T the type of the data
  */
 template <typename T>
@@ -356,9 +358,10 @@ class hierarchical_device_kernel_rbf {
      * @param[in] num_cols the number of rows in the data matrix
      * @param[in] add denotes whether the values are added or subtracted from the result vector
      * @param[in] gamma the gamma parameter used in the rbf kernel function
+     * @param[in] row_offset the first row of the implicit kernel matrix the current device is responsible for
      */
-    hierarchical_device_kernel_rbf(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const real_type gamma) :
-        q_{ q }, ret_{ ret }, d_{ d }, data_d_{ data_d }, QA_cost_{ QA_cost }, cost_{ cost }, num_rows_{ num_rows }, num_cols_{ num_cols }, add_{ add }, gamma_{ gamma } {}
+    hierarchical_device_kernel_rbf(const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const real_type gamma, const kernel_index_type row_offset) :
+        q_{ q }, ret_{ ret }, d_{ d }, data_d_{ data_d }, QA_cost_{ QA_cost }, cost_{ cost }, num_rows_{ num_rows }, num_cols_{ num_cols }, add_{ add }, gamma_{ gamma }, row_offset_{ row_offset } {}
 
     /**
      * @brief Function call operator overload performing the actual calculation.
@@ -381,7 +384,7 @@ class hierarchical_device_kernel_rbf {
         // initialize private variables
         group.parallel_for_work_item([&](::sycl::h_item<2> idx) {
             // indices and diagonal condition
-            private_i(idx) = group[0] * idx.get_local_range(0) * INTERNAL_BLOCK_SIZE;
+            private_i(idx) = row_offset_ + group[0] * idx.get_local_range(0) * INTERNAL_BLOCK_SIZE;
             private_j(idx) = group[1] * idx.get_local_range(1) * INTERNAL_BLOCK_SIZE;
             private_cond(idx) = private_i(idx) >= private_j(idx);
             if (private_cond(idx)) {
@@ -479,6 +482,7 @@ class hierarchical_device_kernel_rbf {
     const kernel_index_type num_cols_;
     const real_type add_;
     const real_type gamma_;
+    const kernel_index_type row_offset_;
     /// @endcond
 };
 
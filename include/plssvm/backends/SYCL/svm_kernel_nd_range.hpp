@@ -157,7 +157,7 @@ class nd_range_device_kernel_linear {
 
 /**
  * @brief Calculates the C-SVM kernel using the nd_range formulation and the polynomial kernel function.
- * @details Currently only single GPU execution is supported.
+ * @details Supports multi-GPU execution by splitting the rows of the implicit kernel matrix across the devices.
  * @tparam T the type of the data
  */
 template <typename T>
@@ -181,9 +181,10 @@ class nd_range_device_kernel_polynomial {
      * @param[in] degree the degree parameter used in the polynomial kernel function
      * @param[in] gamma the gamma parameter used in the polynomial kernel function
      * @param[in] coef0 the coef0 parameter used in the polynomial kernel function
+     * @param[in] row_offset the first row of the implicit kernel matrix the current device is responsible for
      */
-    nd_range_device_kernel_polynomial(::sycl::handler &cgh, const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const int degree, const real_type gamma, const real_type coef0) :
-        data_intern_i_{ ::sycl::range<2>{ THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE }, cgh }, data_intern_j_{ ::sycl::range<2>{ THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE }, cgh }, q_{ q }, ret_{ ret }, d_{ d }, data_d_{ data_d }, QA_cost_{ QA_cost }, cost_{ cost }, num_rows_{ num_rows }, num_cols_{ num_cols }, add_{ add }, degree_{ degree }, gamma_{ gamma }, coef0_{ coef0 } {}
+    nd_range_device_kernel_polynomial(::sycl::handler &cgh, const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const int degree, const real_type gamma, const real_type coef0, const kernel_index_type row_offset) :
+        data_intern_i_{ ::sycl::range<2>{ THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE }, cgh }, data_intern_j_{ ::sycl::range<2>{ THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE }, cgh }, q_{ q }, ret_{ ret }, d_{ d }, data_d_{ data_d }, QA_cost_{ QA_cost }, cost_{ cost }, num_rows_{ num_rows }, num_cols_{ num_cols }, add_{ add }, degree_{ degree }, gamma_{ gamma }, coef0_{ coef0 }, row_offset_{ row_offset } {}
 
     /**
      * @brief Function call operator overload performing the actual calculation.
@@ -191,7 +192,7 @@ class nd_range_device_kernel_polynomial {
      *                   identifying an instance of the functor executing at each point in a [`sycl::range`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#range-class)
      */
     void operator()(::sycl::nd_item<2> nd_idx) const {
-        kernel_index_type i = nd_idx.get_group(0) * nd_idx.get_local_range(0) * INTERNAL_BLOCK_SIZE;
+        kernel_index_type i = row_offset_ + nd_idx.get_group(0) * nd_idx.get_local_range(0) * INTERNAL_BLOCK_SIZE;
         kernel_index_type j = nd_idx.get_group(1) * nd_idx.get_local_range(1) * INTERNAL_BLOCK_SIZE;
 
         real_type matr[INTERNAL_BLOCK_SIZE][INTERNAL_BLOCK_SIZE] = { { 0.0 } };
@@ -280,12 +281,13 @@ class nd_range_device_kernel_polynomial {
     const int degree_;
     const real_type gamma_;
     const real_type coef0_;
+    const kernel_index_type row_offset_;
     /// @endcond
 };
 
 /**
  * @brief Calculates the C-SVM kernel using the nd_range formulation and the radial basis functions kernel function.
- * @details Currently only single GPU execution is supported.
+ * @details Supports multi-GPU execution by splitting the rows of the implicit kernel matrix across the devices.
  * @tparam T the type of the data
  */
 template <typename T>
@@ -307,9 +309,10 @@ class nd_range_device_kernel_rbf {
      * @param[in] num_cols the number of rows in the data matrix
      * @param[in] add denotes whether the values are added or subtracted from the result vector
      * @param[in] gamma the gamma parameter used in the rbf kernel function
+     * @param[in] row_offset the first row of the implicit kernel matrix the current device is responsible for
      */
-    nd_range_device_kernel_rbf(::sycl::handler &cgh, const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const real_type gamma) :
-        data_intern_i_{ ::sycl::range<2>{ THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE }, cgh }, data_intern_j_{ ::sycl::range<2>{ THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE }, cgh }, q_{ q }, ret_{ ret }, d_{ d }, data_d_{ data_d }, QA_cost_{ QA_cost }, cost_{ cost }, num_rows_{ num_rows }, num_cols_{ num_cols }, add_{ add }, gamma_{ gamma } {}
+    nd_range_device_kernel_rbf(::sycl::handler &cgh, const real_type *q, real_type *ret, const real_type *d, const real_type *data_d, const real_type QA_cost, const real_type cost, const kernel_index_type num_rows, const kernel_index_type num_cols, const real_type add, const real_type gamma, const kernel_index_type row_offset) :
+        data_intern_i_{ ::sycl::range<2>{ THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE }, cgh }, data_intern_j_{ ::sycl::range<2>{ THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE }, cgh }, q_{ q }, ret_{ ret }, d_{ d }, data_d_{ data_d }, QA_cost_{ QA_cost }, cost_{ cost }, num_rows_{ num_rows }, num_cols_{ num_cols }, add_{ add }, gamma_{ gamma }, row_offset_{ row_offset } {}
 
     /**
      * @brief Function call operator overload performing the actual calculation.
@@ -317,7 +320,7 @@ class nd_range_device_kernel_rbf {
      *                   identifying an instance of the functor executing at each point in a [`sycl::range`](https://www.khronos.org/registry/SYCL/specs/sycl-2020/html/sycl-2020.html#range-class)
      */
     void operator()(::sycl::nd_item<2> nd_idx) const {
-        kernel_index_type i = nd_idx.get_group(0) * nd_idx.get_local_range(0) * INTERNAL_BLOCK_SIZE;
+        kernel_index_type i = row_offset_ + nd_idx.get_group(0) * nd_idx.get_local_range(0) * INTERNAL_BLOCK_SIZE;
         kernel_index_type j = nd_idx.get_group(1) * nd_idx.get_local_range(1) * INTERNAL_BLOCK_SIZE;
 
         real_type matr[INTERNAL_BLOCK_SIZE][INTERNAL_BLOCK_SIZE] = { { 0.0 } };
@@ -404,6 +407,7 @@ class nd_range_device_kernel_rbf {
     const kernel_index_type num_cols_;
     const real_type add_;
     const real_type gamma_;
+    const kernel_index_type row_offset_;
     /// @endcond
 };
 
@@ -13,26 +13,37 @@
 #define PLSSVM_BACKENDS_GPU_CSVM_HPP_
 #pragma once
 
-#include "plssvm/constants.hpp"                   // plssvm::{THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE}
-#include "plssvm/csvm.hpp"                        // plssvm::csvm
-#include "plssvm/detail/execution_range.hpp"      // plssvm::detail::execution_range
-#include "plssvm/detail/layout.hpp"               // plssvm::detail::{transform_to_layout, layout_type}
-#include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
-#include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY
-#include "plssvm/parameter.hpp"                   // plssvm::parameter
-
-#include "fmt/chrono.h"                           // output std::chrono times using {fmt}
-#include "fmt/core.h"                             // fmt::format
-
-#include <algorithm>                              // std::min, std::all_of, std::adjacent_find
-#include <chrono>                                 // std::chrono::{milliseconds, steady_clock, duration_cast}
-#include <cmath>                                  // std::ceil
-#include <cstddef>                                // std::size_t
-#include <functional>                             // std::less_equal
-#include <iostream>                               // std::clog, std::cout, std::endl
-#include <tuple>                                  // std::tuple, std::make_tuple
-#include <utility>                                // std::forward, std::pair, std::move, std::make_pair
-#include <vector>                                 // std::vector
+#include "plssvm/constants.hpp"                    // plssvm::{kernel_index_type, THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE, TRANSFER_BLOCK_SIZE}
+#include "plssvm/csvm.hpp"                         // plssvm::csvm
+#include "plssvm/detail/chunking.hpp"              // plssvm::detail::{calculate_chunk_size, calculate_chunk_bounds}
+#include "plssvm/detail/execution_range.hpp"       // plssvm::detail::execution_range
+#include "plssvm/detail/io/cg_checkpoint.hpp"      // plssvm::detail::io::{cg_checkpoint, calculate_data_fingerprint, resume_from_cg_checkpoint, write_cg_checkpoint}
+#include "plssvm/detail/logger.hpp"                // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"   // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY
+#include "plssvm/detail/residual_replacement.hpp"  // plssvm::detail::residual_replacement
+#include "plssvm/detail/solver_control.hpp"        // plssvm::detail::solver_control
+#include "plssvm/iteration_info.hpp"               // plssvm::iteration_info
+#include "plssvm/parameter.hpp"                    // plssvm::parameter
+#include "plssvm/solver_types.hpp"                 // plssvm::solver_type
+
+#include "fmt/chrono.h"                            // output std::chrono times using {fmt}
+#include "fmt/core.h"                              // fmt::format
+
+#include <algorithm>                               // std::min, std::max, std::all_of, std::adjacent_find, std::transform, std::copy
+#include <array>                                   // std::array
+#include <chrono>                                  // std::chrono::{milliseconds, steady_clock, duration_cast}
+#include <cmath>                                   // std::ceil, std::round, std::sqrt
+#include <cstddef>                                 // std::size_t
+#include <cstdint>                                 // std::uint64_t
+#include <functional>                              // std::less_equal, std::plus
+#include <iostream>                                // std::clog, std::cout, std::endl
+#include <limits>                                  // std::numeric_limits
+#include <memory>                                  // std::shared_ptr, std::weak_ptr
+#include <optional>                                // std::optional
+#include <tuple>                                   // std::tuple, std::make_tuple, std::tie, std::ignore
+#include <type_traits>                             // std::is_same_v
+#include <utility>                                 // std::forward, std::pair, std::move, std::make_pair
+#include <vector>                                  // std::vector
 
 namespace plssvm::detail {
 
@@ -94,20 +105,59 @@ class gpu_csvm : public ::plssvm::csvm {
         return devices_.size();
     }
 
+    /**
+     * @brief Set the maximum number of bytes the C-SVM may allocate on each device.
+     * @details If the support vectors or the data points to predict don't fit into the device memory, they are split into multiple chunks.
+     *          A value of `0` (default) uses all memory available on the devices.
+     * @param[in] num_bytes the device memory budget in bytes
+     */
+    void set_device_memory_budget(const std::size_t num_bytes) noexcept { device_memory_budget_ = num_bytes; }
+    /**
+     * @brief Return the maximum number of bytes the C-SVM may allocate on each device.
+     * @return the device memory budget in bytes; `0` if all memory available on the devices may be used (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t get_device_memory_budget() const noexcept { return device_memory_budget_; }
+
+    /**
+     * @brief Return the number of threads per block dimension used in the device kernels.
+     * @return the thread block size; plssvm::THREAD_BLOCK_SIZE if the backend compiles its device kernels ahead-of-time (`[[nodiscard]]`)
+     */
+    [[nodiscard]] kernel_index_type get_thread_block_size() const noexcept { return thread_block_size_; }
+    /**
+     * @brief Return the number of data points per thread dimension calculated by a single thread in the device kernels.
+     * @return the internal block size; plssvm::INTERNAL_BLOCK_SIZE if the backend compiles its device kernels ahead-of-time (`[[nodiscard]]`)
+     */
+    [[nodiscard]] kernel_index_type get_internal_block_size() const noexcept { return internal_block_size_; }
+
+    /**
+     * @brief Check whether the data points of a previous `fit` are still kept on the device(s).
+     * @details The data points are reused by all later calls to `fit` using the same data set (or a copy of it) with matching solver settings.
+     *          They are released if another data set is fit, if the data set has been destroyed before the next call to `fit`, or by calling plssvm::detail::gpu_csvm::clear_data_cache.
+     * @return `true` if data points are kept on the device(s) and the corresponding data set is still alive, otherwise `false` (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool has_cached_data() const noexcept { return !float_data_cache_.identity.expired() || !double_data_cache_.identity.expired(); }
+    /**
+     * @brief Release the data points of previous calls to `fit` kept on the device(s).
+     */
+    void clear_data_cache() const {
+        float_data_cache_ = device_data_cache<float>{};
+        double_data_cache_ = device_data_cache<double>{};
+    }
+
   protected:
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter) const final { return this->solve_system_of_linear_equations_impl(params, A, std::move(b), eps, max_iter); }
+    [[nodiscard]] std::pair<std::vector<float>, float> solve_system_of_linear_equations(const parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter, const solver_control<float> &control) const final { return this->solve_system_of_linear_equations_impl(params, A, std::move(b), eps, max_iter, control); }
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter) const final { return this->solve_system_of_linear_equations_impl(params, A, std::move(b), eps, max_iter); }
+    [[nodiscard]] std::pair<std::vector<double>, double> solve_system_of_linear_equations(const parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter, const solver_control<double> &control) const final { return this->solve_system_of_linear_equations_impl(params, A, std::move(b), eps, max_iter, control); }
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
     template <typename real_type>
-    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_impl(const parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter) const;
+    [[nodiscard]] std::pair<std::vector<real_type>, real_type> solve_system_of_linear_equations_impl(const parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, real_type eps, unsigned long long max_iter, const solver_control<real_type> &control) const;
 
     /**
      * @copydoc plssvm::csvm::predict_values
@@ -125,26 +175,38 @@ class gpu_csvm : public ::plssvm::csvm {
 
     /**
      * @brief Returns the number of usable devices given the kernel function @p kernel and the number of features @p num_features.
-     * @details Only the linear kernel supports multi-GPU execution, i.e., for the polynomial and rbf kernel, this function **always** returns 1.
-     *          In addition, at most @p num_features devices may be used (i.e., if **more** devices than features are present not all devices are used).
+     * @details The linear kernel splits the features across the devices, i.e., at most @p num_features devices may be used (i.e., if **more** devices than features are present not all devices are used).
+     *          The polynomial and rbf kernel split the rows of the implicit kernel matrix across the devices, i.e., all devices can be used.
      * @param[in] kernel the kernel function type
      * @param[in] num_features the number of features
      * @return the number of usable devices; may be less than the discovered devices in the system (`[[nodiscard]]`)
      */
     [[nodiscard]] std::size_t select_num_used_devices(kernel_function_type kernel, std::size_t num_features) const noexcept;
+    /**
+     * @brief Return the number of bytes that may be allocated on the device denoted by @p device.
+     * @details The smaller value of the device memory budget (if set) and the memory reported by the device.
+     * @param[in] device the device ID denoting the device to query
+     * @return the number of bytes (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t available_device_memory(std::size_t device) const;
     /**
      * @brief Performs all necessary steps such that the data is available on the device with the correct layout.
      * @details Distributed the data evenly across all devices, adds padding data points, and transforms the data layout to SoA.
+     *          The data is transformed in blocks of features; each transformed block is copied asynchronously to the device(s) while the next block is transformed.
+     *          For the linear kernel, the features are split across the devices. For the polynomial and rbf kernel, each device holds all features and is
+     *          responsible for a block of rows of the implicit kernel matrix. Since only the lower triangular part of the kernel matrix is calculated, the row blocks
+     *          are chosen such that each device calculates roughly the same number of tiles.
      * @tparam real_type the type of the data points (either `float` or `double`)
      * @param[in] data the data that should be copied to the device(s)
      * @param[in] num_data_points_to_setup the number of data points that should be copied to the device
      * @param[in] num_features_to_setup the number of features in the data set
      * @param[in] boundary_size the size of the padding boundary
      * @param[in] num_used_devices the number of devices to distribute the data across
-     * @return a tuple: [pointers to the main data distributed across the devices, pointers to the last data point of the data set distributed across the devices, the feature ranges a specific device is responsible for] (`[[nodiscard]]`)
+     * @param[in] kernel the kernel function type determining how the data is distributed across the devices
+     * @return a tuple: [pointers to the main data distributed across the devices, pointers to the last data point of the data set distributed across the devices, the feature ranges (linear kernel) or row ranges (polynomial and rbf kernel) a specific device is responsible for] (`[[nodiscard]]`)
      */
     template <typename real_type>
-    [[nodiscard]] std::tuple<std::vector<device_ptr_type<real_type>>, std::vector<device_ptr_type<real_type>>, std::vector<std::size_t>> setup_data_on_device(const std::vector<std::vector<real_type>> &data, std::size_t num_data_points_to_setup, std::size_t num_features_to_setup, std::size_t boundary_size, std::size_t num_used_devices) const;
+    [[nodiscard]] std::tuple<std::vector<device_ptr_type<real_type>>, std::vector<device_ptr_type<real_type>>, std::vector<std::size_t>> setup_data_on_device(const std::vector<std::vector<real_type>> &data, std::size_t num_data_points_to_setup, std::size_t num_features_to_setup, std::size_t boundary_size, std::size_t num_used_devices, kernel_function_type kernel) const;
 
     /**
      * @brief Calculate the `q` vector used in the dimensional reduction.
@@ -153,12 +215,12 @@ class gpu_csvm : public ::plssvm::csvm {
      * @param[in] data_d the data points used in the dimensional reduction located on the device(s)
      * @param[in] data_last_d the last data point of the data set located on the device(s)
      * @param[in] num_data_points the number of data points in @p data_p
-     * @param[in] feature_ranges the range of features a specific device is responsible for
+     * @param[in] device_ranges the range of features (linear kernel) or rows (polynomial and rbf kernel) a specific device is responsible for
      * @param[in] boundary_size the size of the padding boundary
      * @return the `q` vector (`[[nodiscard]]`)
      */
     template <typename real_type>
-    [[nodiscard]] std::vector<real_type> generate_q(const parameter<real_type> &params, const std::vector<device_ptr_type<real_type>> &data_d, const std::vector<device_ptr_type<real_type>> &data_last_d, std::size_t num_data_points, const std::vector<std::size_t> &feature_ranges, std::size_t boundary_size) const;
+    [[nodiscard]] std::vector<real_type> generate_q(const parameter<real_type> &params, const std::vector<device_ptr_type<real_type>> &data_d, const std::vector<device_ptr_type<real_type>> &data_last_d, std::size_t num_data_points, const std::vector<std::size_t> &device_ranges, std::size_t boundary_size) const;
     /**
      * @brief Precalculate the `w` vector to speedup up the prediction using the linear kernel function.
      * @tparam real_type the type of the data points (either `float` or `double`)
@@ -180,14 +242,14 @@ class gpu_csvm : public ::plssvm::csvm {
      * @param[in,out] r_d the result vector located on the device(s)
      * @param[in] x_d the right-hand side of the equation located on the device(s)
      * @param[in] data_d the data points used in the dimensional reduction located on the device(s)
-     * @param[in] feature_ranges the range of features a specific device is responsible for
+     * @param[in] device_ranges the range of features (linear kernel) or rows (polynomial and rbf kernel) a specific device is responsible for
      * @param[in] QA_cost a value used in the dimensional reduction
      * @param[in] add denotes whether the values are added or subtracted from the result vector
      * @param[in] dept the number of data points after the dimensional reduction
      * @param[in] boundary_size the size of the padding boundary
      */
     template <typename real_type>
-    void run_device_kernel(std::size_t device, const parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const std::vector<std::size_t> &feature_ranges, real_type QA_cost, real_type add, std::size_t dept, std::size_t boundary_size) const;
+    void run_device_kernel(std::size_t device, const parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const std::vector<std::size_t> &device_ranges, real_type QA_cost, real_type add, std::size_t dept, std::size_t boundary_size) const;
     /**
      * @brief Combines the data in @p buffer_d from all devices into @p buffer and distributes them back to each device.
      * @param[in,out] buffer_d the data to gather
@@ -195,6 +257,50 @@ class gpu_csvm : public ::plssvm::csvm {
      */
     template <typename real_type>
     void device_reduction(std::vector<device_ptr_type<real_type>> &buffer_d, std::vector<real_type> &buffer) const;
+    /**
+     * @brief Combines the data in @p buffer_d from all devices into @p buffer and distributes them back to each device.
+     * @details Uses the preallocated @p workspace to gather the data from the devices, i.e., doesn't allocate any memory in repeated calls (e.g., in each CG iteration).
+     * @param[in,out] buffer_d the data to gather
+     * @param[in,out] buffer the reduced data
+     * @param[in,out] workspace the buffer used to gather the data from the devices; resized to the size of @p buffer if necessary
+     */
+    template <typename real_type>
+    void device_reduction(std::vector<device_ptr_type<real_type>> &buffer_d, std::vector<real_type> &buffer, std::vector<real_type> &workspace) const;
+
+    /**
+     * @brief Calculate `y = alpha * x + y` for the first @p size values of @p x_d and @p y_d on the device denoted by @p device.
+     * @details Doesn't wait for the device kernel to finish.
+     * @param[in] device the device ID denoting the device on which the kernel should be executed
+     * @param[in] alpha the scaling factor of @p x_d
+     * @param[in] x_d the vector to add located on the device
+     * @param[in,out] y_d the result vector located on the device
+     * @param[in] size the number of values to update
+     */
+    template <typename real_type>
+    void device_axpy(std::size_t device, real_type alpha, const device_ptr_type<real_type> &x_d, device_ptr_type<real_type> &y_d, std::size_t size) const;
+    /**
+     * @brief Calculate `y = x + beta * y` for the first @p size values of @p x_d and @p y_d on the device denoted by @p device.
+     * @details Doesn't wait for the device kernel to finish.
+     * @param[in] device the device ID denoting the device on which the kernel should be executed
+     * @param[in] x_d the vector to add located on the device
+     * @param[in] beta the scaling factor of @p y_d
+     * @param[in,out] y_d the result vector located on the device
+     * @param[in] size the number of values to update
+     */
+    template <typename real_type>
+    void device_xpby(std::size_t device, const device_ptr_type<real_type> &x_d, real_type beta, device_ptr_type<real_type> &y_d, std::size_t size) const;
+    /**
+     * @brief Calculate the dot product `x^T * y` of the first @p size values of @p x_d and @p y_d on the device denoted by @p device.
+     * @details The dot product is completely reduced on the device, i.e., only the resulting scalar is copied back to the host.
+     * @param[in] device the device ID denoting the device on which the kernel should be executed
+     * @param[in] x_d the first vector located on the device
+     * @param[in] y_d the second vector located on the device
+     * @param[out] partial_sums_d the buffer used to store the partial sums of each block; must contain at least `thread_block_size_ * thread_block_size_` values
+     * @param[in] size the number of values used in the dot product
+     * @return the dot product (`[[nodiscard]]`)
+     */
+    template <typename real_type>
+    [[nodiscard]] real_type device_dot(std::size_t device, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &y_d, device_ptr_type<real_type> &partial_sums_d, std::size_t size) const;
 
     //*************************************************************************************************************************************//
     //                                         pure virtual, must be implemented by all subclasses                                         //
@@ -206,6 +312,12 @@ class gpu_csvm : public ::plssvm::csvm {
      * @param[in] queue the queue denoting the device to synchronize
      */
     virtual void device_synchronize(const queue_type &queue) const = 0;
+    /**
+     * @brief Return the number of bytes of memory that can be allocated on the device denoted by @p queue.
+     * @param[in] queue the queue denoting the device to query
+     * @return the device memory in bytes (`[[nodiscard]]`)
+     */
+    [[nodiscard]] virtual std::size_t get_device_memory(const queue_type &queue) const = 0;
     /**
      * @brief Run the device kernel filling the `q` vector.
      * @param[in] device the device ID denoting the GPU on which the kernel should be executed
@@ -235,12 +347,13 @@ class gpu_csvm : public ::plssvm::csvm {
      * @param[in] QA_cost a value used in the dimensional reduction
      * @param[in] num_data_points_padded the number of data points after the padding has been applied
      * @param[in] num_features number of features used for the calculation in the @p device
+     * @param[in] row_offset the first row of the implicit kernel matrix the @p device is responsible for (always 0 for the linear kernel)
      */
-    virtual void run_svm_kernel(std::size_t device, const detail::execution_range &range, const parameter<float> &params, const device_ptr_type<float> &q_d, device_ptr_type<float> &r_d, const device_ptr_type<float> &x_d, const device_ptr_type<float> &data_d, float QA_cost, float add, std::size_t num_data_points_padded, std::size_t num_features) const = 0;
+    virtual void run_svm_kernel(std::size_t device, const detail::execution_range &range, const parameter<float> &params, const device_ptr_type<float> &q_d, device_ptr_type<float> &r_d, const device_ptr_type<float> &x_d, const device_ptr_type<float> &data_d, float QA_cost, float add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const = 0;
     /**
      * @copydoc plssvm::detail::gpu_csvm::run_svm_kernel
      */
-    virtual void run_svm_kernel(std::size_t device, const detail::execution_range &range, const parameter<double> &params, const device_ptr_type<double> &q_d, device_ptr_type<double> &r_d, const device_ptr_type<double> &x_d, const device_ptr_type<double> &data_d, double QA_cost, double add, std::size_t num_data_points_padded, std::size_t num_features) const = 0;
+    virtual void run_svm_kernel(std::size_t device, const detail::execution_range &range, const parameter<double> &params, const device_ptr_type<double> &q_d, device_ptr_type<double> &r_d, const device_ptr_type<double> &x_d, const device_ptr_type<double> &data_d, double QA_cost, double add, std::size_t num_data_points_padded, std::size_t num_features, std::size_t row_offset) const = 0;
     /**
      * @brief Run the device kernel the calculate the `w` vector used to speed up the prediction when using the linear kernel function.
      * @param[in] device the device ID denoting the device on which the kernel should be executed
@@ -275,19 +388,129 @@ class gpu_csvm : public ::plssvm::csvm {
      * @copydoc plssvm::detail::gpu_csvm::run_predict_kernel
      */
     virtual void run_predict_kernel(const detail::execution_range &range, const parameter<double> &params, device_ptr_type<double> &out_d, const device_ptr_type<double> &alpha_d, const device_ptr_type<double> &point_d, const device_ptr_type<double> &data_d, const device_ptr_type<double> &data_last_d, std::size_t num_support_vectors, std::size_t num_predict_points, std::size_t num_features) const = 0;
+    /**
+     * @brief Run the device kernel calculating `y = alpha * x + y` used in the CG algorithm.
+     * @param[in] device the device ID denoting the device on which the kernel should be executed
+     * @param[in] range the execution range used to launch the kernel
+     * @param[in] alpha the scaling factor of @p x_d
+     * @param[in] x_d the vector to add located on the device
+     * @param[in,out] y_d the result vector located on the device
+     * @param[in] size the number of values to update
+     */
+    virtual void run_axpy_kernel(std::size_t device, const detail::execution_range &range, float alpha, const device_ptr_type<float> &x_d, device_ptr_type<float> &y_d, std::size_t size) const = 0;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_axpy_kernel
+     */
+    virtual void run_axpy_kernel(std::size_t device, const detail::execution_range &range, double alpha, const device_ptr_type<double> &x_d, device_ptr_type<double> &y_d, std::size_t size) const = 0;
+    /**
+     * @brief Run the device kernel calculating `y = x + beta * y` used in the CG algorithm.
+     * @param[in] device the device ID denoting the device on which the kernel should be executed
+     * @param[in] range the execution range used to launch the kernel
+     * @param[in] x_d the vector to add located on the device
+     * @param[in] beta the scaling factor of @p y_d
+     * @param[in,out] y_d the result vector located on the device
+     * @param[in] size the number of values to update
+     */
+    virtual void run_xpby_kernel(std::size_t device, const detail::execution_range &range, const device_ptr_type<float> &x_d, float beta, device_ptr_type<float> &y_d, std::size_t size) const = 0;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_xpby_kernel
+     */
+    virtual void run_xpby_kernel(std::size_t device, const detail::execution_range &range, const device_ptr_type<double> &x_d, double beta, device_ptr_type<double> &y_d, std::size_t size) const = 0;
+    /**
+     * @brief Run the device kernel calculating the partial sums of the dot product `x^T * y`, one for each block of the execution @p range.
+     * @param[in] device the device ID denoting the device on which the kernel should be executed
+     * @param[in] range the execution range used to launch the kernel; the block size must be `thread_block_size_ * thread_block_size_`
+     * @param[in] x_d the first vector located on the device
+     * @param[in] y_d the second vector located on the device
+     * @param[out] partial_sums_d the partial sums of each block located on the device
+     * @param[in] size the number of values used in the dot product
+     */
+    virtual void run_dot_kernel(std::size_t device, const detail::execution_range &range, const device_ptr_type<float> &x_d, const device_ptr_type<float> &y_d, device_ptr_type<float> &partial_sums_d, std::size_t size) const = 0;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_dot_kernel
+     */
+    virtual void run_dot_kernel(std::size_t device, const detail::execution_range &range, const device_ptr_type<double> &x_d, const device_ptr_type<double> &y_d, device_ptr_type<double> &partial_sums_d, std::size_t size) const = 0;
+    /**
+     * @brief Run the device kernel summing up the first @p size partial sums in @p partial_sums_d using a single block and storing the result in its first value.
+     * @param[in] device the device ID denoting the device on which the kernel should be executed
+     * @param[in] range the execution range used to launch the kernel; must be exactly one block of size `thread_block_size_ * thread_block_size_`
+     * @param[in,out] partial_sums_d the partial sums to reduce located on the device
+     * @param[in] size the number of partial sums
+     */
+    virtual void run_sum_kernel(std::size_t device, const detail::execution_range &range, device_ptr_type<float> &partial_sums_d, std::size_t size) const = 0;
+    /**
+     * @copydoc plssvm::detail::gpu_csvm::run_sum_kernel
+     */
+    virtual void run_sum_kernel(std::size_t device, const detail::execution_range &range, device_ptr_type<double> &partial_sums_d, std::size_t size) const = 0;
 
     /// The available/used backend devices.
     std::vector<queue_type> devices_{};
+    /// The number of threads per block dimension; may only differ from plssvm::THREAD_BLOCK_SIZE if the device kernels are compiled at runtime.
+    kernel_index_type thread_block_size_{ THREAD_BLOCK_SIZE };
+    /// The number of data points per thread dimension calculated by a single thread; may only differ from plssvm::INTERNAL_BLOCK_SIZE if the device kernels are compiled at runtime.
+    kernel_index_type internal_block_size_{ INTERNAL_BLOCK_SIZE };
+
+  private:
+    /**
+     * @brief The data points transformed and copied to the device(s) in a previous call to plssvm::detail::gpu_csvm::solve_system_of_linear_equations.
+     * @tparam real_type the type of the data points (either `float` or `double`)
+     */
+    template <typename real_type>
+    struct device_data_cache {
+        /**
+         * @brief Check whether the cached data points can be reused for the data points identified by @p other_identity with the @p other_shape.
+         * @details Compares the ownership instead of the addresses, since the address of the data points may be reused after their storage has been destroyed.
+         * @param[in] other_identity the identity of the data points (see plssvm::detail::solver_control::data_identity)
+         * @param[in] other_shape the number of data points, the number of features, the boundary size, the number of used devices, and whether the features are split across the devices
+         * @return `true` if the cached data points can be reused, otherwise `false` (`[[nodiscard]]`)
+         */
+        [[nodiscard]] bool matches(const std::shared_ptr<const void> &other_identity, const std::array<std::size_t, 5> &other_shape) const noexcept {
+            return other_identity != nullptr && !identity.expired() && !identity.owner_before(other_identity) && !other_identity.owner_before(identity) && shape == other_shape;
+        }
+
+        /// The identity of the cached data points; expires if the data set owning the data points has been destroyed.
+        std::weak_ptr<const void> identity{};
+        /// The number of data points, the number of features, the boundary size, the number of used devices, and whether the features are split across the devices.
+        std::array<std::size_t, 5> shape{};
+        /// The data points used in the dimensional reduction located on the device(s).
+        std::vector<device_ptr_type<real_type>> data_d{};
+        /// The last data point of the data set located on the device(s).
+        std::vector<device_ptr_type<real_type>> data_last_d{};
+        /// The range of features (linear kernel) or rows (polynomial and rbf kernel) a specific device is responsible for.
+        std::vector<std::size_t> device_ranges{};
+        /// The data points used in the dimensional reduction in single precision; only set if mixed precision has been requested.
+        std::vector<device_ptr_type<float>> data_mixed_d{};
+    };
+
+    /**
+     * @brief Return the data cache for the floating point type @p real_type.
+     * @tparam real_type the type of the data points (either `float` or `double`)
+     * @return the data cache (`[[nodiscard]]`)
+     */
+    template <typename real_type>
+    [[nodiscard]] device_data_cache<real_type> &get_data_cache() const noexcept {
+        if constexpr (std::is_same_v<real_type, float>) {
+            return float_data_cache_;
+        } else {
+            return double_data_cache_;
+        }
+    }
+
+    /// The maximum number of bytes that may be allocated on each device; `0` if all device memory may be used.
+    std::size_t device_memory_budget_{ 0 };
+    /// The single precision data points of the last `fit` kept on the device(s).
+    mutable device_data_cache<float> float_data_cache_{};
+    /// The double precision data points of the last `fit` kept on the device(s).
+    mutable device_data_cache<double> double_data_cache_{};
 };
 
 template <template <typename> typename device_ptr_t, typename queue_t>
 std::size_t gpu_csvm<device_ptr_t, queue_t>::select_num_used_devices(const kernel_function_type kernel, const std::size_t num_features) const noexcept {
     PLSSVM_ASSERT(num_features > 0, "At lest one feature must be given!");
 
-    // polynomial and rbf kernel currently only support single GPU execution
-    if ((kernel == kernel_function_type::polynomial || kernel == kernel_function_type::rbf) && devices_.size() > 1) {
-        std::clog << fmt::format("Warning: found {} devices, however only 1 device can be used since the polynomial and rbf kernels currently only support single GPU execution!", devices_.size()) << std::endl;
-        return 1;
+    // polynomial and rbf kernel split the rows of the implicit kernel matrix, i.e., all devices can be used
+    if (kernel == kernel_function_type::polynomial || kernel == kernel_function_type::rbf) {
+        return devices_.size();
     }
 
     // the number of used devices may not exceed the number of features
@@ -298,6 +521,14 @@ std::size_t gpu_csvm<device_ptr_t, queue_t>::select_num_used_devices(const kerne
     return num_used_devices;
 }
 
+template <template <typename> typename device_ptr_t, typename queue_t>
+std::size_t gpu_csvm<device_ptr_t, queue_t>::available_device_memory(const std::size_t device) const {
+    PLSSVM_ASSERT(device < devices_.size(), "Requested device {}, but only {} device(s) are available!", device, devices_.size());
+
+    const std::size_t device_memory = this->get_device_memory(devices_[device]);
+    return device_memory_budget_ == 0 ? device_memory : std::min(device_memory_budget_, device_memory);
+}
+
 /// @cond Doxygen_suppress
 template <template <typename> typename device_ptr_t, typename queue_t>
 template <typename real_type>
@@ -306,7 +537,8 @@ gpu_csvm<device_ptr_t, queue_t>::setup_data_on_device(const std::vector<std::vec
                                                       const std::size_t num_data_points_to_setup,
                                                       const std::size_t num_features_to_setup,
                                                       const std::size_t boundary_size,
-                                                      const std::size_t num_used_devices) const {
+                                                      const std::size_t num_used_devices,
+                                                      const kernel_function_type kernel) const {
     PLSSVM_ASSERT(!data.empty(), "The data must not be empty!");
     PLSSVM_ASSERT(!data.front().empty(), "The data points must contain at least one feature!");
     PLSSVM_ASSERT(std::all_of(data.cbegin(), data.cend(), [&data](const std::vector<real_type> &data_point) { return data_point.size() == data.front().size(); }), "All data points must have the same number of features!");
@@ -316,33 +548,88 @@ gpu_csvm<device_ptr_t, queue_t>::setup_data_on_device(const std::vector<std::vec
     PLSSVM_ASSERT(num_features_to_setup <= data.front().size(), "Can't copy more features to the device than are present!: {} <= {}", num_features_to_setup, data.front().size());
     PLSSVM_ASSERT(num_used_devices <= devices_.size(), "Can't use more devices than are available!: {} <= {}", num_used_devices, devices_.size());
 
-    // calculate the number of features per device
-    std::vector<std::size_t> feature_ranges(num_used_devices + 1);
-    for (typename std::vector<queue_type>::size_type device = 0; device <= num_used_devices; ++device) {
-        feature_ranges[device] = device * num_features_to_setup / num_used_devices;
+    std::vector<std::size_t> device_ranges(num_used_devices + 1);
+    if (kernel == kernel_function_type::linear) {
+        // calculate the number of features per device
+        for (typename std::vector<queue_type>::size_type device = 0; device <= num_used_devices; ++device) {
+            device_ranges[device] = device * num_features_to_setup / num_used_devices;
+        }
+    } else {
+        // calculate the rows of the implicit kernel matrix per device
+        // note: only the lower triangular tiles are calculated, i.e., the first k row blocks contain k * (k + 1) / 2 tiles
+        // -> use sqrt to balance the number of tiles (and not the number of rows) across the devices; the row blocks must be aligned to the tile size
+        const std::size_t block_size = std::max<std::size_t>(boundary_size, 1);
+        const auto num_blocks = static_cast<std::size_t>(std::ceil(static_cast<double>(num_data_points_to_setup) / static_cast<double>(block_size)));
+        for (typename std::vector<queue_type>::size_type device = 0; device <= num_used_devices; ++device) {
+            const auto num_blocks_in_range = static_cast<std::size_t>(std::round(static_cast<double>(num_blocks) * std::sqrt(static_cast<double>(device) / static_cast<double>(num_used_devices))));
+            device_ranges[device] = std::min(num_blocks_in_range * block_size, num_data_points_to_setup);
+        }
     }
 
-    // transform 2D to 1D SoA data
-    const std::vector<real_type> transformed_data = detail::transform_to_layout(detail::layout_type::soa, data, boundary_size, num_data_points_to_setup);
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
 
     std::vector<device_ptr_type<real_type>> data_last_d(num_used_devices);
     std::vector<device_ptr_type<real_type>> data_d(num_used_devices);
 
-    #pragma omp parallel for default(none) shared(num_used_devices, devices_, feature_ranges, data_last_d, data_d, data, transformed_data) firstprivate(num_data_points_to_setup, boundary_size, num_features_to_setup)
+    #pragma omp parallel for default(none) shared(num_used_devices, devices_, device_ranges, data_last_d, data_d, data) firstprivate(num_data_points_to_setup, boundary_size, num_features_to_setup, kernel)
     for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
-        const std::size_t num_features_in_range = feature_ranges[device + 1] - feature_ranges[device];
+        // the polynomial and rbf kernel need all features on each device
+        const std::size_t first_feature = kernel == kernel_function_type::linear ? device_ranges[device] : 0;
+        const std::size_t num_features_in_range = kernel == kernel_function_type::linear ? device_ranges[device + 1] - device_ranges[device] : num_features_to_setup;
 
         // initialize data_last on device
         data_last_d[device] = device_ptr_type<real_type>{ num_features_in_range + boundary_size, devices_[device] };
         data_last_d[device].memset(0);
-        data_last_d[device].copy_to_device(data.back().data() + feature_ranges[device], 0, num_features_in_range);
+        data_last_d[device].copy_to_device_async(data.back().data() + first_feature, 0, num_features_in_range);
+
+        data_d[device] = device_ptr_type<real_type>{ num_features_in_range * (num_data_points_to_setup + boundary_size), devices_[device] };
+    }
 
-        const std::size_t device_data_size = num_features_in_range * (num_data_points_to_setup + boundary_size);
-        data_d[device] = device_ptr_type<real_type>{ device_data_size, devices_[device] };
-        data_d[device].copy_to_device(transformed_data.data() + feature_ranges[device] * (num_data_points_to_setup + boundary_size), 0, device_data_size);
+    // transform 2D to 1D SoA data block-wise and copy each transformed block of features asynchronously to the device(s) while the next block is transformed
+    // note: the padding values must be zero
+    const std::size_t feature_size = num_data_points_to_setup + boundary_size;
+    std::vector<real_type> transformed_data(num_features_to_setup * feature_size, real_type{ 0.0 });
+    const std::vector<std::size_t> block_bounds = calculate_chunk_bounds(num_features_to_setup, std::max<std::size_t>(TRANSFER_BLOCK_SIZE / (feature_size * sizeof(real_type)), 1));
+    const std::size_t num_blocks = block_bounds.size() - 1;
+
+    for (std::size_t block = 0; block < num_blocks; ++block) {
+        const std::size_t first_feature_in_block = block_bounds[block];
+        const std::size_t last_feature_in_block = block_bounds[block + 1];
+
+        #pragma omp parallel for collapse(2) default(none) shared(transformed_data, data) firstprivate(first_feature_in_block, last_feature_in_block, num_data_points_to_setup, feature_size)
+        for (std::size_t feature = first_feature_in_block; feature < last_feature_in_block; ++feature) {
+            for (std::size_t point = 0; point < num_data_points_to_setup; ++point) {
+                transformed_data[feature * feature_size + point] = data[point][feature];
+            }
+        }
+
+        for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+            // only copy the features of the current block the device is responsible for
+            const std::size_t first_feature = kernel == kernel_function_type::linear ? std::max(device_ranges[device], first_feature_in_block) : first_feature_in_block;
+            const std::size_t last_feature = kernel == kernel_function_type::linear ? std::min(device_ranges[device + 1], last_feature_in_block) : last_feature_in_block;
+            if (first_feature < last_feature) {
+                const std::size_t device_offset = kernel == kernel_function_type::linear ? device_ranges[device] : 0;
+                data_d[device].copy_to_device_async(transformed_data.data() + first_feature * feature_size, (first_feature - device_offset) * feature_size, (last_feature - first_feature) * feature_size);
+            }
+        }
+    }
+
+    // the transformed data must outlive all asynchronous copies
+    for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+        data_d[device].wait_for_async_copies();
+        data_last_d[device].wait_for_async_copies();
     }
 
-    return std::make_tuple(std::move(data_d), std::move(data_last_d), std::move(feature_ranges));
+    const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Transformed the {}x{} dataset to SoA and copied it to {} device(s) in {} block(s) in {}.\n",
+                num_data_points_to_setup,
+                num_features_to_setup,
+                num_used_devices,
+                detail::tracking_entry{ "transfer", "num_blocks", num_blocks },
+                detail::tracking_entry{ "transfer", "setup_time", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+    return std::make_tuple(std::move(data_d), std::move(data_last_d), std::move(device_ranges));
 }
 /// @endcond
 
@@ -352,7 +639,7 @@ std::vector<real_type> gpu_csvm<device_ptr_t, queue_t>::generate_q(const paramet
                                                                    const std::vector<device_ptr_type<real_type>> &data_d,
                                                                    const std::vector<device_ptr_type<real_type>> &data_last_d,
                                                                    const std::size_t num_data_points,
-                                                                   const std::vector<std::size_t> &feature_ranges,
+                                                                   const std::vector<std::size_t> &device_ranges,
                                                                    const std::size_t boundary_size) const {
     PLSSVM_ASSERT(!data_d.empty(), "The data_d array may not be empty!");
     PLSSVM_ASSERT(std::all_of(data_d.cbegin(), data_d.cend(), [](const device_ptr_type<real_type> &ptr) { return !ptr.empty(); }), "Each device_ptr in data_d must at least contain one data point!");
@@ -360,22 +647,25 @@ std::vector<real_type> gpu_csvm<device_ptr_t, queue_t>::generate_q(const paramet
     PLSSVM_ASSERT(std::all_of(data_last_d.cbegin(), data_last_d.cend(), [](const device_ptr_type<real_type> &ptr) { return !ptr.empty(); }), "Each device_ptr in data_last_d must at least contain one data point!");
     PLSSVM_ASSERT(data_d.size() == data_last_d.size(), "The number of used devices to the data_d and data_last_d vectors must be equal!: {} != {}", data_d.size(), data_last_d.size());
     PLSSVM_ASSERT(num_data_points > 0, "At least one data point must be used to calculate q!");
-    PLSSVM_ASSERT(feature_ranges.size() == data_d.size() + 1, "The number of values in the feature_range vector must be exactly one more than the number of used devices!: {} != {} + 1", feature_ranges.size(), data_d.size());
-    PLSSVM_ASSERT(std::adjacent_find(feature_ranges.cbegin(), feature_ranges.cend(), std::less_equal<>{}) != feature_ranges.cend(), "The feature ranges are not monotonically increasing!");
+    PLSSVM_ASSERT(device_ranges.size() == data_d.size() + 1, "The number of values in the device_ranges vector must be exactly one more than the number of used devices!: {} != {} + 1", device_ranges.size(), data_d.size());
+    PLSSVM_ASSERT(std::adjacent_find(device_ranges.cbegin(), device_ranges.cend(), std::less_equal<>{}) != device_ranges.cend(), "The device ranges are not monotonically increasing!");
 
-    const std::size_t num_used_devices = data_d.size();
+    // the polynomial and rbf kernel don't split the features, i.e., q can be calculated completely on the first device
+    const std::size_t num_used_devices = params.kernel_type == kernel_function_type::linear ? data_d.size() : 1;
     std::vector<device_ptr_type<real_type>> q_d(num_used_devices);
 
-    #pragma omp parallel for default(none) shared(num_used_devices, q_d, devices_, data_d, data_last_d, feature_ranges, params) firstprivate(num_data_points, boundary_size, THREAD_BLOCK_SIZE)
+    const auto thread_block_size = static_cast<std::size_t>(thread_block_size_);
+    #pragma omp parallel for default(none) shared(num_used_devices, q_d, devices_, data_d, data_last_d, device_ranges, params) firstprivate(num_data_points, boundary_size, thread_block_size)
     for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
         q_d[device] = device_ptr_type<real_type>{ num_data_points + boundary_size, devices_[device] };
         q_d[device].memset(0);
 
         // feature splitting on multiple devices
-        const detail::execution_range range({ static_cast<std::size_t>(std::ceil(static_cast<real_type>(num_data_points) / static_cast<real_type>(THREAD_BLOCK_SIZE))) },
-                                            { std::min<std::size_t>(THREAD_BLOCK_SIZE, num_data_points) });
+        const detail::execution_range range({ static_cast<std::size_t>(std::ceil(static_cast<real_type>(num_data_points) / static_cast<real_type>(thread_block_size))) },
+                                            { std::min<std::size_t>(thread_block_size, num_data_points) });
 
-        run_q_kernel(device, range, params, q_d[device], data_d[device], data_last_d[device], num_data_points + boundary_size, feature_ranges[device + 1] - feature_ranges[device]);
+        const std::size_t num_features = params.kernel_type == kernel_function_type::linear ? device_ranges[device + 1] - device_ranges[device] : data_last_d[device].size() - boundary_size;
+        run_q_kernel(device, range, params, q_d[device], data_d[device], data_last_d[device], num_data_points + boundary_size, num_features);
     }
 
     std::vector<real_type> q(num_data_points);
@@ -407,7 +697,8 @@ std::vector<real_type> gpu_csvm<device_ptr_t, queue_t>::calculate_w(const std::v
     // create w vector and fill with zeros
     std::vector<real_type> w(feature_ranges.back(), real_type{ 0.0 });
 
-    #pragma omp parallel for default(none) shared(num_used_devices, devices_, feature_ranges, alpha_d, data_d, data_last_d, w) firstprivate(num_data_points, THREAD_BLOCK_SIZE)
+    const auto thread_block_size = static_cast<std::size_t>(thread_block_size_);
+    #pragma omp parallel for default(none) shared(num_used_devices, devices_, feature_ranges, alpha_d, data_d, data_last_d, w) firstprivate(num_data_points, thread_block_size)
     for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
         // feature splitting on multiple devices
         const std::size_t num_features_in_range = feature_ranges[device + 1] - feature_ranges[device];
@@ -415,8 +706,8 @@ std::vector<real_type> gpu_csvm<device_ptr_t, queue_t>::calculate_w(const std::v
         // create the w vector on the device
         device_ptr_type<real_type> w_d = device_ptr_type<real_type>{ num_features_in_range, devices_[device] };
 
-        const detail::execution_range range({ static_cast<std::size_t>(std::ceil(static_cast<real_type>(num_features_in_range) / static_cast<real_type>(THREAD_BLOCK_SIZE))) },
-                                            { std::min<std::size_t>(THREAD_BLOCK_SIZE, num_features_in_range) });
+        const detail::execution_range range({ static_cast<std::size_t>(std::ceil(static_cast<real_type>(num_features_in_range) / static_cast<real_type>(thread_block_size))) },
+                                            { std::min<std::size_t>(thread_block_size, num_features_in_range) });
 
         // calculate the w vector on the device
         run_w_kernel(device, range, w_d, alpha_d[device], data_d[device], data_last_d[device], num_data_points, num_features_in_range);
@@ -430,25 +721,53 @@ std::vector<real_type> gpu_csvm<device_ptr_t, queue_t>::calculate_w(const std::v
 
 template <template <typename> typename device_ptr_t, typename queue_t>
 template <typename real_type>
-void gpu_csvm<device_ptr_t, queue_t>::run_device_kernel(const std::size_t device, const parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const std::vector<std::size_t> &feature_ranges, const real_type QA_cost, const real_type add, const std::size_t dept, const std::size_t boundary_size) const {
+void gpu_csvm<device_ptr_t, queue_t>::run_device_kernel(const std::size_t device, const parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const std::vector<std::size_t> &device_ranges, const real_type QA_cost, const real_type add, const std::size_t dept, const std::size_t boundary_size) const {
     PLSSVM_ASSERT(device < devices_.size(), "Requested device {}, but only {} device(s) are available!", device, devices_.size());
     PLSSVM_ASSERT(!q_d.empty(), "The q_d device_ptr may not be empty!");
     PLSSVM_ASSERT(!r_d.empty(), "The r_d device_ptr may not be empty!");
     PLSSVM_ASSERT(!x_d.empty(), "The x_d device_ptr may not be empty!");
     PLSSVM_ASSERT(!data_d.empty(), "The data_d device_ptr may not be empty!");
-    PLSSVM_ASSERT(std::adjacent_find(feature_ranges.cbegin(), feature_ranges.cend(), std::less_equal<>{}) != feature_ranges.cend(), "The feature ranges are not monotonically increasing!");
+    PLSSVM_ASSERT(device + 1 < device_ranges.size(), "The device_ranges vector must contain a range for device {}!", device);
+    PLSSVM_ASSERT(std::adjacent_find(device_ranges.cbegin(), device_ranges.cend(), std::less_equal<>{}) != device_ranges.cend(), "The device ranges are not monotonically increasing!");
     PLSSVM_ASSERT(add == real_type{ -1.0 } || add == real_type{ 1.0 }, "add must either by -1.0 or 1.0, but is {}!", add);
     PLSSVM_ASSERT(dept > 0, "At least one data point must be used to calculate q!");
 
-    const auto grid = static_cast<std::size_t>(std::ceil(static_cast<real_type>(dept) / static_cast<real_type>(boundary_size)));
-    const detail::execution_range range({ grid, grid }, { THREAD_BLOCK_SIZE, THREAD_BLOCK_SIZE });
+    if (params.kernel_type == kernel_function_type::linear) {
+        // feature splitting on multiple devices
+        const auto grid = static_cast<std::size_t>(std::ceil(static_cast<real_type>(dept) / static_cast<real_type>(boundary_size)));
+        const detail::execution_range range({ grid, grid }, { static_cast<std::size_t>(thread_block_size_), static_cast<std::size_t>(thread_block_size_) });
 
-    run_svm_kernel(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, dept + boundary_size, feature_ranges[device + 1] - feature_ranges[device]);
+        run_svm_kernel(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, dept + boundary_size, device_ranges[device + 1] - device_ranges[device], 0);
+    } else {
+        // row splitting on multiple devices
+        const std::size_t row_begin = device_ranges[device];
+        const std::size_t row_end = device_ranges[device + 1];
+        if (row_begin == row_end) {
+            // no rows assigned to this device
+            return;
+        }
+
+        // only the lower triangular tiles are calculated, i.e., no columns after the last row of this device are needed
+        const auto grid_rows = static_cast<std::size_t>(std::ceil(static_cast<real_type>(row_end - row_begin) / static_cast<real_type>(boundary_size)));
+        const auto grid_cols = static_cast<std::size_t>(std::ceil(static_cast<real_type>(row_end) / static_cast<real_type>(boundary_size)));
+        const detail::execution_range range({ grid_rows, grid_cols }, { static_cast<std::size_t>(thread_block_size_), static_cast<std::size_t>(thread_block_size_) });
+
+        // each device holds all features
+        const std::size_t num_features = data_d.size() / (dept + boundary_size);
+        run_svm_kernel(device, range, params, q_d, r_d, x_d, data_d, QA_cost, add, dept + boundary_size, num_features, row_begin);
+    }
 }
 
 template <template <typename> typename device_ptr_t, typename queue_t>
 template <typename real_type>
 void gpu_csvm<device_ptr_t, queue_t>::device_reduction(std::vector<device_ptr_type<real_type>> &buffer_d, std::vector<real_type> &buffer) const {
+    std::vector<real_type> workspace{};
+    this->device_reduction(buffer_d, buffer, workspace);
+}
+
+template <template <typename> typename device_ptr_t, typename queue_t>
+template <typename real_type>
+void gpu_csvm<device_ptr_t, queue_t>::device_reduction(std::vector<device_ptr_type<real_type>> &buffer_d, std::vector<real_type> &buffer, std::vector<real_type> &workspace) const {
     PLSSVM_ASSERT(!buffer_d.empty(), "The buffer_d array may not be empty!");
     PLSSVM_ASSERT(std::all_of(buffer_d.cbegin(), buffer_d.cend(), [](const device_ptr_type<real_type> &ptr) { return !ptr.empty(); }), "Each device_ptr in buffer_d must at least contain one data point!");
     PLSSVM_ASSERT(!buffer.empty(), "The buffer array may not be empty!");
@@ -459,12 +778,13 @@ void gpu_csvm<device_ptr_t, queue_t>::device_reduction(std::vector<device_ptr_ty
     buffer_d[0].copy_to_host(buffer, 0, buffer.size());
 
     if (buffer_d.size() > 1) {
-        std::vector<real_type> ret(buffer.size());
+        // only allocates memory if the workspace is too small
+        workspace.resize(buffer.size());
         for (typename std::vector<device_ptr_type<real_type>>::size_type device = 1; device < buffer_d.size(); ++device) {
             device_synchronize(devices_[device]);
-            buffer_d[device].copy_to_host(ret, 0, ret.size());
+            buffer_d[device].copy_to_host(workspace, 0, workspace.size());
 
-            buffer += ret;
+            buffer += workspace;
         }
 
         #pragma omp parallel for default(none) shared(buffer_d, buffer)
@@ -474,35 +794,122 @@ void gpu_csvm<device_ptr_t, queue_t>::device_reduction(std::vector<device_ptr_ty
     }
 }
 
+template <template <typename> typename device_ptr_t, typename queue_t>
+template <typename real_type>
+void gpu_csvm<device_ptr_t, queue_t>::device_axpy(const std::size_t device, const real_type alpha, const device_ptr_type<real_type> &x_d, device_ptr_type<real_type> &y_d, const std::size_t size) const {
+    PLSSVM_ASSERT(device < devices_.size(), "Requested device {}, but only {} device(s) are available!", device, devices_.size());
+    PLSSVM_ASSERT(size > 0, "At least one value must be updated!");
+    PLSSVM_ASSERT(x_d.size() >= size, "The x_d device_ptr must at least contain {} values, but contains only {}!", size, x_d.size());
+    PLSSVM_ASSERT(y_d.size() >= size, "The y_d device_ptr must at least contain {} values, but contains only {}!", size, y_d.size());
+
+    const auto block_size = static_cast<std::size_t>(thread_block_size_ * thread_block_size_);
+    const detail::execution_range range({ static_cast<std::size_t>(std::ceil(static_cast<double>(size) / static_cast<double>(block_size))) }, { block_size });
+
+    run_axpy_kernel(device, range, alpha, x_d, y_d, size);
+}
+
+template <template <typename> typename device_ptr_t, typename queue_t>
+template <typename real_type>
+void gpu_csvm<device_ptr_t, queue_t>::device_xpby(const std::size_t device, const device_ptr_type<real_type> &x_d, const real_type beta, device_ptr_type<real_type> &y_d, const std::size_t size) const {
+    PLSSVM_ASSERT(device < devices_.size(), "Requested device {}, but only {} device(s) are available!", device, devices_.size());
+    PLSSVM_ASSERT(size > 0, "At least one value must be updated!");
+    PLSSVM_ASSERT(x_d.size() >= size, "The x_d device_ptr must at least contain {} values, but contains only {}!", size, x_d.size());
+    PLSSVM_ASSERT(y_d.size() >= size, "The y_d device_ptr must at least contain {} values, but contains only {}!", size, y_d.size());
+
+    const auto block_size = static_cast<std::size_t>(thread_block_size_ * thread_block_size_);
+    const detail::execution_range range({ static_cast<std::size_t>(std::ceil(static_cast<double>(size) / static_cast<double>(block_size))) }, { block_size });
+
+    run_xpby_kernel(device, range, x_d, beta, y_d, size);
+}
+
+template <template <typename> typename device_ptr_t, typename queue_t>
+template <typename real_type>
+real_type gpu_csvm<device_ptr_t, queue_t>::device_dot(const std::size_t device, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &y_d, device_ptr_type<real_type> &partial_sums_d, const std::size_t size) const {
+    const auto block_size = static_cast<std::size_t>(thread_block_size_ * thread_block_size_);
+
+    PLSSVM_ASSERT(device < devices_.size(), "Requested device {}, but only {} device(s) are available!", device, devices_.size());
+    PLSSVM_ASSERT(size > 0, "At least one value must be used in the dot product!");
+    PLSSVM_ASSERT(x_d.size() >= size, "The x_d device_ptr must at least contain {} values, but contains only {}!", size, x_d.size());
+    PLSSVM_ASSERT(y_d.size() >= size, "The y_d device_ptr must at least contain {} values, but contains only {}!", size, y_d.size());
+    PLSSVM_ASSERT(partial_sums_d.size() >= block_size, "The partial_sums_d device_ptr must at least contain {} values, but contains only {}!", block_size, partial_sums_d.size());
+
+    // at most one partial sum per thread of the final reduction block, the dot kernel uses grid-stride loops for larger vectors
+    const std::size_t num_blocks = std::min(static_cast<std::size_t>(std::ceil(static_cast<double>(size) / static_cast<double>(block_size))), block_size);
+    run_dot_kernel(device, detail::execution_range({ num_blocks }, { block_size }), x_d, y_d, partial_sums_d, size);
+    // reduce the partial sums on the device such that only a single value must be copied back to the host
+    run_sum_kernel(device, detail::execution_range({ 1 }, { block_size }), partial_sums_d, num_blocks);
+
+    real_type result{};
+    device_synchronize(devices_[device]);
+    partial_sums_d.copy_to_host(&result, 0, 1);
+    return result;
+}
+
 template <template <typename> typename device_ptr_t, typename queue_t>
 template <typename real_type>
 std::pair<std::vector<real_type>, real_type> gpu_csvm<device_ptr_t, queue_t>::solve_system_of_linear_equations_impl(const parameter<real_type> &params,
                                                                                                                     const std::vector<std::vector<real_type>> &A,
                                                                                                                     std::vector<real_type> b,
                                                                                                                     const real_type eps,
-                                                                                                                    const unsigned long long max_iter) const {
+                                                                                                                    const unsigned long long max_iter,
+                                                                                                                    const solver_control<real_type> &control) const {
     PLSSVM_ASSERT(!A.empty(), "The data must not be empty!");
     PLSSVM_ASSERT(!A.front().empty(), "The data points must contain at least one feature!");
     PLSSVM_ASSERT(std::all_of(A.cbegin(), A.cend(), [&A](const std::vector<real_type> &data_point) { return data_point.size() == A.front().size(); }), "All data points must have the same number of features!");
     PLSSVM_ASSERT(A.size() == b.size(), "The number of data points in the matrix A ({}) and the values in the right hand side vector ({}) must be the same!", A.size(), b.size());
     PLSSVM_ASSERT(eps > real_type{ 0.0 }, "The stopping criterion in the CG algorithm must be greater than 0.0, but is {}!", eps);
     PLSSVM_ASSERT(max_iter > 0, "The number of CG iterations must be greater than 0!");
+    PLSSVM_ASSERT(control.initial_guess.empty() || control.initial_guess.size() == A.size() - 1, "The initial guess must either be empty or contain exactly one value less than data points are present!: {} != {}", control.initial_guess.size(), A.size() - 1);
+    PLSSVM_ASSERT(!(std::is_same_v<real_type, double> && control.mixed_precision && control.solver == solver_type::pipelined_cg), "Mixed precision is not supported in combination with the pipelined CG algorithm!");
+
+    const std::chrono::steady_clock::time_point solver_start_time = std::chrono::steady_clock::now();
 
     using namespace plssvm::operators;
 
     const std::size_t dept = A.size() - 1;
-    constexpr auto boundary_size = static_cast<std::size_t>(THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE);
+    const auto boundary_size = static_cast<std::size_t>(thread_block_size_ * internal_block_size_);
     const std::size_t num_features = A.front().size();
 
     const std::size_t num_used_devices = this->select_num_used_devices(params.kernel_type, num_features);
 
-    std::vector<device_ptr_type<real_type>> data_d;
-    std::vector<device_ptr_type<real_type>> data_last_d;
-    std::vector<std::size_t> feature_ranges;
-    std::tie(data_d, data_last_d, feature_ranges) = this->setup_data_on_device(A, dept, num_features, boundary_size, num_used_devices);
+    // check whether the data and the CG state fit into the memory of the used devices
+    // note: in contrast to the prediction, the data can't be split into chunks since each device needs all of its data in every CG iteration
+    {
+        const std::size_t num_features_per_device = params.kernel_type == kernel_function_type::linear ? (num_features + num_used_devices - 1) / num_used_devices : num_features;
+        // the data points, the last data point, the q, x, r, and Ad vectors, and (on the first device) the d and b vectors and the partial sums of the dot products
+        std::size_t required_memory = ((num_features_per_device + 6) * (dept + boundary_size) + num_features_per_device + boundary_size + thread_block_size_ * thread_block_size_) * sizeof(real_type);
+        if (std::is_same_v<real_type, double> && control.mixed_precision) {
+            // the data points and the q, d, and Ad vectors in single precision
+            required_memory += (num_features_per_device + 3) * (dept + boundary_size) * sizeof(float);
+        }
+        for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+            const std::size_t available_memory = this->available_device_memory(device);
+            if (required_memory > available_memory) {
+                throw exception{ fmt::format("Not enough memory on device {} to train the C-SVM: {} bytes are required, but only {} bytes are available!", device, required_memory, available_memory) };
+            }
+        }
+    }
 
-    // create q vector
-    const std::vector<real_type> q = this->generate_q(params, data_d, data_last_d, dept, feature_ranges, boundary_size);
+    // reuse the data points already transformed and copied to the device(s) in a previous call with the same data points
+    // note: without an identity, the data points are released after the system of linear equations has been solved
+    device_data_cache<real_type> local_data_cache{};
+    device_data_cache<real_type> &data_cache = control.data_identity == nullptr ? local_data_cache : this->get_data_cache<real_type>();
+    const std::array<std::size_t, 5> data_shape{ dept, num_features, boundary_size, num_used_devices, static_cast<std::size_t>(params.kernel_type == kernel_function_type::linear) };
+    const bool data_cache_hit = data_cache.matches(control.data_identity, data_shape);
+    if (data_cache_hit) {
+        detail::log(verbosity_level::full,
+                    "Reusing the data points already located on the device(s).\n");
+    } else {
+        // release the outdated data points before allocating the new ones
+        data_cache = device_data_cache<real_type>{};
+        std::tie(data_cache.data_d, data_cache.data_last_d, data_cache.device_ranges) = this->setup_data_on_device(A, dept, num_features, boundary_size, num_used_devices, params.kernel_type);
+        data_cache.identity = control.data_identity;
+        data_cache.shape = data_shape;
+    }
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "data_cache_hit", data_cache_hit }));
+    const std::vector<device_ptr_type<real_type>> &data_d = data_cache.data_d;
+    const std::vector<device_ptr_type<real_type>> &data_last_d = data_cache.data_last_d;
+    const std::vector<std::size_t> &device_ranges = data_cache.device_ranges;
 
     // calculate QA_costs
     const real_type QA_cost = kernel_function(A.back(), A.back(), params) + real_type{ 1.0 } / params.cost;
@@ -512,38 +919,77 @@ std::pair<std::vector<real_type>, real_type> gpu_csvm<device_ptr_t, queue_t>::so
     b.pop_back();
     b -= b_back_value;
 
-    std::vector<real_type> x(dept, 1.0);
+    // if requested, resume the CG algorithm from a previously written checkpoint
+    // note: the data fingerprint is only necessary if checkpoints are written or read
+    const std::uint64_t data_fingerprint = control.checkpoint_file.empty() ? 0 : detail::io::calculate_data_fingerprint(A, b);
+    std::optional<detail::io::cg_checkpoint<real_type>> checkpoint = detail::io::resume_from_cg_checkpoint(control, params, data_fingerprint, dept);
+
+    // use the solution of the checkpoint or the initial guess if provided (warm start), otherwise initialize all values with 1.0
+    std::vector<real_type> x{};
+    if (checkpoint.has_value()) {
+        x = std::move(checkpoint->x);
+    } else {
+        x = control.initial_guess.empty() ? std::vector<real_type>(dept, real_type{ 1.0 }) : control.initial_guess;
+    }
     std::vector<device_ptr_type<real_type>> x_d(num_used_devices);
 
     std::vector<real_type> r(dept, 0.0);
     std::vector<device_ptr_type<real_type>> r_d(num_used_devices);
 
+    // copy x and b asynchronously to the device(s) such that the transfers overlap with the calculation of q
+    // note: x and b must not be changed until the copies are waited for
     #pragma omp parallel for default(none) shared(num_used_devices, devices_, x, x_d, r_d) firstprivate(dept, boundary_size)
     for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
         x_d[device] = device_ptr_type<real_type>{ dept + boundary_size, devices_[device] };
         x_d[device].memset(0);
-        x_d[device].copy_to_device(x, 0, dept);
+        x_d[device].copy_to_device_async(x, 0, dept);
 
         r_d[device] = device_ptr_type<real_type>{ dept + boundary_size, devices_[device] };
         r_d[device].memset(0);
     }
-    r_d[0].copy_to_device(b, 0, dept);
+    r_d[0].copy_to_device_async(b, 0, dept);
+
+    // create q vector
+    const std::vector<real_type> q = this->generate_q(params, data_d, data_last_d, dept, device_ranges, boundary_size);
 
     std::vector<device_ptr_type<real_type>> q_d(num_used_devices);
-    #pragma omp parallel for default(none) shared(num_used_devices, devices_, q, q_d, r_d, x_d, data_d, feature_ranges, params) firstprivate(dept, boundary_size, QA_cost, num_features)
+    #pragma omp parallel for default(none) shared(num_used_devices, devices_, q, q_d, r_d, x_d, data_d, device_ranges, params, checkpoint) firstprivate(dept, boundary_size, QA_cost, num_features)
     for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
         q_d[device] = device_ptr_type<real_type>{ dept + boundary_size, devices_[device] };
         q_d[device].memset(0);
         q_d[device].copy_to_device(q, 0, dept);
 
-        // r = Ax (r = b - Ax)
-        run_device_kernel(device, params, q_d[device], r_d[device], x_d[device], data_d[device], feature_ranges, QA_cost, real_type{ -1.0 }, dept, boundary_size);
+        // r = Ax (r = b - Ax); not necessary if the residual is restored from a checkpoint
+        x_d[device].wait_for_async_copies();
+        r_d[device].wait_for_async_copies();
+        if (!checkpoint.has_value()) {
+            run_device_kernel(device, params, q_d[device], r_d[device], x_d[device], data_d[device], device_ranges, QA_cost, real_type{ -1.0 }, dept, boundary_size);
+        }
     }
-    device_reduction(r_d, r);
 
-    // delta = r.T * r
-    real_type delta = transposed{ r } * r;
-    const real_type delta0 = delta;
+    std::vector<real_type> d{};
+    real_type delta{};
+    real_type delta0{};
+    // the residuum and step size of the previous iteration (only used in the pipelined CG algorithm)
+    real_type delta_old{ 1.0 };
+    real_type alpha_old{ 1.0 };
+    if (checkpoint.has_value()) {
+        // continue with the state of the checkpoint
+        r = std::move(checkpoint->r);
+        d = std::move(checkpoint->d);
+        delta = checkpoint->delta;
+        delta0 = checkpoint->delta0;
+        delta_old = checkpoint->delta_old;
+        alpha_old = checkpoint->alpha_old;
+    } else {
+        device_reduction(r_d, r);
+
+        // delta = r.T * r
+        delta = transposed{ r } * r;
+        delta0 = delta;
+
+        d = r;
+    }
     std::vector<real_type> Ad(dept);
 
     std::vector<device_ptr_type<real_type>> Ad_d(num_used_devices);
@@ -551,7 +997,133 @@ std::pair<std::vector<real_type>, real_type> gpu_csvm<device_ptr_t, queue_t>::so
         Ad_d[device] = device_ptr_type<real_type>{ dept + boundary_size, devices_[device] };
     }
 
-    std::vector<real_type> d(r);
+    // if requested, perform the kernel matrix-vector multiplications in the CG iterations in single precision
+    // note: the CG scalars and vectors are still calculated using real_type, the residual is refined using real_type
+    const bool use_mixed_precision = std::is_same_v<real_type, double> && control.mixed_precision;
+    const parameter<float> params_mixed = static_cast<parameter<float>>(params);
+    const std::vector<device_ptr_type<float>> &data_mixed_d = data_cache.data_mixed_d;
+    std::vector<device_ptr_type<float>> q_mixed_d(num_used_devices);
+    std::vector<device_ptr_type<float>> d_mixed_d(num_used_devices);
+    std::vector<device_ptr_type<float>> Ad_mixed_d(num_used_devices);
+    std::vector<float> d_mixed;
+    std::vector<float> Ad_mixed;
+    if (use_mixed_precision) {
+        if (data_cache.data_mixed_d.empty()) {
+            // copy the data in single precision to the device(s)
+            std::vector<std::vector<float>> A_mixed(A.size(), std::vector<float>(num_features));
+            #pragma omp parallel for default(none) shared(A, A_mixed)
+            for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < A.size(); ++i) {
+                std::transform(A[i].cbegin(), A[i].cend(), A_mixed[i].begin(), [](const real_type val) { return static_cast<float>(val); });
+            }
+            std::tie(data_cache.data_mixed_d, std::ignore, std::ignore) = this->setup_data_on_device(A_mixed, dept, num_features, boundary_size, num_used_devices, params.kernel_type);
+        }
+
+        const std::vector<float> q_mixed(q.cbegin(), q.cend());
+        d_mixed.resize(dept);
+        Ad_mixed.resize(dept);
+
+        #pragma omp parallel for default(none) shared(num_used_devices, devices_, q_mixed, q_mixed_d, d_mixed_d, Ad_mixed_d) firstprivate(dept, boundary_size)
+        for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+            q_mixed_d[device] = device_ptr_type<float>{ dept + boundary_size, devices_[device] };
+            q_mixed_d[device].memset(0);
+            q_mixed_d[device].copy_to_device(q_mixed, 0, dept);
+
+            d_mixed_d[device] = device_ptr_type<float>{ dept + boundary_size, devices_[device] };
+            d_mixed_d[device].memset(0);
+
+            Ad_mixed_d[device] = device_ptr_type<float>{ dept + boundary_size, devices_[device] };
+        }
+    }
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "mixed_precision", use_mixed_precision }));
+
+    // preallocated buffers used to gather the (partial) results from multiple devices in each CG iteration
+    std::vector<real_type> reduction_workspace{};
+    std::vector<float> reduction_workspace_mixed{};
+
+    // the time spent in the kernel matrix-vector multiplications during the current CG iteration
+    std::chrono::steady_clock::duration matrix_vector_duration{};
+
+    // launch Ad = A * d (q = A * d) on all devices, in mixed precision calculated in single precision
+    // note: doesn't wait for the device kernels to finish
+    const auto launch_kernel_matrix_vector_multiplication = [&](const std::vector<real_type> &vec) {
+        const std::chrono::steady_clock::time_point matrix_vector_start_time = std::chrono::steady_clock::now();
+        if (use_mixed_precision) {
+            std::transform(vec.cbegin(), vec.cend(), d_mixed.begin(), [](const real_type val) { return static_cast<float>(val); });
+            #pragma omp parallel for default(shared) firstprivate(dept, QA_cost, boundary_size)
+            for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+                // overlap the broadcast of d with the reset of Ad
+                d_mixed_d[device].copy_to_device_async(d_mixed, 0, dept);
+                Ad_mixed_d[device].memset(0);
+
+                d_mixed_d[device].wait_for_async_copies();
+                run_device_kernel(device, params_mixed, q_mixed_d[device], Ad_mixed_d[device], d_mixed_d[device], data_mixed_d[device], device_ranges, static_cast<float>(QA_cost), 1.0f, dept, boundary_size);
+            }
+        } else {
+            #pragma omp parallel for default(shared) firstprivate(dept, QA_cost, boundary_size)
+            for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+                // overlap the broadcast of vec with the reset of Ad
+                r_d[device].memset(0, dept);
+                r_d[device].copy_to_device_async(vec, 0, dept);
+                Ad_d[device].memset(0);
+
+                r_d[device].wait_for_async_copies();
+                run_device_kernel(device, params, q_d[device], Ad_d[device], r_d[device], data_d[device], device_ranges, QA_cost, real_type{ 1.0 }, dept, boundary_size);
+            }
+        }
+        matrix_vector_duration += std::chrono::steady_clock::now() - matrix_vector_start_time;
+    };
+    // wait for the launched kernel matrix-vector multiplication and gather the result from all devices
+    const auto gather_kernel_matrix_vector_multiplication = [&](std::vector<real_type> &result) {
+        const std::chrono::steady_clock::time_point matrix_vector_start_time = std::chrono::steady_clock::now();
+        if (use_mixed_precision) {
+            // convert the result back to real_type
+            device_reduction(Ad_mixed_d, Ad_mixed, reduction_workspace_mixed);
+            std::copy(Ad_mixed.cbegin(), Ad_mixed.cend(), result.begin());
+        } else {
+            device_reduction(Ad_d, result, reduction_workspace);
+        }
+        matrix_vector_duration += std::chrono::steady_clock::now() - matrix_vector_start_time;
+    };
+    const auto kernel_matrix_vector_multiplication = [&](const std::vector<real_type> &vec, std::vector<real_type> &result) {
+        launch_kernel_matrix_vector_multiplication(vec);
+        gather_kernel_matrix_vector_multiplication(result);
+    };
+    // r = b - A * x, always calculated using real_type
+    const auto calculate_residual = [&](std::vector<real_type> &residual) {
+        const std::chrono::steady_clock::time_point matrix_vector_start_time = std::chrono::steady_clock::now();
+        #pragma omp parallel for default(shared) firstprivate(QA_cost, dept, boundary_size)
+        for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+            if (device == 0) {
+                // r = b
+                r_d[device].copy_to_device_async(b, 0, dept);
+            } else {
+                // set r to 0
+                r_d[device].memset(0);
+            }
+            x_d[device].copy_to_device_async(x, 0, dept);
+
+            // r -= A * x
+            x_d[device].wait_for_async_copies();
+            r_d[device].wait_for_async_copies();
+            run_device_kernel(device, params, q_d[device], r_d[device], x_d[device], data_d[device], device_ranges, QA_cost, real_type{ -1.0 }, dept, boundary_size);
+        }
+        device_reduction(r_d, residual, reduction_workspace);
+        matrix_vector_duration += std::chrono::steady_clock::now() - matrix_vector_start_time;
+    };
+
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "solver", control.solver }));
+
+    // if only a single device is used, keep the whole state of the classical CG algorithm resident on the device such that only scalars are copied back to the host in each iteration
+    // note: with multiple devices the partial kernel matrix-vector multiplications must be reduced on the host anyway
+    // note: the pipelined CG algorithm overlaps its host-side reduction with the device kernels and mixed precision needs the vectors in both precisions
+    const bool device_resident = num_used_devices == 1 && control.solver == solver_type::cg && !use_mixed_precision;
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "device_resident", device_resident }));
+
+    unsigned long long iter = checkpoint.has_value() ? checkpoint->iteration : 0;
+    // true if the iteration callback requested to stop the CG algorithm early
+    bool stop_requested = false;
+    // true if the CG algorithm reached the requested accuracy
+    bool converged = false;
 
     // timing for each CG iteration
     std::chrono::milliseconds average_iteration_time{};
@@ -562,84 +1134,350 @@ std::pair<std::vector<real_type>, real_type> gpu_csvm<device_ptr_t, queue_t>::so
         detail::log(verbosity_level::full | verbosity_level::timing,
                     "Done in {}.\n", iteration_duration);
         average_iteration_time += iteration_duration;
+
+        // invoke the user provided iteration callback, if present
+        if (control.iteration_callback) {
+            const iteration_info info{ iter + 1,
+                                       max_iter,
+                                       static_cast<double>(delta),
+                                       static_cast<double>(eps * eps * delta0),
+                                       std::chrono::duration_cast<std::chrono::milliseconds>(iteration_end_time - solver_start_time),
+                                       iteration_duration,
+                                       std::chrono::duration_cast<std::chrono::milliseconds>(matrix_vector_duration) };
+            stop_requested = !control.iteration_callback(info);
+        }
     };
 
-    unsigned long long iter = 0;
-    for (; iter < max_iter; ++iter) {
-        detail::log(verbosity_level::full | verbosity_level::timing,
-                    "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
-        iteration_start_time = std::chrono::steady_clock::now();
+    // the residual after the last explicit residual refinement
+    real_type delta_refined = delta;
+    // recalculate the residual using real_type as soon as the accumulated rounding errors of the iteratively updated residual are no longer negligible
+    // note: the rounding errors are dominated by the precision used in the kernel matrix-vector multiplications
+    // note: the pipelined CG algorithm must replace the residual repeatedly since its auxiliary recurrences additionally amplify the rounding errors
+    const real_type machine_epsilon = use_mixed_precision ? real_type{ std::numeric_limits<float>::epsilon() } : std::numeric_limits<real_type>::epsilon();
+    detail::residual_replacement<real_type> replacement{ machine_epsilon, std::sqrt(delta), control.solver == solver_type::pipelined_cg };
+    // the squared Euclidean norms of the current solution (xx = x^T * x) and search direction (dd = d^T * d)
+    real_type xx = transposed{ x } * x;
+    real_type dd = transposed{ d } * d;
+    // in mixed precision, the residual must additionally be refined as soon as the single precision iterations reduced it sufficiently
+    const auto residual_refresh_necessary = [&]() {
+        const real_type reduction = control.mixed_precision_refinement_reduction;
+        const bool replacement_necessary = replacement.update(std::sqrt(xx), std::sqrt(delta));
+        return replacement_necessary
+               || (use_mixed_precision && (delta <= eps * eps * delta0 || delta <= reduction * reduction * delta_refined));
+    };
 
-        // Ad = A * r (q = A * d)
-        #pragma omp parallel for default(none) shared(num_used_devices, devices_, Ad_d, r_d, q_d, data_d, feature_ranges, params) firstprivate(dept, QA_cost, boundary_size, num_features)
-        for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
-            Ad_d[device].memset(0);
-            r_d[device].memset(0, dept);
+    // write the current state of the CG algorithm to the checkpoint file (if requested) such that it can be resumed later on
+    const auto write_checkpoint = [&](const unsigned long long num_iterations) {
+        if (!control.checkpoint_file.empty() && control.write_checkpoints) {
+            detail::io::write_cg_checkpoint(control.checkpoint_file, detail::io::cg_checkpoint<real_type>{ params, control.solver, data_fingerprint, num_iterations, delta0, delta, delta_old, alpha_old, x, r, d });
+        }
+    };
 
-            run_device_kernel(device, params, q_d[device], Ad_d[device], r_d[device], data_d[device], feature_ranges, QA_cost, real_type{ 1.0 }, dept, boundary_size);
+    if (control.solver == solver_type::pipelined_cg) {
+        // pipelined CG algorithm (Ghysels and Vanroose): the dot products of one iteration are fused into a single reduction on the host
+        // that is overlapped with the kernel matrix-vector multiplication (Ad = A * w) for the next iteration running on the device(s)
+        // note: d is used as the search direction p
+        std::vector<real_type> w(dept);  // w = A * r
+        std::vector<real_type> s(dept);  // s = A * d
+        std::vector<real_type> z(dept);  // z = A * s
+        kernel_matrix_vector_multiplication(r, w);
+        if (iter > 0) {
+            // resumed from a checkpoint: restore the auxiliary vectors (s = A * d) and (z = A * s)
+            kernel_matrix_vector_multiplication(d, s);
+            kernel_matrix_vector_multiplication(s, z);
         }
-        // update Ad (q)
-        device_reduction(Ad_d, Ad);
+        // Ad = A * w for the first iteration
+        launch_kernel_matrix_vector_multiplication(w);
+        // (gamma = w^T * r)
+        real_type gamma = transposed{ w } * r;
+
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+            matrix_vector_duration = std::chrono::steady_clock::duration{};
+
+            // stop the CG iterations if the time budget has been exhausted or the cancellation has been requested
+            // note: already launched device kernels can't be interrupted, therefore, the stop condition is only checked between the kernel matrix-vector multiplications
+            if (control.stop_requested()) {
+                write_checkpoint(iter);
+                break;
+            }
+
+            // wait for Ad = A * w
+            gather_kernel_matrix_vector_multiplication(Ad);
+
+            // (beta = delta_new / delta_old) and (alpha = delta_new / (d^T * A * d)) using the recurrence d^T * A * d = gamma - beta * delta / alpha_old
+            const real_type beta = iter == 0 ? real_type{ 0.0 } : delta / delta_old;
+            const real_type alpha_cd = iter == 0 ? delta / gamma : delta / (gamma - beta * delta / alpha_old);
+
+            // z = Ad + beta * z, s = w + beta * s, d = r + beta * d
+            xpby(Ad, beta, z);
+            xpby(w, beta, s);
+            dd = xpby_dot(r, beta, d);
+            // estimate the kernel matrix norm using the Rayleigh quotient of the new search direction (d^T * A * d = delta / alpha)
+            replacement.update_matrix_norm(delta / alpha_cd, dd);
+            // (x = x + alpha * d) and (xx = x^T * x)
+            xx = axpy_dot(alpha_cd, d, x);
+            // r -= alpha_cd * s (r = r - alpha * A * d)
+            axpy(-alpha_cd, s, r);
+            // w -= alpha_cd * z (w = w - alpha * A * s)
+            axpy(-alpha_cd, z, w);
+
+            // Ad = A * w for the next iteration: runs on the device(s) while the dot products are calculated on the host
+            launch_kernel_matrix_vector_multiplication(w);
+
+            // (delta = r^T * r) and (gamma = w^T * r) in a single fused reduction
+            delta_old = delta;
+            alpha_old = alpha_cd;
+            delta = real_type{ 0.0 };
+            gamma = real_type{ 0.0 };
+            #pragma omp parallel for simd default(none) shared(r, w) firstprivate(dept) reduction(+ : delta, gamma)
+            for (typename std::vector<real_type>::size_type i = 0; i < dept; ++i) {
+                delta += r[i] * r[i];
+                gamma += w[i] * r[i];
+            }
 
-        // (alpha = delta_new / (d^T * q))
-        const real_type alpha_cd = delta / (transposed{ d } * Ad);
+            if (residual_refresh_necessary()) {
+                // discard the already launched kernel matrix-vector multiplication since w changes
+                gather_kernel_matrix_vector_multiplication(Ad);
+                // residual replacement: (r = b - A * x) and the auxiliary vectors (w = A * r), (s = A * d), and (z = A * s)
+                calculate_residual(r);
+                kernel_matrix_vector_multiplication(r, w);
+                kernel_matrix_vector_multiplication(d, s);
+                kernel_matrix_vector_multiplication(s, z);
+                launch_kernel_matrix_vector_multiplication(w);
+                delta = transposed{ r } * r;
+                gamma = transposed{ w } * r;
+                replacement.replaced(std::sqrt(xx), std::sqrt(delta));
+                delta_refined = delta;
+            }
+
+            // if we are exact enough stop CG iterations
+            if (delta <= eps * eps * delta0) {
+                converged = true;
+                output_iteration_duration();
+                break;
+            }
+
+            output_iteration_duration();
 
-        // (x = x + alpha * d)
-        x += alpha_cd * d;
+            // periodically (and if the CG algorithm is stopped early) write the current state of the CG algorithm to the checkpoint file
+            if (stop_requested || (iter + 1) % control.checkpoint_interval == 0) {
+                write_checkpoint(iter + 1);
+            }
 
-        #pragma omp parallel for default(none) shared(num_used_devices, devices_, x, x_d) firstprivate(dept)
+            // stop the CG iterations if requested by the iteration callback
+            if (stop_requested) {
+                break;
+            }
+        }
+        // wait for the last (speculatively) launched kernel matrix-vector multiplication
         for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
-            x_d[device].copy_to_device(x, 0, dept);
+            device_synchronize(devices_[device]);
+        }
+    } else if (device_resident) {
+        // the search direction d, the right-hand side b, and the partial sums of the dot products located on the device
+        // note: the padding values of d must be zero since it is used in the kernel matrix-vector multiplication
+        device_ptr_type<real_type> d_d{ dept + boundary_size, devices_[0] };
+        d_d.memset(0);
+        d_d.copy_to_device(d, 0, dept);
+        device_ptr_type<real_type> b_d{ dept + boundary_size, devices_[0] };
+        b_d.memset(0);
+        b_d.copy_to_device(b, 0, dept);
+        device_ptr_type<real_type> partial_sums_d{ static_cast<std::size_t>(thread_block_size_ * thread_block_size_), devices_[0] };
+        if (checkpoint.has_value()) {
+            // the device only contains b since the residual has been restored from the checkpoint
+            r_d[0].copy_to_device(r, 0, dept);
         }
 
-        if (iter % 50 == 49) {
-            #pragma omp parallel for default(none) shared(devices_, r_d, b, q_d, x_d, params, data_d, feature_ranges) firstprivate(QA_cost, dept)
-            for (typename std::vector<queue_type>::size_type device = 0; device < devices_.size(); ++device) {
-                if (device == 0) {
-                    // r = b
-                    r_d[device].copy_to_device(b, 0, dept);
-                } else {
-                    // set r to 0
-                    r_d[device].memset(0);
-                }
-                // r -= A * x
-                run_device_kernel(device, params, q_d[device], r_d[device], x_d[device], data_d[device], feature_ranges, QA_cost, real_type{ -1.0 }, dept, boundary_size);
+        // Ad = A * d (q = A * d)
+        const auto device_kernel_matrix_vector_multiplication = [&]() {
+            const std::chrono::steady_clock::time_point matrix_vector_start_time = std::chrono::steady_clock::now();
+            Ad_d[0].memset(0);
+            run_device_kernel(0, params, q_d[0], Ad_d[0], d_d, data_d[0], device_ranges, QA_cost, real_type{ 1.0 }, dept, boundary_size);
+            device_synchronize(devices_[0]);
+            matrix_vector_duration += std::chrono::steady_clock::now() - matrix_vector_start_time;
+        };
+        // r = b - A * x
+        const auto calculate_device_residual = [&]() {
+            const std::chrono::steady_clock::time_point matrix_vector_start_time = std::chrono::steady_clock::now();
+            r_d[0].memset(0);
+            device_axpy(0, real_type{ 1.0 }, b_d, r_d[0], dept);
+            run_device_kernel(0, params, q_d[0], r_d[0], x_d[0], data_d[0], device_ranges, QA_cost, real_type{ -1.0 }, dept, boundary_size);
+            device_synchronize(devices_[0]);
+            matrix_vector_duration += std::chrono::steady_clock::now() - matrix_vector_start_time;
+        };
+        // the vectors are only copied back to the host if a checkpoint must be written
+        const auto write_device_checkpoint = [&](const unsigned long long num_iterations) {
+            if (!control.checkpoint_file.empty() && control.write_checkpoints) {
+                device_synchronize(devices_[0]);
+                x_d[0].copy_to_host(x, 0, dept);
+                r_d[0].copy_to_host(r, 0, dept);
+                d_d.copy_to_host(d, 0, dept);
+                write_checkpoint(num_iterations);
+            }
+        };
+
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+            matrix_vector_duration = std::chrono::steady_clock::duration{};
+
+            // stop the CG iterations if the time budget has been exhausted or the cancellation has been requested
+            if (control.stop_requested()) {
+                write_device_checkpoint(iter);
+                break;
             }
 
-            device_reduction(r_d, r);
-        } else {
-            // r -= alpha_cd * Ad (r = r - alpha * q)
-            r -= alpha_cd * Ad;
-        }
+            // Ad = A * d (q = A * d)
+            device_kernel_matrix_vector_multiplication();
+
+            // (alpha = delta_new / (d^T * q))
+            const real_type dAd = device_dot(0, d_d, Ad_d[0], partial_sums_d, dept);
+            const real_type alpha_cd = delta / dAd;
+            // estimate the kernel matrix norm using the Rayleigh quotient of the current search direction
+            replacement.update_matrix_norm(dAd, dd);
+
+            // (x = x + alpha * d) and (xx = x^T * x)
+            device_axpy(0, alpha_cd, d_d, x_d[0], dept);
+            xx = device_dot(0, x_d[0], x_d[0], partial_sums_d, dept);
+
+            // r -= alpha_cd * Ad (r = r - alpha * q) and (delta = r^T * r)
+            device_axpy(0, -alpha_cd, Ad_d[0], r_d[0], dept);
+            delta_old = delta;
+            delta = device_dot(0, r_d[0], r_d[0], partial_sums_d, dept);
+
+            if (residual_refresh_necessary()) {
+                // (r = b - A * x) and (delta = r^T * r)
+                calculate_device_residual();
+                delta = device_dot(0, r_d[0], r_d[0], partial_sums_d, dept);
+                replacement.replaced(std::sqrt(xx), std::sqrt(delta));
+                delta_refined = delta;
+            }
+
+            // if we are exact enough stop CG iterations
+            if (delta <= eps * eps * delta0) {
+                converged = true;
+                output_iteration_duration();
+                break;
+            }
+
+            // (beta = delta_new / delta_old)
+            const real_type beta = delta / delta_old;
+            // d = beta * d + r and (dd = d^T * d)
+            device_xpby(0, r_d[0], beta, d_d, dept);
+            dd = device_dot(0, d_d, d_d, partial_sums_d, dept);
 
-        // (delta = r^T * r)
-        const real_type delta_old = delta;
-        delta = transposed{ r } * r;
-        // if we are exact enough stop CG iterations
-        if (delta <= eps * eps * delta0) {
             output_iteration_duration();
-            break;
-        }
 
-        // (beta = delta_new / delta_old)
-        const real_type beta = delta / delta_old;
-        // d = beta * d + r
-        d = beta * d + r;
+            // periodically (and if the CG algorithm is stopped early) write the current state of the CG algorithm to the checkpoint file
+            if (stop_requested || (iter + 1) % control.checkpoint_interval == 0) {
+                write_device_checkpoint(iter + 1);
+            }
 
-        // r_d = d
-        #pragma omp parallel for default(none) shared(num_used_devices, devices_, r_d, d) firstprivate(dept)
-        for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
-            r_d[device].copy_to_device(d, 0, dept);
+            // stop the CG iterations if requested by the iteration callback
+            if (stop_requested) {
+                break;
+            }
         }
+        // copy the solution back to the host
+        device_synchronize(devices_[0]);
+        x_d[0].copy_to_host(x, 0, dept);
+    } else {
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+            matrix_vector_duration = std::chrono::steady_clock::duration{};
+
+            // stop the CG iterations if the time budget has been exhausted or the cancellation has been requested
+            // note: already launched device kernels can't be interrupted, therefore, the stop condition is only checked between the kernel matrix-vector multiplications
+            if (control.stop_requested()) {
+                write_checkpoint(iter);
+                break;
+            }
 
-        output_iteration_duration();
+            // Ad = A * d (q = A * d)
+            kernel_matrix_vector_multiplication(d, Ad);
+
+            // (alpha = delta_new / (d^T * q))
+            const real_type dAd = transposed{ d } * Ad;
+            const real_type alpha_cd = delta / dAd;
+            // estimate the kernel matrix norm using the Rayleigh quotient of the current search direction
+            replacement.update_matrix_norm(dAd, dd);
+
+            // (x = x + alpha * d) and (xx = x^T * x)
+            xx = axpy_dot(alpha_cd, d, x);
+
+            // r -= alpha_cd * Ad (r = r - alpha * q) and (delta = r^T * r) in a single pass
+            delta_old = delta;
+            delta = axpy_dot(-alpha_cd, Ad, r);
+
+            bool restart = false;
+            if (residual_refresh_necessary()) {
+                // (r = b - A * x)
+                calculate_residual(r);
+                // (delta = r^T * r)
+                delta = transposed{ r } * r;
+                replacement.replaced(std::sqrt(xx), std::sqrt(delta));
+                // in mixed precision, restart the CG algorithm on the refined residual since the previous search directions are only conjugate with respect to the single precision matrix
+                restart = use_mixed_precision;
+                delta_refined = delta;
+            }
+
+            // if we are exact enough stop CG iterations
+            if (delta <= eps * eps * delta0) {
+                converged = true;
+                output_iteration_duration();
+                break;
+            }
+
+            if (restart) {
+                // d = r
+                d = r;
+                dd = delta;
+            } else {
+                // (beta = delta_new / delta_old)
+                const real_type beta = delta / delta_old;
+                // d = beta * d + r and (dd = d^T * d)
+                dd = xpby_dot(r, beta, d);
+            }
+
+            output_iteration_duration();
+
+            // periodically (and if the CG algorithm is stopped early) write the current state of the CG algorithm to the checkpoint file
+            if (stop_requested || (iter + 1) % control.checkpoint_interval == 0) {
+                write_checkpoint(iter + 1);
+            }
+
+            // stop the CG iterations if requested by the iteration callback
+            if (stop_requested) {
+                break;
+            }
+        }
+    }
+    // note: the iteration callback may also request to stop in the iteration in which the CG algorithm converged anyway
+    const bool stopped_by_callback = stop_requested && delta > eps * eps * delta0;
+    if (stopped_by_callback) {
+        detail::log(verbosity_level::full | verbosity_level::timing,
+                    "Stopped the CG algorithm early as requested by the iteration callback.\n");
+    }
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "stopped_by_callback", stopped_by_callback }));
+    if (!converged && control.stop_requested()) {
+        detail::log(verbosity_level::full | verbosity_level::timing,
+                    "Stopped the CG algorithm early since the time budget has been exhausted or the cancellation has been requested.\n");
     }
+    control.converged = converged;
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "converged", converged }));
     detail::log(verbosity_level::full | verbosity_level::timing,
-                "Finished after {}/{} iterations with a residuum of {} (target: {}) and an average iteration time of {}.\n",
+                "Finished after {}/{} iterations with a residuum of {} (target: {}), {} residual replacement(s), and an average iteration time of {}.\n",
                 detail::tracking_entry{ "cg", "iterations", std::min(iter + 1, max_iter) },
                 detail::tracking_entry{ "cg", "max_iterations", max_iter },
                 detail::tracking_entry{ "cg", "residuum", delta },
                 detail::tracking_entry{ "cg", "target_residuum", eps * eps * delta0 },
+                detail::tracking_entry{ "cg", "residual_replacements", replacement.num_replacements() },
                 detail::tracking_entry{ "cg", "avg_iteration_time", average_iteration_time / std::min(iter + 1, max_iter) });
     PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "epsilon", eps }));
     detail::log(verbosity_level::libsvm,
@@ -676,53 +1514,163 @@ std::vector<real_type> gpu_csvm<device_ptr_t, queue_t>::predict_values_impl(cons
     const std::size_t num_support_vectors = support_vectors.size();
     const std::size_t num_predict_points = predict_points.size();
     const std::size_t num_features = predict_points.front().size();
-    constexpr auto boundary_size = static_cast<std::size_t>(THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE);
+    const auto boundary_size = static_cast<std::size_t>(thread_block_size_ * internal_block_size_);
 
-    const std::size_t num_used_devices = this->select_num_used_devices(params.kernel_type, num_features);
+    // the prediction using the polynomial or rbf kernel is only performed on the first device
+    const std::size_t num_used_devices = params.kernel_type == kernel_function_type::linear ? this->select_num_used_devices(params.kernel_type, num_features) : 1;
 
-    auto [data_d, data_last_d, feature_ranges] = this->setup_data_on_device(support_vectors, num_support_vectors - 1, num_features, boundary_size, num_used_devices);
+    std::vector<real_type> out(num_predict_points, real_type{ 0.0 });
 
-    std::vector<device_ptr_type<real_type>> alpha_d(num_used_devices);
-    #pragma omp parallel for default(none) shared(num_used_devices, devices_, alpha_d, alpha) firstprivate(num_support_vectors)
+    // use faster methode in case of the linear kernel function
+    const auto predict_using_w = [&]() {
+        #pragma omp parallel for default(none) shared(out, predict_points, w) firstprivate(num_predict_points, rho)
+        for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < num_predict_points; ++i) {
+            out[i] = transposed<real_type>{ w } * predict_points[i] + -rho;
+        }
+    };
+    if (params.kernel_type == kernel_function_type::linear && !w.empty()) {
+        // the w vector has already been calculated, i.e., no device computations are necessary
+        predict_using_w();
+        return out;
+    }
+
+    // determine the memory that may be used on all used devices
+    std::size_t memory_budget = std::numeric_limits<std::size_t>::max();
     for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
-        alpha_d[device] = device_ptr_type<real_type>{ num_support_vectors + THREAD_BLOCK_SIZE, devices_[device] };
-        alpha_d[device].memset(0);
-        alpha_d[device].copy_to_device(alpha, 0, num_support_vectors);
+        memory_budget = std::min(memory_budget, this->available_device_memory(device));
     }
 
-    std::vector<real_type> out(predict_points.size());
+    // the linear kernel splits the features across the devices
+    const std::size_t num_features_per_device = params.kernel_type == kernel_function_type::linear ? (num_features + num_used_devices - 1) / num_used_devices : num_features;
+    // the padding of the data points, the last data point, and the alpha values (and the w vector for the linear kernel)
+    const std::size_t support_vector_fixed_bytes = (num_features_per_device * (boundary_size + 2) + boundary_size + thread_block_size_) * sizeof(real_type);
+    const std::size_t support_vector_bytes_per_point = (num_features_per_device + 1) * sizeof(real_type);
+    // the predict points and the result are double buffered, i.e., two chunks must fit into the device memory at the same time (not used for the linear kernel)
+    const std::size_t predict_point_fixed_bytes = 2 * (num_features + 1) * boundary_size * sizeof(real_type);
+    const std::size_t predict_point_bytes_per_point = (num_features + 1) * sizeof(real_type);
+    const std::size_t min_predict_point_bytes = params.kernel_type == kernel_function_type::linear ? 0 : predict_point_fixed_bytes + 2 * std::min<std::size_t>(num_predict_points, thread_block_size_) * predict_point_bytes_per_point;
+
+    // try to keep all support vectors on the device; otherwise use half of the available memory for the support vectors
+    std::size_t support_vector_chunk_size = calculate_chunk_size(memory_budget > min_predict_point_bytes ? memory_budget - min_predict_point_bytes : 0, support_vector_fixed_bytes, support_vector_bytes_per_point, 1, num_support_vectors, boundary_size);
+    if (support_vector_chunk_size < num_support_vectors && params.kernel_type != kernel_function_type::linear) {
+        support_vector_chunk_size = calculate_chunk_size(memory_budget / 2, support_vector_fixed_bytes, support_vector_bytes_per_point, 1, num_support_vectors, boundary_size);
+    }
+    // the remaining memory is used for the predict points
+    const std::size_t support_vector_bytes = support_vector_fixed_bytes + support_vector_chunk_size * support_vector_bytes_per_point;
+    const std::size_t predict_point_chunk_size = params.kernel_type == kernel_function_type::linear ? num_predict_points : calculate_chunk_size(memory_budget > support_vector_bytes ? memory_budget - support_vector_bytes : 0, predict_point_fixed_bytes, predict_point_bytes_per_point, 2, num_predict_points, thread_block_size_);
+
+    // each chunk must contain at least two support vectors (the last support vector of each chunk is handled separately)
+    // note: the chunks have nearly the same size, i.e., a chunk size of at least four guarantees at least two support vectors in each chunk
+    if ((support_vector_chunk_size < num_support_vectors && support_vector_chunk_size < 4) || support_vector_chunk_size < 2 || predict_point_chunk_size == 0) {
+        throw exception{ fmt::format("Not enough device memory to predict the {} data points using {} support vectors: only {} bytes are available!", num_predict_points, num_support_vectors, memory_budget) };
+    }
 
-    // use faster methode in case of the linear kernel function
-    if (params.kernel_type == kernel_function_type::linear && w.empty()) {
-        w = calculate_w(data_d, data_last_d, alpha_d, support_vectors.size(), feature_ranges);
+    const std::vector<std::size_t> support_vector_bounds = calculate_chunk_bounds(num_support_vectors, support_vector_chunk_size);
+    const std::vector<std::size_t> predict_point_bounds = calculate_chunk_bounds(num_predict_points, predict_point_chunk_size);
+    const std::size_t num_support_vector_chunks = support_vector_bounds.size() - 1;
+    const std::size_t num_predict_point_chunks = predict_point_bounds.size() - 1;
+    if (num_support_vector_chunks > 1 || num_predict_point_chunks > 1) {
+        detail::log(verbosity_level::full,
+                    "Split the {} support vectors into {} chunk(s) and the {} data points to predict into {} chunk(s) to fit into {} bytes of device memory.\n",
+                    num_support_vectors,
+                    detail::tracking_entry{ "predict", "num_support_vector_chunks", num_support_vector_chunks },
+                    num_predict_points,
+                    detail::tracking_entry{ "predict", "num_predict_point_chunks", num_predict_point_chunks },
+                    detail::tracking_entry{ "predict", "device_memory_budget", memory_budget });
     }
 
-    if (params.kernel_type == kernel_function_type::linear) {
-        // use faster methode in case of the linear kernel function
-        #pragma omp parallel for default(none) shared(out, predict_points, w) firstprivate(num_predict_points, rho)
-        for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < num_predict_points; ++i) {
-            out[i] = transposed<real_type>{ w } * predict_points[i] + -rho;
+    // the buffers for the predict points and results used for double buffering (only used for the polynomial and rbf kernel)
+    std::array<device_ptr_type<real_type>, 2> point_d{};
+    std::array<device_ptr_type<real_type>, 2> out_d{};
+    if (params.kernel_type != kernel_function_type::linear) {
+        for (std::size_t buffer = 0; buffer < std::min<std::size_t>(num_predict_point_chunks, 2); ++buffer) {
+            point_d[buffer] = device_ptr_type<real_type>{ num_features * (predict_point_chunk_size + boundary_size), devices_[0] };
+            out_d[buffer] = device_ptr_type<real_type>{ predict_point_chunk_size + boundary_size, devices_[0] };
         }
-    } else {
-        // create result vector on the device
-        device_ptr_type<real_type> out_d{ num_predict_points + boundary_size, devices_[0] };
-        out_d.memset(0);
+    }
+    // the host staging buffers of the transformed predict points; must outlive the asynchronous copies to the respective device buffer
+    std::array<std::vector<real_type>, 2> transformed_chunk{};
+    std::vector<real_type> out_chunk(params.kernel_type == kernel_function_type::linear ? 0 : predict_point_chunk_size);
+
+    // transform the predict points of the chunk to SoA and copy them asynchronously to the respective buffer on the device
+    const auto copy_predict_point_chunk_to_device = [&](const std::size_t chunk) {
+        const std::size_t first_point = predict_point_bounds[chunk];
+        const std::size_t num_points_in_chunk = predict_point_bounds[chunk + 1] - first_point;
+        std::vector<real_type> &staging = transformed_chunk[chunk % 2];
+
+        // the padding values must be zero
+        staging.assign(num_features * (num_points_in_chunk + boundary_size), real_type{ 0.0 });
+        #pragma omp parallel for collapse(2) default(none) shared(staging, predict_points) firstprivate(num_features, num_points_in_chunk, first_point, boundary_size)
+        for (std::size_t feature = 0; feature < num_features; ++feature) {
+            for (std::size_t point = 0; point < num_points_in_chunk; ++point) {
+                staging[feature * (num_points_in_chunk + boundary_size) + point] = predict_points[first_point + point][feature];
+            }
+        }
+        point_d[chunk % 2].copy_to_device_async(staging, 0, staging.size());
+    };
+
+    for (std::size_t sv_chunk = 0; sv_chunk < num_support_vector_chunks; ++sv_chunk) {
+        const std::size_t first_support_vector = support_vector_bounds[sv_chunk];
+        const std::size_t num_support_vectors_in_chunk = support_vector_bounds[sv_chunk + 1] - first_support_vector;
 
-        // transform prediction data
-        const std::vector<real_type> transformed_data = detail::transform_to_layout(detail::layout_type::soa, predict_points, boundary_size, predict_points.size());
-        device_ptr_type<real_type> point_d{ num_features * (num_predict_points + boundary_size), devices_[0] };
-        point_d.memset(0);
-        point_d.copy_to_device(transformed_data, 0, transformed_data.size());
+        // only copy the support vectors on the host if they must be split into multiple chunks
+        std::vector<std::vector<real_type>> support_vector_chunk{};
+        if (num_support_vector_chunks > 1) {
+            support_vector_chunk.assign(support_vectors.cbegin() + first_support_vector, support_vectors.cbegin() + first_support_vector + num_support_vectors_in_chunk);
+        }
+        const std::vector<std::vector<real_type>> &support_vectors_in_chunk = num_support_vector_chunks > 1 ? support_vector_chunk : support_vectors;
+
+        auto [data_d, data_last_d, feature_ranges] = this->setup_data_on_device(support_vectors_in_chunk, num_support_vectors_in_chunk - 1, num_features, boundary_size, num_used_devices, params.kernel_type);
 
-        const detail::execution_range range({ static_cast<std::size_t>(std::ceil(static_cast<real_type>(num_support_vectors) / static_cast<real_type>(THREAD_BLOCK_SIZE))),
-                                              static_cast<std::size_t>(std::ceil(static_cast<real_type>(num_predict_points) / static_cast<real_type>(THREAD_BLOCK_SIZE))) },
-                                            { std::min<std::size_t>(THREAD_BLOCK_SIZE, num_support_vectors), std::min<std::size_t>(THREAD_BLOCK_SIZE, num_predict_points) });
+        std::vector<device_ptr_type<real_type>> alpha_d(num_used_devices);
+        #pragma omp parallel for default(none) shared(num_used_devices, devices_, alpha_d, alpha) firstprivate(num_support_vectors_in_chunk, first_support_vector)
+        for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
+            alpha_d[device] = device_ptr_type<real_type>{ num_support_vectors_in_chunk + thread_block_size_, devices_[device] };
+            alpha_d[device].memset(0);
+            alpha_d[device].copy_to_device(alpha.data() + first_support_vector, 0, num_support_vectors_in_chunk);
+        }
 
-        // perform prediction on the first device
-        run_predict_kernel(range, params, out_d, alpha_d[0], point_d, data_d[0], data_last_d[0], num_support_vectors, num_predict_points, num_features);
+        if (params.kernel_type == kernel_function_type::linear) {
+            // use faster methode in case of the linear kernel function: w is the sum of the w vectors of all chunks
+            const std::vector<real_type> w_chunk = calculate_w(data_d, data_last_d, alpha_d, num_support_vectors_in_chunk, feature_ranges);
+            if (w.empty()) {
+                w = w_chunk;
+            } else {
+                w += w_chunk;
+            }
+        } else {
+            // double buffering: copy the next chunk of predict points to the device while the current chunk is processed
+            copy_predict_point_chunk_to_device(0);
+            for (std::size_t chunk = 0; chunk < num_predict_point_chunks; ++chunk) {
+                const std::size_t first_point = predict_point_bounds[chunk];
+                const std::size_t num_points_in_chunk = predict_point_bounds[chunk + 1] - first_point;
+                const std::size_t buffer = chunk % 2;
+
+                out_d[buffer].memset(0);
+
+                const detail::execution_range range({ static_cast<std::size_t>(std::ceil(static_cast<real_type>(num_support_vectors_in_chunk) / static_cast<real_type>(thread_block_size_))),
+                                                      static_cast<std::size_t>(std::ceil(static_cast<real_type>(num_points_in_chunk) / static_cast<real_type>(thread_block_size_))) },
+                                                    { std::min<std::size_t>(thread_block_size_, num_support_vectors_in_chunk), std::min<std::size_t>(thread_block_size_, num_points_in_chunk) });
+
+                // perform prediction on the first device
+                point_d[buffer].wait_for_async_copies();
+                run_predict_kernel(range, params, out_d[buffer], alpha_d[0], point_d[buffer], data_d[0], data_last_d[0], num_support_vectors_in_chunk, num_points_in_chunk, num_features);
+
+                // the other buffer isn't used by any running kernel
+                if (chunk + 1 < num_predict_point_chunks) {
+                    copy_predict_point_chunk_to_device(chunk + 1);
+                }
 
-        out_d.copy_to_host(out, 0, num_predict_points);
+                device_synchronize(devices_[0]);
+                out_d[buffer].copy_to_host(out_chunk, 0, num_points_in_chunk);
+                std::transform(out_chunk.cbegin(), out_chunk.cbegin() + num_points_in_chunk, out.cbegin() + first_point, out.begin() + first_point, std::plus<>{});
+            }
+        }
+    }
 
+    if (params.kernel_type == kernel_function_type::linear) {
+        predict_using_w();
+    } else {
         // add bias_ to all predictions
         out += -rho;
     }
@@ -229,6 +229,49 @@ class gpu_device_ptr {
      */
     virtual void copy_to_host(host_pointer_type buffer, size_type pos, size_type count) const = 0;
 
+    /**
+     * @brief Asynchronously copy device_ptr::size() many values from @p data_to_copy to the device.
+     * @details The copy is enqueued in a separate transfer queue of the device such that it can overlap with running device kernels.
+     *          @p data_to_copy must neither be changed nor destroyed until all asynchronous copies have been finished.
+     * @param[in] data_to_copy the data to copy onto the device
+     * @throws plssvm::gpu_device_ptr_exception if @p data_to_copy is too small to satisfy the copy
+     */
+    void copy_to_device_async(const std::vector<value_type> &data_to_copy);
+    /**
+     * @brief Asynchronously copy up-to @p count many values from @p data_to_copy to the device starting at device pointer position @p pos.
+     * @details Copies `[pos, rcount)` values where `rcount` is the smaller value of @p count and `device_ptr::size() - pos`.
+     *          The copy is enqueued in a separate transfer queue of the device such that it can overlap with running device kernels.
+     *          @p data_to_copy must neither be changed nor destroyed until all asynchronous copies have been finished.
+     * @param[in] data_to_copy the data to copy onto the device
+     * @param[in] pos the starting position for the copying in the device pointer
+     * @param[in] count the number of elements to copy
+     * @throws plssvm::gpu_device_ptr_exception if @p data_to_copy is too small to satisfy the copy
+     */
+    void copy_to_device_async(const std::vector<value_type> &data_to_copy, size_type pos, size_type count);
+    /**
+     * @brief Asynchronously copy device_ptr::size() many values from @p data_to_copy to the device.
+     * @details The copy is enqueued in a separate transfer queue of the device such that it can overlap with running device kernels.
+     *          @p data_to_copy must neither be changed nor destroyed until all asynchronous copies have been finished.
+     * @param[in] data_to_copy the data to copy onto the device
+     */
+    void copy_to_device_async(const_host_pointer_type data_to_copy);
+    /**
+     * @brief Asynchronously copy up-to @p count many values from @p data_to_copy to the device starting at device pointer position @p pos.
+     * @details Copies `[pos, rcount)` values where `rcount` is the smaller value of @p count and `device_ptr::size() - pos`.
+     *          The copy is enqueued in a separate transfer queue of the device such that it can overlap with running device kernels.
+     *          @p data_to_copy must neither be changed nor destroyed until all asynchronous copies have been finished.
+     * @param[in] data_to_copy the data to copy onto the device
+     * @param[in] pos the starting position for the copying in the device pointer
+     * @param[in] count the number of elements to copy
+     */
+    virtual void copy_to_device_async(const_host_pointer_type data_to_copy, size_type pos, size_type count) = 0;
+    /**
+     * @brief Wait until all asynchronous copies to this device_ptr have been finished.
+     * @details Must be called before a device kernel uses the memory of this device_ptr.
+     *          All other member functions (and the destructor) implicitly wait for the pending asynchronous copies.
+     */
+    virtual void wait_for_async_copies() const = 0;
+
   protected:
     /// The device queue used to manage the device memory associated with this device pointer.
     queue_type queue_{};
@@ -0,0 +1,45 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a token used to cooperatively cancel a running `plssvm::csvm::fit` call.
+ */
+
+#ifndef PLSSVM_CANCELLATION_TOKEN_HPP_
+#define PLSSVM_CANCELLATION_TOKEN_HPP_
+#pragma once
+
+#include <atomic>  // std::atomic
+#include <memory>  // std::shared_ptr, std::make_shared
+
+namespace plssvm {
+
+/**
+ * @brief A token used to cooperatively cancel the CG algorithm of a running `plssvm::csvm::fit` call, e.g., from another thread.
+ * @details All copies of a token share the same state, i.e., cancelling one copy cancels all copies.
+ *          The CG algorithm checks the token between its iterations and, if supported by the backend, inside the kernel matrix-vector multiplications.
+ */
+class cancellation_token {
+  public:
+    /**
+     * @brief Request the cancellation of all CG algorithms using this token. Thread-safe.
+     */
+    void cancel() noexcept { cancelled_->store(true, std::memory_order_relaxed); }
+    /**
+     * @brief Check whether the cancellation has been requested. Thread-safe.
+     * @return `true` if `cancel()` has been called on any copy of this token, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool is_cancelled() const noexcept { return cancelled_->load(std::memory_order_relaxed); }
+
+  private:
+    /// The cancellation state shared between all copies of this token.
+    std::shared_ptr<std::atomic<bool>> cancelled_{ std::make_shared<std::atomic<bool>>(false) };
+};
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_CANCELLATION_TOKEN_HPP_
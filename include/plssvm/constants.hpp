@@ -13,6 +13,8 @@
 #define PLSSVM_CONSTANTS_HPP_
 #pragma once
 
+#include <cstddef>  // std::size_t
+
 namespace plssvm {
 
 /// Integer type used inside kernels.
@@ -39,10 +41,18 @@ constexpr kernel_index_type OPENMP_BLOCK_SIZE = PLSSVM_OPENMP_BLOCK_SIZE;
 constexpr kernel_index_type OPENMP_BLOCK_SIZE = 64;
 #endif
 
+/// Global compile-time constant denoting the number of bytes transformed and asynchronously copied to the device(s) at once. May be changed during the CMake configuration step.
+#if defined(PLSSVM_TRANSFER_BLOCK_SIZE)
+constexpr std::size_t TRANSFER_BLOCK_SIZE = PLSSVM_TRANSFER_BLOCK_SIZE;
+#else
+constexpr std::size_t TRANSFER_BLOCK_SIZE = 16777216;
+#endif
+
 // perform sanity checks
 static_assert(THREAD_BLOCK_SIZE > 0, "THREAD_BLOCK_SIZE must be greater than 0!");
 static_assert(INTERNAL_BLOCK_SIZE > 0, "INTERNAL_BLOCK_SIZE must be greater than 0!");
 static_assert(OPENMP_BLOCK_SIZE > 0, "OPENMP_BLOCK_SIZE must be greater than 0!");
+static_assert(TRANSFER_BLOCK_SIZE > 0, "TRANSFER_BLOCK_SIZE must be greater than 0!");
 
 }  // namespace plssvm
 
@@ -21,9 +21,13 @@
 
 #include "plssvm/data_set.hpp"                              // a data set used for training a C-SVM
 #include "plssvm/model.hpp"                                 // the model as a result of training a C-SVM
+#include "plssvm/cross_validation_result.hpp"               // the results of a k-fold cross-validation
+#include "plssvm/iteration_info.hpp"                        // the information passed to a callback after each CG iteration
+#include "plssvm/cancellation_token.hpp"                    // a token to cooperatively cancel a running fit
 
 #include "plssvm/backend_types.hpp"                         // all supported backend types
 #include "plssvm/kernel_function_types.hpp"                 // all supported kernel function types
+#include "plssvm/solver_types.hpp"                          // all supported algorithms to solve the system of linear equations
 #include "plssvm/target_platforms.hpp"                      // all supported target platforms
 
 #include "plssvm/backends/SYCL/implementation_type.hpp"     // the SYCL implementation type
@@ -0,0 +1,62 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a struct encapsulating the results of a k-fold cross-validation.
+ */
+
+#ifndef PLSSVM_CROSS_VALIDATION_RESULT_HPP_
+#define PLSSVM_CROSS_VALIDATION_RESULT_HPP_
+#pragma once
+
+#include <chrono>       // std::chrono::milliseconds
+#include <cstddef>      // std::size_t
+#include <numeric>      // std::accumulate
+#include <type_traits>  // std::is_same_v
+#include <vector>       // std::vector
+
+namespace plssvm {
+
+/**
+ * @brief The per-fold results of a k-fold cross-validation performed using `plssvm::csvm::cross_validate`.
+ * @tparam T the type of the data
+ */
+template <typename T>
+struct cross_validation_result {
+    // make sure only valid template types are used
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "The template type can only be 'float' or 'double'!");
+
+    /// The type of the data. Must be either `float` or `double`.
+    using real_type = T;
+
+    /// The accuracy achieved on the validation data points of each fold.
+    std::vector<real_type> accuracies{};
+    /// The time needed to learn the model on the training data points of each fold.
+    std::vector<std::chrono::milliseconds> fit_times{};
+    /// The time needed to predict the validation data points of each fold.
+    std::vector<std::chrono::milliseconds> predict_times{};
+
+    /**
+     * @brief Return the number of folds used in the cross-validation.
+     * @return the number of folds (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::size_t num_folds() const noexcept { return accuracies.size(); }
+    /**
+     * @brief Return the mean accuracy over all folds.
+     * @return the mean accuracy; `0.0` if no fold is present (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type mean_accuracy() const {
+        if (accuracies.empty()) {
+            return real_type{ 0.0 };
+        }
+        return std::accumulate(accuracies.cbegin(), accuracies.cend(), real_type{ 0.0 }) / static_cast<real_type>(accuracies.size());
+    }
+};
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_CROSS_VALIDATION_RESULT_HPP_
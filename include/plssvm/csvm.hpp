@@ -13,27 +13,37 @@
 #define PLSSVM_CSVM_HPP_
 #pragma once
 
+#include "plssvm/cancellation_token.hpp"          // plssvm::cancellation_token
+#include "plssvm/cross_validation_result.hpp"     // plssvm::cross_validation_result
 #include "plssvm/data_set.hpp"                    // plssvm::data_set
 #include "plssvm/default_value.hpp"               // plssvm::default_value, plssvm::default_init
+#include "plssvm/detail/ball_tree.hpp"            // plssvm::detail::ball_tree
 #include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
 #include "plssvm/detail/operators.hpp"            // plssvm::operators::sign
 #include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::performance_tracker
+#include "plssvm/detail/solver_control.hpp"       // plssvm::detail::solver_control
 #include "plssvm/detail/type_traits.hpp"          // PLSSVM_REQUIRES, plssvm::detail::remove_cvref_t
 #include "plssvm/detail/utility.hpp"              // plssvm::detail::to_underlying
 #include "plssvm/exceptions/exceptions.hpp"       // plssvm::invalid_parameter_exception
+#include "plssvm/iteration_info.hpp"              // plssvm::iteration_callback_type
 #include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type
 #include "plssvm/model.hpp"                       // plssvm::model
 #include "plssvm/parameter.hpp"                   // plssvm::parameter, plssvm::detail::{get_value_from_named_parameter, has_only_parameter_named_args_v}
+#include "plssvm/solver_types.hpp"                // plssvm::solver_type
 #include "plssvm/target_platforms.hpp"            // plssvm::target_platform
 
 #include "fmt/core.h"                             // fmt::format
 #include "igor/igor.hpp"                          // igor::parser
 
-#include <chrono>                                 // std::chrono::{time_point, steady_clock, duration_cast}
+#include <algorithm>                              // std::max
+#include <chrono>                                 // std::chrono::{time_point, steady_clock, duration_cast, milliseconds}
+#include <cstddef>                                // std::size_t
 #include <iostream>                               // std::cout, std::endl
+#include <random>                                 // std::mt19937, std::bernoulli_distribution
+#include <string>                                 // std::string
 #include <tuple>                                  // std::tie
 #include <type_traits>                            // std::enable_if_t, std::is_same_v, std::is_convertible_v, std::false_type
-#include <utility>                                // std::pair, std::forward
+#include <utility>                                // std::pair, std::make_pair, std::forward
 #include <vector>                                 // std::vector
 
 namespace plssvm {
@@ -119,31 +129,101 @@ class csvm {
      * @tparam label_type the type of the label (an arithmetic type or `std::string`)
      * @tparam Args the type of the potential additional parameters
      * @param[in] data the data used to train the SVM model
-     * @param[in] named_args the potential additional parameters (`epsilon` and/or `max_iter`)
+     * @param[in] named_args the potential additional parameters (`epsilon`, `max_iter`, `mixed_precision`, `solver`, `iteration_callback`, `time_budget`, `cancellation`, `checkpoint_file`, `checkpoint_interval`, `resume`, and/or `rbf_tolerance`)
      * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is greater or equal than zero
      * @throws plssvm::invlaid_parameter_exception if the provided maximum number of iterations is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided `time_budget` is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided `checkpoint_interval` is zero
+     * @throws plssvm::invalid_parameter_exception if `resume` is requested without providing a `checkpoint_file`
+     * @throws plssvm::invalid_parameter_exception if the provided `rbf_tolerance` is less than zero
      * @throws plssvm::invalid_parameter_exception if the training @p data does **not** include labels
      * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::solve_system_of_linear_equations`
-     * @return the learned model (`[[nodiscard]]`)
+     * @return the learned model; if the CG algorithm has been stopped early due to the `time_budget` or `cancellation`, it contains the last iterate and isn't flagged as converged (`[[nodiscard]]`)
      */
     template <typename real_type, typename label_type, typename... Args>
     [[nodiscard]] model<real_type, label_type> fit(const data_set<real_type, label_type> &data, Args &&...named_args) const;
+    /**
+     * @brief Update the previously learned @p model by appending the @p new_data points and refitting the extended data set.
+     * @details The SVM parameters used to learn the @p model are reused. The CG algorithm is warm started using the already learned weights of the @p model,
+     *          the weights of the @p new_data points are initialized with zero. Therefore, if only a few new data points are added, the number of necessary
+     *          CG iterations is drastically reduced compared to a new call to `plssvm::csvm::fit` on the extended data set.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] model the previously learned model to update
+     * @param[in] new_data the new data points used to update the model
+     * @param[in] named_args the potential additional parameters (`epsilon`, `max_iter`, `mixed_precision`, `solver`, `iteration_callback`, `time_budget`, `cancellation`, `checkpoint_file`, `checkpoint_interval`, `resume`, and/or `rbf_tolerance`)
+     * @throws plssvm::invalid_parameter_exception if the @p new_data does **not** include labels
+     * @throws plssvm::invalid_parameter_exception if the number of features in the @p model's support vectors don't match the number of features in the @p new_data set
+     * @throws plssvm::data_set_exception if the @p new_data introduces labels not present in the @p model
+     * @throws plssvm::exception all exceptions thrown by `plssvm::csvm::fit`
+     * @return the updated model learned on the support vectors of @p model and the @p new_data (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args>
+    [[nodiscard]] model<real_type, label_type> update(const model<real_type, label_type> &model, const data_set<real_type, label_type> &new_data, Args &&...named_args) const;
+    /**
+     * @brief Perform a @p num_folds-fold cross-validation on the @p data using the current SVM.
+     * @details The data set is held only once and the folds are represented as index views on it: the i-th data point is assigned to the fold `i % num_folds`.
+     *          Each fold is used once for validation while the model is learned on all remaining data points.
+     *          Since the training sets of the different folds largely overlap, the CG algorithm of each fold is warm started using the weights learned in the
+     *          previous folds for the respective data points.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] data the labeled data used to cross-validate the SVM
+     * @param[in] num_folds the number of folds
+     * @param[in] named_args the potential additional parameters (`epsilon`, `max_iter`, `mixed_precision`, `solver`, `iteration_callback`, `time_budget`, `cancellation`, `checkpoint_file`, `checkpoint_interval`, `resume`, and/or `rbf_tolerance`)
+     * @throws plssvm::invalid_parameter_exception if the @p data does **not** include labels
+     * @throws plssvm::invalid_parameter_exception if @p num_folds is less than two or greater than the number of data points
+     * @throws plssvm::data_set_exception if the training data points of any fold don't contain exactly two different labels
+     * @throws plssvm::exception all exceptions thrown by `plssvm::csvm::fit` and `plssvm::csvm::predict`
+     * @return the accuracies and runtimes of all folds (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args>
+    [[nodiscard]] cross_validation_result<real_type> cross_validate(const data_set<real_type, label_type> &data, std::size_t num_folds, Args &&...named_args) const;
+    /**
+     * @brief Estimate the leave-one-out (LOO) error of the previously learned @p model without retraining the model once for each data point.
+     * @details For LS-SVMs, the LOO residual of the i-th data point is given in closed form by \f$\frac{\alpha_i}{(H^{-1})_{ii}}\f$, where \f$H\f$ is the
+     *          matrix of the full system of linear equations. The diagonal of \f$H^{-1}\f$ is approximated using Hutchinson's stochastic diagonal estimator,
+     *          i.e., @p num_probes systems of linear equations with Rademacher distributed right-hand sides are solved using the backend's CG algorithm.
+     *          The random probe vectors are generated using a fixed seed, i.e., the estimate is reproducible.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] model a previously learned model
+     * @param[in] num_probes the number of probe vectors used to estimate the diagonal of \f$H^{-1}\f$; more probes increase the accuracy of the estimate
+     * @param[in] named_args the potential additional parameters (`epsilon` and/or `max_iter`) used in the CG algorithm of each probe
+     * @throws plssvm::invalid_parameter_exception if @p num_probes is zero
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is greater or equal than zero
+     * @throws plssvm::invlaid_parameter_exception if the provided maximum number of iterations is less or equal than zero
+     * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::solve_system_of_linear_equations`
+     * @return the estimated LOO error, i.e., the fraction of data points that would have been misclassified if they were left out during training (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args>
+    [[nodiscard]] real_type estimate_loo_error(const model<real_type, label_type> &model, std::size_t num_probes = 10, Args &&...named_args) const;
 
     //*************************************************************************************************************************************//
     //                                                          predict and score                                                          //
     //*************************************************************************************************************************************//
     /**
      * @brief Predict the labels for the @p data set using the @p model.
+     * @details If a `rbf_tolerance` is provided and the @p model has been learned using the rbf kernel function, the predicted values are approximated
+     *          on the host using a ball tree over the support vectors: support vectors whose summed up contribution is provably less than the tolerance are skipped.
+     *          The ball tree is built on first use and reused by all subsequent predictions using the same @p model. The maximum error bound of all
+     *          predicted values is reported. The pruning is only effective for data sets with few features (roughly less than 20).
      * @tparam real_type the type of the data (`float` or `double`)
      * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
      * @param[in] model a previously learned model
      * @param[in] data the data to predict the labels for
+     * @param[in] named_args the potential additional parameters (`rbf_tolerance`)
      * @throws plssvm::invalid_parameter_exception if the number of features in the @p model's support vectors don't match the number of features in the @p data set
+     * @throws plssvm::invalid_parameter_exception if the provided `rbf_tolerance` is less than zero
      * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::predict_values`
      * @return the predicted labels (`[[nodiscard]]`)
      */
-    template <typename real_type, typename label_type>
-    [[nodiscard]] std::vector<label_type> predict(const model<real_type, label_type> &model, const data_set<real_type, label_type> &data) const;
+    template <typename real_type, typename label_type, typename... Args>
+    [[nodiscard]] std::vector<label_type> predict(const model<real_type, label_type> &model, const data_set<real_type, label_type> &data, Args &&...named_args) const;
 
     /**
      * @brief Calculate the accuracy of the @p model.
@@ -182,14 +262,15 @@ class csvm {
      * @param[in] b the right-hand side of the equation \f$Ax = b\f$
      * @param[in] eps the error tolerance
      * @param[in] max_iter the maximum number of CG iterations
+     * @param[in] control additional information used to control the CG algorithm (e.g., an initial guess to warm start the CG algorithm)
      * @throws plssvm::exception any exception thrown by the backend's implementation
      * @return a pair of [the result vector x, the resulting bias] (`[[nodiscard]]`)
      */
-    [[nodiscard]] virtual std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter) const = 0;
+    [[nodiscard]] virtual std::pair<std::vector<float>, float> solve_system_of_linear_equations(const detail::parameter<float> &params, const std::vector<std::vector<float>> &A, std::vector<float> b, float eps, unsigned long long max_iter, const detail::solver_control<float> &control) const = 0;
     /**
      * @copydoc plssvm::csvm::solve_system_of_linear_equations
      */
-    [[nodiscard]] virtual std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter) const = 0;
+    [[nodiscard]] virtual std::pair<std::vector<double>, double> solve_system_of_linear_equations(const detail::parameter<double> &params, const std::vector<std::vector<double>> &A, std::vector<double> b, double eps, unsigned long long max_iter, const detail::solver_control<double> &control) const = 0;
     /**
      * @brief Uses the already learned model to predict the class of multiple (new) data points.
      * @param[in] params the SVM parameters used in the respective kernel functions
@@ -207,9 +288,52 @@ class csvm {
      */
     [[nodiscard]] virtual std::vector<double> predict_values(const detail::parameter<double> &params, const std::vector<std::vector<double>> &support_vectors, const std::vector<double> &alpha, double rho, std::vector<double> &w, const std::vector<std::vector<double>> &predict_points) const = 0;
 
+    /**
+     * @brief Parse the named parameters in @p named_args controlling the CG algorithm and store them in @p control.
+     * @details Named parameters not controlling the CG algorithm are ignored, i.e., must be checked by the caller.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in,out] control additional information used to control the CG algorithm
+     * @param[in] default_max_iter the maximum number of CG iterations used if `max_iter` isn't provided
+     * @param[in] named_args the potential additional parameters (`epsilon`, `max_iter`, `mixed_precision`, `solver`, `iteration_callback`, `time_budget`, `cancellation`, `checkpoint_file`, `checkpoint_interval`, `resume`, and/or `rbf_tolerance`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is greater or equal than zero
+     * @throws plssvm::invlaid_parameter_exception if the provided maximum number of iterations is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided `time_budget` is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided `checkpoint_interval` is zero
+     * @throws plssvm::invalid_parameter_exception if `resume` is requested without providing a `checkpoint_file`
+     * @throws plssvm::invalid_parameter_exception if the provided `rbf_tolerance` is less than zero
+     * @throws plssvm::invalid_parameter_exception if mixed precision is requested in combination with the pipelined CG algorithm
+     * @return a pair of [the error tolerance, the maximum number of CG iterations] (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename... Args>
+    [[nodiscard]] static std::pair<real_type, unsigned long long> parse_solver_named_args(detail::solver_control<real_type> &control, unsigned long long default_max_iter, Args &&...named_args);
+
     /// The target platform of this SVM.
     target_platform target_{ plssvm::target_platform::automatic };
   private:
+    /**
+     * @brief Fit a model using the SVM parameter @p params on the @p data using the additional CG information @p control.
+     * @details Implements the common functionality of `plssvm::csvm::fit` and `plssvm::csvm::update`.
+     * @tparam real_type the type of the data (`float` or `double`)
+     * @tparam label_type the type of the label (an arithmetic type or `std::string`)
+     * @tparam Args the type of the potential additional parameters
+     * @param[in] params the SVM parameter used to learn the model
+     * @param[in] data the data used to train the SVM model
+     * @param[in] control additional information used to control the CG algorithm
+     * @param[in] named_args the potential additional parameters (`epsilon`, `max_iter`, `mixed_precision`, `solver`, `iteration_callback`, `time_budget`, `cancellation`, `checkpoint_file`, `checkpoint_interval`, `resume`, and/or `rbf_tolerance`)
+     * @throws plssvm::invalid_parameter_exception if the provided value for `epsilon` is greater or equal than zero
+     * @throws plssvm::invlaid_parameter_exception if the provided maximum number of iterations is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided `time_budget` is less or equal than zero
+     * @throws plssvm::invalid_parameter_exception if the provided `checkpoint_interval` is zero
+     * @throws plssvm::invalid_parameter_exception if `resume` is requested without providing a `checkpoint_file`
+     * @throws plssvm::invalid_parameter_exception if the provided `rbf_tolerance` is less than zero
+     * @throws plssvm::invalid_parameter_exception if the training @p data does **not** include labels
+     * @throws plssvm::exception any exception thrown in the respective backend's implementation of `plssvm::csvm::solve_system_of_linear_equations`
+     * @return the learned model; if the CG algorithm has been stopped early due to the `time_budget` or `cancellation`, it contains the last iterate and isn't flagged as converged (`[[nodiscard]]`)
+     */
+    template <typename real_type, typename label_type, typename... Args>
+    [[nodiscard]] model<real_type, label_type> fit_impl(parameter params, const data_set<real_type, label_type> &data, detail::solver_control<real_type> control, Args &&...named_args) const;
+
     /**
      * @brief Perform some sanity checks on the passed SVM parameters.
      * @throws plssvm::invalid_parameter_exception if the kernel function is invalid
@@ -262,11 +386,143 @@ void csvm::set_params(Args &&...named_args) {
 
 template <typename real_type, typename label_type, typename... Args>
 model<real_type, label_type> csvm::fit(const data_set<real_type, label_type> &data, Args &&...named_args) const {
+    // no additional information (e.g., an initial guess) provided for the CG algorithm
+    // note: the data points of a data set never change, i.e., the backends may reuse the data points already copied to the device(s) in a previous fit using the same data set (or a copy of it)
+    detail::solver_control<real_type> control{};
+    control.data_identity = data.X_ptr_;
+    return this->fit_impl(params_, data, std::move(control), std::forward<Args>(named_args)...);
+}
+
+template <typename real_type, typename label_type, typename... Args>
+model<real_type, label_type> csvm::update(const model<real_type, label_type> &model, const data_set<real_type, label_type> &new_data, Args &&...named_args) const {
+    // the new data points must contain labels in order to update the model
+    if (!new_data.has_labels()) {
+        throw invalid_parameter_exception{ "No labels given for the new data points! Maybe the data is only usable for prediction?" };
+    }
+    // the number of features must be equal
+    if (model.num_features() != new_data.num_features()) {
+        throw invalid_parameter_exception{ fmt::format("Number of features per new data point ({}) must match the number of features per support vector of the provided model ({})!", new_data.num_features(), model.num_features()) };
+    }
+
+    // append the new data points and their labels to the data points already used to learn the model
+    std::vector<std::vector<real_type>> data_points{ model.data_.data() };
+    data_points.insert(data_points.end(), new_data.data().cbegin(), new_data.data().cend());
+    std::vector<label_type> labels{ model.labels() };
+    labels.insert(labels.end(), new_data.labels()->get().cbegin(), new_data.labels()->get().cend());
+    // note: since the label mapping is based on the ordered (binary) labels, it is the same as the one of the original model
+    const data_set<real_type, label_type> extended_data{ std::move(data_points), std::move(labels) };
+
+    // warm start the CG algorithm using the already learned weights; the weights of the new data points are initialized with zero
+    // note: the last data point is eliminated in the dimensional reduction, i.e., the initial guess contains one value less than data points are present
+    detail::solver_control<real_type> control{};
+    control.initial_guess = *model.alpha_ptr_;
+    control.initial_guess.resize(extended_data.num_data_points() - 1, real_type{ 0.0 });
+
+    return this->fit_impl(model.params_, extended_data, std::move(control), std::forward<Args>(named_args)...);
+}
+
+template <typename real_type, typename label_type, typename... Args>
+cross_validation_result<real_type> csvm::cross_validate(const data_set<real_type, label_type> &data, const std::size_t num_folds, Args &&...named_args) const {
+    // the data set must contain labels in order to validate the learned models
+    if (!data.has_labels()) {
+        throw invalid_parameter_exception{ "No labels given for cross-validation! Maybe the data is only usable for prediction?" };
+    }
+    // each fold must contain at least one data point and at least one fold must remain for training
+    if (num_folds < 2 || num_folds > data.num_data_points()) {
+        throw invalid_parameter_exception{ fmt::format("The number of folds must be in the range [2, {}], but is {}!", data.num_data_points(), num_folds) };
+    }
+
+    const std::vector<std::vector<real_type>> &data_points = data.data();
+    const std::vector<label_type> &labels = data.labels().value();
+
+    // the weights learned for each data point in the previous folds; used to warm start the CG algorithm of the next fold
+    // note: the data points of the first validation fold haven't been part of any training set yet and, therefore, have a weight of zero
+    std::vector<real_type> weights{};
+
+    cross_validation_result<real_type> result{};
+    for (std::size_t fold = 0; fold < num_folds; ++fold) {
+        // split the data points into training and validation data points using the respective indices
+        std::vector<std::size_t> train_indices{};
+        std::vector<std::vector<real_type>> train_points{};
+        std::vector<label_type> train_labels{};
+        std::vector<std::vector<real_type>> validation_points{};
+        std::vector<label_type> validation_labels{};
+        for (std::size_t i = 0; i < data.num_data_points(); ++i) {
+            if (i % num_folds == fold) {
+                validation_points.push_back(data_points[i]);
+                validation_labels.push_back(labels[i]);
+            } else {
+                train_indices.push_back(i);
+                train_points.push_back(data_points[i]);
+                train_labels.push_back(labels[i]);
+            }
+        }
+        const data_set<real_type, label_type> train_data{ std::move(train_points), std::move(train_labels) };
+        const data_set<real_type, label_type> validation_data{ std::move(validation_points) };
+
+        // warm start the CG algorithm using the weights learned in the previous folds
+        // note: the last data point is eliminated in the dimensional reduction, i.e., the initial guess contains one value less than data points are present
+        detail::solver_control<real_type> control{};
+        if (!weights.empty()) {
+            control.initial_guess.resize(train_indices.size() - 1);
+            for (std::size_t i = 0; i < control.initial_guess.size(); ++i) {
+                control.initial_guess[i] = weights[train_indices[i]];
+            }
+        }
+
+        // learn the model on the training data points
+        const std::chrono::time_point fit_start_time = std::chrono::steady_clock::now();
+        const model<real_type, label_type> fold_model = this->fit_impl(params_, train_data, std::move(control), named_args...);
+        const std::chrono::time_point fit_end_time = std::chrono::steady_clock::now();
+
+        // remember the learned weights
+        weights.resize(data.num_data_points(), real_type{ 0.0 });
+        for (std::size_t i = 0; i < train_indices.size(); ++i) {
+            weights[train_indices[i]] = (*fold_model.alpha_ptr_)[i];
+        }
+
+        // validate the learned model
+        const std::chrono::time_point predict_start_time = std::chrono::steady_clock::now();
+        const std::vector<label_type> predicted_labels = this->predict(fold_model, validation_data);
+        const std::chrono::time_point predict_end_time = std::chrono::steady_clock::now();
+
+        typename std::vector<label_type>::size_type correct{ 0 };
+        for (typename std::vector<label_type>::size_type i = 0; i < predicted_labels.size(); ++i) {
+            if (predicted_labels[i] == validation_labels[i]) {
+                ++correct;
+            }
+        }
+
+        result.accuracies.push_back(static_cast<real_type>(correct) / static_cast<real_type>(predicted_labels.size()));
+        result.fit_times.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(fit_end_time - fit_start_time));
+        result.predict_times.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(predict_end_time - predict_start_time));
+
+        detail::log(verbosity_level::full | verbosity_level::timing,
+                    "Fold {}/{}: accuracy = {:.2f}% ({}/{}), fit in {}, predict in {}.\n",
+                    fold + 1,
+                    num_folds,
+                    result.accuracies.back() * 100,
+                    correct,
+                    predicted_labels.size(),
+                    result.fit_times.back(),
+                    result.predict_times.back());
+    }
+
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Cross-validation ({} folds): mean accuracy = {:.2f}%.\n\n",
+                num_folds,
+                result.mean_accuracy() * 100);
+
+    return result;
+}
+
+template <typename real_type, typename label_type, typename... Args>
+real_type csvm::estimate_loo_error(const model<real_type, label_type> &model, const std::size_t num_probes, Args &&...named_args) const {
     igor::parser parser{ std::forward<Args>(named_args)... };
 
     // set default values
     default_value epsilon_val{ default_init<real_type>{ 0.001 } };
-    default_value max_iter_val{ default_init<unsigned long long>{ data.num_data_points() } };
+    default_value max_iter_val{ default_init<unsigned long long>{ model.num_support_vectors() } };
 
     // compile time check: only named parameter are permitted
     static_assert(!parser.has_unnamed_arguments(), "Can only use named parameter!");
@@ -293,14 +549,162 @@ model<real_type, label_type> csvm::fit(const data_set<real_type, label_type> &da
         }
     }
 
+    // at least one probe vector is necessary
+    if (num_probes == 0) {
+        throw invalid_parameter_exception{ "At least one probe vector must be used to estimate the leave-one-out error!" };
+    }
+
+    const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+    const std::vector<std::vector<real_type>> &data_points = model.data_.data();
+    const std::vector<real_type> &y = *model.data_.y_ptr_;
+    const std::vector<real_type> &alpha = *model.alpha_ptr_;
+    const std::size_t num_data_points = data_points.size();
+
+    // estimate the diagonal of H^-1 using Hutchinson's estimator: diag(H^-1) ~ 1/k * sum_k z_k .* (H^-1 z_k) with Rademacher distributed z_k
+    // note: solving the system of linear equations with the right-hand side z_k yields exactly the alpha part of H^-1 [0, z_k]^T
+    std::mt19937 rng{ 42 };
+    std::bernoulli_distribution dist{ 0.5 };
+    std::vector<real_type> diagonal(num_data_points, real_type{ 0.0 });
+    for (std::size_t probe = 0; probe < num_probes; ++probe) {
+        std::vector<real_type> z(num_data_points);
+        for (real_type &z_i : z) {
+            z_i = dist(rng) ? real_type{ 1.0 } : real_type{ -1.0 };
+        }
+        const std::vector<real_type> x = solve_system_of_linear_equations(static_cast<detail::parameter<real_type>>(model.params_), data_points, z, epsilon_val.value(), max_iter_val.value(), detail::solver_control<real_type>{}).first;
+        for (std::size_t i = 0; i < num_data_points; ++i) {
+            diagonal[i] += z[i] * x[i];
+        }
+    }
+
+    // the i-th LOO residual is alpha_i / (H^-1)_ii -> the i-th LOO decision value is y_i - alpha_i / (H^-1)_ii
+    std::size_t num_misclassified{ 0 };
+    for (std::size_t i = 0; i < num_data_points; ++i) {
+        const real_type loo_decision_value = y[i] - alpha[i] / (diagonal[i] / static_cast<real_type>(num_probes));
+        if (operators::sign(loo_decision_value) != y[i]) {
+            ++num_misclassified;
+        }
+    }
+    const real_type loo_error = static_cast<real_type>(num_misclassified) / static_cast<real_type>(num_data_points);
+
+    const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+    detail::log(verbosity_level::full | verbosity_level::timing,
+                "Estimated the leave-one-out error ({}) using {} probe vectors in {}.\n",
+                loo_error,
+                num_probes,
+                detail::tracking_entry{ "loo", "total_runtime", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+    return loo_error;
+}
+
+template <typename real_type, typename... Args>
+std::pair<real_type, unsigned long long> csvm::parse_solver_named_args(detail::solver_control<real_type> &control, const unsigned long long default_max_iter, Args &&...named_args) {
+    igor::parser parser{ std::forward<Args>(named_args)... };
+
+    // set default values
+    default_value epsilon_val{ default_init<real_type>{ 0.001 } };
+    default_value max_iter_val{ default_init<unsigned long long>{ default_max_iter } };
+
+    // compile time/runtime check: the values must have the correct types
+    if constexpr (parser.has(epsilon)) {
+        // get the value of the provided named parameter
+        epsilon_val = detail::get_value_from_named_parameter<typename decltype(epsilon_val)::value_type>(parser, epsilon);
+        // check if value makes sense
+        if (epsilon_val <= static_cast<typename decltype(epsilon_val)::value_type>(0)) {
+            throw invalid_parameter_exception{ fmt::format("epsilon must be less than 0.0, but is {}!", epsilon_val) };
+        }
+    }
+    if constexpr (parser.has(max_iter)) {
+        // get the value of the provided named parameter
+        max_iter_val = detail::get_value_from_named_parameter<typename decltype(max_iter_val)::value_type>(parser, max_iter);
+        // check if value makes sense
+        if (max_iter_val == static_cast<typename decltype(max_iter_val)::value_type>(0)) {
+            throw invalid_parameter_exception{ fmt::format("max_iter must be greater than 0, but is {}!", max_iter_val) };
+        }
+    }
+    if constexpr (parser.has(mixed_precision)) {
+        // get the value of the provided named parameter
+        control.mixed_precision = detail::get_value_from_named_parameter<bool>(parser, mixed_precision);
+    }
+    if constexpr (parser.has(solver)) {
+        // get the value of the provided named parameter
+        control.solver = detail::get_value_from_named_parameter<solver_type>(parser, solver);
+    }
+    if constexpr (parser.has(iteration_callback)) {
+        // get the value of the provided named parameter
+        control.iteration_callback = detail::get_value_from_named_parameter<iteration_callback_type>(parser, iteration_callback);
+    }
+    if constexpr (parser.has(time_budget)) {
+        // get the value of the provided named parameter
+        const auto time_budget_val = detail::get_value_from_named_parameter<std::chrono::milliseconds>(parser, time_budget);
+        // check if value makes sense
+        if (time_budget_val <= std::chrono::milliseconds::zero()) {
+            throw invalid_parameter_exception{ fmt::format("time_budget must be greater than 0ms, but is {}ms!", time_budget_val.count()) };
+        }
+        // the time budget includes the setup of the backend
+        control.deadline = std::chrono::steady_clock::now() + time_budget_val;
+    }
+    if constexpr (parser.has(cancellation)) {
+        // get the value of the provided named parameter
+        control.cancellation = detail::get_value_from_named_parameter<cancellation_token>(parser, cancellation);
+    }
+    if constexpr (parser.has(checkpoint_file)) {
+        // get the value of the provided named parameter
+        control.checkpoint_file = detail::get_value_from_named_parameter<std::string>(parser, checkpoint_file);
+    }
+    if constexpr (parser.has(checkpoint_interval)) {
+        // get the value of the provided named parameter
+        control.checkpoint_interval = detail::get_value_from_named_parameter<unsigned long long>(parser, checkpoint_interval);
+        // check if value makes sense
+        if (control.checkpoint_interval == 0) {
+            throw invalid_parameter_exception{ fmt::format("checkpoint_interval must be greater than 0, but is {}!", control.checkpoint_interval) };
+        }
+    }
+    if constexpr (parser.has(resume)) {
+        // get the value of the provided named parameter
+        control.resume = detail::get_value_from_named_parameter<bool>(parser, resume);
+        // check if value makes sense
+        if (control.resume && control.checkpoint_file.empty()) {
+            throw invalid_parameter_exception{ "Can't resume the CG algorithm without a checkpoint_file!" };
+        }
+    }
+    if constexpr (parser.has(rbf_tolerance)) {
+        // get the value of the provided named parameter
+        control.rbf_tolerance = detail::get_value_from_named_parameter<real_type>(parser, rbf_tolerance);
+        // check if value makes sense
+        if (control.rbf_tolerance < real_type{ 0.0 }) {
+            throw invalid_parameter_exception{ fmt::format("rbf_tolerance must be greater or equal than 0.0, but is {}!", control.rbf_tolerance) };
+        }
+    }
+    // the additional recurrences in the pipelined CG algorithm amplify the rounding errors of the single precision kernel matrix-vector multiplications
+    if (std::is_same_v<real_type, double> && control.mixed_precision && control.solver == solver_type::pipelined_cg) {
+        throw invalid_parameter_exception{ "Mixed precision is currently not supported in combination with the pipelined CG algorithm!" };
+    }
+
+    return std::make_pair(epsilon_val.value(), max_iter_val.value());
+}
+
+template <typename real_type, typename label_type, typename... Args>
+model<real_type, label_type> csvm::fit_impl(parameter params, const data_set<real_type, label_type> &data, detail::solver_control<real_type> control, Args &&...named_args) const {
+    igor::parser parser{ named_args... };
+
+    // compile time check: only named parameter are permitted
+    static_assert(!parser.has_unnamed_arguments(), "Can only use named parameter!");
+    // compile time check: each named parameter must only be passed once
+    static_assert(!parser.has_duplicates(), "Can only use each named parameter once!");
+    // compile time check: only some named parameters are allowed
+    static_assert(!parser.has_other_than(epsilon, max_iter, mixed_precision, solver, iteration_callback, time_budget, cancellation, checkpoint_file, checkpoint_interval, resume, rbf_tolerance), "An illegal named parameter has been passed!");
+
+    // parse the named parameters controlling the CG algorithm
+    const auto [epsilon_val, max_iter_val] = parse_solver_named_args(control, data.num_data_points(), std::forward<Args>(named_args)...);
+
     // start fitting the data set using a C-SVM
 
     if (!data.has_labels()) {
         throw invalid_parameter_exception{ "No labels given for training! Maybe the data is only usable for prediction?" };
     }
 
-    // copy parameter and set gamma if necessary
-    parameter params{ params_ };
+    // set gamma if necessary
     if (params.gamma.is_default()) {
         // no gamma provided -> use default value which depends on the number of features of the data set
         params.gamma = 1.0 / data.num_features();
@@ -312,7 +716,8 @@ model<real_type, label_type> csvm::fit(const data_set<real_type, label_type> &da
     model<real_type, label_type> csvm_model{ params, data };
 
     // solve the minimization problem
-    std::tie(*csvm_model.alpha_ptr_, csvm_model.rho_) = solve_system_of_linear_equations(static_cast<detail::parameter<real_type>>(params), data.data(), *data.y_ptr_, epsilon_val.value(), max_iter_val.value());
+    std::tie(*csvm_model.alpha_ptr_, csvm_model.rho_) = solve_system_of_linear_equations(static_cast<detail::parameter<real_type>>(params), data.data(), *data.y_ptr_, epsilon_val, max_iter_val, control);
+    csvm_model.converged_ = control.converged;
 
     const std::chrono::time_point end_time = std::chrono::steady_clock::now();
     detail::log(verbosity_level::full | verbosity_level::timing,
@@ -322,14 +727,69 @@ model<real_type, label_type> csvm::fit(const data_set<real_type, label_type> &da
     return csvm_model;
 }
 
-template <typename real_type, typename label_type>
-std::vector<label_type> csvm::predict(const model<real_type, label_type> &model, const data_set<real_type, label_type> &data) const {
+template <typename real_type, typename label_type, typename... Args>
+std::vector<label_type> csvm::predict(const model<real_type, label_type> &model, const data_set<real_type, label_type> &data, Args &&...named_args) const {
+    igor::parser parser{ std::forward<Args>(named_args)... };
+
+    // compile time check: only named parameter are permitted
+    static_assert(!parser.has_unnamed_arguments(), "Can only use named parameter!");
+    // compile time check: each named parameter must only be passed once
+    static_assert(!parser.has_duplicates(), "Can only use each named parameter once!");
+    // compile time check: only some named parameters are allowed
+    static_assert(!parser.has_other_than(rbf_tolerance), "An illegal named parameter has been passed!");
+
+    // set default values; a tolerance of zero disables the approximation
+    default_value rbf_tolerance_val{ default_init<real_type>{ 0.0 } };
+
+    if constexpr (parser.has(rbf_tolerance)) {
+        // get the value of the provided named parameter
+        rbf_tolerance_val = detail::get_value_from_named_parameter<typename decltype(rbf_tolerance_val)::value_type>(parser, rbf_tolerance);
+        // check if value makes sense
+        if (rbf_tolerance_val < static_cast<typename decltype(rbf_tolerance_val)::value_type>(0)) {
+            throw invalid_parameter_exception{ fmt::format("rbf_tolerance must be greater or equal than 0.0, but is {}!", rbf_tolerance_val) };
+        }
+    }
+
     if (model.num_features() != data.num_features()) {
         throw invalid_parameter_exception{ fmt::format("Number of features per data point ({}) must match the number of features per support vector of the provided model ({})!", data.num_features(), model.num_features()) };
     }
 
     // predict values
-    const std::vector<real_type> predicted_values = predict_values(static_cast<detail::parameter<real_type>>(model.params_), model.data_.data(), *model.alpha_ptr_, model.rho_, *model.w_, data.data());
+    std::vector<real_type> predicted_values;
+    const detail::parameter<real_type> params = static_cast<detail::parameter<real_type>>(model.params_);
+    if (params.kernel_type == kernel_function_type::rbf && rbf_tolerance_val.value() > real_type{ 0.0 }) {
+        const std::chrono::time_point start_time = std::chrono::steady_clock::now();
+
+        // build the ball tree over the support vectors only once per model
+        if (!model.ball_tree_->has_value()) {
+            model.ball_tree_->emplace(model.data_.data(), *model.alpha_ptr_);
+        }
+        const detail::ball_tree<real_type> &tree = model.ball_tree_->value();
+
+        const std::vector<std::vector<real_type>> &predict_points = data.data();
+        const real_type gamma_val = params.gamma.value();
+        const real_type tolerance_val = rbf_tolerance_val.value();
+        const real_type rho_val = model.rho_;
+        predicted_values.resize(predict_points.size());
+        real_type max_error_bound{ 0.0 };
+
+        #pragma omp parallel for default(none) shared(predicted_values, predict_points, tree) firstprivate(gamma_val, tolerance_val, rho_val) reduction(max : max_error_bound) schedule(dynamic)
+        for (typename std::vector<real_type>::size_type i = 0; i < predict_points.size(); ++i) {
+            const auto [value, error_bound] = tree.rbf_weighted_sum(predict_points[i], gamma_val, tolerance_val);
+            predicted_values[i] = value - rho_val;
+            max_error_bound = std::max(max_error_bound, error_bound);
+        }
+
+        const std::chrono::time_point end_time = std::chrono::steady_clock::now();
+        detail::log(verbosity_level::full | verbosity_level::timing,
+                    "Approximated the rbf kernel predictions using a ball tree ({} nodes) with a maximum error bound of {} (tolerance: {}) in {}.\n",
+                    detail::tracking_entry{ "predict", "ball_tree_nodes", tree.num_nodes() },
+                    detail::tracking_entry{ "predict", "rbf_error_bound", max_error_bound },
+                    detail::tracking_entry{ "predict", "rbf_tolerance", tolerance_val },
+                    detail::tracking_entry{ "predict", "approximation_time", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+    } else {
+        predicted_values = predict_values(params, model.data_.data(), *model.alpha_ptr_, model.rho_, *model.w_, data.data());
+    }
 
     // convert predicted values to the correct labels
     std::vector<label_type> predicted_labels(predicted_values.size());
@@ -0,0 +1,284 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a ball tree over weighted points used to approximate sums of rbf kernel function values with a guaranteed error bound.
+ */
+
+#ifndef PLSSVM_DETAIL_BALL_TREE_HPP_
+#define PLSSVM_DETAIL_BALL_TREE_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"  // PLSSVM_ASSERT
+
+#include <algorithm>                 // std::max, std::min, std::nth_element, std::all_of
+#include <cmath>                     // std::abs, std::exp, std::sqrt
+#include <cstddef>                   // std::size_t
+#include <limits>                    // std::numeric_limits
+#include <numeric>                   // std::iota
+#include <utility>                   // std::pair, std::make_pair
+#include <vector>                    // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief A ball tree over weighted points, e.g., the support vectors of a model and their weights.
+ * @details Each node stores the center and radius of a ball enclosing all of its points and the sum of the absolute weights of these points.
+ *          Since the rbf kernel function decreases with the distance, \f$\sum_{i \in \text{node}} |\alpha_i| \cdot e^{-\gamma \cdot d_{min}^2}\f$ with
+ *          \f$d_{min}\f$ being the minimal distance of a query point to the ball is an upper bound of the contribution of all points in the node.
+ *          Nodes whose bound doesn't exceed their share of the requested tolerance are skipped, i.e., the total error never exceeds the tolerance.
+ *          Pruning is only effective for low-dimensional data (roughly less than 20 features).
+ * @tparam T the type of the data
+ */
+template <typename T>
+class ball_tree {
+  public:
+    /// The type of the data.
+    using real_type = T;
+    /// The unsigned size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Build the ball tree over the @p points with the respective @p weights.
+     * @details The points are recursively split at the median of the feature with the largest spread.
+     * @param[in] points the points to build the tree for
+     * @param[in] weights the weights of the @p points
+     * @param[in] leaf_size the maximum number of points in a leaf
+     */
+    ball_tree(const std::vector<std::vector<real_type>> &points, const std::vector<real_type> &weights, size_type leaf_size = 16);
+
+    /**
+     * @brief Approximate \f$\sum_i \alpha_i \cdot e^{-\gamma \cdot \lVert x_i - q \rVert^2}\f$ for the @p query point skipping all nodes whose contribution is provably negligible.
+     * @param[in] query the query point
+     * @param[in] gamma the gamma parameter used in the rbf kernel function
+     * @param[in] tolerance the maximum absolute error of the approximated sum
+     * @return the approximated sum and an upper bound of its absolute error, which is never greater than @p tolerance (`[[nodiscard]]`)
+     */
+    [[nodiscard]] std::pair<real_type, real_type> rbf_weighted_sum(const std::vector<real_type> &query, real_type gamma, real_type tolerance) const;
+
+    /**
+     * @brief Replace the weights of all points without rebuilding the ball tree, e.g., in each kernel matrix-vector multiplication of the CG algorithm.
+     * @param[in] weights the new weights in the order of the points the ball tree has been built with
+     */
+    void update_weights(const std::vector<real_type> &weights);
+
+    /**
+     * @brief Return the number of points in the ball tree.
+     * @return the number of points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_points() const noexcept { return weights_.size(); }
+    /**
+     * @brief Return the number of features of each point.
+     * @return the number of features (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_features() const noexcept { return num_features_; }
+    /**
+     * @brief Return the number of nodes in the ball tree.
+     * @return the number of nodes (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_nodes() const noexcept { return nodes_.size(); }
+
+  private:
+    /**
+     * @brief A single node of the ball tree containing the points [begin, end).
+     */
+    struct node {
+        /// The index of the first point in this node.
+        size_type begin{ 0 };
+        /// The index one past the last point in this node.
+        size_type end{ 0 };
+        /// The index of the left child; `0` if this node is a leaf (the root can never be a child).
+        size_type left{ 0 };
+        /// The index of the right child; `0` if this node is a leaf (the root can never be a child).
+        size_type right{ 0 };
+        /// The radius of the ball around the node's center containing all points of this node.
+        real_type radius{ 0.0 };
+        /// The sum of the absolute weights of all points in this node.
+        real_type abs_weight_sum{ 0.0 };
+    };
+
+    /**
+     * @brief Recursively build the node containing the points `indices[begin, end)`.
+     * @return the index of the created node
+     */
+    size_type build(const std::vector<std::vector<real_type>> &points, const std::vector<real_type> &weights, std::vector<size_type> &indices, size_type begin, size_type end);
+
+    /// The number of features of each point.
+    size_type num_features_{ 0 };
+    /// The maximum number of points in a leaf.
+    size_type leaf_size_{ 0 };
+    /// The nodes of the ball tree; the first node is the root.
+    std::vector<node> nodes_{};
+    /// The centers of the nodes' balls stored consecutively.
+    std::vector<real_type> centers_{};
+    /// The points reordered such that the points of each node are stored consecutively.
+    std::vector<real_type> points_{};
+    /// The weights of the reordered points.
+    std::vector<real_type> weights_{};
+    /// The original index of each reordered point.
+    std::vector<size_type> indices_{};
+    /// The sum of the absolute weights of all points.
+    real_type total_abs_weight_{ 0.0 };
+};
+
+template <typename T>
+ball_tree<T>::ball_tree(const std::vector<std::vector<real_type>> &points, const std::vector<real_type> &weights, const size_type leaf_size) :
+    num_features_{ points.empty() ? 0 : points.front().size() },
+    leaf_size_{ leaf_size } {
+    PLSSVM_ASSERT(!points.empty(), "At least one point must be given!");
+    PLSSVM_ASSERT(std::all_of(points.cbegin(), points.cend(), [&points](const std::vector<real_type> &point) { return point.size() == points.front().size(); }), "All points must have the same number of features!");
+    PLSSVM_ASSERT(points.size() == weights.size(), "Sizes mismatch!: {} != {}", points.size(), weights.size());
+    PLSSVM_ASSERT(leaf_size > 0, "The leaf size must be greater than 0!");
+
+    indices_.resize(points.size());
+    std::iota(indices_.begin(), indices_.end(), size_type{ 0 });
+    this->build(points, weights, indices_, 0, points.size());
+
+    // store the points of each node consecutively
+    points_.reserve(points.size() * num_features_);
+    weights_.reserve(points.size());
+    for (const size_type index : indices_) {
+        points_.insert(points_.end(), points[index].cbegin(), points[index].cend());
+        weights_.push_back(weights[index]);
+    }
+    total_abs_weight_ = nodes_.front().abs_weight_sum;
+}
+
+template <typename T>
+auto ball_tree<T>::build(const std::vector<std::vector<real_type>> &points, const std::vector<real_type> &weights, std::vector<size_type> &indices, const size_type begin, const size_type end) -> size_type {
+    const size_type node_index = nodes_.size();
+    nodes_.emplace_back();
+    centers_.resize(centers_.size() + num_features_, real_type{ 0.0 });
+    real_type *center = centers_.data() + node_index * num_features_;
+
+    // the center is the centroid of all points in the node
+    real_type abs_weight_sum{ 0.0 };
+    for (size_type i = begin; i < end; ++i) {
+        for (size_type feature = 0; feature < num_features_; ++feature) {
+            center[feature] += points[indices[i]][feature];
+        }
+        abs_weight_sum += std::abs(weights[indices[i]]);
+    }
+    for (size_type feature = 0; feature < num_features_; ++feature) {
+        center[feature] /= static_cast<real_type>(end - begin);
+    }
+
+    // the radius is the largest distance of a point to the center
+    real_type max_squared_distance{ 0.0 };
+    for (size_type i = begin; i < end; ++i) {
+        real_type squared_distance{ 0.0 };
+        for (size_type feature = 0; feature < num_features_; ++feature) {
+            const real_type diff = points[indices[i]][feature] - center[feature];
+            squared_distance += diff * diff;
+        }
+        max_squared_distance = std::max(max_squared_distance, squared_distance);
+    }
+    // note: slightly enlarge the radius such that rounding errors can never result in a too small ball
+    nodes_[node_index].radius = std::sqrt(max_squared_distance) * (real_type{ 1.0 } + 16 * std::numeric_limits<real_type>::epsilon());
+    nodes_[node_index].abs_weight_sum = abs_weight_sum;
+    nodes_[node_index].begin = begin;
+    nodes_[node_index].end = end;
+
+    if (end - begin > leaf_size_) {
+        // split the points at the median of the feature with the largest spread
+        size_type split_feature = 0;
+        real_type largest_spread{ -1.0 };
+        for (size_type feature = 0; feature < num_features_; ++feature) {
+            real_type min_value = std::numeric_limits<real_type>::max();
+            real_type max_value = std::numeric_limits<real_type>::lowest();
+            for (size_type i = begin; i < end; ++i) {
+                min_value = std::min(min_value, points[indices[i]][feature]);
+                max_value = std::max(max_value, points[indices[i]][feature]);
+            }
+            if (max_value - min_value > largest_spread) {
+                largest_spread = max_value - min_value;
+                split_feature = feature;
+            }
+        }
+        const size_type middle = begin + (end - begin) / 2;
+        std::nth_element(indices.begin() + static_cast<std::ptrdiff_t>(begin), indices.begin() + static_cast<std::ptrdiff_t>(middle), indices.begin() + static_cast<std::ptrdiff_t>(end), [&points, split_feature](const size_type lhs, const size_type rhs) {
+            return points[lhs][split_feature] < points[rhs][split_feature];
+        });
+
+        // note: nodes_ may be reallocated while building the children
+        const size_type left = this->build(points, weights, indices, begin, middle);
+        const size_type right = this->build(points, weights, indices, middle, end);
+        nodes_[node_index].left = left;
+        nodes_[node_index].right = right;
+    }
+    return node_index;
+}
+
+template <typename T>
+std::pair<T, T> ball_tree<T>::rbf_weighted_sum(const std::vector<real_type> &query, const real_type gamma, const real_type tolerance) const {
+    PLSSVM_ASSERT(query.size() == num_features_, "Sizes mismatch!: {} != {}", query.size(), num_features_);
+    PLSSVM_ASSERT(gamma > real_type{ 0.0 }, "gamma must be greater than 0, but is {}!", gamma);
+    PLSSVM_ASSERT(tolerance >= real_type{ 0.0 }, "The tolerance must be greater or equal than 0, but is {}!", tolerance);
+
+    const auto squared_distance = [&query, this](const real_type *point) {
+        real_type result{ 0.0 };
+        for (size_type feature = 0; feature < num_features_; ++feature) {
+            const real_type diff = query[feature] - point[feature];
+            result += diff * diff;
+        }
+        return result;
+    };
+
+    real_type sum{ 0.0 };
+    real_type error_bound{ 0.0 };
+    if (total_abs_weight_ == real_type{ 0.0 }) {
+        // all weights are zero -> nothing to do
+        return std::make_pair(sum, error_bound);
+    }
+    std::vector<size_type> stack{ 0 };
+    while (!stack.empty()) {
+        const size_type node_index = stack.back();
+        const node &n = nodes_[node_index];
+        stack.pop_back();
+
+        // upper bound of the contribution of all points in the node
+        const real_type min_distance = std::max(std::sqrt(squared_distance(centers_.data() + node_index * num_features_)) - n.radius, real_type{ 0.0 });
+        const real_type bound = n.abs_weight_sum * std::exp(-gamma * min_distance * min_distance);
+        // each node may contribute an error proportional to its share of the absolute weights
+        if (bound <= tolerance * (n.abs_weight_sum / total_abs_weight_)) {
+            error_bound += bound;
+        } else if (n.left == 0) {
+            for (size_type i = n.begin; i < n.end; ++i) {
+                sum += weights_[i] * std::exp(-gamma * squared_distance(points_.data() + i * num_features_));
+            }
+        } else {
+            stack.push_back(n.right);
+            stack.push_back(n.left);
+        }
+    }
+    return std::make_pair(sum, std::min(error_bound, tolerance));
+}
+
+template <typename T>
+void ball_tree<T>::update_weights(const std::vector<real_type> &weights) {
+    PLSSVM_ASSERT(weights.size() == weights_.size(), "Sizes mismatch!: {} != {}", weights.size(), weights_.size());
+
+    for (size_type i = 0; i < indices_.size(); ++i) {
+        weights_[i] = weights[indices_[i]];
+    }
+    // note: the children are always stored after their parent -> update the nodes bottom-up
+    for (auto n = nodes_.rbegin(); n != nodes_.rend(); ++n) {
+        if (n->left == 0) {
+            n->abs_weight_sum = real_type{ 0.0 };
+            for (size_type i = n->begin; i < n->end; ++i) {
+                n->abs_weight_sum += std::abs(weights_[i]);
+            }
+        } else {
+            n->abs_weight_sum = nodes_[n->left].abs_weight_sum + nodes_[n->right].abs_weight_sum;
+        }
+    }
+    total_abs_weight_ = nodes_.front().abs_weight_sum;
+}
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_BALL_TREE_HPP_
@@ -0,0 +1,72 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Utility functions to split data that doesn't fit into the device memory into multiple chunks.
+ */
+
+#ifndef PLSSVM_DETAIL_CHUNKING_HPP_
+#define PLSSVM_DETAIL_CHUNKING_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"  // PLSSVM_ASSERT
+
+#include <cstddef>                   // std::size_t
+#include <vector>                    // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief Calculate the maximum number of data points per chunk such that @p num_buffers chunks together with @p fixed_bytes fit into @p memory_budget bytes.
+ * @details If not all @p num_points fit into a single chunk, the chunk size is rounded down to a multiple of @p alignment (if at least @p alignment data points fit).
+ * @param[in] memory_budget the number of bytes available
+ * @param[in] fixed_bytes the number of bytes needed independent of the chunk size (e.g., for padding)
+ * @param[in] bytes_per_point the number of bytes needed for a single data point in a chunk
+ * @param[in] num_buffers the number of chunks that must be allocated at the same time (e.g., two if double buffering is used)
+ * @param[in] num_points the total number of data points
+ * @param[in] alignment the chunk size is preferably a multiple of this value
+ * @return the number of data points per chunk; `0` if not even a single data point fits into the @p memory_budget (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::size_t calculate_chunk_size(const std::size_t memory_budget, const std::size_t fixed_bytes, const std::size_t bytes_per_point, const std::size_t num_buffers, const std::size_t num_points, const std::size_t alignment = 1) {
+    PLSSVM_ASSERT(bytes_per_point > 0, "Each data point must need at least one byte!");
+    PLSSVM_ASSERT(num_buffers > 0, "At least one buffer must be used!");
+    PLSSVM_ASSERT(alignment > 0, "The alignment must be greater than 0!");
+
+    if (fixed_bytes >= memory_budget) {
+        return 0;
+    }
+    const std::size_t max_points = (memory_budget - fixed_bytes) / (num_buffers * bytes_per_point);
+    if (max_points >= num_points) {
+        // all data points fit into a single chunk
+        return num_points;
+    } else if (max_points >= alignment) {
+        return max_points - max_points % alignment;
+    }
+    return max_points;
+}
+
+/**
+ * @brief Split @p num_points data points into chunks of at most @p chunk_size data points with (nearly) the same size.
+ * @param[in] num_points the total number of data points
+ * @param[in] chunk_size the maximum number of data points per chunk
+ * @return the boundaries of the chunks, i.e., chunk `i` contains the data points `[bounds[i], bounds[i + 1])` (`[[nodiscard]]`)
+ */
+[[nodiscard]] inline std::vector<std::size_t> calculate_chunk_bounds(const std::size_t num_points, const std::size_t chunk_size) {
+    PLSSVM_ASSERT(num_points > 0, "At least one data point must be split into chunks!");
+    PLSSVM_ASSERT(chunk_size > 0, "The chunk size must be greater than 0!");
+
+    const std::size_t num_chunks = (num_points + chunk_size - 1) / chunk_size;
+    std::vector<std::size_t> bounds(num_chunks + 1);
+    for (std::size_t chunk = 0; chunk <= num_chunks; ++chunk) {
+        bounds[chunk] = chunk * num_points / num_chunks;
+    }
+    return bounds;
+}
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_CHUNKING_HPP_
@@ -17,6 +17,7 @@
 #include "plssvm/detail/cmd/parser_predict.hpp"  // plssvm::detail::cmd::parser_predict
 #include "plssvm/detail/cmd/parser_scale.hpp"    // plssvm::detail::cmd::parser_scale
 #include "plssvm/detail/cmd/parser_train.hpp"    // plssvm::detail::cmd::parser_train
+#include "plssvm/detail/cmd/parser_tune.hpp"     // plssvm::detail::cmd::parser_tune
 
 #include <string>                                // std::string
 #include <variant>                               // std::variant
@@ -70,9 +71,21 @@ template <typename real_type, typename label_type = typename data_set<real_type>
     }
 }
 
+/**
+ * @brief Return the correct data set type based on the plssvm::detail::cmd::parser_tune command line options.
+ * @tparam real_type the type of the data points
+ * @tparam label_type the type of the labels
+ * @param[in] cmd_parser the provided command line parser
+ * @return the data set type based on the provided command line parser (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type = typename data_set<real_type>::label_type>
+[[nodiscard]] inline data_set_variants data_set_factory_impl(const cmd::parser_tune &cmd_parser) {
+    return data_set_variants{ plssvm::data_set<real_type, label_type>{ cmd_parser.input_filename } };
+}
+
 /**
  * @brief Based on the provided command line @p cmd_parser, return the correct plssvm::data_set type.
- * @tparam cmd_parser_type the type of the command line parser (train, predict, or scale)
+ * @tparam cmd_parser_type the type of the command line parser (train, predict, scale, or tune)
  * @param[in] cmd_parser the provided command line parser
  * @return the data set type based on the provided command line parser (`[[nodiscard]]`)
  */
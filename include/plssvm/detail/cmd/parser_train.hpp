@@ -18,6 +18,7 @@
 #include "plssvm/backends/SYCL/kernel_invocation_type.hpp"  // plssvm::sycl::kernel_invocation_type
 #include "plssvm/default_value.hpp"                         // plssvm::default_value
 #include "plssvm/parameter.hpp"                             // plssvm::parameter
+#include "plssvm/solver_types.hpp"                          // plssvm::solver_type
 #include "plssvm/target_platforms.hpp"                      // plssvm::target_platform
 
 #include <cstddef>                                          // std::size_t
@@ -46,6 +47,8 @@ class parser_train {
     default_value<double> epsilon{ default_init<double>{ 0.001 } };
     /// The maximum number of iterations in the CG algorithm.
     default_value<std::size_t> max_iter{ default_init<std::size_t>{ 0 } };
+    /// The algorithm used to solve the system of linear equations: classical or pipelined CG.
+    default_value<solver_type> solver{ default_init<solver_type>{ solver_type::cg } };
 
     /// The used backend: automatic (depending on the specified target_platforms), OpenMP, CUDA, HIP, OpenCL, or SYCL.
     backend_type backend{ backend_type::automatic };
@@ -61,12 +64,23 @@ class parser_train {
     bool strings_as_labels{ false };
     /// `true` if `float` should be used as real type instead of the default type `double`.
     bool float_as_real_type{ false };
+    /// `true` if the CG algorithm should perform the kernel matrix-vector multiplications in `float` while using `double` as real type.
+    bool mixed_precision{ false };
+    /// If greater than zero, the rbf kernel matrix-vector multiplications in the CG algorithm are approximated with the given accuracy (OpenMP backend only).
+    double rbf_tolerance{ 0.0 };
 
     /// The name of the data/test file to parse.
     std::string input_filename{};
     /// The name of the model file to write the learned support vectors to/to parse the saved model from.
     std::string model_filename{};
 
+    /// The name of the file the state of the CG algorithm is periodically written to. If the filename is empty, no checkpoints are written.
+    std::string checkpoint_filename{};
+    /// The number of CG iterations after which the state of the CG algorithm is written to the checkpoint file.
+    std::size_t checkpoint_interval{ 10 };
+    /// `true` if the CG algorithm should be resumed from the state stored in the checkpoint file.
+    bool resume{ false };
+
     /// If performance tracking has been enabled, provides the name of the file where the performance tracking results are saved to. If the filename is empty, the results are dumped to stdout instead.
     std::string performance_tracking_filename{};
 };
@@ -0,0 +1,134 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a class encapsulating all necessary parameters for tuning the hyper-parameters of a C-SVM possibly provided through command line arguments.
+ */
+
+#ifndef PLSSVM_DETAIL_CMD_PARSER_TUNE_HPP_
+#define PLSSVM_DETAIL_CMD_PARSER_TUNE_HPP_
+#pragma once
+
+#include "plssvm/backend_types.hpp"                         // plssvm::backend_type
+#include "plssvm/backends/SYCL/implementation_type.hpp"     // plssvm::sycl::implementation_type
+#include "plssvm/backends/SYCL/kernel_invocation_type.hpp"  // plssvm::sycl::kernel_invocation_type
+#include "plssvm/default_value.hpp"                         // plssvm::default_value
+#include "plssvm/kernel_function_types.hpp"                 // plssvm::kernel_function_type
+#include "plssvm/target_platforms.hpp"                      // plssvm::target_platform
+
+#include <cstddef>                                          // std::size_t
+#include <iosfwd>                                           // forward declare std::ostream and std::istream
+#include <string>                                           // std::string
+#include <vector>                                           // std::vector
+
+namespace plssvm::detail::cmd {
+
+/**
+ * @brief Enum class for all supported hyper-parameter search strategies.
+ */
+enum class search_type {
+    /** Evaluate all combinations of the provided hyper-parameter values. */
+    grid,
+    /** Evaluate a random subset of all combinations of the provided hyper-parameter values. */
+    random,
+    /** Evaluate all combinations on a small subset of the data points and iteratively keep only the best ones while increasing the number of used data points. */
+    successive_halving
+};
+
+/**
+ * @brief Output the @p search type to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the search type to
+ * @param[in] search the search type
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, search_type search);
+
+/**
+ * @brief Use the input-stream @p in to initialize the @p search type.
+ * @param[in,out] in input-stream to extract the search type from
+ * @param[in] search the search type
+ * @return the input-stream
+ */
+std::istream &operator>>(std::istream &in, search_type &search);
+
+/**
+ * @brief Class for encapsulating all necessary parameters for tuning the hyper-parameters; normally provided through command line arguments.
+ */
+class parser_tune {
+  public:
+    /**
+     * @brief Parse the command line arguments @p argv using [`cxxopts`](https://github.com/jarro2783/cxxopts) and set the tuning parameters accordingly.
+     * @details If no leaderboard filename is given, uses the input filename and appends a ".leaderboard". The leaderboard file is than saved in the current working directory.
+     * @param[in] argc the number of passed command line arguments
+     * @param[in] argv the command line arguments
+     */
+    parser_tune(int argc, char **argv);
+
+    /// The kernel functions to try.
+    std::vector<kernel_function_type> kernel_types{ kernel_function_type::linear };
+    /// The degrees to try in the polynomial kernel function.
+    std::vector<int> degrees{ 3 };
+    /// The gamma values to try in the polynomial and rbf kernel functions. If empty, uses `1 / num_features`.
+    std::vector<double> gammas{};
+    /// The coef0 values to try in the polynomial kernel function.
+    std::vector<double> coef0s{ 0.0 };
+    /// The cost values to try.
+    std::vector<double> costs{ 1.0 };
+
+    /// The used hyper-parameter search strategy.
+    search_type search{ search_type::grid };
+    /// The maximum number of hyper-parameter combinations to evaluate in a random search.
+    std::size_t num_trials{ 10 };
+    /// The fraction of hyper-parameter combinations that are kept after each round of a successive halving search (`1 / halving_factor`).
+    std::size_t halving_factor{ 2 };
+    /// The seed used to initialize the random number generator in a random search.
+    std::size_t seed{ 42 };
+    /// The number of folds used in the cross-validation of each hyper-parameter combination.
+    std::size_t num_folds{ 5 };
+    /// The number of hyper-parameter combinations evaluated concurrently; the available CPU threads are distributed evenly among them.
+    std::size_t num_parallel_trials{ 1 };
+
+    /// The error tolerance parameter for the CG algorithm.
+    default_value<double> epsilon{ default_init<double>{ 0.001 } };
+    /// The maximum number of iterations in the CG algorithm.
+    default_value<std::size_t> max_iter{ default_init<std::size_t>{ 0 } };
+
+    /// The used backend: automatic (depending on the specified target_platforms), OpenMP, CUDA, HIP, OpenCL, or SYCL.
+    backend_type backend{ backend_type::automatic };
+    /// The target platform: automatic (depending on the used backend), CPUs or GPUs from NVIDIA, AMD or Intel.
+    target_platform target{ target_platform::automatic };
+
+    /// The kernel invocation type when using SYCL as backend.
+    sycl::kernel_invocation_type sycl_kernel_invocation_type{ sycl::kernel_invocation_type::automatic };
+    /// The SYCL implementation to use with --backend=sycl.
+    sycl::implementation_type sycl_implementation_type{ sycl::implementation_type::automatic };
+
+    /// `true` if `std::string` should be used as label type instead of the default type `ìnt`.
+    bool strings_as_labels{ false };
+    /// `true` if `float` should be used as real type instead of the default type `double`.
+    bool float_as_real_type{ false };
+
+    /// The name of the data file to parse.
+    std::string input_filename{};
+    /// The name of the file to write the leaderboard of all evaluated hyper-parameter combinations to.
+    std::string leaderboard_filename{};
+
+    /// If performance tracking has been enabled, provides the name of the file where the performance tracking results are saved to. If the filename is empty, the results are dumped to stdout instead.
+    std::string performance_tracking_filename{};
+};
+
+/**
+ * @brief Output all tune parameters encapsulated by @p params to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the parameters to
+ * @param[in] params the parameters
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, const parser_tune &params);
+
+}  // namespace plssvm::detail::cmd
+
+#endif  // PLSSVM_DETAIL_CMD_PARSER_TUNE_HPP_
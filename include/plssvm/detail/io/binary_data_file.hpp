@@ -0,0 +1,227 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements a memory mapped binary file containing the data points used for the out-of-core training.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_BINARY_DATA_FILE_HPP_
+#define PLSSVM_DETAIL_IO_BINARY_DATA_FILE_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"          // PLSSVM_ASSERT
+#include "plssvm/detail/io/file_reader.hpp"  // plssvm::detail::io::file_reader, PLSSVM_HAS_MEMORY_MAPPING_UNIX
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::exception, plssvm::invalid_file_format_exception
+
+#include "fmt/core.h"                        // fmt::format
+
+#if defined(PLSSVM_HAS_MEMORY_MAPPING_UNIX)
+    #include <sys/mman.h>                    // madvise, MADV_WILLNEED, MADV_DONTNEED
+    #include <unistd.h>                      // sysconf, _SC_PAGESIZE
+#endif
+
+#include <algorithm>                         // std::all_of
+#include <cstddef>                           // std::size_t
+#include <cstdint>                           // std::uint32_t, std::uint64_t, std::uintptr_t
+#include <cstring>                           // std::memcpy
+#include <filesystem>                        // std::filesystem::{file_size, rename}
+#include <fstream>                           // std::ofstream
+#include <string>                            // std::string
+#include <string_view>                       // std::string_view
+#include <vector>                            // std::vector
+
+namespace plssvm::detail::io {
+
+/// The magic bytes at the beginning of each binary data file.
+constexpr std::string_view binary_data_file_magic{ "PLSSVMDB" };
+/// The version of the binary data file format; must be incremented if the layout changes.
+constexpr std::uint32_t binary_data_file_version{ 1 };
+/// The size of the binary data file header in bytes; the data points start directly afterwards.
+constexpr std::size_t binary_data_file_header_size{ 64 };
+
+/**
+ * @brief Write the @p data points in row-major order to the binary data file @p filename such that they can be used for the out-of-core training.
+ * @details The file starts with a header of `binary_data_file_header_size` bytes containing the magic bytes, the file format version,
+ *          the size of the `real_type` in bytes, the number of data points, and the number of features.
+ *          The data is first written to a temporary file which is renamed afterwards.
+ * @tparam real_type the type of the data
+ * @param[in] filename the file to write the data points to
+ * @param[in] data the data points to write
+ * @throws plssvm::exception if the data points couldn't be written
+ */
+template <typename real_type>
+void write_binary_data_file(const std::string &filename, const std::vector<std::vector<real_type>> &data) {
+    PLSSVM_ASSERT(!data.empty(), "The data must not be empty!");
+    PLSSVM_ASSERT(!data.front().empty(), "The data points must contain at least one feature!");
+    PLSSVM_ASSERT(std::all_of(data.cbegin(), data.cend(), [&data](const std::vector<real_type> &data_point) { return data_point.size() == data.front().size(); }), "All data points must have the same number of features!");
+
+    // assemble the header
+    char header[binary_data_file_header_size]{};
+    const std::uint32_t real_type_size = sizeof(real_type);
+    const std::uint64_t num_data_points = data.size();
+    const std::uint64_t num_features = data.front().size();
+    std::memcpy(header, binary_data_file_magic.data(), binary_data_file_magic.size());
+    std::memcpy(header + 8, &binary_data_file_version, sizeof(std::uint32_t));
+    std::memcpy(header + 12, &real_type_size, sizeof(std::uint32_t));
+    std::memcpy(header + 16, &num_data_points, sizeof(std::uint64_t));
+    std::memcpy(header + 24, &num_features, sizeof(std::uint64_t));
+
+    const std::string tmp_filename = filename + ".tmp";
+    {
+        std::ofstream out{ tmp_filename, std::ios::binary | std::ios::trunc };
+        out.write(header, binary_data_file_header_size);
+        for (const std::vector<real_type> &data_point : data) {
+            out.write(reinterpret_cast<const char *>(data_point.data()), static_cast<std::streamsize>(data_point.size() * sizeof(real_type)));
+        }
+        if (!out) {
+            throw exception{ fmt::format("Couldn't write the binary data file '{}'!", tmp_filename) };
+        }
+    }
+    std::filesystem::rename(tmp_filename, filename);
+}
+
+/**
+ * @brief A read-only binary data file (see `plssvm::detail::io::write_binary_data_file`) that is memory mapped, if possible, such that the data points don't have to fit into the main memory.
+ * @details The operating system is advised to prefetch the data points that are needed next and to drop the ones that have already been processed.
+ *          Therefore, the memory used by the mapping stays bounded if the data points are accessed in consecutive blocks.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class binary_data_file {
+  public:
+    /// The type of the data.
+    using real_type = T;
+    /// The unsigned size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief Open the binary data file @p filename and check its header.
+     * @param[in] filename the file to open
+     * @throws plssvm::file_not_found_exception if the @p filename couldn't be found
+     * @throws plssvm::invalid_file_format_exception if the file isn't a binary data file, has been written using another version or another `real_type`, or is truncated
+     */
+    explicit binary_data_file(const std::string &filename) :
+        reader_{ filename } {
+        const std::size_t num_bytes = std::filesystem::file_size(filename);
+        if (num_bytes < binary_data_file_header_size || std::string_view{ reader_.buffer(), binary_data_file_magic.size() } != binary_data_file_magic) {
+            throw invalid_file_format_exception{ fmt::format("The file '{}' isn't a valid binary data file!", filename) };
+        }
+        std::uint32_t version{};
+        std::uint32_t real_type_size{};
+        std::uint64_t num_data_points{};
+        std::uint64_t num_features{};
+        std::memcpy(&version, reader_.buffer() + 8, sizeof(std::uint32_t));
+        std::memcpy(&real_type_size, reader_.buffer() + 12, sizeof(std::uint32_t));
+        std::memcpy(&num_data_points, reader_.buffer() + 16, sizeof(std::uint64_t));
+        std::memcpy(&num_features, reader_.buffer() + 24, sizeof(std::uint64_t));
+        if (version != binary_data_file_version) {
+            throw invalid_file_format_exception{ fmt::format("The binary data file '{}' has version {}, but only version {} is supported!", filename, version, binary_data_file_version) };
+        }
+        if (real_type_size != sizeof(real_type)) {
+            throw invalid_file_format_exception{ fmt::format("The binary data file '{}' has been written using a real_type with {} bytes, but the current real_type has {} bytes!", filename, real_type_size, sizeof(real_type)) };
+        }
+        if (num_data_points == 0 || num_features == 0) {
+            throw invalid_file_format_exception{ fmt::format("The binary data file '{}' must contain at least one data point with at least one feature!", filename) };
+        }
+        if (num_bytes != binary_data_file_header_size + num_data_points * num_features * sizeof(real_type)) {
+            throw invalid_file_format_exception{ fmt::format("The binary data file '{}' should contain {} data points with {} features each, but has a size of {} bytes!", filename, num_data_points, num_features, num_bytes) };
+        }
+        num_data_points_ = static_cast<size_type>(num_data_points);
+        num_features_ = static_cast<size_type>(num_features);
+    }
+
+    /**
+     * @brief Return the number of data points in the file.
+     * @return the number of data points (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_data_points() const noexcept { return num_data_points_; }
+    /**
+     * @brief Return the number of features of each data point.
+     * @return the number of features (`[[nodiscard]]`)
+     */
+    [[nodiscard]] size_type num_features() const noexcept { return num_features_; }
+    /**
+     * @brief Return a pointer to the features of the data point @p i.
+     * @param[in] i the index of the data point
+     * @return the pointer to the first feature of the data point (`[[nodiscard]]`)
+     */
+    [[nodiscard]] const real_type *data_point(const size_type i) const noexcept {
+        PLSSVM_ASSERT(i < num_data_points_, "Out-of-bounce access!: {} >= {}", i, num_data_points_);
+        return reinterpret_cast<const real_type *>(reader_.buffer() + binary_data_file_header_size) + i * num_features_;
+    }
+    /**
+     * @brief Copy the data points in the range [@p first, @p last) to the first `last - first` data points in @p buffer.
+     * @param[in] first the index of the first data point to copy
+     * @param[in] last the index one past the last data point to copy
+     * @param[out] buffer the buffer to copy the data points to; must contain at least `last - first` data points with `num_features()` features each
+     */
+    void copy_data_points(const size_type first, const size_type last, std::vector<std::vector<real_type>> &buffer) const noexcept {
+        PLSSVM_ASSERT(first <= last && last <= num_data_points_, "Invalid range [{}, {}) for {} data points!", first, last, num_data_points_);
+        PLSSVM_ASSERT(buffer.size() >= last - first, "The buffer must contain at least {} data points, but contains only {}!", last - first, buffer.size());
+
+        for (size_type i = first; i < last; ++i) {
+            PLSSVM_ASSERT(buffer[i - first].size() == num_features_, "Sizes mismatch!: {} != {}", buffer[i - first].size(), num_features_);
+            std::memcpy(buffer[i - first].data(), this->data_point(i), num_features_ * sizeof(real_type));
+        }
+    }
+    /**
+     * @brief Advise the operating system that the data points in the range [@p first, @p last) will be accessed soon, i.e., should be read ahead.
+     * @details Only has an effect if the file could be memory mapped on a UNIX system.
+     * @param[in] first the index of the first data point
+     * @param[in] last the index one past the last data point
+     */
+    void prefetch([[maybe_unused]] const size_type first, [[maybe_unused]] const size_type last) const noexcept {
+#if defined(PLSSVM_HAS_MEMORY_MAPPING_UNIX)
+        this->advise(first, last, MADV_WILLNEED);
+#endif
+    }
+    /**
+     * @brief Advise the operating system that the data points in the range [@p first, @p last) won't be accessed in the near future, i.e., the mapped pages may be dropped.
+     * @details Only has an effect if the file could be memory mapped on a UNIX system. The data points may still be accessed afterwards, but must be read from the file again.
+     * @param[in] first the index of the first data point
+     * @param[in] last the index one past the last data point
+     */
+    void release([[maybe_unused]] const size_type first, [[maybe_unused]] const size_type last) const noexcept {
+#if defined(PLSSVM_HAS_MEMORY_MAPPING_UNIX)
+        this->advise(first, last, MADV_DONTNEED);
+#endif
+    }
+
+  private:
+#if defined(PLSSVM_HAS_MEMORY_MAPPING_UNIX)
+    /**
+     * @brief Pass the @p advice for all pages containing the data points in the range [@p first, @p last) to the operating system.
+     * @details Errors are ignored since the advice is only a performance hint. Does nothing if the file couldn't be memory mapped,
+     *          since, e.g., `MADV_DONTNEED` would discard the content of a separately allocated buffer.
+     * @param[in] first the index of the first data point
+     * @param[in] last the index one past the last data point
+     * @param[in] advice the advice passed to `madvise`
+     */
+    void advise(const size_type first, const size_type last, const int advice) const noexcept {
+        if (!reader_.is_memory_mapped() || first >= last) {
+            return;
+        }
+        // madvise requires the start address to be aligned to the page size
+        const auto page_size = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+        const auto begin = reinterpret_cast<std::uintptr_t>(this->data_point(first));
+        const auto end = reinterpret_cast<std::uintptr_t>(this->data_point(last - 1) + num_features_);
+        const std::uintptr_t aligned_begin = begin - begin % page_size;
+        ::madvise(reinterpret_cast<void *>(aligned_begin), end - aligned_begin, advice);
+    }
+#endif
+
+    /// The file reader responsible for memory mapping the file (or reading it into a buffer if memory mapping isn't possible).
+    file_reader reader_;
+    /// The number of data points in the file.
+    size_type num_data_points_{ 0 };
+    /// The number of features of each data point.
+    size_type num_features_{ 0 };
+};
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_BINARY_DATA_FILE_HPP_
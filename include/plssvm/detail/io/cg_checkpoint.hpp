@@ -0,0 +1,341 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements functions to write and read checkpoints of the CG algorithm's state to and from binary files.
+ */
+
+#ifndef PLSSVM_DETAIL_IO_CG_CHECKPOINT_HPP_
+#define PLSSVM_DETAIL_IO_CG_CHECKPOINT_HPP_
+#pragma once
+
+#include "plssvm/detail/io/binary_data_file.hpp"  // plssvm::detail::io::binary_data_file
+#include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/solver_control.hpp"       // plssvm::detail::solver_control
+#include "plssvm/detail/utility.hpp"              // plssvm::detail::to_underlying
+#include "plssvm/exceptions/exceptions.hpp"       // plssvm::exception, plssvm::file_not_found_exception, plssvm::invalid_file_format_exception
+#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                   // plssvm::detail::parameter
+#include "plssvm/solver_types.hpp"                // plssvm::solver_type
+
+#include "fmt/core.h"                             // fmt::format
+#include "fmt/ostream.h"                          // can use fmt using operator<< overloads
+
+#include <array>                                  // std::array
+#include <cstddef>                                // std::size_t
+#include <cstdint>                                // std::uint32_t, std::uint64_t, std::int32_t
+#include <filesystem>                             // std::filesystem::{exists, rename}
+#include <fstream>                                // std::ifstream, std::ofstream
+#include <optional>                               // std::optional, std::nullopt
+#include <string>                                 // std::string
+#include <string_view>                            // std::string_view
+#include <vector>                                 // std::vector
+
+namespace plssvm::detail::io {
+
+/**
+ * @brief The state of the CG algorithm after a completed iteration together with the information necessary to check whether a resumed fit is compatible.
+ * @tparam T the type of the data
+ */
+template <typename T>
+struct cg_checkpoint {
+    /// The type of the data.
+    using real_type = T;
+
+    /// The SVM parameters used to learn the model.
+    parameter<real_type> params{};
+    /// The algorithm used to solve the system of linear equations.
+    solver_type solver{ solver_type::cg };
+    /// A fingerprint of the data points and right-hand side of the system of linear equations (see `plssvm::detail::io::calculate_data_fingerprint`).
+    std::uint64_t data_fingerprint{ 0 };
+    /// The number of already completed CG iterations.
+    unsigned long long iteration{ 0 };
+    /// The initial residuum (\f$r_0^T \cdot r_0\f$) used in the termination criterion.
+    real_type delta0{ 0.0 };
+    /// The current residuum (\f$r^T \cdot r\f$).
+    real_type delta{ 0.0 };
+    /// The residuum of the previous iteration; only used in the pipelined CG algorithm.
+    real_type delta_old{ 1.0 };
+    /// The step size of the previous iteration; only used in the pipelined CG algorithm.
+    real_type alpha_old{ 1.0 };
+    /// The current solution.
+    std::vector<real_type> x{};
+    /// The current residual.
+    std::vector<real_type> r{};
+    /// The current search direction.
+    std::vector<real_type> d{};
+};
+
+/// The magic bytes at the beginning of each checkpoint file.
+constexpr std::string_view cg_checkpoint_magic{ "PLSSVMCG" };
+/// The version of the checkpoint file format; must be incremented if the layout changes.
+constexpr std::uint32_t cg_checkpoint_version{ 1 };
+
+/**
+ * @brief Write the raw bytes of @p value to the binary @p out stream.
+ * @tparam T the type of the value
+ * @param[in,out] out the binary output stream
+ * @param[in] value the value to write
+ */
+template <typename T>
+void write_binary(std::ofstream &out, const T &value) {
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+/**
+ * @brief Write the size and the raw bytes of all values in @p vec to the binary @p out stream.
+ * @tparam T the type of the values
+ * @param[in,out] out the binary output stream
+ * @param[in] vec the values to write
+ */
+template <typename T>
+void write_binary(std::ofstream &out, const std::vector<T> &vec) {
+    write_binary(out, static_cast<std::uint64_t>(vec.size()));
+    out.write(reinterpret_cast<const char *>(vec.data()), static_cast<std::streamsize>(vec.size() * sizeof(T)));
+}
+/**
+ * @brief Read the raw bytes of @p value from the binary @p in stream.
+ * @tparam T the type of the value
+ * @param[in,out] in the binary input stream
+ * @param[out] value the read value
+ * @param[in] filename the name of the read file, only used in the exception message
+ * @throws plssvm::invalid_file_format_exception if the file ended prematurely
+ */
+template <typename T>
+void read_binary(std::ifstream &in, T &value, const std::string &filename) {
+    if (!in.read(reinterpret_cast<char *>(&value), sizeof(T))) {
+        throw invalid_file_format_exception{ fmt::format("The checkpoint file '{}' ended prematurely!", filename) };
+    }
+}
+/**
+ * @brief Read the size and the raw bytes of all values in @p vec from the binary @p in stream.
+ * @tparam T the type of the values
+ * @param[in,out] in the binary input stream
+ * @param[out] vec the read values
+ * @param[in] expected_size the expected number of values
+ * @param[in] filename the name of the read file, only used in the exception message
+ * @throws plssvm::invalid_file_format_exception if the number of values doesn't match @p expected_size
+ * @throws plssvm::invalid_file_format_exception if the file ended prematurely
+ */
+template <typename T>
+void read_binary(std::ifstream &in, std::vector<T> &vec, const std::uint64_t expected_size, const std::string &filename) {
+    std::uint64_t size{};
+    read_binary(in, size, filename);
+    if (size != expected_size) {
+        throw invalid_file_format_exception{ fmt::format("The checkpoint file '{}' contains a vector with {} values, but {} were expected!", filename, size, expected_size) };
+    }
+    vec.resize(size);
+    if (!in.read(reinterpret_cast<char *>(vec.data()), static_cast<std::streamsize>(size * sizeof(T)))) {
+        throw invalid_file_format_exception{ fmt::format("The checkpoint file '{}' ended prematurely!", filename) };
+    }
+}
+
+/**
+ * @brief Update the 64-bit FNV-1a @p hash with the raw bytes of the @p num_values @p values.
+ * @tparam real_type the type of the data
+ * @param[in,out] hash the hash to update
+ * @param[in] values the values to hash
+ * @param[in] num_values the number of values to hash
+ */
+template <typename real_type>
+void update_data_fingerprint(std::uint64_t &hash, const real_type *values, const std::size_t num_values) noexcept {
+    const auto *bytes = reinterpret_cast<const unsigned char *>(values);
+    for (std::size_t i = 0; i < num_values * sizeof(real_type); ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+}
+
+/**
+ * @brief Calculate a fingerprint (64-bit FNV-1a hash) of the data points @p A and the right-hand side @p b of the system of linear equations.
+ * @details Used to detect whether a checkpoint has been written for a different data set.
+ * @tparam real_type the type of the data
+ * @param[in] A the data points
+ * @param[in] b the right-hand side of the system of linear equations
+ * @return the fingerprint (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] std::uint64_t calculate_data_fingerprint(const std::vector<std::vector<real_type>> &A, const std::vector<real_type> &b) {
+    std::uint64_t hash{ 14695981039346656037ULL };
+    for (const std::vector<real_type> &point : A) {
+        update_data_fingerprint(hash, point.data(), point.size());
+    }
+    update_data_fingerprint(hash, b.data(), b.size());
+    return hash;
+}
+/**
+ * @brief Calculate a fingerprint (64-bit FNV-1a hash) of the data points in the binary data file @p A and the right-hand side @p b of the system of linear equations.
+ * @details Yields the same fingerprint as if the data points were loaded into memory, i.e., in-core and out-of-core checkpoints are interchangeable.
+ * @tparam real_type the type of the data
+ * @param[in] A the data points
+ * @param[in] b the right-hand side of the system of linear equations
+ * @return the fingerprint (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] std::uint64_t calculate_data_fingerprint(const binary_data_file<real_type> &A, const std::vector<real_type> &b) {
+    std::uint64_t hash{ 14695981039346656037ULL };
+    for (typename binary_data_file<real_type>::size_type i = 0; i < A.num_data_points(); ++i) {
+        update_data_fingerprint(hash, A.data_point(i), A.num_features());
+    }
+    update_data_fingerprint(hash, b.data(), b.size());
+    return hash;
+}
+
+/**
+ * @brief Write the @p checkpoint to the binary file @p filename.
+ * @details The checkpoint is first written to a temporary file which is renamed afterwards.
+ *          Therefore, an already existing checkpoint file remains intact if the process is terminated while writing.
+ * @tparam real_type the type of the data
+ * @param[in] filename the file to write the checkpoint to
+ * @param[in] checkpoint the state of the CG algorithm to write
+ * @throws plssvm::exception if the checkpoint couldn't be written
+ */
+template <typename real_type>
+void write_cg_checkpoint(const std::string &filename, const cg_checkpoint<real_type> &checkpoint) {
+    const std::string tmp_filename = filename + ".tmp";
+    {
+        std::ofstream out{ tmp_filename, std::ios::binary | std::ios::trunc };
+        out.write(cg_checkpoint_magic.data(), static_cast<std::streamsize>(cg_checkpoint_magic.size()));
+        write_binary(out, cg_checkpoint_version);
+        write_binary(out, static_cast<std::uint32_t>(sizeof(real_type)));
+        // the SVM parameters
+        write_binary(out, static_cast<std::int32_t>(detail::to_underlying(checkpoint.params.kernel_type.value())));
+        write_binary(out, static_cast<std::int32_t>(checkpoint.params.degree.value()));
+        write_binary(out, checkpoint.params.gamma.value());
+        write_binary(out, checkpoint.params.coef0.value());
+        write_binary(out, checkpoint.params.cost.value());
+        write_binary(out, static_cast<std::int32_t>(detail::to_underlying(checkpoint.solver)));
+        write_binary(out, checkpoint.data_fingerprint);
+        // the state of the CG algorithm
+        write_binary(out, static_cast<std::uint64_t>(checkpoint.iteration));
+        write_binary(out, checkpoint.delta0);
+        write_binary(out, checkpoint.delta);
+        write_binary(out, checkpoint.delta_old);
+        write_binary(out, checkpoint.alpha_old);
+        write_binary(out, checkpoint.x);
+        write_binary(out, checkpoint.r);
+        write_binary(out, checkpoint.d);
+        if (!out) {
+            throw exception{ fmt::format("Couldn't write the checkpoint file '{}'!", tmp_filename) };
+        }
+    }
+    std::filesystem::rename(tmp_filename, filename);
+}
+
+/**
+ * @brief Read the checkpoint from the binary file @p filename and check whether it can be used to resume solving the current system of linear equations.
+ * @tparam real_type the type of the data
+ * @param[in] filename the file to read the checkpoint from
+ * @param[in] params the SVM parameters of the current fit
+ * @param[in] solver the algorithm used to solve the current system of linear equations
+ * @param[in] data_fingerprint the fingerprint of the current data set (see `plssvm::detail::io::calculate_data_fingerprint`)
+ * @param[in] num_rows the number of rows of the current system of linear equations
+ * @throws plssvm::file_not_found_exception if the file couldn't be opened
+ * @throws plssvm::invalid_file_format_exception if the file isn't a checkpoint file, has been written using another version or another `real_type`, or ended prematurely
+ * @throws plssvm::invalid_file_format_exception if the checkpoint has been written for other SVM parameters, another solver, or another data set
+ * @return the read checkpoint (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] cg_checkpoint<real_type> read_cg_checkpoint(const std::string &filename, const parameter<real_type> &params, const solver_type solver, const std::uint64_t data_fingerprint, const std::uint64_t num_rows) {
+    std::ifstream in{ filename, std::ios::binary };
+    if (!in) {
+        throw file_not_found_exception{ fmt::format("Couldn't find file: '{}'!", filename) };
+    }
+
+    // check the file header
+    std::array<char, cg_checkpoint_magic.size()> magic{};
+    std::uint32_t version{};
+    std::uint32_t real_type_size{};
+    if (!in.read(magic.data(), static_cast<std::streamsize>(magic.size())) || std::string_view{ magic.data(), magic.size() } != cg_checkpoint_magic) {
+        throw invalid_file_format_exception{ fmt::format("The file '{}' isn't a valid checkpoint file!", filename) };
+    }
+    read_binary(in, version, filename);
+    if (version != cg_checkpoint_version) {
+        throw invalid_file_format_exception{ fmt::format("The checkpoint file '{}' has version {}, but only version {} is supported!", filename, version, cg_checkpoint_version) };
+    }
+    read_binary(in, real_type_size, filename);
+    if (real_type_size != sizeof(real_type)) {
+        throw invalid_file_format_exception{ fmt::format("The checkpoint file '{}' has been written using a real_type with {} bytes, but the current real_type has {} bytes!", filename, real_type_size, sizeof(real_type)) };
+    }
+
+    cg_checkpoint<real_type> checkpoint{};
+    // the SVM parameters
+    std::int32_t kernel_type{};
+    std::int32_t degree{};
+    real_type gamma{};
+    real_type coef0{};
+    real_type cost{};
+    std::int32_t solver_read{};
+    read_binary(in, kernel_type, filename);
+    read_binary(in, degree, filename);
+    read_binary(in, gamma, filename);
+    read_binary(in, coef0, filename);
+    read_binary(in, cost, filename);
+    read_binary(in, solver_read, filename);
+    read_binary(in, checkpoint.data_fingerprint, filename);
+    checkpoint.params.kernel_type = static_cast<kernel_function_type>(kernel_type);
+    checkpoint.params.degree = static_cast<int>(degree);
+    checkpoint.params.gamma = gamma;
+    checkpoint.params.coef0 = coef0;
+    checkpoint.params.cost = cost;
+    checkpoint.solver = static_cast<solver_type>(solver_read);
+
+    // check whether the checkpoint may be used for the current system of linear equations
+    if (!checkpoint.params.equivalent(params)) {
+        throw invalid_file_format_exception{ fmt::format("The checkpoint file '{}' has been written using different SVM parameters!", filename) };
+    }
+    if (checkpoint.solver != solver) {
+        throw invalid_file_format_exception{ fmt::format("The checkpoint file '{}' has been written using the {} solver, but the {} solver has been requested!", filename, checkpoint.solver, solver) };
+    }
+    if (checkpoint.data_fingerprint != data_fingerprint) {
+        throw invalid_file_format_exception{ fmt::format("The checkpoint file '{}' has been written for a different data set!", filename) };
+    }
+
+    // the state of the CG algorithm
+    std::uint64_t iteration{};
+    read_binary(in, iteration, filename);
+    checkpoint.iteration = static_cast<unsigned long long>(iteration);
+    read_binary(in, checkpoint.delta0, filename);
+    read_binary(in, checkpoint.delta, filename);
+    read_binary(in, checkpoint.delta_old, filename);
+    read_binary(in, checkpoint.alpha_old, filename);
+    read_binary(in, checkpoint.x, num_rows, filename);
+    read_binary(in, checkpoint.r, num_rows, filename);
+    read_binary(in, checkpoint.d, num_rows, filename);
+
+    return checkpoint;
+}
+
+/**
+ * @brief If requested in @p control, read the checkpoint used to resume the CG algorithm.
+ * @details If the checkpoint file doesn't exist (e.g., since the previous run has been terminated before the first checkpoint has been written),
+ *          the CG algorithm is started from scratch.
+ * @tparam real_type the type of the data
+ * @param[in] control the solver control containing the checkpoint file
+ * @param[in] params the SVM parameters of the current fit
+ * @param[in] data_fingerprint the fingerprint of the current data set (see `plssvm::detail::io::calculate_data_fingerprint`)
+ * @param[in] num_rows the number of rows of the current system of linear equations
+ * @throws plssvm::exception all exceptions thrown by `plssvm::detail::io::read_cg_checkpoint`
+ * @return the checkpoint to resume from or `std::nullopt` if the CG algorithm should be started from scratch (`[[nodiscard]]`)
+ */
+template <typename real_type>
+[[nodiscard]] std::optional<cg_checkpoint<real_type>> resume_from_cg_checkpoint(const solver_control<real_type> &control, const parameter<real_type> &params, const std::uint64_t data_fingerprint, const std::uint64_t num_rows) {
+    if (!control.resume) {
+        return std::nullopt;
+    }
+    if (!std::filesystem::exists(control.checkpoint_file)) {
+        detail::log(verbosity_level::full,
+                    "Couldn't find the checkpoint file '{}', starting the CG algorithm from scratch.\n", control.checkpoint_file);
+        return std::nullopt;
+    }
+    cg_checkpoint<real_type> checkpoint = read_cg_checkpoint(control.checkpoint_file, params, control.solver, data_fingerprint, num_rows);
+    detail::log(verbosity_level::full,
+                "Resuming the CG algorithm from the checkpoint file '{}' after {} iteration(s).\n", control.checkpoint_file, checkpoint.iteration);
+    return checkpoint;
+}
+
+}  // namespace plssvm::detail::io
+
+#endif  // PLSSVM_DETAIL_IO_CG_CHECKPOINT_HPP_
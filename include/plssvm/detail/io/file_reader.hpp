@@ -107,6 +107,11 @@ class file_reader {
      * @return `true` if a file is currently open, `false` otherwise (`[[nodiscard]]`)
      */
     [[nodiscard]] bool is_open() const noexcept;
+    /**
+     * @brief Checks whether the associated file could be memory mapped.
+     * @return `true` if the file content is memory mapped, `false` if it has been read into a separately allocated buffer or no file is open (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool is_memory_mapped() const noexcept;
     /**
      * @brief Closes the associated file.
      * @details If memory mapped IO has been used, unmap the file and close the file descriptor, and delete the allocated buffer.
@@ -170,6 +170,82 @@ template <typename T>
     return val;
 }
 
+/**
+ * @brief Calculate \f$y = \alpha \cdot x + y\f$ in-place, i.e., without creating a temporary [`std::vector`](https://en.cppreference.com/w/cpp/container/vector).
+ * @tparam T the value type
+ * @param[in] alpha the scaling factor for @p x
+ * @param[in] x the vector to scale
+ * @param[in,out] y the vector to update
+ */
+template <typename T>
+inline void axpy(const T alpha, const std::vector<T> &x, std::vector<T> &y) {
+    PLSSVM_ASSERT(x.size() == y.size(), "Sizes mismatch!: {} != {}", x.size(), y.size());
+
+    #pragma omp simd
+    for (typename std::vector<T>::size_type i = 0; i < y.size(); ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+/**
+ * @brief Calculate \f$y = \alpha \cdot x + y\f$ in-place and the squared Euclidean norm of the updated vector (\f$y^T \cdot y\f$) in the same pass over the data.
+ * @tparam T the value type
+ * @param[in] alpha the scaling factor for @p x
+ * @param[in] x the vector to scale
+ * @param[in,out] y the vector to update
+ * @return the squared Euclidean norm of the updated @p y (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] inline T axpy_dot(const T alpha, const std::vector<T> &x, std::vector<T> &y) {
+    PLSSVM_ASSERT(x.size() == y.size(), "Sizes mismatch!: {} != {}", x.size(), y.size());
+
+    T val{};
+    #pragma omp simd reduction(+ : val)
+    for (typename std::vector<T>::size_type i = 0; i < y.size(); ++i) {
+        y[i] += alpha * x[i];
+        val += y[i] * y[i];
+    }
+    return val;
+}
+
+/**
+ * @brief Calculate \f$y = x + \beta \cdot y\f$ in-place, i.e., without creating a temporary [`std::vector`](https://en.cppreference.com/w/cpp/container/vector).
+ * @tparam T the value type
+ * @param[in] x the vector to add
+ * @param[in] beta the scaling factor for @p y
+ * @param[in,out] y the vector to scale and update
+ */
+template <typename T>
+inline void xpby(const std::vector<T> &x, const T beta, std::vector<T> &y) {
+    PLSSVM_ASSERT(x.size() == y.size(), "Sizes mismatch!: {} != {}", x.size(), y.size());
+
+    #pragma omp simd
+    for (typename std::vector<T>::size_type i = 0; i < y.size(); ++i) {
+        y[i] = beta * y[i] + x[i];
+    }
+}
+
+/**
+ * @brief Calculate \f$y = x + \beta \cdot y\f$ in-place and the squared Euclidean norm of the updated vector (\f$y^T \cdot y\f$) in the same pass over the data.
+ * @tparam T the value type
+ * @param[in] x the vector to add
+ * @param[in] beta the scaling factor for @p y
+ * @param[in,out] y the vector to scale and update
+ * @return the squared Euclidean norm of the updated @p y (`[[nodiscard]]`)
+ */
+template <typename T>
+[[nodiscard]] inline T xpby_dot(const std::vector<T> &x, const T beta, std::vector<T> &y) {
+    PLSSVM_ASSERT(x.size() == y.size(), "Sizes mismatch!: {} != {}", x.size(), y.size());
+
+    T val{};
+    #pragma omp simd reduction(+ : val)
+    for (typename std::vector<T>::size_type i = 0; i < y.size(); ++i) {
+        y[i] = beta * y[i] + x[i];
+        val += y[i] * y[i];
+    }
+    return val;
+}
+
 /**
  * @brief Returns +1 if x is positive and -1 if x is negative or 0.
  * @param[in] x the value to calculate the sign for
@@ -0,0 +1,129 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Implements an adaptive residual replacement strategy for the CG algorithms based on an estimate of the accumulated rounding errors.
+ */
+
+#ifndef PLSSVM_DETAIL_RESIDUAL_REPLACEMENT_HPP_
+#define PLSSVM_DETAIL_RESIDUAL_REPLACEMENT_HPP_
+#pragma once
+
+#include "plssvm/detail/assert.hpp"  // PLSSVM_ASSERT
+
+#include <algorithm>                 // std::max
+#include <cmath>                     // std::sqrt
+
+namespace plssvm::detail {
+
+/**
+ * @brief Decides when the iteratively updated residual in the CG algorithms must be replaced by the explicitly calculated residual (`r = b - Ax`).
+ * @details Follows the strategy of van der Vorst and Ye: the deviation between the iteratively updated and the true residual is estimated by
+ *          accumulating the rounding errors of each iteration, \f$d_k = d_{k - 1} + u \cdot (\|A\| \cdot \|x_k\| + \|r_k\|)\f$ with \f$u\f$ being the machine epsilon.
+ *          The residual is replaced as soon as the deviation stops being negligible compared to the current residual, i.e.,
+ *          \f$d_{k - 1} \leq \sqrt{u} \cdot \|r_{k - 1}\|\f$ and \f$d_k > \sqrt{u} \cdot \|r_k\|\f$, and the deviation grew noticeably since the last replacement.
+ *          Once the residual reached the level of the rounding errors, no further replacements are performed since they wouldn't improve the accuracy.
+ *          However, the auxiliary recurrences of the pipelined CG algorithm additionally amplify the rounding errors such that the residual must be replaced repeatedly in this case.
+ *          The norm of the (implicit) kernel matrix \f$\|A\|\f$ is estimated by the largest Rayleigh quotient of the search directions.
+ * @tparam T the type of the data
+ */
+template <typename T>
+class residual_replacement {
+  public:
+    /// The type of the data.
+    using real_type = T;
+
+    /**
+     * @brief Initialize the residual replacement strategy.
+     * @param[in] machine_epsilon the machine epsilon of the precision the kernel matrix-vector multiplications are performed in
+     * @param[in] initial_residual_norm the Euclidean norm of the initial residual \f$\|r_0\|\f$
+     * @param[in] replace_repeatedly if `true`, the residual is replaced in every iteration in which the deviation isn't negligible and grew noticeably since the last replacement
+     */
+    residual_replacement(const real_type machine_epsilon, const real_type initial_residual_norm, const bool replace_repeatedly = false) :
+        machine_epsilon_{ machine_epsilon },
+        threshold_{ std::sqrt(machine_epsilon) },
+        deviation_{ machine_epsilon * initial_residual_norm },
+        deviation_init_{ deviation_ },
+        negligible_{ deviation_ <= threshold_ * initial_residual_norm },
+        replace_repeatedly_{ replace_repeatedly } {
+        PLSSVM_ASSERT(machine_epsilon > real_type{ 0.0 }, "The machine epsilon must be greater than 0.0, but is {}!", machine_epsilon);
+    }
+
+    /**
+     * @brief Update the estimate of the kernel matrix norm using the Rayleigh quotient \f$\frac{d^T A d}{d^T d}\f$ of the current search direction @p d.
+     * @param[in] dAd the value \f$d^T A d\f$
+     * @param[in] dd the squared Euclidean norm of the search direction \f$d^T d\f$
+     */
+    void update_matrix_norm(const real_type dAd, const real_type dd) noexcept {
+        if (dd > real_type{ 0.0 }) {
+            matrix_norm_ = std::max(matrix_norm_, dAd / dd);
+        }
+    }
+
+    /**
+     * @brief Accumulate the rounding errors of the current CG iteration and check whether the residual must be replaced.
+     * @param[in] solution_norm the Euclidean norm of the current solution \f$\|x_k\|\f$
+     * @param[in] residual_norm the Euclidean norm of the iteratively updated residual \f$\|r_k\|\f$
+     * @return `true` if the residual should be replaced by the explicitly calculated residual, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool update(const real_type solution_norm, const real_type residual_norm) noexcept {
+        deviation_ += machine_epsilon_ * (matrix_norm_ * solution_norm + residual_norm);
+        const bool negligible_old = negligible_;
+        negligible_ = deviation_ <= threshold_ * residual_norm;
+        return (negligible_old || replace_repeatedly_) && !negligible_ && deviation_ > real_type{ 1.1 } * deviation_init_;
+    }
+
+    /**
+     * @brief Reset the deviation estimate after the residual has been replaced and increment the number of performed replacements.
+     * @param[in] solution_norm the Euclidean norm of the current solution \f$\|x_k\|\f$
+     * @param[in] residual_norm the Euclidean norm of the explicitly calculated residual \f$\|b - A x_k\|\f$
+     */
+    void replaced(const real_type solution_norm, const real_type residual_norm) noexcept {
+        deviation_ = machine_epsilon_ * (matrix_norm_ * solution_norm + residual_norm);
+        deviation_init_ = deviation_;
+        negligible_ = deviation_ <= threshold_ * residual_norm;
+        ++num_replacements_;
+    }
+
+    /**
+     * @brief Return the current estimate of the deviation between the iteratively updated and the true residual.
+     * @return the deviation estimate (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type deviation() const noexcept { return deviation_; }
+    /**
+     * @brief Return the current estimate of the kernel matrix norm.
+     * @return the matrix norm estimate (`[[nodiscard]]`)
+     */
+    [[nodiscard]] real_type matrix_norm() const noexcept { return matrix_norm_; }
+    /**
+     * @brief Return the number of residual replacements performed so far.
+     * @return the number of replacements (`[[nodiscard]]`)
+     */
+    [[nodiscard]] unsigned long long num_replacements() const noexcept { return num_replacements_; }
+
+  private:
+    /// The machine epsilon of the precision used in the kernel matrix-vector multiplications.
+    real_type machine_epsilon_;
+    /// The relative threshold (\f$\sqrt{u}\f$) above which the deviation is no longer negligible.
+    real_type threshold_;
+    /// The estimate of the kernel matrix norm.
+    real_type matrix_norm_{ 0.0 };
+    /// The current estimate of the deviation between the iteratively updated and the true residual.
+    real_type deviation_;
+    /// The deviation estimate directly after the last residual replacement.
+    real_type deviation_init_;
+    /// `true` if the deviation was negligible compared to the residual in the previous iteration.
+    bool negligible_;
+    /// `true` if the residual should also be replaced if the deviation already wasn't negligible in the previous iteration.
+    bool replace_repeatedly_;
+    /// The number of residual replacements performed so far.
+    unsigned long long num_replacements_{ 0 };
+};
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_RESIDUAL_REPLACEMENT_HPP_
@@ -0,0 +1,105 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines a struct encapsulating additional, optional information used to control the CG solver in the backends.
+ */
+
+#ifndef PLSSVM_DETAIL_SOLVER_CONTROL_HPP_
+#define PLSSVM_DETAIL_SOLVER_CONTROL_HPP_
+#pragma once
+
+#include "plssvm/cancellation_token.hpp"  // plssvm::cancellation_token
+#include "plssvm/iteration_info.hpp"      // plssvm::iteration_callback_type
+#include "plssvm/solver_types.hpp"        // plssvm::solver_type
+
+#include <chrono>                         // std::chrono::steady_clock
+#include <memory>                         // std::shared_ptr
+#include <optional>                       // std::optional
+#include <string>                         // std::string
+#include <vector>                         // std::vector
+
+namespace plssvm::detail {
+
+/**
+ * @brief Additional, optional information passed to the backends' CG solver besides the actual system of linear equations.
+ * @tparam T the type of the data (`float` or `double`)
+ */
+template <typename T>
+struct solver_control {
+    /// The type of the data. Must be either `float` or `double`.
+    using real_type = T;
+
+    /**
+     * @brief The initial guess used to warm start the CG algorithm.
+     * @details Must either be empty (all values are initialized with `1.0`) or contain exactly one value less than data points are present,
+     *          since the last data point is eliminated in the dimensional reduction.
+     */
+    std::vector<real_type> initial_guess{};
+    /// The algorithm used to solve the system of linear equations.
+    solver_type solver{ solver_type::cg };
+    /**
+     * @brief If `true`, the kernel matrix-vector multiplications in the CG iterations are performed in single precision.
+     * @details The CG scalars, vectors, and the residual refinements are still calculated using `real_type`.
+     *          Only has an effect if `real_type` is `double`.
+     */
+    bool mixed_precision{ false };
+    /**
+     * @brief In mixed precision, the relative reduction of the residual after which the residual is refined using `real_type`.
+     * @details Afterwards, the CG algorithm is restarted on the refined residual (mixed precision iterative refinement).
+     */
+    real_type mixed_precision_refinement_reduction{ 1e-3 };
+    /// An optional callback invoked after each CG iteration; may stop the CG algorithm early by returning `false`.
+    iteration_callback_type iteration_callback{};
+    /// An optional token used to cooperatively cancel the CG algorithm.
+    std::optional<cancellation_token> cancellation{};
+    /// The point in time after which the CG algorithm is stopped. By default, no deadline is set.
+    std::chrono::steady_clock::time_point deadline{ std::chrono::steady_clock::time_point::max() };
+    /// The file the state of the CG algorithm is periodically written to. If empty, no checkpoints are written.
+    std::string checkpoint_file{};
+    /// The number of CG iterations after which a new checkpoint is written.
+    unsigned long long checkpoint_interval{ 10 };
+    /// If `true`, the CG algorithm is resumed from the state stored in the `checkpoint_file` (if it exists).
+    bool resume{ false };
+    /**
+     * @brief If greater than zero, the rbf kernel matrix-vector multiplications may be approximated such that each entry deviates by at most `rbf_tolerance` times the 1-norm of the multiplied vector.
+     * @details Currently only used in the OpenMP backend which skips all data points whose contribution is provably negligible using a ball tree.
+     *          Only effective for data sets with few features. A value of zero disables the approximation.
+     */
+    real_type rbf_tolerance{ 0.0 };
+    /**
+     * @brief If `false`, the `checkpoint_file` is only read to resume the CG algorithm, but no checkpoints are written.
+     * @details Used if multiple processes solve the same system of linear equations and share the same `checkpoint_file`, e.g., in the distributed C-SVM.
+     */
+    bool write_checkpoints{ true };
+    /**
+     * @brief Identifies the storage of the data points, i.e., the same identity guarantees the same data points.
+     * @details If set, the backends may keep the data points transformed and copied to the device(s) and reuse them in later calls using the same identity.
+     *          If empty, nothing is kept after solving the system of linear equations.
+     */
+    std::shared_ptr<const void> data_identity{};
+
+    /**
+     * @brief Set by the backends after solving the system of linear equations: `true` if the CG algorithm reached the requested residual,
+     *        `false` if it has been stopped early (e.g., cancelled, deadline exceeded, or maximum number of iterations reached).
+     * @note `mutable` since the solver control is passed as `const` reference to the backends.
+     */
+    mutable bool converged{ true };
+
+    /**
+     * @brief Check whether the CG algorithm should be stopped since the cancellation has been requested or the deadline has been exceeded.
+     * @details Once `true` is returned, all further calls return `true` too. Thread-safe.
+     * @return `true` if the CG algorithm should be stopped, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool stop_requested() const noexcept {
+        return (cancellation.has_value() && cancellation->is_cancelled()) || std::chrono::steady_clock::now() >= deadline;
+    }
+};
+
+}  // namespace plssvm::detail
+
+#endif  // PLSSVM_DETAIL_SOLVER_CONTROL_HPP_
@@ -0,0 +1,50 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines the information passed to a user provided callback after each iteration of the CG algorithm.
+ */
+
+#ifndef PLSSVM_ITERATION_INFO_HPP_
+#define PLSSVM_ITERATION_INFO_HPP_
+#pragma once
+
+#include <chrono>      // std::chrono::milliseconds
+#include <functional>  // std::function
+
+namespace plssvm {
+
+/**
+ * @brief The state of the CG algorithm after a single iteration.
+ */
+struct iteration_info {
+    /// The number of the just finished CG iteration (starting at `1`).
+    unsigned long long iteration{ 0 };
+    /// The maximum number of CG iterations.
+    unsigned long long max_iter{ 0 };
+    /// The current residuum, i.e., the squared Euclidean norm of the residual \f$r^T \cdot r\f$.
+    double residual{ 0.0 };
+    /// The residuum at which the CG algorithm is considered to be converged.
+    double target_residual{ 0.0 };
+    /// The time elapsed since the start of the CG algorithm (including the setup of the backend).
+    std::chrono::milliseconds elapsed_time{};
+    /// The runtime of the just finished CG iteration.
+    std::chrono::milliseconds iteration_time{};
+    /// The time spent in the kernel matrix-vector multiplications during the just finished CG iteration.
+    std::chrono::milliseconds matrix_vector_time{};
+};
+
+/**
+ * @brief The type of the callback invoked after each iteration of the CG algorithm.
+ * @details Must return `true` to continue the CG algorithm or `false` to stop it early, e.g., if a time budget has been exhausted.
+ *          If the CG algorithm is stopped early, the current (not yet converged) solution is used for the learned model.
+ */
+using iteration_callback_type = std::function<bool(const iteration_info &)>;
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_ITERATION_INFO_HPP_
@@ -15,6 +15,7 @@
 
 #include "plssvm/data_set.hpp"                        // plssvm::data_set
 #include "plssvm/detail/assert.hpp"                   // PLSSVM_ASSERT
+#include "plssvm/detail/ball_tree.hpp"                // plssvm::detail::ball_tree
 #include "plssvm/detail/io/libsvm_model_parsing.hpp"  // plssvm::detail::io::{parse_libsvm_model_header, write_libsvm_model_data}
 #include "plssvm/detail/io/libsvm_parsing.hpp"        // plssvm::detail::io::parse_libsvm_data
 #include "plssvm/detail/logger.hpp"                   // plssvm::detail::log, plssvm::verbosity_level
@@ -29,6 +30,7 @@
 #include <cstddef>                                    // std::size_t
 #include <iostream>                                   // std::cout, std::endl
 #include <memory>                                     // std::shared_ptr, std::make_shared
+#include <optional>                                   // std::optional
 #include <string>                                     // std::string
 #include <tuple>                                      // std::tie
 #include <utility>                                    // std::move
@@ -133,6 +135,13 @@ class model {
      * @return the bias `rho` (`[[nodiscard]]`)
      */
     [[nodiscard]] real_type rho() const noexcept { return rho_; }
+    /**
+     * @brief Check whether the CG algorithm used to learn this model converged.
+     * @details Is `false` if the CG algorithm has been stopped early, e.g., due to a cancellation, an exceeded time budget, or the maximum number of iterations.
+     *          In this case, the weights are the best ones found so far. Models read from a file are always considered converged.
+     * @return `true` if the CG algorithm converged, `false` otherwise (`[[nodiscard]]`)
+     */
+    [[nodiscard]] bool converged() const noexcept { return converged_; }
 
   private:
     /**
@@ -157,6 +166,8 @@ class model {
     std::shared_ptr<std::vector<real_type>> alpha_ptr_{ nullptr };
     /// The bias after learning this model.
     real_type rho_{ 0.0 };
+    /// `true` if the CG algorithm used to learn this model converged.
+    bool converged_{ true };
 
     /**
      * @brief A vector used to speedup the prediction in case of the linear kernel function.
@@ -164,6 +175,12 @@ class model {
      * @note Must be initialized to an empty vector instead of a `nullptr` in order to be passable as const reference.
      */
     std::shared_ptr<std::vector<real_type>> w_{ std::make_shared<std::vector<real_type>>() };
+    /**
+     * @brief A ball tree over the support vectors used to approximate the predictions in case of the rbf kernel function.
+     * @details Will be built by the first call to `plssvm::csvm::predict` with a `plssvm::rbf_tolerance` and reused by all subsequent calls with the same `plssvm::model`.
+     * @note Must be initialized to an empty optional instead of a `nullptr` in order to be shareable between copies of this model.
+     */
+    std::shared_ptr<std::optional<detail::ball_tree<real_type>>> ball_tree_{ std::make_shared<std::optional<detail::ball_tree<real_type>>>() };
 };
 
 template <typename T, typename U>
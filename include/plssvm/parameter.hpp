@@ -45,6 +45,42 @@ IGOR_MAKE_NAMED_ARGUMENT(cost);
 IGOR_MAKE_NAMED_ARGUMENT(epsilon);
 /// Create a named argument for the maximum number of iterations `max_iter` performed in the CG algorithm.
 IGOR_MAKE_NAMED_ARGUMENT(max_iter);
+/// Create a named argument for enabling single precision kernel matrix-vector multiplications in the CG algorithm while using `double` as `real_type`.
+IGOR_MAKE_NAMED_ARGUMENT(mixed_precision);
+/// Create a named argument for the algorithm used to solve the system of linear equations (classical or pipelined CG).
+IGOR_MAKE_NAMED_ARGUMENT(solver);
+/// Create a named argument for a callback invoked after each iteration of the CG algorithm.
+IGOR_MAKE_NAMED_ARGUMENT(iteration_callback);
+/// Create a named argument for the wall-clock time budget of the CG algorithm.
+IGOR_MAKE_NAMED_ARGUMENT(time_budget);
+/// Create a named argument for a token used to cooperatively cancel the CG algorithm.
+IGOR_MAKE_NAMED_ARGUMENT(cancellation);
+/// Create a named argument for the file the state of the CG algorithm is periodically written to.
+IGOR_MAKE_NAMED_ARGUMENT(checkpoint_file);
+/// Create a named argument for the number of CG iterations after which a new checkpoint is written.
+IGOR_MAKE_NAMED_ARGUMENT(checkpoint_interval);
+/// Create a named argument for resuming the CG algorithm from a previously written checkpoint.
+IGOR_MAKE_NAMED_ARGUMENT(resume);
+/// Create a named argument for the maximum number of bytes used to store the data points in memory during the out-of-core training.
+IGOR_MAKE_NAMED_ARGUMENT(memory_budget);
+/// Create a named argument for the maximum error when approximating the rbf kernel predictions or kernel matrix-vector multiplications by skipping distant data points.
+IGOR_MAKE_NAMED_ARGUMENT(rbf_tolerance);
+/// Create a named argument for the OpenMP backend specific thread pinning policy (none, close, or spread).
+IGOR_MAKE_NAMED_ARGUMENT(openmp_thread_pinning);
+/// Create a named argument for the OpenMP backend specific number of threads used in all parallel regions of a single C-SVM.
+IGOR_MAKE_NAMED_ARGUMENT(openmp_num_threads);
+/// Create a named argument for the OpenMP backend specific CPUs the threads of a single C-SVM are bound to.
+IGOR_MAKE_NAMED_ARGUMENT(openmp_cpu_set);
+/// Create a named argument for the OpenMP backend specific number of host devices the multi-device C-SVM distributes its work across.
+IGOR_MAKE_NAMED_ARGUMENT(openmp_num_devices);
+/// Create a named argument for the OpenMP backend specific block size used in the kernel matrix-vector multiplications.
+IGOR_MAKE_NAMED_ARGUMENT(openmp_block_size);
+/// Create a named argument for the OpenMP backend specific profile file storing the auto-tuned block sizes.
+IGOR_MAKE_NAMED_ARGUMENT(openmp_tuning_profile);
+/// Create a named argument for the OpenCL backend specific number of threads per work-group dimension substituted into the kernels at JIT time.
+IGOR_MAKE_NAMED_ARGUMENT(opencl_thread_block_size);
+/// Create a named argument for the OpenCL backend specific number of data points per work-item dimension substituted into the kernels at JIT time.
+IGOR_MAKE_NAMED_ARGUMENT(opencl_internal_block_size);
 /// Create a named argument for the SYCL backend specific SYCL implementation type (DPC++ or hipSYCL).
 IGOR_MAKE_NAMED_ARGUMENT(sycl_implementation_type);
 /// Create a named argument for the SYCL backend specific kernel invocation type (nd_range or hierarchical).
@@ -65,6 +101,24 @@ constexpr bool has_only_named_args_v = !igor::has_unnamed_arguments<Args...>();
 template <typename... Args>
 constexpr bool has_only_parameter_named_args_v = !igor::has_other_than<Args...>(plssvm::kernel_type, plssvm::gamma, plssvm::degree, plssvm::coef0, plssvm::cost);
 
+/**
+ * @brief Trait to check whether @p Args only contains named-parameter that can be used to initialize a `plssvm::parameter` struct including OpenMP specific named-parameters.
+ */
+template <typename... Args>
+constexpr bool has_only_openmp_parameter_named_args_v = !igor::has_other_than<Args...>(plssvm::kernel_type, plssvm::gamma, plssvm::degree, plssvm::coef0, plssvm::cost, plssvm::openmp_thread_pinning, plssvm::openmp_num_threads, plssvm::openmp_cpu_set, plssvm::openmp_block_size, plssvm::openmp_tuning_profile);
+
+/**
+ * @brief Trait to check whether @p Args only contains named-parameter that can be used to initialize a `plssvm::parameter` struct including the OpenMP multi-device specific named-parameters.
+ */
+template <typename... Args>
+constexpr bool has_only_openmp_device_parameter_named_args_v = !igor::has_other_than<Args...>(plssvm::kernel_type, plssvm::gamma, plssvm::degree, plssvm::coef0, plssvm::cost, plssvm::openmp_num_devices);
+
+/**
+ * @brief Trait to check whether @p Args only contains named-parameter that can be used to initialize a `plssvm::parameter` struct including OpenCL specific named-parameters.
+ */
+template <typename... Args>
+constexpr bool has_only_opencl_parameter_named_args_v = !igor::has_other_than<Args...>(plssvm::kernel_type, plssvm::gamma, plssvm::degree, plssvm::coef0, plssvm::cost, plssvm::opencl_thread_block_size, plssvm::opencl_internal_block_size);
+
 /**
  * @brief Trait to check whether @p Args only contains named-parameter that can be used to initialize a `plssvm::parameter` struct including SYCL specific named-parameters.
  */
@@ -221,7 +275,7 @@ struct parameter {
         // compile time check: each named parameter must only be passed once
         static_assert(!parser.has_duplicates(), "Can only use each named parameter once!");
         // compile time check: only some named parameters are allowed
-        static_assert(!parser.has_other_than(plssvm::kernel_type, plssvm::gamma, plssvm::degree, plssvm::coef0, plssvm::cost, plssvm::sycl_implementation_type, plssvm::sycl_kernel_invocation_type),
+        static_assert(!parser.has_other_than(plssvm::kernel_type, plssvm::gamma, plssvm::degree, plssvm::coef0, plssvm::cost, plssvm::openmp_thread_pinning, plssvm::openmp_num_threads, plssvm::openmp_cpu_set, plssvm::openmp_num_devices, plssvm::openmp_block_size, plssvm::openmp_tuning_profile, plssvm::opencl_thread_block_size, plssvm::opencl_internal_block_size, plssvm::sycl_implementation_type, plssvm::sycl_kernel_invocation_type),
                       "An illegal named parameter has been passed!");
 
         // shorthand function for emitting a warning if a provided parameter is not used by the current kernel function
@@ -0,0 +1,51 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Defines an enumeration holding all possible algorithms used to solve the system of linear equations.
+ */
+
+#ifndef PLSSVM_SOLVER_TYPES_HPP_
+#define PLSSVM_SOLVER_TYPES_HPP_
+#pragma once
+
+#include <iosfwd>  // forward declare std::ostream and std::istream
+
+namespace plssvm {
+
+/**
+ * @brief Enum class for all possible algorithms used to solve the system of linear equations.
+ */
+enum class solver_type {
+    /** The classical Conjugate Gradients (CG) algorithm. */
+    cg,
+    /**
+     * The pipelined (communication-hiding) CG algorithm by [Ghysels and Vanroose](https://doi.org/10.1016/j.parco.2013.06.001).
+     * Needs only one global reduction per iteration which can be overlapped with the kernel matrix-vector multiplication.
+     */
+    pipelined_cg
+};
+
+/**
+ * @brief Output the @p solver type to the given output-stream @p out.
+ * @param[in,out] out the output-stream to write the solver type to
+ * @param[in] solver the solver type
+ * @return the output-stream
+ */
+std::ostream &operator<<(std::ostream &out, solver_type solver);
+
+/**
+ * @brief Use the input-stream @p in to initialize the @p solver type.
+ * @param[in,out] in input-stream to extract the solver type from
+ * @param[in] solver the solver type
+ * @return the input-stream
+ */
+std::istream &operator>>(std::istream &in, solver_type &solver);
+
+}  // namespace plssvm
+
+#endif  // PLSSVM_SOLVER_TYPES_HPP_
@@ -46,7 +46,7 @@ int main(int argc, char *argv[]) {
             if (cmd_parser.max_iter.is_default()) {
                 cmd_parser.max_iter = data.num_data_points();
             }
-            const plssvm::model<real_type, label_type> model = svm->fit(data, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter);
+            const plssvm::model<real_type, label_type> model = svm->fit(data, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter, plssvm::mixed_precision = cmd_parser.mixed_precision, plssvm::solver = cmd_parser.solver, plssvm::checkpoint_file = cmd_parser.checkpoint_filename, plssvm::checkpoint_interval = cmd_parser.checkpoint_interval, plssvm::resume = cmd_parser.resume, plssvm::rbf_tolerance = cmd_parser.rbf_tolerance);
             // save model to file
             model.save(cmd_parser.model_filename);
         }, plssvm::detail::cmd::data_set_factory(cmd_parser));
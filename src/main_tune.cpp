@@ -0,0 +1,366 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Main function compiled to the `plssvm-tune` executable used for tuning the hyper-parameters of a C-SVM.
+ */
+
+#include "plssvm/core.hpp"
+
+#include "plssvm/detail/cmd/data_set_variants.hpp"  // plssvm::detail::cmd::data_set_factory
+#include "plssvm/detail/cmd/parser_tune.hpp"        // plssvm::detail::cmd::{parser_tune, search_type}
+#include "plssvm/detail/logger.hpp"                 // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"    // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_SAVE
+
+#include "fmt/chrono.h"                             // format std::chrono types
+#include "fmt/core.h"                               // fmt::format
+#include "fmt/os.h"                                 // fmt::output_file
+
+#include <algorithm>                                // std::min, std::max, std::shuffle, std::stable_sort
+#include <atomic>                                   // std::atomic
+#include <chrono>                                   // std::chrono::{steady_clock, duration, milliseconds}
+#include <cstddef>                                  // std::size_t
+#include <cstdlib>                                  // EXIT_SUCCESS, EXIT_FAILURE
+#include <exception>                                // std::exception, std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <iostream>                                 // std::cout, std::cerr, std::endl
+#include <memory>                                   // std::unique_ptr
+#include <mutex>                                    // std::mutex, std::lock_guard
+#include <random>                                   // std::mt19937
+#include <string>                                   // std::string
+#include <thread>                                   // std::thread
+#include <utility>                                  // std::move
+#include <variant>                                  // std::visit
+#include <vector>                                   // std::vector
+
+#ifdef _OPENMP
+    #include <omp.h>  // omp_get_max_threads, omp_set_num_threads
+#endif
+
+namespace {
+
+/**
+ * @brief The result of a single trial, i.e., the cross-validation of one hyper-parameter combination.
+ */
+struct trial {
+    /// The unique ID of this trial.
+    std::size_t id{};
+    /// The evaluated hyper-parameter combination.
+    plssvm::parameter params{};
+    /// The number of data points used in the cross-validation.
+    std::size_t num_data_points{};
+    /// The mean accuracy over all folds.
+    double mean_accuracy{};
+    /// The accumulated time needed to learn the models of all folds.
+    std::chrono::milliseconds fit_time{};
+    /// The accumulated time needed to validate the models of all folds.
+    std::chrono::milliseconds predict_time{};
+};
+
+/**
+ * @brief Create all hyper-parameter combinations based on the values provided in @p cmd_parser.
+ * @details Only the hyper-parameters actually used in the respective kernel function are combined, e.g., for the linear kernel only the cost values are varied.
+ * @param[in] cmd_parser the provided command line parser
+ * @param[in] num_features the number of features in the data set; used as default gamma value
+ * @return all hyper-parameter combinations (`[[nodiscard]]`)
+ */
+[[nodiscard]] std::vector<plssvm::parameter> create_candidates(const plssvm::detail::cmd::parser_tune &cmd_parser, const std::size_t num_features) {
+    const std::vector<double> gammas = cmd_parser.gammas.empty() ? std::vector<double>{ 1.0 / static_cast<double>(num_features) } : cmd_parser.gammas;
+    const plssvm::parameter default_params{};
+
+    std::vector<plssvm::parameter> candidates;
+    for (const plssvm::kernel_function_type kernel : cmd_parser.kernel_types) {
+        for (const double cost : cmd_parser.costs) {
+            switch (kernel) {
+                case plssvm::kernel_function_type::linear:
+                    candidates.emplace_back(kernel, default_params.degree.value(), default_params.gamma.value(), default_params.coef0.value(), cost);
+                    break;
+                case plssvm::kernel_function_type::polynomial:
+                    for (const int degree : cmd_parser.degrees) {
+                        for (const double gamma : gammas) {
+                            for (const double coef0 : cmd_parser.coef0s) {
+                                candidates.emplace_back(kernel, degree, gamma, coef0, cost);
+                            }
+                        }
+                    }
+                    break;
+                case plssvm::kernel_function_type::rbf:
+                    for (const double gamma : gammas) {
+                        candidates.emplace_back(kernel, default_params.degree.value(), gamma, default_params.coef0.value(), cost);
+                    }
+                    break;
+            }
+        }
+    }
+    return candidates;
+}
+
+/**
+ * @brief Cross-validate all hyper-parameter @p candidates on the @p data set using `num_parallel_trials` concurrent workers.
+ * @details The available OpenMP threads are distributed evenly among all workers.
+ * @tparam real_type the type of the data points
+ * @tparam label_type the type of the labels
+ * @param[in] cmd_parser the provided command line parser
+ * @param[in] data the data set used for the cross-validation; shared between all workers
+ * @param[in] candidates the hyper-parameter combinations to evaluate
+ * @param[in,out] next_trial_id the ID of the next trial; updated accordingly
+ * @throws plssvm::exception any exception thrown during the cross-validation of a hyper-parameter combination
+ * @return the results of all trials in the same order as the @p candidates (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] std::vector<trial> run_trials(const plssvm::detail::cmd::parser_tune &cmd_parser, const plssvm::data_set<real_type, label_type> &data, const std::vector<plssvm::parameter> &candidates, std::size_t &next_trial_id) {
+    std::vector<trial> trials(candidates.size());
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        trials[i].id = next_trial_id++;
+        trials[i].params = candidates[i];
+        trials[i].num_data_points = data.num_data_points();
+    }
+
+    const std::size_t num_workers = std::min(cmd_parser.num_parallel_trials, candidates.size());
+#ifdef _OPENMP
+    const int num_threads_per_worker = std::max(1, omp_get_max_threads() / static_cast<int>(num_workers));
+#endif
+
+    // the output of the C-SVMs running concurrently would be interleaved -> only output the results of the trials
+    const plssvm::verbosity_level user_verbosity = plssvm::verbosity;
+    const bool log_trials = (user_verbosity & plssvm::verbosity_level::full) != plssvm::verbosity_level::quiet;
+    plssvm::verbosity = plssvm::verbosity_level::quiet;
+    // the performance tracker is not thread-safe -> the results of the trials are tracked afterwards
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_PAUSE();
+
+    std::atomic<std::size_t> next_candidate{ 0 };
+    std::mutex mutex{};
+    std::exception_ptr exception{};
+
+    const auto worker = [&]() {
+#ifdef _OPENMP
+        omp_set_num_threads(num_threads_per_worker);
+#endif
+        for (std::size_t i = next_candidate++; i < candidates.size(); i = next_candidate++) {
+            try {
+                // create SVM
+                const std::unique_ptr<plssvm::csvm> svm = (cmd_parser.backend == plssvm::backend_type::sycl) ? plssvm::make_csvm(cmd_parser.backend, cmd_parser.target, candidates[i], plssvm::sycl_implementation_type = cmd_parser.sycl_implementation_type, plssvm::sycl_kernel_invocation_type = cmd_parser.sycl_kernel_invocation_type)
+                                                                                                             : plssvm::make_csvm(cmd_parser.backend, cmd_parser.target, candidates[i]);
+
+                // cross-validate the current hyper-parameter combination
+                const plssvm::cross_validation_result<real_type> result = cmd_parser.max_iter.is_default() ? svm->cross_validate(data, cmd_parser.num_folds, plssvm::epsilon = cmd_parser.epsilon)
+                                                                                                           : svm->cross_validate(data, cmd_parser.num_folds, plssvm::epsilon = cmd_parser.epsilon, plssvm::max_iter = cmd_parser.max_iter);
+
+                trials[i].mean_accuracy = static_cast<double>(result.mean_accuracy());
+                for (std::size_t fold = 0; fold < result.num_folds(); ++fold) {
+                    trials[i].fit_time += result.fit_times[fold];
+                    trials[i].predict_time += result.predict_times[fold];
+                }
+
+                if (log_trials) {
+                    const std::lock_guard lock{ mutex };
+                    std::cout << fmt::format("Trial {}: kernel_type {}, degree {}, gamma {}, coef0 {}, cost {} on {} data points -> mean accuracy = {:.2f}% (fit in {}, predict in {}).\n",
+                                             trials[i].id,
+                                             candidates[i].kernel_type,
+                                             candidates[i].degree,
+                                             candidates[i].gamma,
+                                             candidates[i].coef0,
+                                             candidates[i].cost,
+                                             trials[i].num_data_points,
+                                             trials[i].mean_accuracy * 100,
+                                             trials[i].fit_time,
+                                             trials[i].predict_time)
+                              << std::flush;
+                }
+            } catch (...) {
+                // remember the first exception and stop all other workers
+                const std::lock_guard lock{ mutex };
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+                next_candidate = candidates.size();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (std::size_t w = 1; w < num_workers; ++w) {
+        workers.emplace_back(worker);
+    }
+    // the main thread is also a worker
+    worker();
+    for (std::thread &t : workers) {
+        t.join();
+    }
+
+    plssvm::verbosity = user_verbosity;
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_RESUME();
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
+    // track the results of all trials
+    for (const trial &t : trials) {
+        const std::string category = fmt::format("trial_{}", t.id);
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ category, "kernel_type", t.params.kernel_type.value() }));
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ category, "degree", t.params.degree.value() }));
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ category, "gamma", t.params.gamma.value() }));
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ category, "coef0", t.params.coef0.value() }));
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ category, "cost", t.params.cost.value() }));
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ category, "num_data_points", t.num_data_points }));
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ category, "mean_accuracy", t.mean_accuracy }));
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ category, "fit_time", t.fit_time }));
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ category, "predict_time", t.predict_time }));
+    }
+
+    return trials;
+}
+
+/**
+ * @brief Sort the @p trials descending by their mean accuracy. Trials using more data points are ranked higher.
+ * @param[in,out] trials the trials to sort
+ */
+void sort_trials(std::vector<trial> &trials) {
+    std::stable_sort(trials.begin(), trials.end(), [](const trial &lhs, const trial &rhs) {
+        if (lhs.num_data_points != rhs.num_data_points) {
+            return lhs.num_data_points > rhs.num_data_points;
+        }
+        return lhs.mean_accuracy > rhs.mean_accuracy;
+    });
+}
+
+/**
+ * @brief Create a subset of the @p data set containing every @p stride-th data point.
+ * @tparam real_type the type of the data points
+ * @tparam label_type the type of the labels
+ * @param[in] data the data set to create the subset from
+ * @param[in] stride the distance between two data points in the original data set
+ * @return the subset (`[[nodiscard]]`)
+ */
+template <typename real_type, typename label_type>
+[[nodiscard]] plssvm::data_set<real_type, label_type> create_subset(const plssvm::data_set<real_type, label_type> &data, const std::size_t stride) {
+    std::vector<std::vector<real_type>> data_points;
+    std::vector<label_type> labels;
+    for (std::size_t i = 0; i < data.num_data_points(); i += stride) {
+        data_points.push_back(data.data()[i]);
+        labels.push_back(data.labels().value().get()[i]);
+    }
+    return plssvm::data_set<real_type, label_type>{ std::move(data_points), std::move(labels) };
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    try {
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+        // parse SVM parameter from command line
+        plssvm::detail::cmd::parser_tune cmd_parser{ argc, argv };
+
+        // output used parameter
+        plssvm::detail::log(plssvm::verbosity_level::full,
+                            "\ntask: hyper-parameter tuning\n{}\n\n\n",
+                            cmd_parser);
+
+        // create data set
+        std::visit([&](auto &&data) {
+            using real_type = typename std::remove_reference_t<decltype(data)>::real_type;
+            using label_type = typename std::remove_reference_t<decltype(data)>::label_type;
+
+            std::vector<plssvm::parameter> candidates = create_candidates(cmd_parser, data.num_features());
+            std::size_t next_trial_id{ 0 };
+            std::vector<trial> trials;
+
+            switch (cmd_parser.search) {
+                case plssvm::detail::cmd::search_type::grid:
+                    trials = run_trials(cmd_parser, data, candidates, next_trial_id);
+                    break;
+                case plssvm::detail::cmd::search_type::random: {
+                    // randomly select at most num_trials hyper-parameter combinations
+                    std::mt19937 rng{ static_cast<std::mt19937::result_type>(cmd_parser.seed) };
+                    std::shuffle(candidates.begin(), candidates.end(), rng);
+                    candidates.resize(std::min(candidates.size(), cmd_parser.num_trials));
+                    trials = run_trials(cmd_parser, data, candidates, next_trial_id);
+                } break;
+                case plssvm::detail::cmd::search_type::successive_halving: {
+                    // calculate the number of rounds necessary to reduce all hyper-parameter combinations to a single one
+                    std::size_t num_rounds{ 0 };
+                    for (std::size_t num_candidates = candidates.size(); num_candidates > 1; num_candidates = (num_candidates + cmd_parser.halving_factor - 1) / cmd_parser.halving_factor) {
+                        ++num_rounds;
+                    }
+                    // each fold must contain at least two data points
+                    const std::size_t max_stride = std::max<std::size_t>(1, data.num_data_points() / (2 * cmd_parser.num_folds));
+
+                    for (std::size_t round = 0; round <= num_rounds; ++round) {
+                        // in each round, the number of used data points is multiplied by the halving factor
+                        std::size_t stride{ 1 };
+                        for (std::size_t r = round; r < num_rounds && stride < max_stride; ++r) {
+                            stride *= cmd_parser.halving_factor;
+                        }
+                        stride = std::min(stride, max_stride);
+
+                        std::vector<trial> round_trials = run_trials(cmd_parser, stride == 1 ? data : create_subset(data, stride), candidates, next_trial_id);
+                        trials.insert(trials.end(), round_trials.cbegin(), round_trials.cend());
+
+                        // only keep the best hyper-parameter combinations for the next round
+                        sort_trials(round_trials);
+                        candidates.resize((candidates.size() + cmd_parser.halving_factor - 1) / cmd_parser.halving_factor);
+                        for (std::size_t i = 0; i < candidates.size(); ++i) {
+                            candidates[i] = round_trials[i].params;
+                        }
+                    }
+                } break;
+            }
+
+            // create and output the leaderboard
+            sort_trials(trials);
+            auto out = fmt::output_file(cmd_parser.leaderboard_filename);
+            out.print("rank,trial,kernel_type,degree,gamma,coef0,cost,num_data_points,mean_accuracy,fit_time_ms,predict_time_ms\n");
+            for (std::size_t rank = 0; rank < trials.size(); ++rank) {
+                const trial &t = trials[rank];
+                out.print("{},{},{},{},{},{},{},{},{},{},{}\n",
+                          rank + 1,
+                          t.id,
+                          t.params.kernel_type,
+                          t.params.degree,
+                          t.params.gamma,
+                          t.params.coef0,
+                          t.params.cost,
+                          t.num_data_points,
+                          t.mean_accuracy,
+                          t.fit_time.count(),
+                          t.predict_time.count());
+            }
+
+            if (!trials.empty()) {
+                const trial &best = trials.front();
+                plssvm::detail::log(plssvm::verbosity_level::full | plssvm::verbosity_level::libsvm,
+                                    "\nBest hyper-parameters (trial {}): kernel_type {}, degree {}, gamma {}, coef0 {}, cost {} -> mean accuracy = {:.2f}%\n"
+                                    "Wrote the leaderboard of {} trials to '{}'.\n",
+                                    best.id,
+                                    best.params.kernel_type,
+                                    best.params.degree,
+                                    best.params.gamma,
+                                    best.params.coef0,
+                                    best.params.cost,
+                                    best.mean_accuracy * 100,
+                                    trials.size(),
+                                    cmd_parser.leaderboard_filename);
+            }
+        }, plssvm::detail::cmd::data_set_factory(cmd_parser));
+
+        const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+        plssvm::detail::log(plssvm::verbosity_level::full,
+                            "\nTotal runtime: {}\n",
+                            plssvm::detail::tracking_entry{ "", "total_time", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+
+        PLSSVM_DETAIL_PERFORMANCE_TRACKER_SAVE(cmd_parser.performance_tracking_filename);
+
+    } catch (const plssvm::exception &e) {
+        std::cerr << e.what_with_loc() << std::endl;
+        return EXIT_FAILURE;
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/CUDA/cg_kernel.cuh"
+
+#include "plssvm/constants.hpp"  // plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE
+
+namespace plssvm::cuda {
+
+template <typename real_type>
+__global__ void device_kernel_axpy(const real_type alpha, const real_type *x, real_type *y, const kernel_index_type size) {
+    const kernel_index_type index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index < size) {
+        y[index] += alpha * x[index];
+    }
+}
+template __global__ void device_kernel_axpy(const float, const float *, float *, const kernel_index_type);
+template __global__ void device_kernel_axpy(const double, const double *, double *, const kernel_index_type);
+
+template <typename real_type>
+__global__ void device_kernel_xpby(const real_type *x, const real_type beta, real_type *y, const kernel_index_type size) {
+    const kernel_index_type index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index < size) {
+        y[index] = x[index] + beta * y[index];
+    }
+}
+template __global__ void device_kernel_xpby(const float *, const float, float *, const kernel_index_type);
+template __global__ void device_kernel_xpby(const double *, const double, double *, const kernel_index_type);
+
+template <typename real_type>
+__global__ void device_kernel_dot(const real_type *x, const real_type *y, real_type *partial_sums, const kernel_index_type size) {
+    __shared__ real_type block_sums[THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE];
+    const kernel_index_type thread_id = threadIdx.x;
+    const kernel_index_type block_size = blockDim.x;
+
+    // grid-stride loop: each thread accumulates multiple values if the vectors are larger than the grid
+    real_type temp{ 0.0 };
+    for (kernel_index_type i = blockIdx.x * block_size + thread_id; i < size; i += gridDim.x * block_size) {
+        temp += x[i] * y[i];
+    }
+    block_sums[thread_id] = temp;
+
+    // tree-based reduction in shared memory
+    for (kernel_index_type stride = 1; stride < block_size; stride *= 2) {
+        __syncthreads();
+        if (thread_id % (2 * stride) == 0 && thread_id + stride < block_size) {
+            block_sums[thread_id] += block_sums[thread_id + stride];
+        }
+    }
+    if (thread_id == 0) {
+        partial_sums[blockIdx.x] = block_sums[0];
+    }
+}
+template __global__ void device_kernel_dot(const float *, const float *, float *, const kernel_index_type);
+template __global__ void device_kernel_dot(const double *, const double *, double *, const kernel_index_type);
+
+template <typename real_type>
+__global__ void device_kernel_sum(real_type *partial_sums, const kernel_index_type size) {
+    __shared__ real_type block_sums[THREAD_BLOCK_SIZE * THREAD_BLOCK_SIZE];
+    const kernel_index_type thread_id = threadIdx.x;
+    const kernel_index_type block_size = blockDim.x;
+
+    real_type temp{ 0.0 };
+    for (kernel_index_type i = thread_id; i < size; i += block_size) {
+        temp += partial_sums[i];
+    }
+    block_sums[thread_id] = temp;
+
+    // tree-based reduction in shared memory
+    // note: all partial sums have been read before the first barrier, i.e., the result may overwrite them
+    for (kernel_index_type stride = 1; stride < block_size; stride *= 2) {
+        __syncthreads();
+        if (thread_id % (2 * stride) == 0 && thread_id + stride < block_size) {
+            block_sums[thread_id] += block_sums[thread_id + stride];
+        }
+    }
+    if (thread_id == 0) {
+        partial_sums[0] = block_sums[0];
+    }
+}
+template __global__ void device_kernel_sum(float *, const kernel_index_type);
+template __global__ void device_kernel_sum(double *, const kernel_index_type);
+
+}  // namespace plssvm::cuda
@@ -9,7 +9,7 @@
 #include "plssvm/backends/CUDA/detail/device_ptr.cuh"
 
 #include "plssvm/backends/CUDA/detail/fill_kernel.cuh"  // plssvm::cuda::detail::fill_array
-#include "plssvm/backends/CUDA/detail/utility.cuh"      // PLSSVM_CUDA_ERROR_CHECK, plssvm::cuda::detail::get_device_count
+#include "plssvm/backends/CUDA/detail/utility.cuh"      // PLSSVM_CUDA_ERROR_CHECK, plssvm::cuda::detail::{get_device_count, get_transfer_stream}
 #include "plssvm/backends/CUDA/exceptions.hpp"          // plssvm::cuda::backend_exception
 #include "plssvm/backends/gpu_device_ptr.hpp"           // plssvm::detail::gpu_device_ptr
 #include "plssvm/detail/assert.hpp"                     // PLSSVM_ASSERT
@@ -17,6 +17,7 @@
 #include "fmt/core.h"                                   // fmt::format
 
 #include <algorithm>                                    // std::min
+#include <utility>                                      // std::exchange, std::move, std::swap
 
 namespace plssvm::cuda::detail {
 
@@ -30,9 +31,25 @@ device_ptr<T>::device_ptr(const size_type size, const queue_type device) :
     PLSSVM_CUDA_ERROR_CHECK(cudaMalloc(reinterpret_cast<void **>(&data_), size_ * sizeof(value_type)));
 }
 
+template <typename T>
+device_ptr<T>::device_ptr(device_ptr &&other) noexcept :
+    base_type{ std::move(other) },
+    copy_event_{ std::exchange(other.copy_event_, nullptr) } {}
+
+template <typename T>
+auto device_ptr<T>::operator=(device_ptr &&other) noexcept -> device_ptr & {
+    base_type::operator=(std::move(other));
+    std::swap(copy_event_, other.copy_event_);
+    return *this;
+}
+
 template <typename T>
 device_ptr<T>::~device_ptr() {
     detail::set_device(queue_);
+    if (copy_event_ != nullptr) {
+        PLSSVM_CUDA_ERROR_CHECK(cudaEventSynchronize(copy_event_));
+        PLSSVM_CUDA_ERROR_CHECK(cudaEventDestroy(copy_event_));
+    }
     PLSSVM_CUDA_ERROR_CHECK(cudaFree(data_));
 }
 
@@ -40,6 +57,8 @@ template <typename T>
 void device_ptr<T>::memset(const int pattern, const size_type pos, const size_type num_bytes) {
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
 
+    this->wait_for_async_copies();
+
     if (pos >= size_) {
         throw backend_exception{ fmt::format("Illegal access in memset!: {} >= {}", pos, size_) };
     }
@@ -53,6 +72,8 @@ template <typename T>
 void device_ptr<T>::fill(const value_type value, const size_type pos, const size_type count) {
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
 
+    this->wait_for_async_copies();
+
     if (pos >= size_) {
         throw backend_exception{ fmt::format("Illegal access in fill!: {} >= {}", pos, size_) };
     }
@@ -74,6 +95,8 @@ void device_ptr<T>::copy_to_device(const_host_pointer_type data_to_copy, const s
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
     PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
 
+    this->wait_for_async_copies();
+
     detail::set_device(queue_);
     const size_type rcount = std::min(count, size_ - pos);
     PLSSVM_CUDA_ERROR_CHECK(cudaMemcpy(data_ + pos, data_to_copy, rcount * sizeof(value_type), cudaMemcpyHostToDevice));
@@ -84,11 +107,41 @@ void device_ptr<T>::copy_to_host(host_pointer_type buffer, const size_type pos,
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
     PLSSVM_ASSERT(buffer != nullptr, "Invalid host pointer for the data to copy!");
 
+    this->wait_for_async_copies();
+
     detail::set_device(queue_);
     const size_type rcount = std::min(count, size_ - pos);
     PLSSVM_CUDA_ERROR_CHECK(cudaMemcpy(buffer, data_ + pos, rcount * sizeof(value_type), cudaMemcpyDeviceToHost));
 }
 
+template <typename T>
+void device_ptr<T>::copy_to_device_async(const_host_pointer_type data_to_copy, const size_type pos, const size_type count) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+    PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
+
+    detail::set_device(queue_);
+    const cudaStream_t transfer_stream = detail::get_transfer_stream(queue_);
+    if (copy_event_ == nullptr) {
+        PLSSVM_CUDA_ERROR_CHECK(cudaEventCreateWithFlags(&copy_event_, cudaEventDisableTiming));
+    }
+    // the copy may not overtake the work previously enqueued in the default stream (e.g., a memset of this device_ptr)
+    PLSSVM_CUDA_ERROR_CHECK(cudaEventRecord(copy_event_, nullptr));
+    PLSSVM_CUDA_ERROR_CHECK(cudaStreamWaitEvent(transfer_stream, copy_event_, 0));
+
+    const size_type rcount = std::min(count, size_ - pos);
+    PLSSVM_CUDA_ERROR_CHECK(cudaMemcpyAsync(data_ + pos, data_to_copy, rcount * sizeof(value_type), cudaMemcpyHostToDevice, transfer_stream));
+
+    // the event is completed as soon as all previous copies in the in-order transfer stream are completed
+    PLSSVM_CUDA_ERROR_CHECK(cudaEventRecord(copy_event_, transfer_stream));
+}
+
+template <typename T>
+void device_ptr<T>::wait_for_async_copies() const {
+    if (copy_event_ != nullptr) {
+        PLSSVM_CUDA_ERROR_CHECK(cudaEventSynchronize(copy_event_));
+    }
+}
+
 template class device_ptr<float>;
 template class device_ptr<double>;
 
@@ -12,6 +12,10 @@
 
 #include "fmt/format.h"                         // fmt::format
 
+#include <cstddef>                              // std::size_t
+#include <mutex>                                // std::mutex, std::lock_guard
+#include <vector>                               // std::vector
+
 namespace plssvm::cuda::detail {
 
 void gpu_assert(const cudaError_t code) {
@@ -46,4 +50,25 @@ void device_synchronize(const int device) {
     PLSSVM_CUDA_ERROR_CHECK(cudaDeviceSynchronize());
 }
 
+std::size_t get_device_memory(const int device) {
+    set_device(device);
+    std::size_t free_memory{};
+    std::size_t total_memory{};
+    PLSSVM_CUDA_ERROR_CHECK(cudaMemGetInfo(&free_memory, &total_memory));
+    return free_memory;
+}
+
+cudaStream_t get_transfer_stream(const int device) {
+    // the streams live until the end of the program
+    static std::mutex transfer_streams_mutex;
+    static std::vector<cudaStream_t> transfer_streams(get_device_count(), nullptr);
+
+    set_device(device);
+    const std::lock_guard<std::mutex> lock{ transfer_streams_mutex };
+    if (transfer_streams[device] == nullptr) {
+        PLSSVM_CUDA_ERROR_CHECK(cudaStreamCreateWithFlags(&transfer_streams[device], cudaStreamNonBlocking));
+    }
+    return transfer_streams[device];
+}
+
 }  // namespace plssvm::cuda::detail
\ No newline at end of file
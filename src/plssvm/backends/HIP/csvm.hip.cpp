@@ -8,8 +8,9 @@
 
 #include "plssvm/backends/HIP/csvm.hpp"
 
+#include "plssvm/backends/HIP/cg_kernel.hip.hpp"          // plssvm::hip::{device_kernel_axpy, device_kernel_xpby, device_kernel_dot, device_kernel_sum}
 #include "plssvm/backends/HIP/detail/device_ptr.hip.hpp"  // plssvm::hip::detail::device_ptr
-#include "plssvm/backends/HIP/detail/utility.hip.hpp"     // plssvm::hip::detail::{device_synchronize, get_device_count, set_device, peek_at_last_error}
+#include "plssvm/backends/HIP/detail/utility.hip.hpp"     // plssvm::hip::detail::{device_synchronize, get_device_memory, get_device_count, set_device, peek_at_last_error}
 #include "plssvm/backends/HIP/exceptions.hpp"             // plssvm::hip::backend_exception
 #include "plssvm/backends/HIP/predict_kernel.hip.hpp"     // plssvm::hip::detail::{device_kernel_w_linear, device_kernel_predict_polynomial, device_kernel_predict_rbf}
 #include "plssvm/backends/HIP/q_kernel.hip.hpp"           // plssvm::hip::detail::{device_kernel_q_linear, device_kernel_q_polynomial, device_kernel_q_rbf}
@@ -100,6 +101,10 @@ void csvm::device_synchronize(const queue_type &queue) const {
     detail::device_synchronize(queue);
 }
 
+std::size_t csvm::get_device_memory(const queue_type &queue) const {
+    return detail::get_device_memory(queue);
+}
+
 std::pair<dim3, dim3> execution_range_to_native(const ::plssvm::detail::execution_range &range) {
     const dim3 grid(range.grid[0], range.grid[1], range.grid[2]);
     const dim3 block(range.block[0], range.block[1], range.block[2]);
@@ -131,7 +136,7 @@ template void csvm::run_q_kernel_impl(std::size_t, const ::plssvm::detail::execu
 template void csvm::run_q_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, std::size_t, std::size_t) const;
 
 template <typename real_type>
-void csvm::run_svm_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const real_type QA_cost, const real_type add, const std::size_t num_data_points_padded, const std::size_t num_features) const {
+void csvm::run_svm_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const real_type QA_cost, const real_type add, const std::size_t num_data_points_padded, const std::size_t num_features, const std::size_t row_offset) const {
     const auto [grid, block] = execution_range_to_native(range);
 
     detail::set_device(static_cast<queue_type>(device));
@@ -140,19 +145,17 @@ void csvm::run_svm_kernel_impl(const std::size_t device, const ::plssvm::detail:
             hip::device_kernel_linear<<<grid, block>>>(q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, static_cast<kernel_index_type>(device));
             break;
         case kernel_function_type::polynomial:
-            PLSSVM_ASSERT(device == 0, "The polynomial kernel function currently only supports single GPU execution!");
-            hip::device_kernel_polynomial<<<grid, block>>>(q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.degree.value(), params.gamma.value(), params.coef0.value());
+            hip::device_kernel_polynomial<<<grid, block>>>(q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.degree.value(), params.gamma.value(), params.coef0.value(), static_cast<kernel_index_type>(row_offset));
             break;
         case kernel_function_type::rbf:
-            PLSSVM_ASSERT(device == 0, "The radial basis function kernel function currently only supports single GPU execution!");
-            hip::device_kernel_rbf<<<grid, block>>>(q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.gamma.value());
+            hip::device_kernel_rbf<<<grid, block>>>(q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.gamma.value(), static_cast<kernel_index_type>(row_offset));
             break;
     }
     detail::peek_at_last_error();
 }
 
-template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, float, float, std::size_t, std::size_t) const;
-template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, double, double, std::size_t, std::size_t) const;
+template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, float, float, std::size_t, std::size_t, std::size_t) const;
+template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, double, double, std::size_t, std::size_t, std::size_t) const;
 
 template <typename real_type>
 void csvm::run_w_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &w_d, const device_ptr_type<real_type> &alpha_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, const std::size_t num_data_points, const std::size_t num_features) const {
@@ -187,4 +190,52 @@ void csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &rang
 template void csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, std::size_t, std::size_t, std::size_t) const;
 template void csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, std::size_t, std::size_t, std::size_t) const;
 
+template <typename real_type>
+void csvm::run_axpy_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const real_type alpha, const device_ptr_type<real_type> &x_d, device_ptr_type<real_type> &y_d, const std::size_t size) const {
+    const auto [grid, block] = execution_range_to_native(range);
+
+    detail::set_device(static_cast<queue_type>(device));
+    hip::device_kernel_axpy<<<grid, block>>>(alpha, x_d.get(), y_d.get(), static_cast<kernel_index_type>(size));
+    detail::peek_at_last_error();
+}
+
+template void csvm::run_axpy_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, float, const device_ptr_type<float> &, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_axpy_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, double, const device_ptr_type<double> &, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void csvm::run_xpby_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const real_type beta, device_ptr_type<real_type> &y_d, const std::size_t size) const {
+    const auto [grid, block] = execution_range_to_native(range);
+
+    detail::set_device(static_cast<queue_type>(device));
+    hip::device_kernel_xpby<<<grid, block>>>(x_d.get(), beta, y_d.get(), static_cast<kernel_index_type>(size));
+    detail::peek_at_last_error();
+}
+
+template void csvm::run_xpby_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<float> &, float, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_xpby_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<double> &, double, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void csvm::run_dot_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &y_d, device_ptr_type<real_type> &partial_sums_d, const std::size_t size) const {
+    const auto [grid, block] = execution_range_to_native(range);
+
+    detail::set_device(static_cast<queue_type>(device));
+    hip::device_kernel_dot<<<grid, block>>>(x_d.get(), y_d.get(), partial_sums_d.get(), static_cast<kernel_index_type>(size));
+    detail::peek_at_last_error();
+}
+
+template void csvm::run_dot_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_dot_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void csvm::run_sum_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &partial_sums_d, const std::size_t size) const {
+    const auto [grid, block] = execution_range_to_native(range);
+
+    detail::set_device(static_cast<queue_type>(device));
+    hip::device_kernel_sum<<<grid, block>>>(partial_sums_d.get(), static_cast<kernel_index_type>(size));
+    detail::peek_at_last_error();
+}
+
+template void csvm::run_sum_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_sum_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, device_ptr_type<double> &, std::size_t) const;
+
 }  // namespace plssvm::hip
@@ -9,7 +9,7 @@
 #include "plssvm/backends/HIP/detail/device_ptr.hip.hpp"
 
 #include "plssvm/backends/HIP/detail/fill_kernel.hip.hpp"  // plssvm::hip::detail::fill_array
-#include "plssvm/backends/HIP/detail/utility.hip.hpp"      // PLSSVM_HIP_ERROR_CHECK, plssvm::hip::detail::get_device_count
+#include "plssvm/backends/HIP/detail/utility.hip.hpp"      // PLSSVM_HIP_ERROR_CHECK, plssvm::hip::detail::{get_device_count, get_transfer_stream}
 #include "plssvm/backends/HIP/exceptions.hpp"              // plssvm::hip::backend_exception
 #include "plssvm/backends/gpu_device_ptr.hpp"              // plssvm::detail::gpu_device_ptr
 #include "plssvm/detail/assert.hpp"                        // PLSSVM_ASSERT
@@ -19,6 +19,7 @@
 #include "fmt/core.h"  // fmt::format
 
 #include <algorithm>  // std::min
+#include <utility>    // std::exchange, std::move, std::swap
 
 namespace plssvm::hip::detail {
 
@@ -32,9 +33,25 @@ device_ptr<T>::device_ptr(const size_type size, const queue_type device) :
     PLSSVM_HIP_ERROR_CHECK(hipMalloc(reinterpret_cast<void **>(&data_), size_ * sizeof(value_type)));
 }
 
+template <typename T>
+device_ptr<T>::device_ptr(device_ptr &&other) noexcept :
+    base_type{ std::move(other) },
+    copy_event_{ std::exchange(other.copy_event_, nullptr) } {}
+
+template <typename T>
+auto device_ptr<T>::operator=(device_ptr &&other) noexcept -> device_ptr & {
+    base_type::operator=(std::move(other));
+    std::swap(copy_event_, other.copy_event_);
+    return *this;
+}
+
 template <typename T>
 device_ptr<T>::~device_ptr() {
     detail::set_device(queue_);
+    if (copy_event_ != nullptr) {
+        PLSSVM_HIP_ERROR_CHECK(hipEventSynchronize(copy_event_));
+        PLSSVM_HIP_ERROR_CHECK(hipEventDestroy(copy_event_));
+    }
     PLSSVM_HIP_ERROR_CHECK(hipFree(data_));
 }
 
@@ -42,6 +59,8 @@ template <typename T>
 void device_ptr<T>::memset(const int pattern, const size_type pos, const size_type num_bytes) {
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
 
+    this->wait_for_async_copies();
+
     if (pos >= size_) {
         throw backend_exception{ fmt::format("Illegal access in memset!: {} >= {}", pos, size_) };
     }
@@ -55,6 +74,8 @@ template <typename T>
 void device_ptr<T>::fill(const value_type value, const size_type pos, const size_type count) {
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
 
+    this->wait_for_async_copies();
+
     if (pos >= size_) {
         throw backend_exception{ fmt::format("Illegal access in fill!: {} >= {}", pos, size_) };
     }
@@ -76,6 +97,8 @@ void device_ptr<T>::copy_to_device(const_host_pointer_type data_to_copy, const s
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
     PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
 
+    this->wait_for_async_copies();
+
     detail::set_device(queue_);
     const size_type rcount = std::min(count, size_ - pos);
     PLSSVM_HIP_ERROR_CHECK(hipMemcpy(data_ + pos, data_to_copy, rcount * sizeof(value_type), hipMemcpyHostToDevice));
@@ -86,11 +109,41 @@ void device_ptr<T>::copy_to_host(host_pointer_type buffer, const size_type pos,
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
     PLSSVM_ASSERT(buffer != nullptr, "Invalid host pointer for the data to copy!");
 
+    this->wait_for_async_copies();
+
     detail::set_device(queue_);
     const size_type rcount = std::min(count, size_ - pos);
     PLSSVM_HIP_ERROR_CHECK(hipMemcpy(buffer, data_ + pos, rcount * sizeof(value_type), hipMemcpyDeviceToHost));
 }
 
+template <typename T>
+void device_ptr<T>::copy_to_device_async(const_host_pointer_type data_to_copy, const size_type pos, const size_type count) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+    PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
+
+    detail::set_device(queue_);
+    const hipStream_t transfer_stream = detail::get_transfer_stream(queue_);
+    if (copy_event_ == nullptr) {
+        PLSSVM_HIP_ERROR_CHECK(hipEventCreateWithFlags(&copy_event_, hipEventDisableTiming));
+    }
+    // the copy may not overtake the work previously enqueued in the default stream (e.g., a memset of this device_ptr)
+    PLSSVM_HIP_ERROR_CHECK(hipEventRecord(copy_event_, nullptr));
+    PLSSVM_HIP_ERROR_CHECK(hipStreamWaitEvent(transfer_stream, copy_event_, 0));
+
+    const size_type rcount = std::min(count, size_ - pos);
+    PLSSVM_HIP_ERROR_CHECK(hipMemcpyAsync(data_ + pos, data_to_copy, rcount * sizeof(value_type), hipMemcpyHostToDevice, transfer_stream));
+
+    // the event is completed as soon as all previous copies in the in-order transfer stream are completed
+    PLSSVM_HIP_ERROR_CHECK(hipEventRecord(copy_event_, transfer_stream));
+}
+
+template <typename T>
+void device_ptr<T>::wait_for_async_copies() const {
+    if (copy_event_ != nullptr) {
+        PLSSVM_HIP_ERROR_CHECK(hipEventSynchronize(copy_event_));
+    }
+}
+
 template class device_ptr<float>;
 template class device_ptr<double>;
 
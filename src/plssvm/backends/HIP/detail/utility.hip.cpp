@@ -10,10 +10,14 @@
 
 #include "plssvm/backends/HIP/exceptions.hpp"  // plssvm::hip::backend_exception
 
-#include "hip/hip_runtime_api.h"  // hipError_t, hipSuccess, hipGetErrorName, hipGetErrorString, hipGetDeviceCount, hipSetDevice, hipPeekAtLastError, hipDeviceSynchronize
+#include "hip/hip_runtime_api.h"  // hipError_t, hipSuccess, hipGetErrorName, hipGetErrorString, hipGetDeviceCount, hipSetDevice, hipPeekAtLastError, hipDeviceSynchronize, hipMemGetInfo, hipStreamCreateWithFlags, hipStreamNonBlocking
 
 #include "fmt/core.h"  // fmt::format
 
+#include <cstddef>  // std::size_t
+#include <mutex>    // std::mutex, std::lock_guard
+#include <vector>   // std::vector
+
 namespace plssvm::hip::detail {
 
 void gpu_assert(const hipError_t code) {
@@ -48,4 +52,25 @@ void device_synchronize(const int device) {
     PLSSVM_HIP_ERROR_CHECK(hipDeviceSynchronize());
 }
 
+std::size_t get_device_memory(const int device) {
+    set_device(device);
+    std::size_t free_memory{};
+    std::size_t total_memory{};
+    PLSSVM_HIP_ERROR_CHECK(hipMemGetInfo(&free_memory, &total_memory));
+    return free_memory;
+}
+
+hipStream_t get_transfer_stream(const int device) {
+    // the streams live until the end of the program
+    static std::mutex transfer_streams_mutex;
+    static std::vector<hipStream_t> transfer_streams(get_device_count(), nullptr);
+
+    set_device(device);
+    const std::lock_guard<std::mutex> lock{ transfer_streams_mutex };
+    if (transfer_streams[device] == nullptr) {
+        PLSSVM_HIP_ERROR_CHECK(hipStreamCreateWithFlags(&transfer_streams[device], hipStreamNonBlocking));
+    }
+    return transfer_streams[device];
+}
+
 }  // namespace plssvm::hip::detail
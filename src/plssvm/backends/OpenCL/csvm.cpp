@@ -12,7 +12,7 @@
 #include "plssvm/backends/OpenCL/detail/context.hpp"        // plssvm::opencl::detail::context
 #include "plssvm/backends/OpenCL/detail/device_ptr.hpp"     // plssvm::opencl::detail::device_ptr
 #include "plssvm/backends/OpenCL/detail/kernel.hpp"         // plssvm::opencl::detail::{compute_kernel_name, kernel}
-#include "plssvm/backends/OpenCL/detail/utility.hpp"        // plssvm::opencl::detail::{get_contexts, create_command_queues, run_kernel, kernel_type_to_function_name, device_synchronize}
+#include "plssvm/backends/OpenCL/detail/utility.hpp"        // plssvm::opencl::detail::{get_contexts, get_max_work_group_size, create_command_queues, run_kernel, kernel_type_to_function_name, device_synchronize, get_device_memory}
 #include "plssvm/backends/OpenCL/exceptions.hpp"            // plssvm::opencl::backend_exception
 #include "plssvm/backends/gpu_csvm.hpp"                     // plssvm::detail::gpu_csvm
 #include "plssvm/constants.hpp"                             // plssvm::kernel_index_type
@@ -25,12 +25,15 @@
 #include "plssvm/parameter.hpp"                             // plssvm::parameter, plssvm::detail::parameter
 #include "plssvm/target_platforms.hpp"                      // plssvm::target_platform
 
+#include "CL/cl.h"                                          // cl_device_id
+
 #include "fmt/chrono.h"                                     // can directly print std::chrono literals
 #include "fmt/core.h"                                       // fmt::format
 #include "fmt/ostream.h"                                    // can use fmt using operator<< overloads
 
 #include <algorithm>                                        // std::all_of
 #include <chrono>                                           // std::chrono
+#include <cstddef>                                          // std::size_t
 #include <exception>                                        // std::terminate
 #include <iostream>                                         // std::cout, std::endl
 #include <string>                                           // std::string
@@ -91,6 +94,17 @@ void csvm::init(const target_platform target) {
         throw backend_exception{ fmt::format("OpenCL backend selected but no devices for the target {} were found!", target) };
     }
 
+    // the block sizes are substituted into the OpenCL kernels and, therefore, must be valid on all devices
+    if (thread_block_size_ < 1 || internal_block_size_ < 1) {
+        throw backend_exception{ fmt::format("The thread block size ({}) and the internal block size ({}) must be greater than 0!", thread_block_size_, internal_block_size_) };
+    }
+    const auto work_group_size = static_cast<std::size_t>(thread_block_size_) * static_cast<std::size_t>(thread_block_size_);
+    for (const cl_device_id device : contexts_[0].devices) {
+        if (const std::size_t max_work_group_size = detail::get_max_work_group_size(device); work_group_size > max_work_group_size) {
+            throw backend_exception{ fmt::format("The thread block size {} results in work-groups of size {}, but the OpenCL device only supports work-groups of at most size {}!", thread_block_size_, work_group_size, max_work_group_size) };
+        }
+    }
+
     // print OpenCL info
     plssvm::detail::log(verbosity_level::full,
                         "\nUsing OpenCL as backend.\n");
@@ -98,6 +112,10 @@ void csvm::init(const target_platform target) {
         plssvm::detail::log(verbosity_level::full,
                             "Using {} as automatic target platform.\n", target_);
     }
+    plssvm::detail::log(verbosity_level::full,
+                        "Using a thread block size of {} and an internal block size of {}.\n",
+                        plssvm::detail::tracking_entry{ "backend", "thread_block_size", thread_block_size_ },
+                        plssvm::detail::tracking_entry{ "backend", "internal_block_size", internal_block_size_ });
     PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ "backend", "backend", plssvm::backend_type::opencl }));
 
     // create command_queues and JIT compile OpenCL kernels
@@ -106,7 +124,7 @@ void csvm::init(const target_platform target) {
     // get kernel names
     const std::vector<std::pair<detail::compute_kernel_name, std::string>> kernel_names = detail::kernel_type_to_function_names(kernel);
     // compile all kernels for float and double
-    devices_ = detail::create_command_queues(contexts_, target_, kernel_names);
+    devices_ = detail::create_command_queues(contexts_, target_, kernel_names, thread_block_size_, internal_block_size_);
 
     const auto jit_end_time = std::chrono::steady_clock::now();
     plssvm::detail::log(verbosity_level::full | verbosity_level::timing,
@@ -126,8 +144,8 @@ void csvm::init(const target_platform target) {
                         "\n");
 
     // sanity checks for the number of the float OpenCL kernels
-    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.float_kernels.size() == 3; }),
-                  "Every command queue must have exactly three associated float kernels!");
+    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.float_kernels.size() == 7; }),
+                  "Every command queue must have exactly seven associated float kernels!");
     PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.float_kernels.count(detail::compute_kernel_name::q_kernel) == 1; }),
                   "The float q_kernel kernel is missing!");
     PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.float_kernels.count(detail::compute_kernel_name::svm_kernel) == 1; }),
@@ -139,9 +157,17 @@ void csvm::init(const target_platform target) {
         PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.float_kernels.count(detail::compute_kernel_name::predict_kernel) == 1; }),
                       "The float predict_kernel device kernel is missing!");
     }
+    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.float_kernels.count(detail::compute_kernel_name::axpy_kernel) == 1; }),
+                  "The float axpy_kernel device kernel is missing!");
+    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.float_kernels.count(detail::compute_kernel_name::xpby_kernel) == 1; }),
+                  "The float xpby_kernel device kernel is missing!");
+    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.float_kernels.count(detail::compute_kernel_name::dot_kernel) == 1; }),
+                  "The float dot_kernel device kernel is missing!");
+    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.float_kernels.count(detail::compute_kernel_name::sum_kernel) == 1; }),
+                  "The float sum_kernel device kernel is missing!");
     // sanity checks for the number of the double OpenCL kernels
-    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.double_kernels.size() == 3; }),
-                  "Every command queue must have exactly three associated double kernels!");
+    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.double_kernels.size() == 7; }),
+                  "Every command queue must have exactly seven associated double kernels!");
     PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.double_kernels.count(detail::compute_kernel_name::q_kernel) == 1; }),
                   "The double q_kernel kernel is missing!");
     PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.double_kernels.count(detail::compute_kernel_name::svm_kernel) == 1; }),
@@ -153,6 +179,14 @@ void csvm::init(const target_platform target) {
         PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.double_kernels.count(detail::compute_kernel_name::predict_kernel) == 1; }),
                       "The double predict_kernel device kernel is missing!");
     }
+    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.double_kernels.count(detail::compute_kernel_name::axpy_kernel) == 1; }),
+                  "The double axpy_kernel device kernel is missing!");
+    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.double_kernels.count(detail::compute_kernel_name::xpby_kernel) == 1; }),
+                  "The double xpby_kernel device kernel is missing!");
+    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.double_kernels.count(detail::compute_kernel_name::dot_kernel) == 1; }),
+                  "The double dot_kernel device kernel is missing!");
+    PLSSVM_ASSERT(std::all_of(devices_.begin(), devices_.end(), [](const queue_type &queue) { return queue.double_kernels.count(detail::compute_kernel_name::sum_kernel) == 1; }),
+                  "The double sum_kernel device kernel is missing!");
 }
 
 csvm::~csvm() {
@@ -171,6 +205,10 @@ void csvm::device_synchronize(const queue_type &queue) const {
     detail::device_synchronize(queue);
 }
 
+std::size_t csvm::get_device_memory(const queue_type &queue) const {
+    return detail::get_device_memory(queue);
+}
+
 std::pair<std::vector<std::size_t>, std::vector<std::size_t>> execution_range_to_native(const ::plssvm::detail::execution_range &range) {
     std::vector<std::size_t> grid = { range.grid[0], range.grid[1], range.grid[2] };
     std::vector<std::size_t> block = { range.block[0], range.block[1], range.block[2] };
@@ -203,7 +241,7 @@ template void csvm::run_q_kernel_impl(std::size_t, const ::plssvm::detail::execu
 template void csvm::run_q_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, std::size_t, std::size_t) const;
 
 template <typename real_type>
-void csvm::run_svm_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const real_type QA_cost, const real_type add, const std::size_t num_data_points_padded, const std::size_t num_features) const {
+void csvm::run_svm_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const real_type QA_cost, const real_type add, const std::size_t num_data_points_padded, const std::size_t num_features, const std::size_t row_offset) const {
     auto [grid, block] = execution_range_to_native(range);
 
     const real_type cost = real_type{ 1.0 } / params.cost.value();
@@ -212,18 +250,16 @@ void csvm::run_svm_kernel_impl(const std::size_t device, const ::plssvm::detail:
             detail::run_kernel(devices_[device], devices_[device].get_kernel<real_type>(detail::compute_kernel_name::svm_kernel), grid, block, q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, static_cast<kernel_index_type>(device));
             break;
         case kernel_function_type::polynomial:
-            PLSSVM_ASSERT(device == 0, "The radial basis function kernel function currently only supports single GPU execution!");
-            detail::run_kernel(devices_[device], devices_[device].get_kernel<real_type>(detail::compute_kernel_name::svm_kernel), grid, block, q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.degree.value(), params.gamma.value(), params.coef0.value());
+            detail::run_kernel(devices_[device], devices_[device].get_kernel<real_type>(detail::compute_kernel_name::svm_kernel), grid, block, q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.degree.value(), params.gamma.value(), params.coef0.value(), static_cast<kernel_index_type>(row_offset));
             break;
         case kernel_function_type::rbf:
-            PLSSVM_ASSERT(device == 0, "The radial basis function kernel function currently only supports single GPU execution!");
-            detail::run_kernel(devices_[device], devices_[device].get_kernel<real_type>(detail::compute_kernel_name::svm_kernel), grid, block, q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.gamma.value());
+            detail::run_kernel(devices_[device], devices_[device].get_kernel<real_type>(detail::compute_kernel_name::svm_kernel), grid, block, q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.gamma.value(), static_cast<kernel_index_type>(row_offset));
             break;
     }
 }
 
-template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, float, float, std::size_t, std::size_t) const;
-template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, double, double, std::size_t, std::size_t) const;
+template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, float, float, std::size_t, std::size_t, std::size_t) const;
+template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, double, double, std::size_t, std::size_t, std::size_t) const;
 
 template <typename real_type>
 void csvm::run_w_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &w_d, const device_ptr_type<real_type> &alpha_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, const std::size_t num_data_points, const std::size_t num_features) const {
@@ -254,4 +290,44 @@ void csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &rang
 template void csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, std::size_t, std::size_t, std::size_t) const;
 template void csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, std::size_t, std::size_t, std::size_t) const;
 
+template <typename real_type>
+void csvm::run_axpy_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const real_type alpha, const device_ptr_type<real_type> &x_d, device_ptr_type<real_type> &y_d, const std::size_t size) const {
+    auto [grid, block] = execution_range_to_native(range);
+
+    detail::run_kernel(devices_[device], devices_[device].get_kernel<real_type>(detail::compute_kernel_name::axpy_kernel), grid, block, alpha, x_d.get(), y_d.get(), static_cast<kernel_index_type>(size));
+}
+
+template void csvm::run_axpy_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, float, const device_ptr_type<float> &, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_axpy_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, double, const device_ptr_type<double> &, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void csvm::run_xpby_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const real_type beta, device_ptr_type<real_type> &y_d, const std::size_t size) const {
+    auto [grid, block] = execution_range_to_native(range);
+
+    detail::run_kernel(devices_[device], devices_[device].get_kernel<real_type>(detail::compute_kernel_name::xpby_kernel), grid, block, x_d.get(), beta, y_d.get(), static_cast<kernel_index_type>(size));
+}
+
+template void csvm::run_xpby_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<float> &, float, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_xpby_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<double> &, double, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void csvm::run_dot_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &y_d, device_ptr_type<real_type> &partial_sums_d, const std::size_t size) const {
+    auto [grid, block] = execution_range_to_native(range);
+
+    detail::run_kernel(devices_[device], devices_[device].get_kernel<real_type>(detail::compute_kernel_name::dot_kernel), grid, block, x_d.get(), y_d.get(), partial_sums_d.get(), static_cast<kernel_index_type>(size));
+}
+
+template void csvm::run_dot_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_dot_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void csvm::run_sum_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &partial_sums_d, const std::size_t size) const {
+    auto [grid, block] = execution_range_to_native(range);
+
+    detail::run_kernel(devices_[device], devices_[device].get_kernel<real_type>(detail::compute_kernel_name::sum_kernel), grid, block, partial_sums_d.get(), static_cast<kernel_index_type>(size));
+}
+
+template void csvm::run_sum_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_sum_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, device_ptr_type<double> &, std::size_t) const;
+
 }  // namespace plssvm::opencl
@@ -27,19 +27,24 @@ command_queue::command_queue(cl_context context, cl_device_id device) {
 #ifdef CL_VERSION_2_0
     // use new clCreateCommandQueueWithProperties function
     queue = clCreateCommandQueueWithProperties(context, device, 0, &err);
+    PLSSVM_OPENCL_ERROR_CHECK(err, "error creating the OpenCL command queue");
+    transfer_queue = clCreateCommandQueueWithProperties(context, device, 0, &err);
 #else
     // use old clCreateCommandQueue function (deprecated in newer OpenCL versions)
     queue = clCreateCommandQueue(context, device, 0, &err);
-#endif
     PLSSVM_OPENCL_ERROR_CHECK(err, "error creating the OpenCL command queue");
+    transfer_queue = clCreateCommandQueue(context, device, 0, &err);
+#endif
+    PLSSVM_OPENCL_ERROR_CHECK(err, "error creating the OpenCL transfer command queue");
 }
 
 command_queue::command_queue(command_queue &&other) noexcept :
-    queue{ std::exchange(other.queue, nullptr) }, float_kernels{ std::move(other.float_kernels) }, double_kernels{ std::move(other.double_kernels) } {}
+    queue{ std::exchange(other.queue, nullptr) }, transfer_queue{ std::exchange(other.transfer_queue, nullptr) }, float_kernels{ std::move(other.float_kernels) }, double_kernels{ std::move(other.double_kernels) } {}
 
 command_queue &command_queue::operator=(command_queue &&other) noexcept {
     if (this != std::addressof(other)) {
         queue = std::exchange(other.queue, nullptr);
+        transfer_queue = std::exchange(other.transfer_queue, nullptr);
         float_kernels = std::move(other.float_kernels);
         double_kernels = std::move(other.double_kernels);
     }
@@ -50,6 +55,9 @@ command_queue::~command_queue() {
     if (queue) {
         PLSSVM_OPENCL_ERROR_CHECK(clReleaseCommandQueue(queue), "error releasing cl_command_queue");
     }
+    if (transfer_queue) {
+        PLSSVM_OPENCL_ERROR_CHECK(clReleaseCommandQueue(transfer_queue), "error releasing the transfer cl_command_queue");
+    }
 }
 
 template <typename real_type>
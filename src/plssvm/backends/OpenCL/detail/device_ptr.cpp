@@ -15,10 +15,11 @@
 #include "plssvm/backends/gpu_device_ptr.hpp"               // plssvm::detail::gpu_device_ptr
 #include "plssvm/detail/assert.hpp"                         // PLSSVM_ASSERT
 
-#include "CL/cl.h"                                          // CL_MEM_READ_WRITE, CL_TRUE, clFinish, clCreateBuffer, clReleaseMemObject, clEnqueueFillBuffer, clEnqueueWriteBuffer, clEnqueueReadBuffer
+#include "CL/cl.h"                                          // CL_MEM_READ_WRITE, CL_TRUE, CL_FALSE, clFinish, clFlush, clCreateBuffer, clReleaseMemObject, clEnqueueFillBuffer, clEnqueueWriteBuffer, clEnqueueReadBuffer, clWaitForEvents, clReleaseEvent
 #include "fmt/core.h"                                       // fmt::format
 
 #include <algorithm>                                        // std::min
+#include <utility>                                          // std::exchange, std::move, std::swap
 
 namespace plssvm::opencl::detail {
 
@@ -32,8 +33,21 @@ device_ptr<T>::device_ptr(const size_type size, const command_queue &queue) :
     PLSSVM_OPENCL_ERROR_CHECK(err);
 }
 
+template <typename T>
+device_ptr<T>::device_ptr(device_ptr &&other) noexcept :
+    base_type{ std::move(other) },
+    copy_event_{ std::exchange(other.copy_event_, nullptr) } {}
+
+template <typename T>
+auto device_ptr<T>::operator=(device_ptr &&other) noexcept -> device_ptr & {
+    base_type::operator=(std::move(other));
+    std::swap(copy_event_, other.copy_event_);
+    return *this;
+}
+
 template <typename T>
 device_ptr<T>::~device_ptr() {
+    this->wait_for_async_copies();
     if (data_ != nullptr) {
         PLSSVM_OPENCL_ERROR_CHECK(clReleaseMemObject(data_));
     }
@@ -43,6 +57,8 @@ template <typename T>
 void device_ptr<T>::memset(const int pattern, const size_type pos, const size_type num_bytes) {
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
 
+    this->wait_for_async_copies();
+
     if (pos >= size_) {
         throw backend_exception{ fmt::format("Illegal access in memset!: {} >= {}", pos, size_) };
     }
@@ -58,6 +74,8 @@ template <typename T>
 void device_ptr<T>::fill(const value_type value, const size_type pos, const size_type count) {
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
 
+    this->wait_for_async_copies();
+
     if (pos >= size_) {
         throw backend_exception{ fmt::format("Illegal access in fill!: {} >= {}", pos, size_) };
     }
@@ -75,6 +93,8 @@ void device_ptr<T>::copy_to_device(const_host_pointer_type data_to_copy, const s
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
     PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
 
+    this->wait_for_async_copies();
+
     const size_type rcount = std::min(count, size_ - pos);
     error_code err;
     err = clEnqueueWriteBuffer(queue_->queue, data_, CL_TRUE, pos * sizeof(value_type), rcount * sizeof(value_type), data_to_copy, 0, nullptr, nullptr);
@@ -87,6 +107,8 @@ void device_ptr<T>::copy_to_host(host_pointer_type buffer, const size_type pos,
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
     PLSSVM_ASSERT(buffer != nullptr, "Invalid host pointer for the data to copy!");
 
+    this->wait_for_async_copies();
+
     const size_type rcount = std::min(count, size_ - pos);
     error_code err;
     err = clEnqueueReadBuffer(queue_->queue, data_, CL_TRUE, pos * sizeof(value_type), rcount * sizeof(value_type), buffer, 0, nullptr, nullptr);
@@ -94,6 +116,30 @@ void device_ptr<T>::copy_to_host(host_pointer_type buffer, const size_type pos,
     PLSSVM_OPENCL_ERROR_CHECK(clFinish(queue_->queue));
 }
 
+template <typename T>
+void device_ptr<T>::copy_to_device_async(const_host_pointer_type data_to_copy, const size_type pos, const size_type count) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+    PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
+
+    // the transfer queue is an in-order queue, i.e., the new event completes only after all previous copies completed
+    if (copy_event_ != nullptr) {
+        PLSSVM_OPENCL_ERROR_CHECK(clReleaseEvent(std::exchange(copy_event_, nullptr)));
+    }
+    const size_type rcount = std::min(count, size_ - pos);
+    error_code err;
+    err = clEnqueueWriteBuffer(queue_->transfer_queue, data_, CL_FALSE, pos * sizeof(value_type), rcount * sizeof(value_type), data_to_copy, 0, nullptr, &copy_event_);
+    PLSSVM_OPENCL_ERROR_CHECK(err);
+    PLSSVM_OPENCL_ERROR_CHECK(clFlush(queue_->transfer_queue));
+}
+
+template <typename T>
+void device_ptr<T>::wait_for_async_copies() const {
+    if (copy_event_ != nullptr) {
+        PLSSVM_OPENCL_ERROR_CHECK(clWaitForEvents(1, &copy_event_));
+        PLSSVM_OPENCL_ERROR_CHECK(clReleaseEvent(std::exchange(copy_event_, nullptr)));
+    }
+}
+
 template class device_ptr<float>;
 template class device_ptr<double>;
 
@@ -13,7 +13,7 @@
 #include "plssvm/backends/OpenCL/detail/error_code.hpp"     // plssvm::opencl::detail::error_code
 #include "plssvm/backends/OpenCL/detail/kernel.hpp"         // plssvm::opencl::detail::compute_kernel_name, plssvm::opencl::detail::kernel
 #include "plssvm/backends/OpenCL/exceptions.hpp"            // plssvm::opencl::backend_exception
-#include "plssvm/constants.hpp"                             // plssvm::kernel_index_type, plssvm::kernel_index_type, plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
+#include "plssvm/constants.hpp"                             // plssvm::kernel_index_type
 #include "plssvm/detail/arithmetic_type_name.hpp"           // plssvm::detail::arithmetic_type_name
 #include "plssvm/detail/logger.hpp"                         // plssvm::detail::log, plssvm::verbosity_level
 #include "plssvm/detail/sha256.hpp"                         // plssvm::detail::sha256
@@ -24,7 +24,7 @@
 #include "plssvm/target_platforms.hpp"                      // plssvm::target_platform
 
 #include "CL/cl.h"                                          // cl_program, cl_platform_id, cl_device_id, cl_uint, cl_device_type, cl_context,
-                                                            // CL_DEVICE_NAME, CL_QUEUE_DEVICE, CL_DEVICE_TYPE_ALL, CL_DEVICE_TYPE_CPU, CL_DEVICE_TYPE_GPU, CL_DEVICE_VENDOR, CL_PROGRAM_BUILD_LOG, CL_PROGRAM_BINARY_SIZES, CL_PROGRAM_BINARIES,
+                                                            // cl_ulong, CL_DEVICE_NAME, CL_DEVICE_GLOBAL_MEM_SIZE, CL_QUEUE_DEVICE, CL_DEVICE_TYPE_ALL, CL_DEVICE_TYPE_CPU, CL_DEVICE_TYPE_GPU, CL_DEVICE_VENDOR, CL_PROGRAM_BUILD_LOG, CL_PROGRAM_BINARY_SIZES, CL_PROGRAM_BINARIES,
                                                             // clCreateProgramWithSource, clBuildProgram, clGetProgramBuildInfo, clGetProgramInfo, clCreateKernel, clReleaseProgram, clCreateProgramWithBinary,
                                                             //  clSetKernelArg, clEnqueueNDRangeKernel, clFinish, clGetPlatformIDs, clGetDeviceIDs, clGetDeviceInfo, clCreateContext
 #include "fmt/core.h"                                       // fmt::print, fmt::format
@@ -175,26 +175,54 @@ std::string get_device_name(const command_queue &queue) {
     return device_name;
 }
 
+std::size_t get_device_memory(const command_queue &queue) {
+    // get device
+    cl_device_id device_id{};
+    PLSSVM_OPENCL_ERROR_CHECK(clGetCommandQueueInfo(queue, CL_QUEUE_DEVICE, sizeof(cl_device_id), &device_id, nullptr), "error obtaining device");
+    // get global device memory size
+    cl_ulong global_mem_size{};
+    PLSSVM_OPENCL_ERROR_CHECK(clGetDeviceInfo(device_id, CL_DEVICE_GLOBAL_MEM_SIZE, sizeof(cl_ulong), &global_mem_size, nullptr), "error obtaining global device memory size");
+    return static_cast<std::size_t>(global_mem_size);
+}
+
+std::size_t get_max_work_group_size(cl_device_id device) {
+    std::size_t max_work_group_size{};
+    PLSSVM_OPENCL_ERROR_CHECK(clGetDeviceInfo(device, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(std::size_t), &max_work_group_size, nullptr), "error obtaining the maximum work-group size");
+    return max_work_group_size;
+}
+
 std::vector<std::pair<compute_kernel_name, std::string>> kernel_type_to_function_names(const kernel_function_type kernel) {
     switch (kernel) {
         case kernel_function_type::linear:
             return { std::make_pair(compute_kernel_name::q_kernel, "device_kernel_q_linear"),
                      std::make_pair(compute_kernel_name::svm_kernel, "device_kernel_linear"),
-                     std::make_pair(compute_kernel_name::w_kernel, "device_kernel_w_linear") };
+                     std::make_pair(compute_kernel_name::w_kernel, "device_kernel_w_linear"),
+                     std::make_pair(compute_kernel_name::axpy_kernel, "device_kernel_axpy"),
+                     std::make_pair(compute_kernel_name::xpby_kernel, "device_kernel_xpby"),
+                     std::make_pair(compute_kernel_name::dot_kernel, "device_kernel_dot"),
+                     std::make_pair(compute_kernel_name::sum_kernel, "device_kernel_sum") };
         case kernel_function_type::polynomial:
             return { std::make_pair(compute_kernel_name::q_kernel, "device_kernel_q_polynomial"),
                      std::make_pair(compute_kernel_name::svm_kernel, "device_kernel_polynomial"),
-                     std::make_pair(compute_kernel_name::predict_kernel, "device_kernel_predict_polynomial") };
+                     std::make_pair(compute_kernel_name::predict_kernel, "device_kernel_predict_polynomial"),
+                     std::make_pair(compute_kernel_name::axpy_kernel, "device_kernel_axpy"),
+                     std::make_pair(compute_kernel_name::xpby_kernel, "device_kernel_xpby"),
+                     std::make_pair(compute_kernel_name::dot_kernel, "device_kernel_dot"),
+                     std::make_pair(compute_kernel_name::sum_kernel, "device_kernel_sum") };
         case kernel_function_type::rbf:
             return { std::make_pair(compute_kernel_name::q_kernel, "device_kernel_q_rbf"),
                      std::make_pair(compute_kernel_name::svm_kernel, "device_kernel_rbf"),
-                     std::make_pair(compute_kernel_name::predict_kernel, "device_kernel_predict_rbf") };
+                     std::make_pair(compute_kernel_name::predict_kernel, "device_kernel_predict_rbf"),
+                     std::make_pair(compute_kernel_name::axpy_kernel, "device_kernel_axpy"),
+                     std::make_pair(compute_kernel_name::xpby_kernel, "device_kernel_xpby"),
+                     std::make_pair(compute_kernel_name::dot_kernel, "device_kernel_dot"),
+                     std::make_pair(compute_kernel_name::sum_kernel, "device_kernel_sum") };
     }
     throw unsupported_kernel_type_exception{ fmt::format("Unknown kernel type (value: {})!", ::plssvm::detail::to_underlying(kernel)) };
 }
 
 template <typename real_type>
-void fill_command_queues_with_kernels(std::vector<command_queue> &queues, const std::vector<context> &contexts, const target_platform target, const std::vector<std::pair<compute_kernel_name, std::string>> &kernel_names) {
+void fill_command_queues_with_kernels(std::vector<command_queue> &queues, const std::vector<context> &contexts, const target_platform target, const std::vector<std::pair<compute_kernel_name, std::string>> &kernel_names, const kernel_index_type thread_block_size, const kernel_index_type internal_block_size) {
     PLSSVM_ASSERT(!queues.empty(), "At least one command queue must be available!");
 
     const auto cl_build_program_error_message = [](cl_program prog, cl_device_id device, const std::size_t device_idx) {
@@ -217,7 +245,7 @@ void fill_command_queues_with_kernels(std::vector<command_queue> &queues, const
     const std::filesystem::path base_path{ PLSSVM_OPENCL_KERNEL_SOURCE_DIR };
     std::string kernel_src_string{};
     // note: the detail/atomics.cl file must be included first!
-    for (const auto &path : { base_path / "detail/atomics.cl", base_path / "q_kernel.cl", base_path / "svm_kernel.cl", base_path / "predict_kernel.cl" }) {
+    for (const auto &path : { base_path / "detail/atomics.cl", base_path / "q_kernel.cl", base_path / "svm_kernel.cl", base_path / "predict_kernel.cl", base_path / "cg_kernel.cl" }) {
         std::ifstream file{ base_path / path };
         kernel_src_string.append((std::istreambuf_iterator<char>{ file }),
                                  std::istreambuf_iterator<char>{});
@@ -226,9 +254,9 @@ void fill_command_queues_with_kernels(std::vector<command_queue> &queues, const
     // replace types in kernel_src_string
     ::plssvm::detail::replace_all(kernel_src_string, "real_type", ::plssvm::detail::arithmetic_type_name<real_type>());
     ::plssvm::detail::replace_all(kernel_src_string, "kernel_index_type", ::plssvm::detail::arithmetic_type_name<::plssvm::kernel_index_type>());
-    // replace constants in kernel_src_string
-    ::plssvm::detail::replace_all(kernel_src_string, "INTERNAL_BLOCK_SIZE", fmt::format("{}", INTERNAL_BLOCK_SIZE));
-    ::plssvm::detail::replace_all(kernel_src_string, "THREAD_BLOCK_SIZE", fmt::format("{}", THREAD_BLOCK_SIZE));
+    // replace constants in kernel_src_string (also results in a different checksum for different block sizes)
+    ::plssvm::detail::replace_all(kernel_src_string, "INTERNAL_BLOCK_SIZE", fmt::format("{}", internal_block_size));
+    ::plssvm::detail::replace_all(kernel_src_string, "THREAD_BLOCK_SIZE", fmt::format("{}", thread_block_size));
 
     // append number of device to influence checksum calculation
     kernel_src_string.append(fmt::format("\n// num_devices: {}\n// OpenCL library: {}", contexts[0].devices.size(), PLSSVM_OPENCL_LIBRARY));
@@ -393,13 +421,13 @@ void fill_command_queues_with_kernels(std::vector<command_queue> &queues, const
     }
 }
 
-std::vector<command_queue> create_command_queues(const std::vector<context> &contexts, const target_platform target, const std::vector<std::pair<compute_kernel_name, std::string>> &kernel_names) {
+std::vector<command_queue> create_command_queues(const std::vector<context> &contexts, const target_platform target, const std::vector<std::pair<compute_kernel_name, std::string>> &kernel_names, const kernel_index_type thread_block_size, const kernel_index_type internal_block_size) {
     std::vector<command_queue> queues;
     for (std::vector<cl_device_id>::size_type device = 0; device < contexts[0].devices.size(); ++device) {
         queues.emplace_back(contexts[0], contexts[0].devices[device]);
     }
-    fill_command_queues_with_kernels<float>(queues, contexts, target, kernel_names);
-    fill_command_queues_with_kernels<double>(queues, contexts, target, kernel_names);
+    fill_command_queues_with_kernels<float>(queues, contexts, target, kernel_names, thread_block_size, internal_block_size);
+    fill_command_queues_with_kernels<double>(queues, contexts, target, kernel_names, thread_block_size, internal_block_size);
     return queues;
 }
 
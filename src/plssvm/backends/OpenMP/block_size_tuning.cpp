@@ -0,0 +1,208 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/block_size_tuning.hpp"
+
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"      // plssvm::openmp::{supported_block_sizes, is_supported_block_size, device_kernel_linear, device_kernel_polynomial, device_kernel_rbf}
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"  // plssvm::openmp::thread_pinning
+#include "plssvm/constants.hpp"                       // plssvm::kernel_index_type, plssvm::OPENMP_BLOCK_SIZE
+#include "plssvm/detail/arithmetic_type_name.hpp"     // plssvm::detail::arithmetic_type_name
+#include "plssvm/detail/assert.hpp"                   // PLSSVM_ASSERT
+#include "plssvm/detail/io/file_reader.hpp"           // plssvm::detail::io::file_reader
+#include "plssvm/detail/string_conversion.hpp"        // plssvm::detail::convert_to
+#include "plssvm/detail/string_utility.hpp"           // plssvm::detail::{split, trim, starts_with}
+#include "plssvm/exceptions/exceptions.hpp"           // plssvm::exception, plssvm::invalid_file_format_exception
+#include "plssvm/kernel_function_types.hpp"           // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                       // plssvm::detail::parameter
+
+#include "fmt/core.h"                                 // fmt::format
+#include "fmt/ostream.h"                              // can use fmt using operator<< overloads
+
+#if defined(__linux__)
+    #include <unistd.h>                               // gethostname
+#endif
+
+#include <algorithm>                                  // std::min
+#include <array>                                      // std::array
+#include <chrono>                                     // std::chrono::{steady_clock, duration}
+#include <cstddef>                                    // std::size_t
+#include <filesystem>                                 // std::filesystem::{exists, rename}
+#include <fstream>                                    // std::ifstream, std::ofstream
+#include <limits>                                     // std::numeric_limits
+#include <optional>                                   // std::optional, std::nullopt
+#include <sstream>                                    // std::istringstream
+#include <string>                                     // std::string, std::getline
+#include <string_view>                                // std::string_view
+#include <tuple>                                      // std::make_tuple
+#include <vector>                                     // std::vector
+
+namespace plssvm::openmp {
+
+std::string current_machine_name() {
+    // the host name and the CPU model name are only available on Linux
+    std::string host_name{ "unknown" };
+#if defined(__linux__)
+    std::array<char, 256> buffer{};
+    if (gethostname(buffer.data(), buffer.size() - 1) == 0 && buffer[0] != '\0') {
+        host_name = std::string{ buffer.data() };
+    }
+#endif
+
+    std::ifstream cpuinfo{ "/proc/cpuinfo" };
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (detail::starts_with(line, "model name")) {
+            const std::string::size_type pos = line.find(':');
+            if (pos != std::string::npos) {
+                return fmt::format("{} ({})", host_name, detail::trim(std::string_view{ line }.substr(pos + 1)));
+            }
+        }
+    }
+    return host_name;
+}
+
+tuning_profile::tuning_profile(const std::string &filename) {
+    if (!std::filesystem::exists(filename)) {
+        // nothing has been tuned yet
+        return;
+    }
+
+    detail::io::file_reader reader{ filename };
+    reader.read_lines('#');
+    for (const std::string_view line : reader.lines()) {
+        const std::vector<std::string_view> values = detail::split(detail::trim(line), ';');
+        if (values.size() != 4) {
+            throw invalid_file_format_exception{ fmt::format("Each entry of the tuning profile must consist of exactly four values separated by ';', but \"{}\" contains {}!", line, values.size()) };
+        }
+
+        kernel_function_type kernel{};
+        std::istringstream kernel_stream{ std::string{ detail::trim(values[1]) } };
+        kernel_stream >> kernel;
+        if (kernel_stream.fail()) {
+            throw invalid_file_format_exception{ fmt::format("Invalid kernel function \"{}\" in the tuning profile!", values[1]) };
+        }
+        const std::string_view real_type = detail::trim(values[2]);
+        if (real_type != "float" && real_type != "double") {
+            throw invalid_file_format_exception{ fmt::format("Invalid floating point type \"{}\" in the tuning profile!", real_type) };
+        }
+        const auto block_size = detail::convert_to<kernel_index_type, invalid_file_format_exception>(values[3]);
+        if (block_size <= 0) {
+            throw invalid_file_format_exception{ fmt::format("The block size in the tuning profile must be greater than 0, but is {}!", block_size) };
+        }
+
+        this->set_block_size(std::string{ detail::trim(values[0]) }, kernel, real_type, block_size);
+    }
+}
+
+std::optional<kernel_index_type> tuning_profile::get_block_size(const std::string &machine, const kernel_function_type kernel, const std::string_view real_type) const {
+    const auto it = entries_.find(std::make_tuple(machine, kernel, std::string{ real_type }));
+    if (it == entries_.cend()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void tuning_profile::set_block_size(const std::string &machine, const kernel_function_type kernel, const std::string_view real_type, const kernel_index_type block_size) {
+    PLSSVM_ASSERT(block_size > 0, "The block size must be greater than 0!");
+
+    entries_[std::make_tuple(machine, kernel, std::string{ real_type })] = block_size;
+}
+
+void tuning_profile::save(const std::string &filename) const {
+    const std::string tmp_filename = filename + ".tmp";
+    {
+        std::ofstream out{ tmp_filename, std::ios::trunc };
+        out << "# machine;kernel;real_type;block_size\n";
+        for (const auto &[key, block_size] : entries_) {
+            const auto &[machine, kernel, real_type] = key;
+            out << fmt::format("{};{};{};{}\n", machine, kernel, real_type, block_size);
+        }
+        if (!out) {
+            throw exception{ fmt::format("Couldn't write the tuning profile '{}'!", tmp_filename) };
+        }
+    }
+    std::filesystem::rename(tmp_filename, filename);
+}
+
+template <typename real_type>
+kernel_index_type tune_block_size(const ::plssvm::detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &data, const thread_pinning pinning, const std::size_t num_samples, const std::size_t num_repetitions) {
+    PLSSVM_ASSERT(num_samples > 1, "At least two data points must be used to tune the block size!");
+    PLSSVM_ASSERT(num_repetitions > 0, "At least one repetition must be performed!");
+
+    if (data.size() < 2) {
+        // nothing to tune
+        return OPENMP_BLOCK_SIZE;
+    }
+
+    // use data points evenly spread over the whole data set
+    const std::size_t num_sample_points = std::min(num_samples, data.size());
+    std::vector<std::vector<real_type>> sample(num_sample_points);
+    for (std::size_t i = 0; i < num_sample_points; ++i) {
+        sample[i] = data[i * data.size() / num_sample_points];
+    }
+
+    // only the runtime matters, not the calculated values
+    const std::vector<real_type> q(num_sample_points - 1, real_type{ 0.0 });
+    const std::vector<real_type> d(num_sample_points - 1, real_type{ 1.0 });
+    std::vector<real_type> ret(num_sample_points - 1);
+    const real_type QA_cost{ 1.0 };
+    const real_type cost = real_type{ 1.0 } / params.cost;
+
+    kernel_index_type best_block_size = OPENMP_BLOCK_SIZE;
+    double best_time = std::numeric_limits<double>::max();
+    for (const kernel_index_type block_size : supported_block_sizes()) {
+        double time = std::numeric_limits<double>::max();
+        for (std::size_t rep = 0; rep < num_repetitions; ++rep) {
+            const auto start_time = std::chrono::steady_clock::now();
+            switch (params.kernel_type) {
+                case kernel_function_type::linear:
+                    device_kernel_linear(q, ret, d, sample, QA_cost, cost, real_type{ 1.0 }, 0, d.size(), {}, pinning, block_size);
+                    break;
+                case kernel_function_type::polynomial:
+                    device_kernel_polynomial(q, ret, d, sample, QA_cost, cost, real_type{ 1.0 }, 0, d.size(), params.degree.value(), params.gamma.value(), params.coef0.value(), {}, pinning, block_size);
+                    break;
+                case kernel_function_type::rbf:
+                    device_kernel_rbf(q, ret, d, sample, QA_cost, cost, real_type{ 1.0 }, 0, d.size(), params.gamma.value(), {}, pinning, block_size);
+                    break;
+            }
+            const auto end_time = std::chrono::steady_clock::now();
+            time = std::min(time, std::chrono::duration<double>(end_time - start_time).count());
+        }
+        if (time < best_time) {
+            best_time = time;
+            best_block_size = block_size;
+        }
+    }
+    return best_block_size;
+}
+
+template kernel_index_type tune_block_size(const ::plssvm::detail::parameter<float> &, const std::vector<std::vector<float>> &, thread_pinning, std::size_t, std::size_t);
+template kernel_index_type tune_block_size(const ::plssvm::detail::parameter<double> &, const std::vector<std::vector<double>> &, thread_pinning, std::size_t, std::size_t);
+
+template <typename real_type>
+kernel_index_type load_or_tune_block_size(const std::string &profile_filename, const ::plssvm::detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &data, const thread_pinning pinning) {
+    const std::string machine = current_machine_name();
+    constexpr std::string_view real_type_name = ::plssvm::detail::arithmetic_type_name<real_type>();
+
+    tuning_profile profile{ profile_filename };
+    // note: the profile may have been created using a build supporting other block sizes
+    if (const std::optional<kernel_index_type> block_size = profile.get_block_size(machine, params.kernel_type, real_type_name); block_size.has_value() && is_supported_block_size(block_size.value())) {
+        return block_size.value();
+    }
+
+    // tune the block size and persist it for later runs
+    const kernel_index_type block_size = tune_block_size(params, data, pinning);
+    profile.set_block_size(machine, params.kernel_type, real_type_name, block_size);
+    profile.save(profile_filename);
+    return block_size;
+}
+
+template kernel_index_type load_or_tune_block_size(const std::string &, const ::plssvm::detail::parameter<float> &, const std::vector<std::vector<float>> &, thread_pinning);
+template kernel_index_type load_or_tune_block_size(const std::string &, const ::plssvm::detail::parameter<double> &, const std::vector<std::vector<double>> &, thread_pinning);
+
+}  // namespace plssvm::openmp
@@ -8,28 +8,50 @@
 
 #include "plssvm/backends/OpenMP/csvm.hpp"
 
-#include "plssvm/backends/OpenMP/exceptions.hpp"  // plssvm::openmp::backend_exception
-#include "plssvm/backends/OpenMP/q_kernel.hpp"    // plssvm::openmp::device_kernel_q_linear, plssvm::openmp::device_kernel_q_polynomial, plssvm::openmp::device_kernel_q_rbf
-#include "plssvm/backends/OpenMP/svm_kernel.hpp"  // plssvm::openmp::device_kernel_linear, plssvm::openmp::device_kernel_polynomial, plssvm::openmp::device_kernel_rbf
-#include "plssvm/csvm.hpp"                        // plssvm::csvm
-#include "plssvm/detail/assert.hpp"               // PLSSVM_ASSERT
-#include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
-#include "plssvm/detail/operators.hpp"            // various operator overloads for std::vector and scalars
-#include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY
-#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type
-#include "plssvm/parameter.hpp"                   // plssvm::parameter, plssvm::detail::parameter
-#include "plssvm/target_platforms.hpp"            // plssvm::target_platform
-
-#include "fmt/chrono.h"                           // directly print std::chrono literals with fmt
-#include "fmt/core.h"                             // fmt::format
-#include "fmt/ostream.h"                          // can use fmt using operator<< overloads
-
-#include <algorithm>                              // std::fill, std::all_of, std::min
-#include <chrono>                                 // std::chrono::{milliseconds, steady_clock, time_point, duration_cast}
-#include <cmath>                                  // std::fma
-#include <iostream>                               // std::cout, std::endl
-#include <utility>                                // std::pair, std::make_pair, std::move
-#include <vector>                                 // std::vector
+#include "plssvm/backends/OpenMP/block_size_tuning.hpp"   // plssvm::openmp::load_or_tune_block_size
+#include "plssvm/backends/OpenMP/exceptions.hpp"          // plssvm::openmp::backend_exception
+#include "plssvm/backends/OpenMP/out_of_core_kernel.hpp"  // plssvm::openmp::{calculate_out_of_core_block_size, device_kernel_q_out_of_core_*, device_kernel_out_of_core_*}
+#include "plssvm/backends/OpenMP/parallel.hpp"            // plssvm::openmp::first_touch_copy
+#include "plssvm/backends/OpenMP/predict_kernel.hpp"      // plssvm::openmp::{device_kernel_predict_polynomial, device_kernel_predict_rbf}
+#include "plssvm/backends/OpenMP/q_kernel.hpp"            // plssvm::openmp::device_kernel_q_linear, plssvm::openmp::device_kernel_q_polynomial, plssvm::openmp::device_kernel_q_rbf
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"          // plssvm::openmp::{device_kernel_linear, device_kernel_polynomial, device_kernel_rbf, device_kernel_rbf_ball_tree, supported_block_sizes, is_supported_block_size}
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"      // plssvm::openmp::thread_pinning
+#include "plssvm/backends/OpenMP/thread_scope.hpp"        // plssvm::openmp::thread_scope
+#include "plssvm/constants.hpp"                           // plssvm::kernel_index_type
+#include "plssvm/csvm.hpp"                                // plssvm::csvm
+#include "plssvm/detail/assert.hpp"                       // PLSSVM_ASSERT
+#include "plssvm/detail/ball_tree.hpp"                    // plssvm::detail::ball_tree
+#include "plssvm/detail/io/binary_data_file.hpp"          // plssvm::detail::io::binary_data_file
+#include "plssvm/detail/io/cg_checkpoint.hpp"             // plssvm::detail::io::{cg_checkpoint, calculate_data_fingerprint, resume_from_cg_checkpoint, write_cg_checkpoint}
+#include "plssvm/detail/logger.hpp"                       // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/operators.hpp"                    // various operator overloads for std::vector and scalars
+#include "plssvm/detail/performance_tracker.hpp"          // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY
+#include "plssvm/detail/residual_replacement.hpp"         // plssvm::detail::residual_replacement
+#include "plssvm/detail/solver_control.hpp"               // plssvm::detail::solver_control
+#include "plssvm/iteration_info.hpp"                      // plssvm::iteration_info
+#include "plssvm/kernel_function_types.hpp"               // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                           // plssvm::parameter, plssvm::detail::parameter
+#include "plssvm/solver_types.hpp"                        // plssvm::solver_type
+#include "plssvm/target_platforms.hpp"                    // plssvm::target_platform
+
+#include "fmt/chrono.h"                                   // directly print std::chrono literals with fmt
+#include "fmt/core.h"                                     // fmt::format
+#include "fmt/format.h"                                   // fmt::join
+#include "fmt/ostream.h"                                  // can use fmt using operator<< overloads
+
+#include <algorithm>                                      // std::fill, std::all_of, std::min, std::max, std::transform
+#include <chrono>                                         // std::chrono::{milliseconds, steady_clock, time_point, duration_cast}
+#include <cmath>                                          // std::fma, std::sqrt
+#include <cstddef>                                        // std::size_t
+#include <cstdint>                                        // std::uint64_t
+#include <functional>                                     // std::function
+#include <iostream>                                       // std::cout, std::endl
+#include <limits>                                         // std::numeric_limits
+#include <optional>                                       // std::optional
+#include <string>                                         // std::string
+#include <type_traits>                                    // std::is_same_v
+#include <utility>                                        // std::pair, std::make_pair, std::move
+#include <vector>                                         // std::vector
 
 namespace plssvm::openmp {
 
@@ -51,16 +73,32 @@ void csvm::init(const target_platform target) {
     throw backend_exception{ "Requested target platform 'cpu' that hasn't been enabled using PLSSVM_TARGET_PLATFORMS!" };
 #endif
 
-    // get the number of used OpenMP threads
+    // the threads can either be bound using the OpenMP places or to an explicit CPU set
+    if (pinning_ != thread_pinning::none && !cpu_set_.empty()) {
+        throw backend_exception{ fmt::format("The thread pinning policy '{}' can't be combined with an explicit CPU set!", pinning_) };
+    }
+    // the kernels are only instantiated for some block sizes
+    if (!is_supported_block_size(block_size_)) {
+        throw backend_exception{ fmt::format("Unsupported OpenMP block size {}! Supported block sizes are: [{}].", block_size_, fmt::join(supported_block_sizes(), ", ")) };
+    }
+
+    // get the number of used OpenMP threads; also checks whether the threads can be bound to the CPU set
     int num_omp_threads = 0;
-    #pragma omp parallel default(none) shared(num_omp_threads)
     {
-        #pragma omp master
-        num_omp_threads = omp_get_num_threads();
+        const thread_scope scope = this->make_thread_scope();
+        #pragma omp parallel default(none) shared(num_omp_threads)
+        {
+            #pragma omp master
+            num_omp_threads = omp_get_num_threads();
+        }
     }
 
     plssvm::detail::log(verbosity_level::full,
-                        "\nUsing OpenMP as backend with {} threads.\n\n", plssvm::detail::tracking_entry{ "backend", "num_threads", num_omp_threads });
+                        "\nUsing OpenMP as backend with {} threads (thread pinning: {}{}, block size: {}).\n\n",
+                        plssvm::detail::tracking_entry{ "backend", "num_threads", num_omp_threads },
+                        plssvm::detail::tracking_entry{ "backend", "thread_pinning", pinning_ },
+                        cpu_set_.empty() ? std::string{} : fmt::format(", CPU set: [{}]", fmt::join(cpu_set_, ", ")),
+                        tuning_profile_.empty() ? fmt::format("{}", block_size_) : fmt::format("auto-tuned using '{}'", tuning_profile_));
     PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ "backend", "backend", plssvm::backend_type::openmp }));
     PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ "backend", "target_platform", plssvm::target_platform::cpu }));
 
@@ -69,13 +107,20 @@ void csvm::init(const target_platform target) {
 }
 
 template <typename real_type>
-std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, const real_type eps, const unsigned long long max_iter) const {
+std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equations_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, const real_type eps, const unsigned long long max_iter, const detail::solver_control<real_type> &control) const {
     PLSSVM_ASSERT(!A.empty(), "The data must not be empty!");
     PLSSVM_ASSERT(!A.front().empty(), "The data points must contain at least one feature!");
     PLSSVM_ASSERT(std::all_of(A.cbegin(), A.cend(), [&A](const std::vector<real_type> &data_point) { return data_point.size() == A.front().size(); }), "All data points must have the same number of features!");
     PLSSVM_ASSERT(A.size() == b.size(), "The number of data points in the matrix A ({}) and the values in the right hand side vector ({}) must be the same!", A.size(), b.size());
     PLSSVM_ASSERT(eps > real_type{ 0.0 }, "The stopping criterion in the CG algorithm must be greater than 0.0, but is {}!", eps);
     PLSSVM_ASSERT(max_iter > 0, "The number of CG iterations must be greater than 0!");
+    PLSSVM_ASSERT(control.initial_guess.empty() || control.initial_guess.size() == A.size() - 1, "The initial guess must either be empty or contain exactly one value less than data points are present!: {} != {}", control.initial_guess.size(), A.size() - 1);
+    PLSSVM_ASSERT(!(std::is_same_v<real_type, double> && control.mixed_precision && control.solver == solver_type::pipelined_cg), "Mixed precision is not supported in combination with the pipelined CG algorithm!");
+
+    const std::chrono::steady_clock::time_point solver_start_time = std::chrono::steady_clock::now();
+
+    // all parallel regions use the threads of this C-SVM
+    const thread_scope scope = this->make_thread_scope();
 
     using namespace plssvm::operators;
 
@@ -90,25 +135,260 @@ std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equati
     b.pop_back();
     b -= b_back_value;
 
+    // note: the data fingerprint is only necessary if checkpoints are written or read
+    const std::uint64_t data_fingerprint = control.checkpoint_file.empty() ? 0 : detail::io::calculate_data_fingerprint(A, b);
+
+    // if requested, approximate the rbf kernel matrix-vector multiplications using a ball tree over all data points
+    const bool use_ball_tree = params.kernel_type == kernel_function_type::rbf && control.rbf_tolerance > real_type{ 0.0 };
+
+    // if requested, perform the kernel matrix-vector multiplications in the CG iterations in single precision
+    // note: the CG scalars and vectors are still calculated using real_type, the residual is refined using real_type
+    // note: the approximated kernel matrix-vector multiplications are always performed using real_type
+    const bool use_mixed_precision = std::is_same_v<real_type, double> && control.mixed_precision && !use_ball_tree;
+    const detail::parameter<float> params_mixed = static_cast<detail::parameter<float>>(params);
+    std::vector<std::vector<float>> A_mixed{};
+    std::vector<float> q_mixed{};
+    std::vector<float> d_mixed{};
+    std::vector<float> Ad_mixed{};
+    if (use_mixed_precision) {
+        if (pinning_ != thread_pinning::none) {
+            // place each data point on the NUMA node of the thread owning its kernel matrix row
+            A_mixed = first_touch_copy<float>(A, pinning_);
+        } else {
+            A_mixed = std::vector<std::vector<float>>(A.size(), std::vector<float>(A.front().size()));
+            #pragma omp parallel for default(none) shared(A, A_mixed)
+            for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < A.size(); ++i) {
+                std::transform(A[i].cbegin(), A[i].cend(), A_mixed[i].begin(), [](const real_type val) { return static_cast<float>(val); });
+            }
+        }
+        q_mixed = std::vector<float>(q.cbegin(), q.cend());
+        d_mixed.resize(b.size());
+        Ad_mixed.resize(b.size());
+    }
+
+    // if the threads are pinned, the data points are usually allocated by the (single) thread that parsed them, i.e., are located on a single NUMA node
+    // -> copy them such that each data point is located on the NUMA node of the thread owning its kernel matrix row
+    // note: the CG vectors aren't copied since every thread accesses all of their entries in the lower triangular kernel matrix-vector multiplication
+    std::vector<std::vector<real_type>> A_first_touch{};
+    if (pinning_ != thread_pinning::none && !use_mixed_precision) {
+        A_first_touch = first_touch_copy<real_type>(A, pinning_);
+    }
+    const std::vector<std::vector<real_type>> &A_kernel = A_first_touch.empty() ? A : A_first_touch;
+
+    // select the block size for the floating point type used in (most of) the kernel matrix-vector multiplications
+    const kernel_index_type block_size = use_ball_tree ? block_size_ : (use_mixed_precision ? this->select_block_size(params_mixed, A_mixed) : this->select_block_size(params, A_kernel));
+
+    // the ball tree is built only once, only its weights are replaced in each kernel matrix-vector multiplication
+    std::optional<detail::ball_tree<real_type>> tree{};
+    real_type max_error_bound{ 0.0 };
+    if (use_ball_tree) {
+        const std::chrono::steady_clock::time_point tree_start_time = std::chrono::steady_clock::now();
+        tree.emplace(A, std::vector<real_type>(A.size(), real_type{ 0.0 }));
+        const std::chrono::steady_clock::time_point tree_end_time = std::chrono::steady_clock::now();
+        detail::log(verbosity_level::full | verbosity_level::timing,
+                    "Approximating the rbf kernel matrix-vector multiplications using a ball tree ({} nodes, tolerance {}) built in {}.\n",
+                    detail::tracking_entry{ "cg", "ball_tree_nodes", tree->num_nodes() },
+                    detail::tracking_entry{ "cg", "rbf_tolerance", control.rbf_tolerance },
+                    detail::tracking_entry{ "cg", "ball_tree_build_time", std::chrono::duration_cast<std::chrono::milliseconds>(tree_end_time - tree_start_time) });
+    }
+
+    // skip the remaining blocks of a kernel matrix-vector multiplication as soon as the time budget has been exhausted or the cancellation has been requested
+    // note: the partially calculated result of an aborted kernel matrix-vector multiplication must not be used
+    const std::function<bool()> fit_stop_requested = [&control]() { return control.stop_requested(); };
+
+    // result += add * A * vec, in single precision calculated in float and converted back to real_type
+    const auto matrix_vector_multiplication = [&](const std::vector<real_type> &vec, std::vector<real_type> &result, const real_type add, const bool single_precision) {
+        if (tree.has_value()) {
+            const real_type error_bound = device_kernel_rbf_ball_tree(q, result, vec, A, *tree, QA_cost, 1 / params.cost, add, params.gamma.value(), control.rbf_tolerance, fit_stop_requested);
+            max_error_bound = std::max(max_error_bound, error_bound);
+        } else if (single_precision) {
+            std::transform(vec.cbegin(), vec.cend(), d_mixed.begin(), [](const real_type val) { return static_cast<float>(val); });
+            std::fill(Ad_mixed.begin(), Ad_mixed.end(), 0.0f);
+            run_device_kernel(params_mixed, q_mixed, Ad_mixed, d_mixed, A_mixed, static_cast<float>(QA_cost), static_cast<float>(add), fit_stop_requested, block_size);
+            std::transform(Ad_mixed.cbegin(), Ad_mixed.cend(), result.cbegin(), result.begin(), [](const float val, const real_type res) { return res + static_cast<real_type>(val); });
+        } else {
+            run_device_kernel(params, q, result, vec, A_kernel, QA_cost, add, fit_stop_requested, block_size);
+        }
+    };
+
+    // CG
+    std::vector<real_type> alpha = this->conjugate_gradients<real_type>(params, b, data_fingerprint, eps, max_iter, control, use_mixed_precision, solver_start_time, matrix_vector_multiplication);
+    if (use_ball_tree) {
+        detail::log(verbosity_level::full,
+                    "The maximum absolute error bound of all approximated kernel matrix-vector products is {}.\n",
+                    detail::tracking_entry{ "cg", "rbf_error_bound", max_error_bound });
+    }
+
+    // calculate bias
+    const real_type bias = b_back_value + QA_cost * sum(alpha) - (transposed{ q } * alpha);
+    alpha.push_back(-sum(alpha));
+
+    return std::make_pair(std::move(alpha), -bias);
+}
+
+template std::pair<std::vector<float>, float> csvm::solve_system_of_linear_equations_impl(const detail::parameter<float> &, const std::vector<std::vector<float>> &, std::vector<float>, const float, const unsigned long long, const detail::solver_control<float> &) const;
+template std::pair<std::vector<double>, double> csvm::solve_system_of_linear_equations_impl(const detail::parameter<double> &, const std::vector<std::vector<double>> &, std::vector<double>, const double, const unsigned long long, const detail::solver_control<double> &) const;
+
+template <typename real_type>
+std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equations_out_of_core_impl(const detail::parameter<real_type> &params, const detail::io::binary_data_file<real_type> &A, std::vector<real_type> b, const real_type eps, const unsigned long long max_iter, const std::size_t memory_budget, const detail::solver_control<real_type> &control) const {
+    PLSSVM_ASSERT(A.num_data_points() > 1, "The data must contain at least two data points!");
+    PLSSVM_ASSERT(A.num_data_points() == b.size(), "The number of data points in the matrix A ({}) and the values in the right hand side vector ({}) must be the same!", A.num_data_points(), b.size());
+    PLSSVM_ASSERT(eps > real_type{ 0.0 }, "The stopping criterion in the CG algorithm must be greater than 0.0, but is {}!", eps);
+    PLSSVM_ASSERT(max_iter > 0, "The number of CG iterations must be greater than 0!");
+    PLSSVM_ASSERT(memory_budget > 0, "The memory budget must be greater than 0!");
+    PLSSVM_ASSERT(!control.mixed_precision, "Mixed precision is not supported in the out-of-core training!");
+
+    const std::chrono::steady_clock::time_point solver_start_time = std::chrono::steady_clock::now();
+
+    // all parallel regions use the threads of this C-SVM
+    const thread_scope scope = this->make_thread_scope();
+
+    using namespace plssvm::operators;
+
+    // the number of data points kept in memory at once
+    const std::size_t block_size = calculate_out_of_core_block_size(memory_budget, A.num_features(), sizeof(real_type));
+    detail::log(verbosity_level::full,
+                "Streaming the {} data points out-of-core in blocks of {} data points using a memory budget of {} bytes.\n",
+                A.num_data_points(),
+                detail::tracking_entry{ "out_of_core", "block_size", block_size },
+                detail::tracking_entry{ "out_of_core", "memory_budget", memory_budget });
+
+    // create q vector
+    std::vector<real_type> q(A.num_data_points() - 1);
+    switch (params.kernel_type) {
+        case kernel_function_type::linear:
+            device_kernel_q_out_of_core_linear(q, A, block_size);
+            break;
+        case kernel_function_type::polynomial:
+            device_kernel_q_out_of_core_polynomial(q, A, params.degree.value(), params.gamma.value(), params.coef0.value(), block_size);
+            break;
+        case kernel_function_type::rbf:
+            device_kernel_q_out_of_core_rbf(q, A, params.gamma.value(), block_size);
+            break;
+    }
+
+    // calculate QA_costs
+    const std::vector<real_type> last_data_point(A.data_point(A.num_data_points() - 1), A.data_point(A.num_data_points() - 1) + A.num_features());
+    const real_type QA_cost = kernel_function(last_data_point, last_data_point, params) + real_type{ 1.0 } / params.cost;
+
+    // update b
+    const real_type b_back_value = b.back();
+    b.pop_back();
+    b -= b_back_value;
+
+    // note: the data fingerprint is only necessary if checkpoints are written or read
+    const std::uint64_t data_fingerprint = control.checkpoint_file.empty() ? 0 : detail::io::calculate_data_fingerprint(A, b);
+
+    // skip the remaining blocks of a kernel matrix-vector multiplication as soon as the time budget has been exhausted or the cancellation has been requested
+    // note: the partially calculated result of an aborted kernel matrix-vector multiplication must not be used
+    const std::function<bool()> fit_stop_requested = [&control]() { return control.stop_requested(); };
+
+    // result += add * A * vec, streaming the data points from the binary data file
+    const auto matrix_vector_multiplication = [&](const std::vector<real_type> &vec, std::vector<real_type> &result, const real_type add, bool) {
+        switch (params.kernel_type) {
+            case kernel_function_type::linear:
+                device_kernel_out_of_core_linear(q, result, vec, A, QA_cost, 1 / params.cost, add, block_size, fit_stop_requested);
+                break;
+            case kernel_function_type::polynomial:
+                device_kernel_out_of_core_polynomial(q, result, vec, A, QA_cost, 1 / params.cost, add, params.degree.value(), params.gamma.value(), params.coef0.value(), block_size, fit_stop_requested);
+                break;
+            case kernel_function_type::rbf:
+                device_kernel_out_of_core_rbf(q, result, vec, A, QA_cost, 1 / params.cost, add, params.gamma.value(), block_size, fit_stop_requested);
+                break;
+        }
+    };
+
     // CG
+    std::vector<real_type> alpha = this->conjugate_gradients<real_type>(params, b, data_fingerprint, eps, max_iter, control, false, solver_start_time, matrix_vector_multiplication);
 
-    std::vector<real_type> alpha(b.size(), 1.0);
+    // calculate bias
+    const real_type bias = b_back_value + QA_cost * sum(alpha) - (transposed{ q } * alpha);
+    alpha.push_back(-sum(alpha));
+
+    return std::make_pair(std::move(alpha), -bias);
+}
+
+template std::pair<std::vector<float>, float> csvm::solve_system_of_linear_equations_out_of_core_impl(const detail::parameter<float> &, const detail::io::binary_data_file<float> &, std::vector<float>, const float, const unsigned long long, const std::size_t, const detail::solver_control<float> &) const;
+template std::pair<std::vector<double>, double> csvm::solve_system_of_linear_equations_out_of_core_impl(const detail::parameter<double> &, const detail::io::binary_data_file<double> &, std::vector<double>, const double, const unsigned long long, const std::size_t, const detail::solver_control<double> &) const;
+
+template <typename real_type>
+std::vector<real_type> csvm::conjugate_gradients(const detail::parameter<real_type> &params, const std::vector<real_type> &b, const std::uint64_t data_fingerprint, const real_type eps, const unsigned long long max_iter, const detail::solver_control<real_type> &control, const bool use_mixed_precision, const std::chrono::steady_clock::time_point solver_start_time, const kernel_matrix_vector_multiplication_type<real_type> &matrix_vector_multiplication) const {
+    PLSSVM_ASSERT(!b.empty(), "The right-hand side must not be empty!");
+    PLSSVM_ASSERT(eps > real_type{ 0.0 }, "The stopping criterion in the CG algorithm must be greater than 0.0, but is {}!", eps);
+    PLSSVM_ASSERT(max_iter > 0, "The number of CG iterations must be greater than 0!");
+    PLSSVM_ASSERT(control.initial_guess.empty() || control.initial_guess.size() == b.size(), "The initial guess must either be empty or contain exactly as many values as the right-hand side!: {} != {}", control.initial_guess.size(), b.size());
+    PLSSVM_ASSERT(!(use_mixed_precision && control.solver == solver_type::pipelined_cg), "Mixed precision is not supported in combination with the pipelined CG algorithm!");
+
+    using namespace plssvm::operators;
+
+    // if requested, resume the CG algorithm from a previously written checkpoint
+    std::optional<detail::io::cg_checkpoint<real_type>> checkpoint = detail::io::resume_from_cg_checkpoint(control, params, data_fingerprint, b.size());
+
+    // use the solution of the checkpoint or the initial guess if provided (warm start), otherwise initialize all values with 1.0
+    std::vector<real_type> alpha{};
+    if (checkpoint.has_value()) {
+        alpha = std::move(checkpoint->x);
+    } else {
+        alpha = control.initial_guess.empty() ? std::vector<real_type>(b.size(), real_type{ 1.0 }) : control.initial_guess;
+    }
     const typename std::vector<real_type>::size_type dept = b.size();
 
-    // sanity checks
-    PLSSVM_ASSERT(dept == A.size() - 1, "Sizes mismatch!: {} != {}", dept, A.size() - 1);
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "mixed_precision", use_mixed_precision }));
 
-    std::vector<real_type> r(b);
+    // the time spent in the kernel matrix-vector multiplications during the current CG iteration
+    std::chrono::steady_clock::duration matrix_vector_duration{};
 
-    // r = A + alpha_ (r = b - Ax)
-    run_device_kernel(params, q, r, alpha, A, QA_cost, real_type{ -1.0 });
+    // Ad = A * d (q = A * d), in mixed precision calculated in single precision and converted back to real_type
+    const auto kernel_matrix_vector_multiplication = [&](const std::vector<real_type> &vec, std::vector<real_type> &result) {
+        const std::chrono::steady_clock::time_point matrix_vector_start_time = std::chrono::steady_clock::now();
+        std::fill(result.begin(), result.end(), real_type{ 0.0 });
+        matrix_vector_multiplication(vec, result, real_type{ 1.0 }, use_mixed_precision);
+        matrix_vector_duration += std::chrono::steady_clock::now() - matrix_vector_start_time;
+    };
+    // r = b - A * x, always calculated using real_type
+    const auto calculate_residual = [&](std::vector<real_type> &residual) {
+        const std::chrono::steady_clock::time_point matrix_vector_start_time = std::chrono::steady_clock::now();
+        // r = b
+        residual = b;
+        // r -= A * x
+        matrix_vector_multiplication(alpha, residual, real_type{ -1.0 }, false);
+        matrix_vector_duration += std::chrono::steady_clock::now() - matrix_vector_start_time;
+    };
+
+    std::vector<real_type> r(dept);
+    std::vector<real_type> d{};
+    real_type delta{};
+    real_type delta0{};
+    // the residuum and step size of the previous iteration (only used in the pipelined CG algorithm)
+    real_type delta_old{ 1.0 };
+    real_type alpha_old{ 1.0 };
+    if (checkpoint.has_value()) {
+        // continue with the state of the checkpoint
+        r = std::move(checkpoint->r);
+        d = std::move(checkpoint->d);
+        delta = checkpoint->delta;
+        delta0 = checkpoint->delta0;
+        delta_old = checkpoint->delta_old;
+        alpha_old = checkpoint->alpha_old;
+    } else {
+        // r = A + alpha_ (r = b - Ax)
+        calculate_residual(r);
+
+        // delta = r.T * r
+        delta = transposed{ r } * r;
+        delta0 = delta;
 
-    // delta = r.T * r
-    real_type delta = transposed{ r } * r;
-    const real_type delta0 = delta;
+        d = r;
+    }
     std::vector<real_type> Ad(dept);
 
-    std::vector<real_type> d(r);
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "solver", control.solver }));
+
+    unsigned long long iter = checkpoint.has_value() ? checkpoint->iteration : 0;
+    // true if the iteration callback requested to stop the CG algorithm early
+    bool stop_requested = false;
+    // true if the CG algorithm reached the requested accuracy
+    bool converged = false;
 
     // timing for each CG iteration
     std::chrono::milliseconds average_iteration_time{};
@@ -119,71 +399,243 @@ std::pair<std::vector<real_type>, real_type> csvm::solve_system_of_linear_equati
         detail::log(verbosity_level::full | verbosity_level::timing,
                     "Done in {}.\n", iteration_duration);
         average_iteration_time += iteration_duration;
+
+        // invoke the user provided iteration callback, if present
+        if (control.iteration_callback) {
+            const iteration_info info{ iter + 1,
+                                       max_iter,
+                                       static_cast<double>(delta),
+                                       static_cast<double>(eps * eps * delta0),
+                                       std::chrono::duration_cast<std::chrono::milliseconds>(iteration_end_time - solver_start_time),
+                                       iteration_duration,
+                                       std::chrono::duration_cast<std::chrono::milliseconds>(matrix_vector_duration) };
+            stop_requested = !control.iteration_callback(info);
+        }
     };
 
-    unsigned long long iter = 0;
-    for (; iter < max_iter; ++iter) {
-        detail::log(verbosity_level::full | verbosity_level::timing,
-                    "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
-        iteration_start_time = std::chrono::steady_clock::now();
+    // the residual after the last explicit residual refinement
+    real_type delta_refined = delta;
+    // recalculate the residual using real_type as soon as the accumulated rounding errors of the iteratively updated residual are no longer negligible
+    // note: the rounding errors are dominated by the precision used in the kernel matrix-vector multiplications
+    // note: the pipelined CG algorithm must replace the residual repeatedly since its auxiliary recurrences additionally amplify the rounding errors
+    const real_type machine_epsilon = use_mixed_precision ? real_type{ std::numeric_limits<float>::epsilon() } : std::numeric_limits<real_type>::epsilon();
+    detail::residual_replacement<real_type> replacement{ machine_epsilon, std::sqrt(delta), control.solver == solver_type::pipelined_cg };
+    // the squared Euclidean norms of the current solution (xx = x^T * x) and search direction (dd = d^T * d)
+    real_type xx = transposed{ alpha } * alpha;
+    real_type dd = transposed{ d } * d;
+    // in mixed precision, the residual must additionally be refined as soon as the single precision iterations reduced it sufficiently
+    const auto residual_refresh_necessary = [&]() {
+        const real_type reduction = control.mixed_precision_refinement_reduction;
+        const bool replacement_necessary = replacement.update(std::sqrt(xx), std::sqrt(delta));
+        return replacement_necessary
+               || (use_mixed_precision && (delta <= eps * eps * delta0 || delta <= reduction * reduction * delta_refined));
+    };
 
-        // Ad = A * d (q = A * d)
-        std::fill(Ad.begin(), Ad.end(), real_type{ 0.0 });
-        run_device_kernel(params, q, Ad, d, A, QA_cost, real_type{ 1.0 });
+    // write the current state of the CG algorithm to the checkpoint file (if requested) such that it can be resumed later on
+    const auto write_checkpoint = [&](const unsigned long long num_iterations) {
+        if (!control.checkpoint_file.empty() && control.write_checkpoints) {
+            detail::io::write_cg_checkpoint(control.checkpoint_file, detail::io::cg_checkpoint<real_type>{ params, control.solver, data_fingerprint, num_iterations, delta0, delta, delta_old, alpha_old, alpha, r, d });
+        }
+    };
 
-        // (alpha = delta_new / (d^T * q))
-        const real_type alpha_cd = delta / (transposed{ d } * Ad);
+    if (control.solver == solver_type::pipelined_cg) {
+        // pipelined CG algorithm (Ghysels and Vanroose): the dot products of one iteration are fused into a single reduction
+        // that is independent of the kernel matrix-vector multiplication of the same iteration (Ad = A * w)
+        // note: d is used as the search direction p; mixed precision is rejected in plssvm::csvm::fit since the additional recurrences amplify the single precision rounding errors
+        std::vector<real_type> w(dept);  // w = A * r
+        std::vector<real_type> s(dept);  // s = A * d
+        std::vector<real_type> z(dept);  // z = A * s
+        kernel_matrix_vector_multiplication(r, w);
+        if (iter > 0) {
+            // resumed from a checkpoint: restore the auxiliary vectors (s = A * d) and (z = A * s)
+            kernel_matrix_vector_multiplication(d, s);
+            kernel_matrix_vector_multiplication(s, z);
+        }
+        // (gamma = w^T * r)
+        real_type gamma = transposed{ w } * r;
+
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+            matrix_vector_duration = std::chrono::steady_clock::duration{};
+
+            // Ad = A * w
+            kernel_matrix_vector_multiplication(w, Ad);
+            // stop the CG iterations if the time budget has been exhausted or the cancellation has been requested -> use the last complete iterate
+            if (control.stop_requested()) {
+                write_checkpoint(iter);
+                break;
+            }
+
+            // (beta = delta_new / delta_old) and (alpha = delta_new / (d^T * A * d)) using the recurrence d^T * A * d = gamma - beta * delta / alpha_old
+            const real_type beta = iter == 0 ? real_type{ 0.0 } : delta / delta_old;
+            const real_type alpha_cd = iter == 0 ? delta / gamma : delta / (gamma - beta * delta / alpha_old);
+
+            // z = Ad + beta * z, s = w + beta * s, d = r + beta * d
+            xpby(Ad, beta, z);
+            xpby(w, beta, s);
+            dd = xpby_dot(r, beta, d);
+            // estimate the kernel matrix norm using the Rayleigh quotient of the new search direction (d^T * A * d = delta / alpha)
+            replacement.update_matrix_norm(delta / alpha_cd, dd);
+            // (x = x + alpha * d) and (xx = x^T * x)
+            xx = axpy_dot(alpha_cd, d, alpha);
+            // r -= alpha_cd * s (r = r - alpha * A * d)
+            axpy(-alpha_cd, s, r);
+            // w -= alpha_cd * z (w = w - alpha * A * s)
+            axpy(-alpha_cd, z, w);
+
+            // (delta = r^T * r) and (gamma = w^T * r) in a single fused reduction
+            delta_old = delta;
+            alpha_old = alpha_cd;
+            delta = real_type{ 0.0 };
+            gamma = real_type{ 0.0 };
+            #pragma omp parallel for simd default(none) shared(r, w) firstprivate(dept) reduction(+ : delta, gamma)
+            for (typename std::vector<real_type>::size_type i = 0; i < dept; ++i) {
+                delta += r[i] * r[i];
+                gamma += w[i] * r[i];
+            }
+
+            if (residual_refresh_necessary()) {
+                // residual replacement: (r = b - A * x) and the auxiliary vectors (w = A * r), (s = A * d), and (z = A * s)
+                calculate_residual(r);
+                kernel_matrix_vector_multiplication(r, w);
+                kernel_matrix_vector_multiplication(d, s);
+                kernel_matrix_vector_multiplication(s, z);
+                delta = transposed{ r } * r;
+                gamma = transposed{ w } * r;
+                replacement.replaced(std::sqrt(xx), std::sqrt(delta));
+                delta_refined = delta;
+                // the replaced residual may have only been partially calculated, but the current solution is still valid
+                if (control.stop_requested()) {
+                    break;
+                }
+            }
 
-        // (x = x + alpha * d)
-        alpha += alpha_cd * d;
+            // if we are exact enough stop CG iterations
+            if (delta <= eps * eps * delta0) {
+                converged = true;
+                output_iteration_duration();
+                break;
+            }
 
-        if (iter % 50 == 49) {
-            // (r = b - A * x)
-            // r = b
-            r = b;
-            // r -= A * x
-            run_device_kernel(params, q, r, alpha, A, QA_cost, real_type{ -1.0 });
-        } else {
-            // r -= alpha_cd * Ad (r = r - alpha * q)
-            r -= alpha_cd * Ad;
+            output_iteration_duration();
+
+            // periodically (and if the CG algorithm is stopped early) write the current state of the CG algorithm to the checkpoint file
+            if (stop_requested || (iter + 1) % control.checkpoint_interval == 0) {
+                write_checkpoint(iter + 1);
+            }
+
+            // stop the CG iterations if requested by the iteration callback
+            if (stop_requested) {
+                break;
+            }
         }
+    } else {
+        for (; iter < max_iter; ++iter) {
+            detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Start Iteration {} (max: {}) with current residuum {} (target: {}). ", iter + 1, max_iter, delta, eps * eps * delta0);
+            iteration_start_time = std::chrono::steady_clock::now();
+            matrix_vector_duration = std::chrono::steady_clock::duration{};
+
+            // Ad = A * d (q = A * d)
+            kernel_matrix_vector_multiplication(d, Ad);
+            // stop the CG iterations if the time budget has been exhausted or the cancellation has been requested -> use the last complete iterate
+            if (control.stop_requested()) {
+                write_checkpoint(iter);
+                break;
+            }
+
+            // (alpha = delta_new / (d^T * q))
+            const real_type dAd = transposed{ d } * Ad;
+            const real_type alpha_cd = delta / dAd;
+            // estimate the kernel matrix norm using the Rayleigh quotient of the current search direction
+            replacement.update_matrix_norm(dAd, dd);
+
+            // (x = x + alpha * d) and (xx = x^T * x)
+            xx = axpy_dot(alpha_cd, d, alpha);
+
+            // r -= alpha_cd * Ad (r = r - alpha * q) and (delta = r^T * r) in a single pass
+            delta_old = delta;
+            delta = axpy_dot(-alpha_cd, Ad, r);
+
+            bool restart = false;
+            if (residual_refresh_necessary()) {
+                // (r = b - A * x)
+                calculate_residual(r);
+                // (delta = r^T * r)
+                delta = transposed{ r } * r;
+                replacement.replaced(std::sqrt(xx), std::sqrt(delta));
+                // in mixed precision, restart the CG algorithm on the refined residual since the previous search directions are only conjugate with respect to the single precision matrix
+                restart = use_mixed_precision;
+                delta_refined = delta;
+                // the replaced residual may have only been partially calculated, but the current solution is still valid
+                if (control.stop_requested()) {
+                    break;
+                }
+            }
+
+            // if we are exact enough stop CG iterations
+            if (delta <= eps * eps * delta0) {
+                converged = true;
+                output_iteration_duration();
+                break;
+            }
+
+            if (restart) {
+                // d = r
+                d = r;
+                dd = delta;
+            } else {
+                // (beta = delta_new / delta_old)
+                const real_type beta = delta / delta_old;
+                // d = beta * d + r and (dd = d^T * d)
+                dd = xpby_dot(r, beta, d);
+            }
 
-        // (delta = r^T * r)
-        const real_type delta_old = delta;
-        delta = transposed{ r } * r;
-        // if we are exact enough stop CG iterations
-        if (delta <= eps * eps * delta0) {
             output_iteration_duration();
-            break;
-        }
 
-        // (beta = delta_new / delta_old)
-        const real_type beta = delta / delta_old;
-        // d = beta * d + r
-        d = beta * d + r;
+            // periodically (and if the CG algorithm is stopped early) write the current state of the CG algorithm to the checkpoint file
+            if (stop_requested || (iter + 1) % control.checkpoint_interval == 0) {
+                write_checkpoint(iter + 1);
+            }
 
-        output_iteration_duration();
+            // stop the CG iterations if requested by the iteration callback
+            if (stop_requested) {
+                break;
+            }
+        }
     }
+    // note: the iteration callback may also request to stop in the iteration in which the CG algorithm converged anyway
+    const bool stopped_by_callback = stop_requested && delta > eps * eps * delta0;
+    if (stopped_by_callback) {
+        detail::log(verbosity_level::full | verbosity_level::timing,
+                    "Stopped the CG algorithm early as requested by the iteration callback.\n");
+    }
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "stopped_by_callback", stopped_by_callback }));
+    if (!converged && control.stop_requested()) {
+        detail::log(verbosity_level::full | verbosity_level::timing,
+                    "Stopped the CG algorithm early since the time budget has been exhausted or the cancellation has been requested.\n");
+    }
+    control.converged = converged;
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "converged", converged }));
     detail::log(verbosity_level::full | verbosity_level::timing,
-                "Finished after {}/{} iterations with a residuum of {} (target: {}) and an average iteration time of {}.\n",
+                "Finished after {}/{} iterations with a residuum of {} (target: {}), {} residual replacement(s), and an average iteration time of {}.\n",
                 detail::tracking_entry{ "cg", "iterations", std::min(iter + 1, max_iter) },
                 detail::tracking_entry{ "cg", "max_iterations", max_iter },
                 detail::tracking_entry{ "cg", "residuum", delta },
                 detail::tracking_entry{ "cg", "target_residuum", eps * eps * delta0 },
+                detail::tracking_entry{ "cg", "residual_replacements", replacement.num_replacements() },
                 detail::tracking_entry{ "cg", "avg_iteration_time", average_iteration_time / std::min(iter + 1, max_iter) });
     PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((detail::tracking_entry{ "cg", "epsilon", eps }));
     detail::log(verbosity_level::libsvm,
                 "optimization finished, #iter = {}\n", std::min(iter + 1, max_iter));
 
-    // calculate bias
-    const real_type bias = b_back_value + QA_cost * sum(alpha) - (transposed{ q } * alpha);
-    alpha.push_back(-sum(alpha));
-
-    return std::make_pair(std::move(alpha), -bias);
+    return alpha;
 }
 
-template std::pair<std::vector<float>, float> csvm::solve_system_of_linear_equations_impl(const detail::parameter<float> &, const std::vector<std::vector<float>> &, std::vector<float>, const float, const unsigned long long) const;
-template std::pair<std::vector<double>, double> csvm::solve_system_of_linear_equations_impl(const detail::parameter<double> &, const std::vector<std::vector<double>> &, std::vector<double>, const double, const unsigned long long) const;
+template std::vector<float> csvm::conjugate_gradients(const detail::parameter<float> &, const std::vector<float> &, const std::uint64_t, const float, const unsigned long long, const detail::solver_control<float> &, const bool, const std::chrono::steady_clock::time_point, const kernel_matrix_vector_multiplication_type<float> &) const;
+template std::vector<double> csvm::conjugate_gradients(const detail::parameter<double> &, const std::vector<double> &, const std::uint64_t, const double, const unsigned long long, const detail::solver_control<double> &, const bool, const std::chrono::steady_clock::time_point, const kernel_matrix_vector_multiplication_type<double> &) const;
 
 template <typename real_type>
 std::vector<real_type> csvm::predict_values_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &support_vectors, const std::vector<real_type> &alpha, const real_type rho, std::vector<real_type> &w, const std::vector<std::vector<real_type>> &predict_points) const {
@@ -199,6 +651,9 @@ std::vector<real_type> csvm::predict_values_impl(const detail::parameter<real_ty
 
     using namespace plssvm::operators;
 
+    // all parallel regions use the threads of this C-SVM
+    const thread_scope scope = this->make_thread_scope();
+
     std::vector<real_type> out(predict_points.size(), -rho);
 
     // use faster methode in case of the linear kernel function
@@ -206,22 +661,21 @@ std::vector<real_type> csvm::predict_values_impl(const detail::parameter<real_ty
         w = calculate_w(support_vectors, alpha);
     }
 
-    #pragma omp parallel for default(none) shared(predict_points, support_vectors, alpha, w, params, out)
-    for (typename std::vector<std::vector<real_type>>::size_type point_index = 0; point_index < predict_points.size(); ++point_index) {
-        switch (params.kernel_type) {
-            case kernel_function_type::linear:
+    switch (params.kernel_type) {
+        case kernel_function_type::linear:
+            #pragma omp parallel for default(none) shared(predict_points, w, out)
+            for (typename std::vector<std::vector<real_type>>::size_type point_index = 0; point_index < predict_points.size(); ++point_index) {
                 out[point_index] += transposed{ w } * predict_points[point_index];
-                break;
-            case kernel_function_type::polynomial:
-            case kernel_function_type::rbf: {
-                real_type temp{ 0.0 };
-                #pragma omp simd reduction(+ : temp)
-                for (typename std::vector<std::vector<real_type>>::size_type data_index = 0; data_index < support_vectors.size(); ++data_index) {
-                    temp += alpha[data_index] * kernel_function(support_vectors[data_index], predict_points[point_index], params);
-                }
-                out[point_index] += temp;
-            } break;
-        }
+            }
+            break;
+        case kernel_function_type::polynomial:
+            // the data points to predict and the support vectors are processed in tiles
+            device_kernel_predict_polynomial(out, support_vectors, alpha, predict_points, params.degree.value(), params.gamma.value(), params.coef0.value());
+            break;
+        case kernel_function_type::rbf:
+            // the data points to predict and the support vectors are processed in tiles
+            device_kernel_predict_rbf(out, support_vectors, alpha, predict_points, params.gamma.value());
+            break;
     }
     return out;
 }
@@ -283,7 +737,14 @@ template std::vector<float> csvm::calculate_w(const std::vector<std::vector<floa
 template std::vector<double> csvm::calculate_w(const std::vector<std::vector<double>> &, const std::vector<double> &) const;
 
 template <typename real_type>
-void csvm::run_device_kernel(const detail::parameter<real_type> &params, const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type add) const {
+void csvm::run_device_kernel(const detail::parameter<real_type> &params, const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type add, const std::function<bool()> &stop_requested, const kernel_index_type block_size) const {
+    this->run_device_kernel(params, q, ret, d, data, QA_cost, add, 0, d.size(), stop_requested, block_size);
+}
+template void csvm::run_device_kernel(const detail::parameter<float> &, const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, const std::function<bool()> &, kernel_index_type) const;
+template void csvm::run_device_kernel(const detail::parameter<double> &, const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, const std::function<bool()> &, kernel_index_type) const;
+
+template <typename real_type>
+void csvm::run_device_kernel(const detail::parameter<real_type> &params, const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type add, const std::size_t row_begin, const std::size_t row_end, const std::function<bool()> &stop_requested, const kernel_index_type block_size) const {
     PLSSVM_ASSERT(!q.empty(), "The q array may not be empty!");
     PLSSVM_ASSERT(!ret.empty(), "The ret array may not be empty!");
     PLSSVM_ASSERT(!d.empty(), "The d array may not be empty!");
@@ -291,20 +752,41 @@ void csvm::run_device_kernel(const detail::parameter<real_type> &params, const s
     PLSSVM_ASSERT(!data.front().empty(), "The data points must contain at least one feature!");
     PLSSVM_ASSERT(std::all_of(data.cbegin(), data.cend(), [](const std::vector<real_type> &features) { return !features.empty(); }), "All data point must have exactly the same number of features!");
     PLSSVM_ASSERT(add == real_type{ -1.0 } || add == real_type{ 1.0 }, "add must either by -1.0 or 1.0, but is {}!", add);
+    PLSSVM_ASSERT(block_size >= 0, "The block size must not be negative!");
 
+    const kernel_index_type used_block_size = block_size == 0 ? block_size_ : block_size;
     switch (params.kernel_type) {
         case kernel_function_type::linear:
-            openmp::device_kernel_linear(q, ret, d, data, QA_cost, 1 / params.cost, add);
+            openmp::device_kernel_linear(q, ret, d, data, QA_cost, 1 / params.cost, add, row_begin, row_end, stop_requested, pinning_, used_block_size);
             break;
         case kernel_function_type::polynomial:
-            openmp::device_kernel_polynomial(q, ret, d, data, QA_cost, 1 / params.cost, add, params.degree.value(), params.gamma.value(), params.coef0.value());
+            openmp::device_kernel_polynomial(q, ret, d, data, QA_cost, 1 / params.cost, add, row_begin, row_end, params.degree.value(), params.gamma.value(), params.coef0.value(), stop_requested, pinning_, used_block_size);
             break;
         case kernel_function_type::rbf:
-            openmp::device_kernel_rbf(q, ret, d, data, QA_cost, 1 / params.cost, add, params.gamma.value());
+            openmp::device_kernel_rbf(q, ret, d, data, QA_cost, 1 / params.cost, add, row_begin, row_end, params.gamma.value(), stop_requested, pinning_, used_block_size);
             break;
     }
 }
-template void csvm::run_device_kernel(const detail::parameter<float> &, const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float) const;
-template void csvm::run_device_kernel(const detail::parameter<double> &, const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double) const;
+template void csvm::run_device_kernel(const detail::parameter<float> &, const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, std::size_t, std::size_t, const std::function<bool()> &, kernel_index_type) const;
+template void csvm::run_device_kernel(const detail::parameter<double> &, const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, std::size_t, std::size_t, const std::function<bool()> &, kernel_index_type) const;
+
+template <typename real_type>
+kernel_index_type csvm::select_block_size(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &data) const {
+    if (tuning_profile_.empty()) {
+        return block_size_;
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+    const kernel_index_type block_size = load_or_tune_block_size(tuning_profile_, params, data, pinning_);
+    const auto end_time = std::chrono::steady_clock::now();
+    plssvm::detail::log(verbosity_level::full | verbosity_level::timing,
+                        "Selected the OpenMP block size {} using the tuning profile '{}' in {}.\n",
+                        plssvm::detail::tracking_entry{ "backend", "block_size", block_size },
+                        tuning_profile_,
+                        plssvm::detail::tracking_entry{ "backend", "block_size_tuning_time", std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time) });
+    return block_size;
+}
+template kernel_index_type csvm::select_block_size(const detail::parameter<float> &, const std::vector<std::vector<float>> &) const;
+template kernel_index_type csvm::select_block_size(const detail::parameter<double> &, const std::vector<std::vector<double>> &) const;
 
 }  // namespace plssvm::openmp
@@ -0,0 +1,405 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/device_csvm.hpp"
+
+#include "plssvm/backend_types.hpp"               // plssvm::backend_type
+#include "plssvm/backends/OpenMP/device_ptr.hpp"  // plssvm::openmp::device_ptr
+#include "plssvm/backends/OpenMP/exceptions.hpp"  // plssvm::openmp::backend_exception
+#include "plssvm/constants.hpp"                   // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE
+#include "plssvm/detail/assert.hpp"               // PLSSVM_ASSERT
+#include "plssvm/detail/execution_range.hpp"      // plssvm::detail::execution_range
+#include "plssvm/detail/logger.hpp"               // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/performance_tracker.hpp"  // plssvm::detail::tracking_entry, PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY
+#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                   // plssvm::parameter, plssvm::detail::parameter
+#include "plssvm/target_platforms.hpp"            // plssvm::target_platform
+
+#include "fmt/core.h"                             // fmt::format
+#include "fmt/ostream.h"                          // can use fmt using operator<< overloads
+
+#include "omp.h"                                  // omp_get_max_threads, omp_get_max_active_levels, omp_set_max_active_levels
+
+#if defined(__linux__)
+    #include <unistd.h>                           // sysconf, _SC_PHYS_PAGES, _SC_PAGE_SIZE
+#endif
+
+#include <algorithm>                              // std::max, std::min, std::fill
+#include <array>                                  // std::array
+#include <cmath>                                  // std::pow, std::exp
+#include <cstddef>                                // std::size_t
+#include <filesystem>                             // std::filesystem::{directory_iterator, directory_entry}
+#include <limits>                                 // std::numeric_limits
+#include <numeric>                                // std::iota
+#include <string>                                 // std::string
+#include <system_error>                           // std::error_code
+#include <vector>                                 // std::vector
+
+namespace plssvm::openmp {
+
+std::size_t get_num_numa_nodes() {
+    std::size_t num_numa_nodes = 0;
+#if defined(__linux__)
+    // each NUMA node is represented by a directory named "nodeX" where X is the ID of the NUMA node
+    std::error_code ec;
+    for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator{ "/sys/devices/system/node", ec }) {
+        const std::string name = entry.path().filename().string();
+        if (name.size() > 4 && name.compare(0, 4, "node") == 0 && name.find_first_not_of("0123456789", 4) == std::string::npos) {
+            ++num_numa_nodes;
+        }
+    }
+#endif
+    return std::max<std::size_t>(num_numa_nodes, 1);
+}
+
+device_csvm::device_csvm(parameter params) :
+    device_csvm{ plssvm::target_platform::automatic, params } {}
+
+device_csvm::device_csvm(const target_platform target, parameter params) :
+    base_type{ params } {
+    this->init(target, get_num_numa_nodes());
+}
+
+void device_csvm::init(const target_platform target, const std::size_t num_devices) {
+    // check if supported target platform has been selected
+    if (target != target_platform::automatic && target != target_platform::cpu) {
+        throw backend_exception{ fmt::format("Invalid target platform '{}' for the OpenMP backend!", target) };
+    }
+    // the CPU target must be available
+#if !defined(PLSSVM_HAS_CPU_TARGET)
+    throw backend_exception{ "Requested target platform 'cpu' that hasn't been enabled using PLSSVM_TARGET_PLATFORMS!" };
+#endif
+
+    // at least one device must be used
+    if (num_devices == 0) {
+        throw backend_exception{ "The number of devices must be greater than 0!" };
+    }
+
+    // the kernels are launched from within a parallel region over all devices
+    if (omp_get_max_active_levels() < 2) {
+        omp_set_max_active_levels(2);
+    }
+    // distribute the available threads evenly among the devices
+    num_threads_per_device_ = std::max(1, omp_get_max_threads() / static_cast<int>(num_devices));
+
+    plssvm::detail::log(verbosity_level::full,
+                        "\nUsing OpenMP as backend with {} device(s) and {} thread(s) per device.\n\n",
+                        plssvm::detail::tracking_entry{ "backend", "num_devices", num_devices },
+                        plssvm::detail::tracking_entry{ "backend", "num_threads_per_device", num_threads_per_device_ });
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ "backend", "backend", plssvm::backend_type::openmp }));
+    PLSSVM_DETAIL_PERFORMANCE_TRACKER_ADD_TRACKING_ENTRY((plssvm::detail::tracking_entry{ "backend", "target_platform", plssvm::target_platform::cpu }));
+
+    // update the target platform
+    target_ = plssvm::target_platform::cpu;
+
+    // the devices are only logical IDs
+    devices_.resize(num_devices);
+    std::iota(devices_.begin(), devices_.end(), 0);
+}
+
+void device_csvm::device_synchronize([[maybe_unused]] const queue_type &queue) const {
+    // all kernels are executed synchronously
+}
+
+std::size_t device_csvm::get_device_memory([[maybe_unused]] const queue_type &queue) const {
+#if defined(__linux__)
+    const long num_pages = sysconf(_SC_PHYS_PAGES);
+    const long page_size = sysconf(_SC_PAGE_SIZE);
+    if (num_pages > 0 && page_size > 0) {
+        return static_cast<std::size_t>(num_pages) * static_cast<std::size_t>(page_size) / devices_.size();
+    }
+#endif
+    // the physical memory couldn't be determined
+    return std::numeric_limits<std::size_t>::max();
+}
+
+template <typename real_type>
+void device_csvm::run_q_kernel_impl([[maybe_unused]] const std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, device_ptr_type<real_type> &q_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, const std::size_t num_data_points_padded, const std::size_t num_features) const {
+    real_type *q = q_d.get();
+    const real_type *data = data_d.get();
+    const real_type *data_last = data_last_d.get();
+    const std::size_t num_indices = std::min(range.grid[0] * range.block[0], num_data_points_padded);
+
+    #pragma omp parallel for num_threads(num_threads_per_device_) proc_bind(close)
+    for (std::size_t index = 0; index < num_indices; ++index) {
+        real_type temp{ 0.0 };
+        switch (params.kernel_type) {
+            case kernel_function_type::linear:
+            case kernel_function_type::polynomial:
+                for (std::size_t feature = 0; feature < num_features; ++feature) {
+                    temp += data[feature * num_data_points_padded + index] * data_last[feature];
+                }
+                break;
+            case kernel_function_type::rbf:
+                for (std::size_t feature = 0; feature < num_features; ++feature) {
+                    const real_type diff = data[feature * num_data_points_padded + index] - data_last[feature];
+                    temp += diff * diff;
+                }
+                break;
+        }
+        switch (params.kernel_type) {
+            case kernel_function_type::linear:
+                q[index] = temp;
+                break;
+            case kernel_function_type::polynomial:
+                q[index] = std::pow(params.gamma.value() * temp + params.coef0.value(), params.degree.value());
+                break;
+            case kernel_function_type::rbf:
+                q[index] = std::exp(-params.gamma.value() * temp);
+                break;
+        }
+    }
+}
+
+template void device_csvm::run_q_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, std::size_t, std::size_t) const;
+template void device_csvm::run_q_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, std::size_t, std::size_t) const;
+
+template <typename real_type>
+void device_csvm::run_svm_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const real_type QA_cost, const real_type add, const std::size_t num_data_points_padded, const std::size_t num_features, const std::size_t row_offset) const {
+    // the same tiles as calculated by the thread blocks of the GPU kernels
+    constexpr auto tile_size = static_cast<std::size_t>(THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE);
+
+    const real_type *q = q_d.get();
+    real_type *ret = r_d.get();
+    const real_type *d = x_d.get();
+    const real_type *data = data_d.get();
+    const real_type cost = real_type{ 1.0 } / params.cost;
+    // if the features are distributed across the devices (linear kernel), the QA_cost, q, and cost terms may only be added by the first device
+    const bool add_constant_terms = params.kernel_type != kernel_function_type::linear || device == 0;
+
+    const std::size_t num_row_tiles = range.grid[0];
+    const std::size_t num_col_tiles = range.grid[1];
+    PLSSVM_ASSERT(row_offset + num_row_tiles * tile_size <= num_data_points_padded, "The row tiles exceed the padded data points!: {} > {}", row_offset + num_row_tiles * tile_size, num_data_points_padded);
+    PLSSVM_ASSERT(num_col_tiles * tile_size <= num_data_points_padded, "The column tiles exceed the padded data points!: {} > {}", num_col_tiles * tile_size, num_data_points_padded);
+
+    #pragma omp parallel num_threads(num_threads_per_device_) proc_bind(close)
+    {
+        std::vector<real_type> tile(tile_size * tile_size);
+        std::array<real_type, tile_size> ret_i{};
+        std::array<real_type, tile_size> ret_j{};
+
+        #pragma omp for collapse(2) schedule(dynamic)
+        for (std::size_t row_tile = 0; row_tile < num_row_tiles; ++row_tile) {
+            for (std::size_t col_tile = 0; col_tile < num_col_tiles; ++col_tile) {
+                const std::size_t i = row_offset + row_tile * tile_size;
+                const std::size_t j = col_tile * tile_size;
+                // only the lower triangular matrix is calculated
+                if (i < j) {
+                    continue;
+                }
+
+                // calculate the scalar products or squared euclidean distances of the tile
+                std::fill(tile.begin(), tile.end(), real_type{ 0.0 });
+                for (std::size_t feature = 0; feature < num_features; ++feature) {
+                    const real_type *feature_data = data + feature * num_data_points_padded;
+                    for (std::size_t x = 0; x < tile_size; ++x) {
+                        const real_type data_j = feature_data[j + x];
+                        real_type *tile_row = tile.data() + x * tile_size;
+                        if (params.kernel_type == kernel_function_type::rbf) {
+                            #pragma omp simd
+                            for (std::size_t y = 0; y < tile_size; ++y) {
+                                const real_type diff = feature_data[i + y] - data_j;
+                                tile_row[y] += diff * diff;
+                            }
+                        } else {
+                            #pragma omp simd
+                            for (std::size_t y = 0; y < tile_size; ++y) {
+                                tile_row[y] += feature_data[i + y] * data_j;
+                            }
+                        }
+                    }
+                }
+
+                // apply the kernel function and multiply the tile with the vector d
+                ret_i.fill(real_type{ 0.0 });
+                ret_j.fill(real_type{ 0.0 });
+                for (std::size_t x = 0; x < tile_size; ++x) {
+                    for (std::size_t y = 0; y < tile_size; ++y) {
+                        if (i + y < j + x) {
+                            continue;
+                        }
+                        real_type temp = tile[x * tile_size + y];
+                        switch (params.kernel_type) {
+                            case kernel_function_type::linear:
+                                break;
+                            case kernel_function_type::polynomial:
+                                temp = std::pow(params.gamma.value() * temp + params.coef0.value(), params.degree.value());
+                                break;
+                            case kernel_function_type::rbf:
+                                temp = std::exp(-params.gamma.value() * temp);
+                                break;
+                        }
+                        if (add_constant_terms) {
+                            temp += QA_cost - q[i + y] - q[j + x];
+                        }
+                        temp *= add;
+
+                        if (i + y > j + x) {
+                            // upper triangular matrix
+                            ret_i[y] += temp * d[j + x];
+                            ret_j[x] += temp * d[i + y];
+                        } else {
+                            // diagonal
+                            ret_j[x] += (add_constant_terms ? temp + cost * add : temp) * d[i + y];
+                        }
+                    }
+                }
+
+                // the same entries of the result vector may be updated by multiple tiles
+                for (std::size_t y = 0; y < tile_size; ++y) {
+                    #pragma omp atomic
+                    ret[i + y] += ret_i[y];
+                }
+                for (std::size_t x = 0; x < tile_size; ++x) {
+                    #pragma omp atomic
+                    ret[j + x] += ret_j[x];
+                }
+            }
+        }
+    }
+}
+
+template void device_csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, float, float, std::size_t, std::size_t, std::size_t) const;
+template void device_csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, double, double, std::size_t, std::size_t, std::size_t) const;
+
+template <typename real_type>
+void device_csvm::run_w_kernel_impl([[maybe_unused]] const std::size_t device, [[maybe_unused]] const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &w_d, const device_ptr_type<real_type> &alpha_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, const std::size_t num_data_points, const std::size_t num_features) const {
+    constexpr auto boundary_size = static_cast<std::size_t>(THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE);
+
+    real_type *w = w_d.get();
+    const real_type *alpha = alpha_d.get();
+    const real_type *data = data_d.get();
+    const real_type *data_last = data_last_d.get();
+
+    #pragma omp parallel for num_threads(num_threads_per_device_) proc_bind(close)
+    for (std::size_t feature = 0; feature < num_features; ++feature) {
+        const real_type *feature_data = data + (num_data_points - 1 + boundary_size) * feature;
+        real_type temp{ 0.0 };
+        #pragma omp simd reduction(+ : temp)
+        for (std::size_t dat = 0; dat < num_data_points - 1; ++dat) {
+            temp += alpha[dat] * feature_data[dat];
+        }
+        w[feature] = temp + alpha[num_data_points - 1] * data_last[feature];
+    }
+}
+
+template void device_csvm::run_w_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, std::size_t, std::size_t) const;
+template void device_csvm::run_w_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, std::size_t, std::size_t) const;
+
+template <typename real_type>
+void device_csvm::run_predict_kernel_impl([[maybe_unused]] const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, device_ptr_type<real_type> &out_d, const device_ptr_type<real_type> &alpha_d, const device_ptr_type<real_type> &point_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, const std::size_t num_support_vectors, const std::size_t num_predict_points, const std::size_t num_features) const {
+    constexpr auto boundary_size = static_cast<std::size_t>(THREAD_BLOCK_SIZE * INTERNAL_BLOCK_SIZE);
+
+    // the linear kernel uses the normal vector w instead
+    if (params.kernel_type == kernel_function_type::linear) {
+        return;
+    }
+
+    real_type *out = out_d.get();
+    const real_type *alpha = alpha_d.get();
+    const real_type *points = point_d.get();
+    const real_type *data = data_d.get();
+    const real_type *data_last = data_last_d.get();
+
+    #pragma omp parallel for num_threads(num_threads_per_device_) proc_bind(close) schedule(dynamic)
+    for (std::size_t point = 0; point < num_predict_points; ++point) {
+        real_type temp{ 0.0 };
+        for (std::size_t sv = 0; sv < num_support_vectors; ++sv) {
+            real_type kernel_value{ 0.0 };
+            for (std::size_t feature = 0; feature < num_features; ++feature) {
+                const real_type sv_value = sv == num_support_vectors - 1 ? data_last[feature] : data[sv + (num_support_vectors - 1 + boundary_size) * feature];
+                const real_type point_value = points[point + (num_predict_points + boundary_size) * feature];
+                if (params.kernel_type == kernel_function_type::rbf) {
+                    kernel_value += (sv_value - point_value) * (sv_value - point_value);
+                } else {
+                    kernel_value += sv_value * point_value;
+                }
+            }
+            if (params.kernel_type == kernel_function_type::rbf) {
+                temp += alpha[sv] * std::exp(-params.gamma.value() * kernel_value);
+            } else {
+                temp += alpha[sv] * std::pow(params.gamma.value() * kernel_value + params.coef0.value(), params.degree.value());
+            }
+        }
+        out[point] += temp;
+    }
+}
+
+template void device_csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, std::size_t, std::size_t, std::size_t) const;
+template void device_csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, std::size_t, std::size_t, std::size_t) const;
+
+template <typename real_type>
+void device_csvm::run_axpy_kernel_impl([[maybe_unused]] const std::size_t device, [[maybe_unused]] const ::plssvm::detail::execution_range &range, const real_type alpha, const device_ptr_type<real_type> &x_d, device_ptr_type<real_type> &y_d, const std::size_t size) const {
+    const real_type *x = x_d.get();
+    real_type *y = y_d.get();
+
+    #pragma omp parallel for simd num_threads(num_threads_per_device_) proc_bind(close)
+    for (std::size_t index = 0; index < size; ++index) {
+        y[index] += alpha * x[index];
+    }
+}
+
+template void device_csvm::run_axpy_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, float, const device_ptr_type<float> &, device_ptr_type<float> &, std::size_t) const;
+template void device_csvm::run_axpy_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, double, const device_ptr_type<double> &, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void device_csvm::run_xpby_kernel_impl([[maybe_unused]] const std::size_t device, [[maybe_unused]] const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const real_type beta, device_ptr_type<real_type> &y_d, const std::size_t size) const {
+    const real_type *x = x_d.get();
+    real_type *y = y_d.get();
+
+    #pragma omp parallel for simd num_threads(num_threads_per_device_) proc_bind(close)
+    for (std::size_t index = 0; index < size; ++index) {
+        y[index] = x[index] + beta * y[index];
+    }
+}
+
+template void device_csvm::run_xpby_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<float> &, float, device_ptr_type<float> &, std::size_t) const;
+template void device_csvm::run_xpby_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<double> &, double, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void device_csvm::run_dot_kernel_impl([[maybe_unused]] const std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &y_d, device_ptr_type<real_type> &partial_sums_d, const std::size_t size) const {
+    const real_type *x = x_d.get();
+    const real_type *y = y_d.get();
+    real_type *partial_sums = partial_sums_d.get();
+    const std::size_t num_blocks = range.grid[0];
+    const std::size_t block_size = range.block[0];
+
+    // one partial sum for each block of the execution range using the same grid-stride loop as the GPU kernels
+    #pragma omp parallel for num_threads(num_threads_per_device_) proc_bind(close)
+    for (std::size_t block = 0; block < num_blocks; ++block) {
+        real_type temp{ 0.0 };
+        for (std::size_t first = block * block_size; first < size; first += num_blocks * block_size) {
+            const std::size_t last = std::min(first + block_size, size);
+            #pragma omp simd reduction(+ : temp)
+            for (std::size_t index = first; index < last; ++index) {
+                temp += x[index] * y[index];
+            }
+        }
+        partial_sums[block] = temp;
+    }
+}
+
+template void device_csvm::run_dot_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, std::size_t) const;
+template void device_csvm::run_dot_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void device_csvm::run_sum_kernel_impl([[maybe_unused]] const std::size_t device, [[maybe_unused]] const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &partial_sums_d, const std::size_t size) const {
+    real_type *partial_sums = partial_sums_d.get();
+
+    // the number of partial sums is small, i.e., sum them up sequentially
+    real_type temp{ 0.0 };
+    for (std::size_t index = 0; index < size; ++index) {
+        temp += partial_sums[index];
+    }
+    partial_sums[0] = temp;
+}
+
+template void device_csvm::run_sum_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, device_ptr_type<float> &, std::size_t) const;
+template void device_csvm::run_sum_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, device_ptr_type<double> &, std::size_t) const;
+
+}  // namespace plssvm::openmp
@@ -0,0 +1,111 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/device_ptr.hpp"
+
+#include "plssvm/backends/OpenMP/exceptions.hpp"  // plssvm::openmp::backend_exception
+#include "plssvm/backends/gpu_device_ptr.hpp"     // plssvm::detail::gpu_device_ptr
+#include "plssvm/detail/assert.hpp"               // PLSSVM_ASSERT
+
+#include "fmt/core.h"                             // fmt::format
+
+#include <algorithm>                              // std::min, std::fill_n, std::copy_n
+#include <cstring>                                // std::memset
+#include <future>                                 // std::async, std::launch
+
+namespace plssvm::openmp {
+
+template <typename T>
+device_ptr<T>::device_ptr(const size_type size, const queue_type device) :
+    base_type{ size, device } {
+    if (queue_ < 0) {
+        throw backend_exception{ fmt::format("Illegal device ID! Must be greater or equal than 0 but is {}.", queue_) };
+    }
+    // note: the memory is intentionally not initialized such that the first touch happens on the thread associated with the device
+    data_ = new value_type[size_];
+}
+
+template <typename T>
+device_ptr<T>::~device_ptr() {
+    this->wait_for_async_copies();
+    delete[] data_;
+}
+
+template <typename T>
+void device_ptr<T>::memset(const int pattern, const size_type pos, const size_type num_bytes) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+
+    this->wait_for_async_copies();
+
+    if (pos >= size_) {
+        throw backend_exception{ fmt::format("Illegal access in memset!: {} >= {}", pos, size_) };
+    }
+
+    const size_type rnum_bytes = std::min(num_bytes, (size_ - pos) * sizeof(value_type));
+    std::memset(data_ + pos, pattern, rnum_bytes);
+}
+
+template <typename T>
+void device_ptr<T>::fill(const value_type value, const size_type pos, const size_type count) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+
+    this->wait_for_async_copies();
+
+    if (pos >= size_) {
+        throw backend_exception{ fmt::format("Illegal access in fill!: {} >= {}", pos, size_) };
+    }
+
+    const size_type rcount = std::min(count, size_ - pos);
+    std::fill_n(data_ + pos, rcount, value);
+}
+
+template <typename T>
+void device_ptr<T>::copy_to_device(const_host_pointer_type data_to_copy, const size_type pos, const size_type count) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+    PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
+
+    this->wait_for_async_copies();
+
+    const size_type rcount = std::min(count, size_ - pos);
+    std::copy_n(data_to_copy, rcount, data_ + pos);
+}
+
+template <typename T>
+void device_ptr<T>::copy_to_host(host_pointer_type buffer, const size_type pos, const size_type count) const {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+    PLSSVM_ASSERT(buffer != nullptr, "Invalid host pointer for the data to copy!");
+
+    this->wait_for_async_copies();
+
+    const size_type rcount = std::min(count, size_ - pos);
+    std::copy_n(data_ + pos, rcount, buffer);
+}
+
+template <typename T>
+void device_ptr<T>::copy_to_device_async(const_host_pointer_type data_to_copy, const size_type pos, const size_type count) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+    PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
+
+    // perform the copy on a separate host thread
+    const size_type rcount = std::min(count, size_ - pos);
+    device_pointer_type data = data_;
+    pending_copies_.push_back(std::async(std::launch::async, [=]() { std::copy_n(data_to_copy, rcount, data + pos); }));
+}
+
+template <typename T>
+void device_ptr<T>::wait_for_async_copies() const {
+    for (std::future<void> &copy : pending_copies_) {
+        copy.get();
+    }
+    pending_copies_.clear();
+}
+
+template class device_ptr<float>;
+template class device_ptr<double>;
+
+}  // namespace plssvm::openmp
@@ -0,0 +1,204 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/distributed_csvm.hpp"
+
+#include "plssvm/backends/OpenMP/csvm.hpp"          // plssvm::openmp::csvm
+#include "plssvm/backends/OpenMP/exceptions.hpp"    // plssvm::openmp::backend_exception
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"    // plssvm::openmp::calculate_kernel_row_range
+#include "plssvm/backends/OpenMP/thread_scope.hpp"  // plssvm::openmp::thread_scope
+#include "plssvm/cancellation_token.hpp"            // plssvm::cancellation_token
+#include "plssvm/constants.hpp"                     // plssvm::kernel_index_type
+#include "plssvm/detail/assert.hpp"                 // PLSSVM_ASSERT
+#include "plssvm/detail/io/cg_checkpoint.hpp"       // plssvm::detail::io::calculate_data_fingerprint
+#include "plssvm/detail/logger.hpp"                 // plssvm::detail::log, plssvm::verbosity_level
+#include "plssvm/detail/operators.hpp"              // various operator overloads for std::vector and scalars
+#include "plssvm/detail/performance_tracker.hpp"    // plssvm::detail::tracking_entry
+#include "plssvm/detail/solver_control.hpp"         // plssvm::detail::solver_control
+#include "plssvm/iteration_info.hpp"                // plssvm::iteration_info
+#include "plssvm/kernel_function_types.hpp"         // plssvm::kernel_function
+#include "plssvm/parameter.hpp"                     // plssvm::parameter, plssvm::detail::parameter
+#include "plssvm/solver_types.hpp"                  // plssvm::solver_type
+
+#include "mpi.h"                                    // MPI_Comm, MPI_Initialized, MPI_Comm_rank, MPI_Comm_size, MPI_Allreduce, MPI_Bcast, MPI_IN_PLACE, MPI_SUM, MPI_MAX, MPI_MIN, MPI_INT, MPI_FLOAT, MPI_DOUBLE
+
+#include <algorithm>                                // std::fill, std::all_of, std::transform
+#include <chrono>                                   // std::chrono::steady_clock
+#include <cstddef>                                  // std::size_t
+#include <cstdint>                                  // std::uint64_t
+#include <functional>                               // std::function
+#include <type_traits>                              // std::is_same_v
+#include <utility>                                  // std::pair, std::make_pair, std::move
+#include <vector>                                   // std::vector
+
+namespace plssvm::openmp {
+
+std::pair<std::size_t, std::size_t> calculate_distributed_row_range(const std::size_t num_rows, const int rank, const int num_ranks) noexcept {
+    PLSSVM_ASSERT(num_ranks > 0, "At least one MPI process must be present!");
+    PLSSVM_ASSERT(0 <= rank && rank < num_ranks, "Invalid rank {} for {} MPI processes!", rank, num_ranks);
+
+    return calculate_kernel_row_range(0, num_rows, rank, num_ranks);
+}
+
+distributed_csvm::distributed_csvm(parameter params) :
+    distributed_csvm{ MPI_COMM_WORLD, params } {}
+
+distributed_csvm::distributed_csvm(MPI_Comm communicator, parameter params) :
+    csvm{ params } {
+    this->init(communicator);
+}
+
+void distributed_csvm::init(MPI_Comm communicator) {
+    // MPI must already be initialized by the user
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    if (initialized == 0) {
+        throw backend_exception{ "MPI must be initialized before creating a distributed C-SVM!" };
+    }
+
+    communicator_ = communicator;
+    MPI_Comm_rank(communicator_, &rank_);
+    MPI_Comm_size(communicator_, &num_ranks_);
+
+    plssvm::detail::log(verbosity_level::full,
+                        "Distributing the kernel matrix across {} MPI processes (rank {}).\n\n", plssvm::detail::tracking_entry{ "backend", "num_mpi_processes", num_ranks_ }, rank_);
+}
+
+template <typename real_type>
+std::pair<std::vector<real_type>, real_type> distributed_csvm::solve_system_of_linear_equations_distributed_impl(const detail::parameter<real_type> &params, const std::vector<std::vector<real_type>> &A, std::vector<real_type> b, const real_type eps, const unsigned long long max_iter, const detail::solver_control<real_type> &control) const {
+    PLSSVM_ASSERT(!A.empty(), "The data must not be empty!");
+    PLSSVM_ASSERT(!A.front().empty(), "The data points must contain at least one feature!");
+    PLSSVM_ASSERT(std::all_of(A.cbegin(), A.cend(), [&A](const std::vector<real_type> &data_point) { return data_point.size() == A.front().size(); }), "All data points must have the same number of features!");
+    PLSSVM_ASSERT(A.size() == b.size(), "The number of data points in the matrix A ({}) and the values in the right hand side vector ({}) must be the same!", A.size(), b.size());
+    PLSSVM_ASSERT(eps > real_type{ 0.0 }, "The stopping criterion in the CG algorithm must be greater than 0.0, but is {}!", eps);
+    PLSSVM_ASSERT(max_iter > 0, "The number of CG iterations must be greater than 0!");
+    PLSSVM_ASSERT(control.initial_guess.empty() || control.initial_guess.size() == A.size() - 1, "The initial guess must either be empty or contain exactly one value less than data points are present!: {} != {}", control.initial_guess.size(), A.size() - 1);
+    PLSSVM_ASSERT(!(std::is_same_v<real_type, double> && control.mixed_precision && control.solver == solver_type::pipelined_cg), "Mixed precision is not supported in combination with the pipelined CG algorithm!");
+
+    const std::chrono::steady_clock::time_point solver_start_time = std::chrono::steady_clock::now();
+
+    // all parallel regions use the threads of this C-SVM
+    const thread_scope scope = this->make_thread_scope();
+
+    using namespace plssvm::operators;
+
+    // create q vector
+    // note: all processes calculate the whole q vector since it is cheap compared to the kernel matrix-vector multiplications
+    const std::vector<real_type> q = this->generate_q(params, A);
+
+    // calculate QA_costs
+    const real_type QA_cost = kernel_function(A.back(), A.back(), params) + real_type{ 1.0 } / params.cost;
+
+    // update b
+    const real_type b_back_value = b.back();
+    b.pop_back();
+    b -= b_back_value;
+
+    // the rows of the kernel matrix calculated by this process
+    // note: no structured bindings since they can't be captured in lambdas in C++17
+    const std::pair<std::size_t, std::size_t> row_range = calculate_distributed_row_range(b.size(), rank_, num_ranks_);
+    const std::size_t row_begin = row_range.first;
+    const std::size_t row_end = row_range.second;
+    detail::log(verbosity_level::full,
+                "Calculating the rows [{}, {}) of the kernel matrix with {} rows on rank {}.\n",
+                row_begin,
+                row_end,
+                b.size(),
+                rank_);
+
+    // note: the data fingerprint is only necessary if checkpoints are written or read
+    const std::uint64_t data_fingerprint = control.checkpoint_file.empty() ? 0 : detail::io::calculate_data_fingerprint(A, b);
+
+    // if requested, perform the kernel matrix-vector multiplications in the CG iterations in single precision
+    const bool use_mixed_precision = std::is_same_v<real_type, double> && control.mixed_precision;
+    const detail::parameter<float> params_mixed = static_cast<detail::parameter<float>>(params);
+    std::vector<std::vector<float>> A_mixed{};
+    std::vector<float> q_mixed{};
+    std::vector<float> d_mixed{};
+    std::vector<float> Ad_mixed{};
+    if (use_mixed_precision) {
+        A_mixed = std::vector<std::vector<float>>(A.size(), std::vector<float>(A.front().size()));
+        #pragma omp parallel for default(none) shared(A, A_mixed)
+        for (typename std::vector<std::vector<real_type>>::size_type i = 0; i < A.size(); ++i) {
+            std::transform(A[i].cbegin(), A[i].cend(), A_mixed[i].begin(), [](const real_type val) { return static_cast<float>(val); });
+        }
+        q_mixed = std::vector<float>(q.cbegin(), q.cend());
+        d_mixed.resize(b.size());
+        Ad_mixed.resize(b.size());
+    }
+
+    // all processes must stop the CG algorithm in the same iteration, otherwise the collective MPI calls would deadlock
+    // -> the time budget and the cancellation are only checked in the kernel matrix-vector multiplications and the decision is shared with all processes
+    detail::solver_control<real_type> distributed_control = control;
+    distributed_control.cancellation = cancellation_token{};
+    distributed_control.deadline = std::chrono::steady_clock::time_point::max();
+    // the CG algorithm is only stopped by the iteration callback if the callback of any process returned false
+    if (control.iteration_callback) {
+        distributed_control.iteration_callback = [&](const iteration_info &info) {
+            int continue_iterating = control.iteration_callback(info) ? 1 : 0;
+            MPI_Allreduce(MPI_IN_PLACE, &continue_iterating, 1, MPI_INT, MPI_MIN, communicator_);
+            return continue_iterating == 1;
+        };
+    }
+    // all processes have the same state of the CG algorithm, hence only one of them writes the checkpoints
+    distributed_control.write_checkpoints = control.write_checkpoints && rank_ == 0;
+
+    // only the first process reads or tunes the block size such that all processes use the same one and write the tuning profile at most once
+    kernel_index_type block_size = 0;
+    if (rank_ == 0) {
+        block_size = use_mixed_precision ? this->select_block_size(params_mixed, A_mixed) : this->select_block_size(params, A);
+    }
+    MPI_Bcast(&block_size, 1, MPI_INT, 0, communicator_);
+
+    // skip the remaining blocks of a kernel matrix-vector multiplication as soon as the time budget of this process has been exhausted or the cancellation has been requested
+    // note: the partially calculated result of an aborted kernel matrix-vector multiplication is never used since the stop is shared with all processes afterwards
+    const std::function<bool()> fit_stop_requested = [&control]() { return control.stop_requested(); };
+
+    // the partial result of this process before it is summed up with the partial results of all other processes
+    std::vector<real_type> partial_result(b.size());
+    const MPI_Datatype mpi_real_type = std::is_same_v<real_type, float> ? MPI_FLOAT : MPI_DOUBLE;
+
+    // result += add * A * vec, where each process only calculates its rows of A
+    const auto matrix_vector_multiplication = [&](const std::vector<real_type> &vec, std::vector<real_type> &result, const real_type add, const bool single_precision) {
+        if (single_precision) {
+            std::transform(vec.cbegin(), vec.cend(), d_mixed.begin(), [](const real_type val) { return static_cast<float>(val); });
+            std::fill(Ad_mixed.begin(), Ad_mixed.end(), 0.0f);
+            this->run_device_kernel(params_mixed, q_mixed, Ad_mixed, d_mixed, A_mixed, static_cast<float>(QA_cost), static_cast<float>(add), row_begin, row_end, fit_stop_requested, block_size);
+            MPI_Allreduce(MPI_IN_PLACE, Ad_mixed.data(), static_cast<int>(Ad_mixed.size()), MPI_FLOAT, MPI_SUM, communicator_);
+            std::transform(Ad_mixed.cbegin(), Ad_mixed.cend(), result.cbegin(), result.begin(), [](const float val, const real_type res) { return res + static_cast<real_type>(val); });
+        } else {
+            std::fill(partial_result.begin(), partial_result.end(), real_type{ 0.0 });
+            this->run_device_kernel(params, q, partial_result, vec, A, QA_cost, add, row_begin, row_end, fit_stop_requested, block_size);
+            MPI_Allreduce(MPI_IN_PLACE, partial_result.data(), static_cast<int>(partial_result.size()), mpi_real_type, MPI_SUM, communicator_);
+            result += partial_result;
+        }
+
+        // stop all processes if any process exhausted its time budget or has been cancelled
+        int stop = control.stop_requested() ? 1 : 0;
+        MPI_Allreduce(MPI_IN_PLACE, &stop, 1, MPI_INT, MPI_MAX, communicator_);
+        if (stop == 1) {
+            distributed_control.cancellation->cancel();
+        }
+    };
+
+    // CG
+    // note: the vectors are replicated on all processes, i.e., the dot products are calculated locally without additional communication
+    std::vector<real_type> alpha = this->conjugate_gradients<real_type>(params, b, data_fingerprint, eps, max_iter, distributed_control, use_mixed_precision, solver_start_time, matrix_vector_multiplication);
+    control.converged = distributed_control.converged;
+
+    // calculate bias
+    const real_type bias = b_back_value + QA_cost * sum(alpha) - (transposed{ q } * alpha);
+    alpha.push_back(-sum(alpha));
+
+    return std::make_pair(std::move(alpha), -bias);
+}
+
+template std::pair<std::vector<float>, float> distributed_csvm::solve_system_of_linear_equations_distributed_impl(const detail::parameter<float> &, const std::vector<std::vector<float>> &, std::vector<float>, const float, const unsigned long long, const detail::solver_control<float> &) const;
+template std::pair<std::vector<double>, double> distributed_csvm::solve_system_of_linear_equations_distributed_impl(const detail::parameter<double> &, const std::vector<std::vector<double>> &, std::vector<double>, const double, const unsigned long long, const detail::solver_control<double> &) const;
+
+}  // namespace plssvm::openmp
@@ -0,0 +1,202 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/out_of_core_kernel.hpp"
+
+#include "plssvm/detail/assert.hpp"               // PLSSVM_ASSERT
+#include "plssvm/detail/io/binary_data_file.hpp"  // plssvm::detail::io::binary_data_file
+#include "plssvm/kernel_function_types.hpp"       // plssvm::kernel_function_type, plssvm::kernel_function
+
+#include <algorithm>                              // std::max, std::min
+#include <array>                                  // std::array
+#include <cstddef>                                // std::size_t
+#include <functional>                             // std::function
+#include <future>                                 // std::future, std::async, std::launch
+#include <vector>                                 // std::vector
+
+namespace plssvm::openmp {
+
+std::size_t calculate_out_of_core_block_size(const std::size_t memory_budget, const std::size_t num_features, const std::size_t real_type_size) noexcept {
+    PLSSVM_ASSERT(num_features > 0, "The data points must contain at least one feature!");
+    PLSSVM_ASSERT(real_type_size > 0, "The size of the real_type must be greater than 0!");
+
+    // one row block and two column blocks must fit into the memory budget
+    return std::max<std::size_t>(memory_budget / (3 * num_features * real_type_size), 1);
+}
+
+namespace detail {
+
+/**
+ * @brief Read the data points in the range [@p first, @p last) from the binary data file @p data into the @p buffer.
+ * @details Afterwards, the operating system is allowed to drop the mapped pages again, i.e., only the buffers stay resident.
+ * @tparam real_type the type of the data
+ * @param[in] data the binary data file containing the data points
+ * @param[in] first the index of the first data point to read
+ * @param[in] last the index one past the last data point to read
+ * @param[out] buffer the buffer to store the data points in
+ */
+template <typename real_type>
+void load_data_points(const plssvm::detail::io::binary_data_file<real_type> &data, const std::size_t first, const std::size_t last, std::vector<std::vector<real_type>> &buffer) {
+    data.prefetch(first, last);
+    data.copy_data_points(first, last, buffer);
+    data.release(first, last);
+}
+
+template <kernel_function_type kernel, typename real_type, typename... Args>
+void device_kernel_q_out_of_core(std::vector<real_type> &q, const plssvm::detail::io::binary_data_file<real_type> &data, std::size_t block_size, const Args... args) {
+    PLSSVM_ASSERT(q.size() == data.num_data_points() - 1, "Sizes mismatch!: {} != {}", q.size(), data.num_data_points() - 1);
+    PLSSVM_ASSERT(block_size > 0, "The block size must be greater than 0!");
+
+    const std::size_t dept = q.size();
+    block_size = std::min(block_size, dept);
+
+    // the last data point is needed for all entries in q
+    std::vector<std::vector<real_type>> last_data_point(1, std::vector<real_type>(data.num_features()));
+    load_data_points(data, dept, dept + 1, last_data_point);
+    const std::vector<real_type> &x_last = last_data_point.front();
+
+    std::vector<std::vector<real_type>> block(block_size, std::vector<real_type>(data.num_features()));
+    for (std::size_t first = 0; first < dept; first += block_size) {
+        const std::size_t last = std::min(first + block_size, dept);
+        load_data_points(data, first, last, block);
+
+        // can't use default(none) due to the parameter pack Args (args)
+        #pragma omp parallel for
+        for (std::size_t i = first; i < last; ++i) {
+            q[i] = kernel_function<kernel>(block[i - first], x_last, args...);
+        }
+    }
+}
+
+template <kernel_function_type kernel, typename real_type, typename... Args>
+void device_kernel_out_of_core(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const plssvm::detail::io::binary_data_file<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, std::size_t block_size, const std::function<bool()> &stop_requested, const Args... args) {
+    PLSSVM_ASSERT(q.size() == data.num_data_points() - 1, "Sizes mismatch!: {} != {}", q.size(), data.num_data_points() - 1);
+    PLSSVM_ASSERT(q.size() == ret.size(), "Sizes mismatch!: {} != {}", q.size(), ret.size());
+    PLSSVM_ASSERT(q.size() == d.size(), "Sizes mismatch!: {} != {}", q.size(), d.size());
+    PLSSVM_ASSERT(cost != real_type{ 0.0 }, "cost must not be 0.0 since it is 1 / plssvm::cost!");
+    PLSSVM_ASSERT(add == real_type{ -1.0 } || add == real_type{ 1.0 }, "add must either be -1.0 or 1.0, but is {}!", add);
+    PLSSVM_ASSERT(block_size > 0, "The block size must be greater than 0!");
+
+    const std::size_t dept = d.size();
+    block_size = std::min(block_size, dept);
+
+    // the only data points kept in memory: the current row block and two column blocks
+    // while the current column block is processed, the next one is read from the file in the background (double buffering)
+    std::vector<std::vector<real_type>> row_block(block_size, std::vector<real_type>(data.num_features()));
+    std::array<std::vector<std::vector<real_type>>, 2> column_blocks{ row_block, row_block };
+
+    for (std::size_t row_first = 0; row_first < dept; row_first += block_size) {
+        const std::size_t row_last = std::min(row_first + block_size, dept);
+        load_data_points(data, row_first, row_last, row_block);
+
+        // asynchronously read the column block starting at col_first into column_blocks[buffer]
+        // note: the diagonal block is the current row block, i.e., doesn't have to be read again
+        const auto load_column_block_async = [&](const std::size_t col_first, const std::size_t buffer) -> std::future<void> {
+            if (col_first >= row_first) {
+                return {};
+            }
+            const std::size_t col_last = std::min(col_first + block_size, dept);
+            return std::async(std::launch::async, [&data, &column_blocks, col_first, col_last, buffer]() {
+                load_data_points(data, col_first, col_last, column_blocks[buffer]);
+            });
+        };
+
+        // only the lower triangular part (including the diagonal) of the kernel matrix is calculated
+        std::future<void> next_column_block = load_column_block_async(0, 0);
+        for (std::size_t col_first = 0, buffer = 0; col_first <= row_first; col_first += block_size, buffer = 1 - buffer) {
+            // wait until the current column block is available and start reading the next one
+            if (next_column_block.valid()) {
+                next_column_block.get();
+            }
+            next_column_block = load_column_block_async(col_first + block_size, 1 - buffer);
+
+            // skip all remaining blocks if the calculation should be stopped early
+            if (stop_requested && stop_requested()) {
+                if (next_column_block.valid()) {
+                    next_column_block.wait();
+                }
+                return;
+            }
+
+            const std::vector<std::vector<real_type>> &column_block = col_first == row_first ? row_block : column_blocks[buffer];
+            const std::size_t col_last = std::min(col_first + block_size, dept);
+
+            // can't use default(none) due to the parameter pack Args (args)
+            #pragma omp parallel for schedule(dynamic)
+            for (std::size_t i = row_first; i < row_last; ++i) {
+                real_type ret_i = 0.0;
+                for (std::size_t j = col_first; j < col_last && j <= i; ++j) {
+                    const real_type temp = (kernel_function<kernel>(row_block[i - row_first], column_block[j - col_first], args...) + QA_cost - q[i] - q[j]) * add;
+                    if (i == j) {
+                        ret_i += (temp + cost * add) * d[i];
+                    } else {
+                        ret_i += temp * d[j];
+                        #pragma omp atomic
+                        ret[j] += temp * d[i];
+                    }
+                }
+                #pragma omp atomic
+                ret[i] += ret_i;
+            }
+        }
+    }
+}
+
+}  // namespace detail
+
+template <typename real_type>
+void device_kernel_q_out_of_core_linear(std::vector<real_type> &q, const plssvm::detail::io::binary_data_file<real_type> &data, const std::size_t block_size) {
+    detail::device_kernel_q_out_of_core<kernel_function_type::linear>(q, data, block_size);
+}
+template void device_kernel_q_out_of_core_linear(std::vector<float> &, const plssvm::detail::io::binary_data_file<float> &, std::size_t);
+template void device_kernel_q_out_of_core_linear(std::vector<double> &, const plssvm::detail::io::binary_data_file<double> &, std::size_t);
+
+template <typename real_type>
+void device_kernel_q_out_of_core_polynomial(std::vector<real_type> &q, const plssvm::detail::io::binary_data_file<real_type> &data, const int degree, const real_type gamma, const real_type coef0, const std::size_t block_size) {
+    PLSSVM_ASSERT(gamma > real_type{ 0.0 }, "gamma must be greater than 0, but is {}!", gamma);
+
+    detail::device_kernel_q_out_of_core<kernel_function_type::polynomial>(q, data, block_size, degree, gamma, coef0);
+}
+template void device_kernel_q_out_of_core_polynomial(std::vector<float> &, const plssvm::detail::io::binary_data_file<float> &, int, float, float, std::size_t);
+template void device_kernel_q_out_of_core_polynomial(std::vector<double> &, const plssvm::detail::io::binary_data_file<double> &, int, double, double, std::size_t);
+
+template <typename real_type>
+void device_kernel_q_out_of_core_rbf(std::vector<real_type> &q, const plssvm::detail::io::binary_data_file<real_type> &data, const real_type gamma, const std::size_t block_size) {
+    PLSSVM_ASSERT(gamma > real_type{ 0.0 }, "gamma must be greater than 0, but is {}!", gamma);
+
+    detail::device_kernel_q_out_of_core<kernel_function_type::rbf>(q, data, block_size, gamma);
+}
+template void device_kernel_q_out_of_core_rbf(std::vector<float> &, const plssvm::detail::io::binary_data_file<float> &, float, std::size_t);
+template void device_kernel_q_out_of_core_rbf(std::vector<double> &, const plssvm::detail::io::binary_data_file<double> &, double, std::size_t);
+
+template <typename real_type>
+void device_kernel_out_of_core_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const plssvm::detail::io::binary_data_file<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, const std::size_t block_size, const std::function<bool()> &stop_requested) {
+    detail::device_kernel_out_of_core<kernel_function_type::linear>(q, ret, d, data, QA_cost, cost, add, block_size, stop_requested);
+}
+template void device_kernel_out_of_core_linear(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const plssvm::detail::io::binary_data_file<float> &, float, float, float, std::size_t, const std::function<bool()> &);
+template void device_kernel_out_of_core_linear(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const plssvm::detail::io::binary_data_file<double> &, double, double, double, std::size_t, const std::function<bool()> &);
+
+template <typename real_type>
+void device_kernel_out_of_core_polynomial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const plssvm::detail::io::binary_data_file<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, const int degree, const real_type gamma, const real_type coef0, const std::size_t block_size, const std::function<bool()> &stop_requested) {
+    PLSSVM_ASSERT(gamma > real_type{ 0.0 }, "gamma must be greater than 0, but is {}!", gamma);
+
+    detail::device_kernel_out_of_core<kernel_function_type::polynomial>(q, ret, d, data, QA_cost, cost, add, block_size, stop_requested, degree, gamma, coef0);
+}
+template void device_kernel_out_of_core_polynomial(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const plssvm::detail::io::binary_data_file<float> &, float, float, float, int, float, float, std::size_t, const std::function<bool()> &);
+template void device_kernel_out_of_core_polynomial(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const plssvm::detail::io::binary_data_file<double> &, double, double, double, int, double, double, std::size_t, const std::function<bool()> &);
+
+template <typename real_type>
+void device_kernel_out_of_core_rbf(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const plssvm::detail::io::binary_data_file<real_type> &data, const real_type QA_cost, const real_type cost, const real_type add, const real_type gamma, const std::size_t block_size, const std::function<bool()> &stop_requested) {
+    PLSSVM_ASSERT(gamma > real_type{ 0.0 }, "gamma must be greater than 0, but is {}!", gamma);
+
+    detail::device_kernel_out_of_core<kernel_function_type::rbf>(q, ret, d, data, QA_cost, cost, add, block_size, stop_requested, gamma);
+}
+template void device_kernel_out_of_core_rbf(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const plssvm::detail::io::binary_data_file<float> &, float, float, float, float, std::size_t, const std::function<bool()> &);
+template void device_kernel_out_of_core_rbf(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const plssvm::detail::io::binary_data_file<double> &, double, double, double, double, std::size_t, const std::function<bool()> &);
+
+}  // namespace plssvm::openmp
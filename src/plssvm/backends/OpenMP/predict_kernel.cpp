@@ -0,0 +1,138 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/predict_kernel.hpp"
+
+#include "plssvm/detail/assert.hpp"  // PLSSVM_ASSERT
+
+#include <algorithm>                 // std::min, std::max, std::fill
+#include <array>                     // std::array
+#include <cmath>                     // std::pow, std::exp, std::fma
+#include <cstddef>                   // std::size_t
+#include <vector>                    // std::vector
+
+namespace plssvm::openmp {
+
+namespace detail {
+
+/**
+ * @brief Calculate the dot products of all data points to predict with all support vectors tile-wise and apply @p kernel on each tile.
+ * @details The support vectors are packed feature-wise per tile (padded with zeros) such that the innermost loop over the support vectors of a tile is contiguous.
+ *          The kernel function and the weighting with @p alpha are applied directly on the tile of dot products, i.e., the kernel matrix is never stored.
+ */
+template <typename real_type, typename Kernel>
+void device_kernel_predict_blocked(std::vector<real_type> &out, const std::vector<std::vector<real_type>> &support_vectors, const std::vector<real_type> &alpha, const std::vector<std::vector<real_type>> &predict_points, const Kernel &kernel) {
+    PLSSVM_ASSERT(!support_vectors.empty(), "The support vectors must not be empty!");
+    PLSSVM_ASSERT(support_vectors.size() == alpha.size(), "Sizes mismatch!: {} != {}", support_vectors.size(), alpha.size());
+    PLSSVM_ASSERT(out.size() == predict_points.size(), "Sizes mismatch!: {} != {}", out.size(), predict_points.size());
+    PLSSVM_ASSERT(predict_points.empty() || predict_points.front().size() == support_vectors.front().size(), "Sizes mismatch!: {} != {}", predict_points.front().size(), support_vectors.front().size());
+
+    const std::size_t num_support_vectors = support_vectors.size();
+    const std::size_t num_features = support_vectors.front().size();
+    const std::size_t num_sv_tiles = (num_support_vectors + PREDICT_SUPPORT_VECTOR_BLOCK_SIZE - 1) / PREDICT_SUPPORT_VECTOR_BLOCK_SIZE;
+
+    // pack the support vectors as [tile][feature][support vector in tile]; the padded support vectors have a weight of 0
+    std::vector<real_type> packed_support_vectors(num_sv_tiles * num_features * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE, real_type{ 0.0 });
+    std::vector<real_type> packed_alpha(num_sv_tiles * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE, real_type{ 0.0 });
+    #pragma omp parallel for default(none) shared(support_vectors, alpha, packed_support_vectors, packed_alpha) firstprivate(num_support_vectors, num_features)
+    for (std::size_t sv = 0; sv < num_support_vectors; ++sv) {
+        const std::size_t tile_offset = (sv / PREDICT_SUPPORT_VECTOR_BLOCK_SIZE) * num_features * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE;
+        for (std::size_t feature = 0; feature < num_features; ++feature) {
+            packed_support_vectors[tile_offset + feature * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE + sv % PREDICT_SUPPORT_VECTOR_BLOCK_SIZE] = support_vectors[sv][feature];
+        }
+        packed_alpha[sv] = alpha[sv];
+    }
+
+    #pragma omp parallel for default(none) shared(out, predict_points, packed_support_vectors, packed_alpha, kernel) firstprivate(num_features, num_sv_tiles) schedule(dynamic)
+    for (std::size_t point_begin = 0; point_begin < predict_points.size(); point_begin += PREDICT_POINT_BLOCK_SIZE) {
+        const std::size_t num_points_in_tile = std::min(std::size_t{ PREDICT_POINT_BLOCK_SIZE }, predict_points.size() - point_begin);
+        std::array<real_type, PREDICT_POINT_BLOCK_SIZE * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE> dots{};
+
+        for (std::size_t sv_tile = 0; sv_tile < num_sv_tiles; ++sv_tile) {
+            const real_type *sv_tile_ptr = packed_support_vectors.data() + sv_tile * num_features * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE;
+            std::fill(dots.begin(), dots.end(), real_type{ 0.0 });
+
+            // reuse each block of features of the support vectors for all data points in the tile
+            for (std::size_t feature_begin = 0; feature_begin < num_features; feature_begin += PREDICT_FEATURE_BLOCK_SIZE) {
+                const std::size_t feature_end = std::min(feature_begin + PREDICT_FEATURE_BLOCK_SIZE, num_features);
+                for (std::size_t p = 0; p < num_points_in_tile; ++p) {
+                    const real_type *point = predict_points[point_begin + p].data();
+                    real_type *dot_row = dots.data() + p * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE;
+                    for (std::size_t feature = feature_begin; feature < feature_end; ++feature) {
+                        const real_type point_value = point[feature];
+                        const real_type *sv_row = sv_tile_ptr + feature * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE;
+                        #pragma omp simd
+                        for (std::size_t s = 0; s < PREDICT_SUPPORT_VECTOR_BLOCK_SIZE; ++s) {
+                            dot_row[s] += point_value * sv_row[s];
+                        }
+                    }
+                }
+            }
+
+            // apply the kernel function and the weights on the tile
+            const real_type *alpha_tile = packed_alpha.data() + sv_tile * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE;
+            for (std::size_t p = 0; p < num_points_in_tile; ++p) {
+                const real_type *dot_row = dots.data() + p * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE;
+                real_type temp{ 0.0 };
+                #pragma omp simd reduction(+ : temp)
+                for (std::size_t s = 0; s < PREDICT_SUPPORT_VECTOR_BLOCK_SIZE; ++s) {
+                    temp += alpha_tile[s] * kernel(dot_row[s], point_begin + p, sv_tile * PREDICT_SUPPORT_VECTOR_BLOCK_SIZE + s);
+                }
+                out[point_begin + p] += temp;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Calculate the squared euclidean norms of all @p data points; padded with zeros to a multiple of @p padding.
+ */
+template <typename real_type>
+[[nodiscard]] std::vector<real_type> squared_norms(const std::vector<std::vector<real_type>> &data, const std::size_t padding) {
+    std::vector<real_type> norms(((data.size() + padding - 1) / padding) * padding, real_type{ 0.0 });
+    #pragma omp parallel for default(none) shared(data, norms)
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        real_type temp{ 0.0 };
+        #pragma omp simd reduction(+ : temp)
+        for (std::size_t feature = 0; feature < data[i].size(); ++feature) {
+            temp += data[i][feature] * data[i][feature];
+        }
+        norms[i] = temp;
+    }
+    return norms;
+}
+
+}  // namespace detail
+
+template <typename real_type>
+void device_kernel_predict_polynomial(std::vector<real_type> &out, const std::vector<std::vector<real_type>> &support_vectors, const std::vector<real_type> &alpha, const std::vector<std::vector<real_type>> &predict_points, const int degree, const real_type gamma, const real_type coef0) {
+    PLSSVM_ASSERT(gamma > real_type{ 0.0 }, "gamma must be greater than 0, but is {}!", gamma);
+
+    detail::device_kernel_predict_blocked(out, support_vectors, alpha, predict_points, [degree, gamma, coef0](const real_type dot, std::size_t, std::size_t) {
+        return std::pow(std::fma(gamma, dot, coef0), degree);
+    });
+}
+template void device_kernel_predict_polynomial(std::vector<float> &, const std::vector<std::vector<float>> &, const std::vector<float> &, const std::vector<std::vector<float>> &, int, float, float);
+template void device_kernel_predict_polynomial(std::vector<double> &, const std::vector<std::vector<double>> &, const std::vector<double> &, const std::vector<std::vector<double>> &, int, double, double);
+
+template <typename real_type>
+void device_kernel_predict_rbf(std::vector<real_type> &out, const std::vector<std::vector<real_type>> &support_vectors, const std::vector<real_type> &alpha, const std::vector<std::vector<real_type>> &predict_points, const real_type gamma) {
+    PLSSVM_ASSERT(gamma > real_type{ 0.0 }, "gamma must be greater than 0, but is {}!", gamma);
+
+    // ||x - y||^2 = ||x||^2 + ||y||^2 - 2 * x^T y
+    const std::vector<real_type> point_norms = detail::squared_norms(predict_points, 1);
+    const std::vector<real_type> sv_norms = detail::squared_norms(support_vectors, PREDICT_SUPPORT_VECTOR_BLOCK_SIZE);
+    detail::device_kernel_predict_blocked(out, support_vectors, alpha, predict_points, [gamma, &point_norms, &sv_norms](const real_type dot, const std::size_t point, const std::size_t sv) {
+        // note: the distance may become slightly negative due to cancellation
+        return std::exp(-gamma * std::max(point_norms[point] + sv_norms[sv] - real_type{ 2.0 } * dot, real_type{ 0.0 }));
+    });
+}
+template void device_kernel_predict_rbf(std::vector<float> &, const std::vector<std::vector<float>> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float);
+template void device_kernel_predict_rbf(std::vector<double> &, const std::vector<std::vector<double>> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double);
+
+}  // namespace plssvm::openmp
@@ -8,77 +8,237 @@
 
 #include "plssvm/backends/OpenMP/svm_kernel.hpp"
 
-#include "plssvm/constants.hpp"              // plssvm::kernel_index_type, plssvm::OPENMP_BLOCK_SIZE
-#include "plssvm/detail/assert.hpp"          // PLSSVM_ASSERT
-#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type, plssvm::kernel_function
+#include "plssvm/backends/OpenMP/parallel.hpp"        // plssvm::openmp::parallel_region
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"  // plssvm::openmp::thread_pinning
+#include "plssvm/constants.hpp"                       // plssvm::kernel_index_type, plssvm::OPENMP_BLOCK_SIZE
+#include "plssvm/detail/assert.hpp"                   // PLSSVM_ASSERT
+#include "plssvm/detail/ball_tree.hpp"                // plssvm::detail::ball_tree
+#include "plssvm/kernel_function_types.hpp"           // plssvm::kernel_function_type, plssvm::kernel_function
 
-#include <utility>                           // std::forward
-#include <vector>                            // std::vector
+#include "omp.h"                                      // omp_get_thread_num, omp_get_num_threads
+
+#include <algorithm>                                  // std::clamp, std::sort, std::unique, std::find, std::copy, std::max
+#include <cmath>                                      // std::sqrt, std::abs
+#include <cstddef>                                    // std::size_t
+#include <functional>                                 // std::function
+#include <type_traits>                                // std::integral_constant
+#include <utility>                                    // std::forward, std::pair, std::make_pair, std::integer_sequence
+#include <vector>                                     // std::vector
 
 namespace plssvm::openmp {
 
+std::pair<std::size_t, std::size_t> calculate_kernel_row_range(const std::size_t row_begin, const std::size_t row_end, const int part, const int num_parts) noexcept {
+    PLSSVM_ASSERT(row_begin <= row_end, "Invalid row range [{}, {})!", row_begin, row_end);
+    PLSSVM_ASSERT(num_parts > 0, "At least one part must be present!");
+    PLSSVM_ASSERT(0 <= part && part < num_parts, "Invalid part {} for {} parts!", part, num_parts);
+
+    // the rows [row_begin, b) of the lower triangular matrix contain approximately (b^2 - row_begin^2) / 2 entries
+    // -> the boundary of part p is located at approximately sqrt(row_begin^2 + p / num_parts * (row_end^2 - row_begin^2))
+    const auto boundary = [row_begin, row_end, num_parts](const int p) -> std::size_t {
+        if (p >= num_parts) {
+            return row_end;
+        }
+        const auto begin = static_cast<double>(row_begin);
+        const auto end = static_cast<double>(row_end);
+        const auto b = static_cast<std::size_t>(std::sqrt(begin * begin + static_cast<double>(p) / static_cast<double>(num_parts) * (end * end - begin * begin)));
+        return std::clamp(b, row_begin, row_end);
+    };
+    return std::make_pair(boundary(part), boundary(part + 1));
+}
+
 namespace detail {
 
-template <kernel_function_type kernel, typename real_type, typename... Args>
-void device_kernel(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, Args &&...args) {
+/// The block sizes the kernels are instantiated for additionally to plssvm::OPENMP_BLOCK_SIZE.
+using block_size_candidates = std::integer_sequence<kernel_index_type, 16, 32, 64, 128, 256>;
+
+template <kernel_index_type... block_sizes>
+[[nodiscard]] std::vector<kernel_index_type> list_block_sizes(std::integer_sequence<kernel_index_type, block_sizes...>) {
+    std::vector<kernel_index_type> result{ block_sizes..., OPENMP_BLOCK_SIZE };
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+/**
+ * @brief Call @p func with the runtime @p block_size converted to a `std::integral_constant`, i.e., a compile-time constant.
+ * @details Falls back to plssvm::OPENMP_BLOCK_SIZE if @p block_size isn't one of the @p block_sizes.
+ */
+template <typename Func, kernel_index_type... block_sizes>
+void dispatch_block_size(const kernel_index_type block_size, std::integer_sequence<kernel_index_type, block_sizes...>, Func &&func) {
+    const bool dispatched = ((block_size == block_sizes && (func(std::integral_constant<kernel_index_type, block_sizes>{}), true)) || ...);
+    if (!dispatched) {
+        func(std::integral_constant<kernel_index_type, OPENMP_BLOCK_SIZE>{});
+    }
+}
+
+template <kernel_index_type block_size, kernel_function_type kernel, typename real_type, typename... Args>
+void device_kernel_blocked(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const kernel_index_type row_begin, const kernel_index_type row_end, const std::function<bool()> &stop_requested, const thread_pinning pinning, Args &&...args) {
     PLSSVM_ASSERT(q.size() == data.size() - 1, "Sizes mismatch!: {} != {}", q.size(), data.size() - 1);
     PLSSVM_ASSERT(q.size() == ret.size(), "Sizes mismatch!: {} != {}", q.size(), ret.size());
     PLSSVM_ASSERT(q.size() == d.size(), "Sizes mismatch!: {} != {}", q.size(), d.size());
     PLSSVM_ASSERT(cost != real_type{ 0.0 }, "cost must not be 0.0 since it is 1 / plssvm::cost!");
     PLSSVM_ASSERT(add == real_type{ -1.0 } || add == real_type{ 1.0 }, "add must either be -1.0 or 1.0, but is {}!", add);
+    PLSSVM_ASSERT(0 <= row_begin && row_begin <= row_end && row_end <= static_cast<kernel_index_type>(d.size()), "Invalid row range [{}, {}) for {} rows!", row_begin, row_end, d.size());
 
-    const auto dept = static_cast<kernel_index_type>(d.size());
-
-    // can't use default(none) due to the parameter pack Args (args)
-    #pragma omp parallel for collapse(2) schedule(dynamic)
-    for (kernel_index_type i = 0; i < dept; i += OPENMP_BLOCK_SIZE) {
-        for (kernel_index_type j = 0; j < dept; j += OPENMP_BLOCK_SIZE) {
-            for (kernel_index_type ii = 0; ii < OPENMP_BLOCK_SIZE && ii + i < dept; ++ii) {
-                real_type ret_iii = 0.0;
-                for (kernel_index_type jj = 0; jj < OPENMP_BLOCK_SIZE && jj + j < dept; ++jj) {
-                    if (ii + i >= jj + j) {
-                        const real_type temp = (kernel_function<kernel>(data[ii + i], data[jj + j], std::forward<Args>(args)...) + QA_cost - q[ii + i] - q[jj + j]) * add;
-                        if (ii + i == jj + j) {
-                            ret_iii += (temp + cost * add) * d[ii + i];
-                        } else {
-                            ret_iii += temp * d[jj + j];
-                            #pragma omp atomic
-                            ret[jj + j] += temp * d[ii + i];
-                        }
+    // calculate the contributions of the rows [i, min(i + block_size, i_end)) and columns [j, j + block_size)
+    const auto calculate_block = [&](const kernel_index_type i, const kernel_index_type i_end, const kernel_index_type j) {
+        // skip all remaining blocks if the calculation should be stopped early
+        if (stop_requested && stop_requested()) {
+            return;
+        }
+        for (kernel_index_type ii = 0; ii < block_size && ii + i < i_end; ++ii) {
+            real_type ret_iii = 0.0;
+            for (kernel_index_type jj = 0; jj < block_size && jj + j < row_end; ++jj) {
+                if (ii + i >= jj + j) {
+                    const real_type temp = (kernel_function<kernel>(data[ii + i], data[jj + j], std::forward<Args>(args)...) + QA_cost - q[ii + i] - q[jj + j]) * add;
+                    if (ii + i == jj + j) {
+                        ret_iii += (temp + cost * add) * d[ii + i];
+                    } else {
+                        ret_iii += temp * d[jj + j];
+                        #pragma omp atomic
+                        ret[jj + j] += temp * d[ii + i];
                     }
                 }
-                #pragma omp atomic
-                ret[ii + i] += ret_iii;
             }
+            #pragma omp atomic
+            ret[ii + i] += ret_iii;
         }
-    }
+    };
+
+    // note: only the lower triangular matrix is calculated, i.e., the rows [row_begin, row_end) only need the columns [0, row_end)
+    parallel_region(pinning, [&]() {
+        if (pinning == thread_pinning::none) {
+            #pragma omp for collapse(2) schedule(dynamic)
+            for (kernel_index_type i = row_begin; i < row_end; i += block_size) {
+                for (kernel_index_type j = 0; j < row_end; j += block_size) {
+                    calculate_block(i, row_end, j);
+                }
+            }
+        } else {
+            // each pinned thread calculates a fixed block of rows, i.e., the data points of these rows are located on its NUMA node if they have been copied using first_touch_copy
+            const std::pair<std::size_t, std::size_t> rows = calculate_kernel_row_range(static_cast<std::size_t>(row_begin), static_cast<std::size_t>(row_end), omp_get_thread_num(), omp_get_num_threads());
+            const auto first = static_cast<kernel_index_type>(rows.first);
+            const auto last = static_cast<kernel_index_type>(rows.second);
+            for (kernel_index_type i = first; i < last; i += block_size) {
+                for (kernel_index_type j = 0; j < i + block_size && j < last; j += block_size) {
+                    calculate_block(i, last, j);
+                }
+            }
+        }
+    });
+}
+
+template <kernel_function_type kernel, typename real_type, typename... Args>
+void device_kernel(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const kernel_index_type row_begin, const kernel_index_type row_end, const std::function<bool()> &stop_requested, const thread_pinning pinning, const kernel_index_type block_size, Args &&...args) {
+    PLSSVM_ASSERT(is_supported_block_size(block_size), "Unsupported OpenMP block size {}!", block_size);
+
+    // the kernels are instantiated for all supported block sizes such that the loops over a block have compile-time bounds
+    dispatch_block_size(block_size, block_size_candidates{}, [&](const auto block_size_constant) {
+        device_kernel_blocked<decltype(block_size_constant)::value, kernel>(q, ret, d, data, QA_cost, cost, add, row_begin, row_end, stop_requested, pinning, std::forward<Args>(args)...);
+    });
 }
 
 }  // namespace detail
 
+std::vector<kernel_index_type> supported_block_sizes() {
+    return detail::list_block_sizes(detail::block_size_candidates{});
+}
+
+bool is_supported_block_size(const kernel_index_type block_size) {
+    const std::vector<kernel_index_type> block_sizes = supported_block_sizes();
+    return std::find(block_sizes.cbegin(), block_sizes.cend(), block_size) != block_sizes.cend();
+}
+
+template <typename real_type>
+void device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const std::function<bool()> &stop_requested) {
+    device_kernel_linear(q, ret, d, data, QA_cost, cost, add, 0, d.size(), stop_requested);
+}
+template void device_kernel_linear(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, float, const std::function<bool()> &);
+template void device_kernel_linear(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, double, const std::function<bool()> &);
+
+template <typename real_type>
+void device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const std::size_t row_begin, const std::size_t row_end, const std::function<bool()> &stop_requested, const thread_pinning pinning, const kernel_index_type block_size) {
+    detail::device_kernel<kernel_function_type::linear>(q, ret, d, data, QA_cost, cost, add, static_cast<kernel_index_type>(row_begin), static_cast<kernel_index_type>(row_end), stop_requested, pinning, block_size);
+}
+template void device_kernel_linear(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, float, std::size_t, std::size_t, const std::function<bool()> &, thread_pinning, kernel_index_type);
+template void device_kernel_linear(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, double, std::size_t, std::size_t, const std::function<bool()> &, thread_pinning, kernel_index_type);
+
 template <typename real_type>
-void device_kernel_linear(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add) {
-    detail::device_kernel<kernel_function_type::linear>(q, ret, d, data, QA_cost, cost, add);
+void device_kernel_polynomial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const int degree, const real_type gamma, const real_type coef0, const std::function<bool()> &stop_requested) {
+    device_kernel_polynomial(q, ret, d, data, QA_cost, cost, add, 0, d.size(), degree, gamma, coef0, stop_requested);
 }
-template void device_kernel_linear(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, float);
-template void device_kernel_linear(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, double);
+template void device_kernel_polynomial(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, float, int, float, float, const std::function<bool()> &);
+template void device_kernel_polynomial(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, double, int, double, double, const std::function<bool()> &);
 
 template <typename real_type>
-void device_kernel_polynomial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const int degree, const real_type gamma, const real_type coef0) {
+void device_kernel_polynomial(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const std::size_t row_begin, const std::size_t row_end, const int degree, const real_type gamma, const real_type coef0, const std::function<bool()> &stop_requested, const thread_pinning pinning, const kernel_index_type block_size) {
     PLSSVM_ASSERT(gamma > real_type{ 0.0 }, "gamma must be greater than 0, but is {}!", gamma);
 
-    detail::device_kernel<kernel_function_type::polynomial>(q, ret, d, data, QA_cost, cost, add, degree, gamma, coef0);
+    detail::device_kernel<kernel_function_type::polynomial>(q, ret, d, data, QA_cost, cost, add, static_cast<kernel_index_type>(row_begin), static_cast<kernel_index_type>(row_end), stop_requested, pinning, block_size, degree, gamma, coef0);
+}
+template void device_kernel_polynomial(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, float, std::size_t, std::size_t, int, float, float, const std::function<bool()> &, thread_pinning, kernel_index_type);
+template void device_kernel_polynomial(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, double, std::size_t, std::size_t, int, double, double, const std::function<bool()> &, thread_pinning, kernel_index_type);
+
+template <typename real_type>
+void device_kernel_rbf(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const real_type gamma, const std::function<bool()> &stop_requested) {
+    device_kernel_rbf(q, ret, d, data, QA_cost, cost, add, 0, d.size(), gamma, stop_requested);
 }
-template void device_kernel_polynomial(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, float, int, float, float);
-template void device_kernel_polynomial(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, double, int, double, double);
+template void device_kernel_rbf(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, float, float, const std::function<bool()> &);
+template void device_kernel_rbf(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, double, double, const std::function<bool()> &);
 
 template <typename real_type>
-void device_kernel_rbf(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const real_type gamma) {
+void device_kernel_rbf(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, const real_type QA_cost, const real_type cost, const real_type add, const std::size_t row_begin, const std::size_t row_end, const real_type gamma, const std::function<bool()> &stop_requested, const thread_pinning pinning, const kernel_index_type block_size) {
     PLSSVM_ASSERT(gamma > real_type{ 0.0 }, "gamma must be greater than 0, but is {}!", gamma);
 
-    detail::device_kernel<kernel_function_type::rbf>(q, ret, d, data, QA_cost, cost, add, gamma);
+    detail::device_kernel<kernel_function_type::rbf>(q, ret, d, data, QA_cost, cost, add, static_cast<kernel_index_type>(row_begin), static_cast<kernel_index_type>(row_end), stop_requested, pinning, block_size, gamma);
+}
+template void device_kernel_rbf(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, float, std::size_t, std::size_t, float, const std::function<bool()> &, thread_pinning, kernel_index_type);
+template void device_kernel_rbf(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, double, std::size_t, std::size_t, double, const std::function<bool()> &, thread_pinning, kernel_index_type);
+
+template <typename real_type>
+real_type device_kernel_rbf_ball_tree(const std::vector<real_type> &q, std::vector<real_type> &ret, const std::vector<real_type> &d, const std::vector<std::vector<real_type>> &data, plssvm::detail::ball_tree<real_type> &tree, const real_type QA_cost, const real_type cost, const real_type add, const real_type gamma, const real_type tolerance, const std::function<bool()> &stop_requested) {
+    PLSSVM_ASSERT(q.size() == data.size() - 1, "Sizes mismatch!: {} != {}", q.size(), data.size() - 1);
+    PLSSVM_ASSERT(q.size() == ret.size(), "Sizes mismatch!: {} != {}", q.size(), ret.size());
+    PLSSVM_ASSERT(q.size() == d.size(), "Sizes mismatch!: {} != {}", q.size(), d.size());
+    PLSSVM_ASSERT(tree.num_points() == data.size(), "Sizes mismatch!: {} != {}", tree.num_points(), data.size());
+    PLSSVM_ASSERT(cost != real_type{ 0.0 }, "cost must not be 0.0 since it is 1 / plssvm::cost!");
+    PLSSVM_ASSERT(add == real_type{ -1.0 } || add == real_type{ 1.0 }, "add must either be -1.0 or 1.0, but is {}!", add);
+    PLSSVM_ASSERT(gamma > real_type{ 0.0 }, "gamma must be greater than 0, but is {}!", gamma);
+    PLSSVM_ASSERT(tolerance >= real_type{ 0.0 }, "The tolerance must be greater or equal than 0, but is {}!", tolerance);
+
+    const std::size_t dept = d.size();
+
+    // the last data point has been eliminated in the dimensional reduction -> its weight is always zero
+    std::vector<real_type> weights(data.size(), real_type{ 0.0 });
+    std::copy(d.cbegin(), d.cend(), weights.begin());
+    tree.update_weights(weights);
+
+    // Q_ij = k(x_i, x_j) + QA_cost - q_i - q_j -> (Q d)_i = (K d)_i + (QA_cost - q_i) * sum(d) - q^T d
+    real_type d_sum{ 0.0 };
+    real_type d_abs_sum{ 0.0 };
+    real_type qd{ 0.0 };
+    #pragma omp parallel for default(none) shared(q, d) firstprivate(dept) reduction(+ : d_sum, d_abs_sum, qd)
+    for (std::size_t i = 0; i < dept; ++i) {
+        d_sum += d[i];
+        d_abs_sum += std::abs(d[i]);
+        qd += q[i] * d[i];
+    }
+    const real_type abs_tolerance = tolerance * d_abs_sum;
+
+    real_type max_error_bound{ 0.0 };
+    #pragma omp parallel for default(none) shared(q, ret, d, data, tree, stop_requested) firstprivate(dept, QA_cost, cost, add, gamma, d_sum, qd, abs_tolerance) reduction(max : max_error_bound) schedule(dynamic, 64)
+    for (std::size_t i = 0; i < dept; ++i) {
+        // skip all remaining rows if the calculation should be stopped early
+        if (stop_requested && stop_requested()) {
+            continue;
+        }
+        const std::pair<real_type, real_type> kernel_row_sum = tree.rbf_weighted_sum(data[i], gamma, abs_tolerance);
+        ret[i] += add * (kernel_row_sum.first + (QA_cost - q[i]) * d_sum - qd + cost * d[i]);
+        max_error_bound = std::max(max_error_bound, kernel_row_sum.second);
+    }
+    return max_error_bound;
 }
-template void device_kernel_rbf(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, float, float, float, float);
-template void device_kernel_rbf(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, double, double, double, double);
+template float device_kernel_rbf_ball_tree(const std::vector<float> &, std::vector<float> &, const std::vector<float> &, const std::vector<std::vector<float>> &, plssvm::detail::ball_tree<float> &, float, float, float, float, float, const std::function<bool()> &);
+template double device_kernel_rbf_ball_tree(const std::vector<double> &, std::vector<double> &, const std::vector<double> &, const std::vector<std::vector<double>> &, plssvm::detail::ball_tree<double> &, double, double, double, double, double, const std::function<bool()> &);
 
 }  // namespace plssvm::openmp
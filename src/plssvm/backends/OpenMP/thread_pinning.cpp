@@ -0,0 +1,49 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"
+
+#include "plssvm/detail/string_utility.hpp"  // plssvm::detail::to_lower_case
+
+#include <ios>                               // std::ios::failbit
+#include <istream>                           // std::istream
+#include <ostream>                           // std::ostream
+#include <string>                            // std::string
+
+namespace plssvm::openmp {
+
+std::ostream &operator<<(std::ostream &out, const thread_pinning pinning) {
+    switch (pinning) {
+        case thread_pinning::none:
+            return out << "none";
+        case thread_pinning::close:
+            return out << "close";
+        case thread_pinning::spread:
+            return out << "spread";
+    }
+    return out << "unknown";
+}
+
+std::istream &operator>>(std::istream &in, thread_pinning &pinning) {
+    std::string str;
+    in >> str;
+    detail::to_lower_case(str);
+
+    if (str == "none") {
+        pinning = thread_pinning::none;
+    } else if (str == "close") {
+        pinning = thread_pinning::close;
+    } else if (str == "spread") {
+        pinning = thread_pinning::spread;
+    } else {
+        in.setstate(std::ios::failbit);
+    }
+    return in;
+}
+
+}  // namespace plssvm::openmp
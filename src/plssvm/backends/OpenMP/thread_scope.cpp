@@ -0,0 +1,117 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/backends/OpenMP/thread_scope.hpp"
+
+#include "plssvm/backends/OpenMP/exceptions.hpp"  // plssvm::openmp::backend_exception
+
+#include "fmt/core.h"                             // fmt::format
+#include "fmt/format.h"                           // fmt::join
+
+#include "omp.h"                                  // omp_get_max_threads, omp_set_num_threads, omp_get_thread_num
+
+#if defined(__linux__)
+    #include <sched.h>                            // cpu_set_t, CPU_ZERO, CPU_SET, CPU_ISSET, CPU_SETSIZE, sched_getaffinity, sched_setaffinity
+#endif
+
+#include <cstddef>                                // std::size_t
+#include <utility>                                // std::move
+#include <vector>                                 // std::vector
+
+namespace plssvm::openmp {
+
+thread_scope::thread_scope(const int num_threads, std::vector<int> cpu_set) :
+    previous_num_threads_{ omp_get_max_threads() },
+    num_threads_{ num_threads },
+    cpu_set_{ std::move(cpu_set) } {
+    // check whether the provided values are valid before changing anything
+    if (num_threads_ < 0) {
+        throw backend_exception{ fmt::format("The number of OpenMP threads must be greater or equal than 0, but is {}!", num_threads_) };
+    }
+#if defined(__linux__)
+    for (const int cpu : cpu_set_) {
+        if (cpu < 0 || cpu >= CPU_SETSIZE) {
+            throw backend_exception{ fmt::format("Invalid CPU {} in the CPU set [{}]!", cpu, fmt::join(cpu_set_, ", ")) };
+        }
+    }
+#else
+    if (!cpu_set_.empty()) {
+        throw backend_exception{ "Binding the OpenMP threads to a CPU set is currently only supported on Linux!" };
+    }
+#endif
+
+    // by default, use one thread per CPU or all threads if no CPU set is provided
+    if (num_threads_ == 0) {
+        num_threads_ = cpu_set_.empty() ? previous_num_threads_ : static_cast<int>(cpu_set_.size());
+    }
+    // only affects the parallel regions started by the calling thread
+    omp_set_num_threads(num_threads_);
+
+#if defined(__linux__)
+    if (!cpu_set_.empty()) {
+        // bind each thread of the team to its CPU and remember its previous affinity
+        previous_affinities_.resize(static_cast<std::size_t>(num_threads_));
+        bool binding_failed = false;
+        #pragma omp parallel num_threads(num_threads_) shared(binding_failed)
+        {
+            const auto thread = static_cast<std::size_t>(omp_get_thread_num());
+
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            if (sched_getaffinity(0, sizeof(cpu_set_t), &mask) == 0) {
+                for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    if (CPU_ISSET(cpu, &mask)) {
+                        previous_affinities_[thread].push_back(cpu);
+                    }
+                }
+            }
+
+            CPU_ZERO(&mask);
+            CPU_SET(cpu_set_[thread % cpu_set_.size()], &mask);
+            if (sched_setaffinity(0, sizeof(cpu_set_t), &mask) != 0) {
+                #pragma omp atomic write
+                binding_failed = true;
+            }
+        }
+
+        if (binding_failed) {
+            // undo all changes, since the destructor isn't called
+            this->restore_affinities();
+            omp_set_num_threads(previous_num_threads_);
+            throw backend_exception{ fmt::format("Can't bind the OpenMP threads to the CPU set [{}]!", fmt::join(cpu_set_, ", ")) };
+        }
+    }
+#endif
+}
+
+thread_scope::~thread_scope() {
+    this->restore_affinities();
+    omp_set_num_threads(previous_num_threads_);
+}
+
+void thread_scope::restore_affinities() noexcept {
+#if defined(__linux__)
+    if (previous_affinities_.empty()) {
+        return;
+    }
+    #pragma omp parallel num_threads(static_cast<int>(previous_affinities_.size()))
+    {
+        const std::vector<int> &cpus = previous_affinities_[static_cast<std::size_t>(omp_get_thread_num())];
+        if (!cpus.empty()) {
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            for (const int cpu : cpus) {
+                CPU_SET(cpu, &mask);
+            }
+            sched_setaffinity(0, sizeof(cpu_set_t), &mask);
+        }
+    }
+#endif
+}
+
+}  // namespace plssvm::openmp
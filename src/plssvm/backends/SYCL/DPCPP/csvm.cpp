@@ -10,8 +10,9 @@
 
 #include "plssvm/backends/SYCL/DPCPP/detail/device_ptr.hpp"  // plssvm::dpcpp::detail::::device_ptr
 #include "plssvm/backends/SYCL/DPCPP/detail/queue_impl.hpp"  // plssvm::dpcpp::detail::queue (PImpl implementation)
-#include "plssvm/backends/SYCL/DPCPP/detail/utility.hpp"     // plssvm::dpcpp::detail::get_device_list, plssvm::dpcpp::device_synchronize
+#include "plssvm/backends/SYCL/DPCPP/detail/utility.hpp"     // plssvm::dpcpp::detail::get_device_list, plssvm::dpcpp::detail::{device_synchronize, get_device_memory}
 
+#include "plssvm/backends/SYCL/cg_kernel.hpp"                // plssvm::sycl::detail::{device_kernel_axpy, device_kernel_xpby, device_kernel_dot, device_kernel_sum}
 #include "plssvm/backends/SYCL/exceptions.hpp"               // plssvm::dpcpp::backend_exception
 #include "plssvm/backends/SYCL/predict_kernel.hpp"           // plssvm::sycl::detail::{kernel_w, device_kernel_predict_polynomial, device_kernel_predict_rbf}
 #include "plssvm/backends/SYCL/q_kernel.hpp"                 // plssvm::sycl::detail::{device_kernel_q_linear, device_kernel_q_polynomial, device_kernel_q_rbf}
@@ -129,6 +130,10 @@ void csvm::device_synchronize(const queue_type &queue) const {
     detail::device_synchronize(queue);
 }
 
+std::size_t csvm::get_device_memory(const queue_type &queue) const {
+    return detail::get_device_memory(queue);
+}
+
 template <std::size_t I>
 ::sycl::nd_range<I> execution_range_to_native(const ::plssvm::detail::execution_range &range, const sycl::kernel_invocation_type invocation_type) {
     PLSSVM_ASSERT(invocation_type != sycl::kernel_invocation_type::automatic, "The SYCL kernel invocation type may not be automatic anymore at this point!");
@@ -186,7 +191,7 @@ template void csvm::run_q_kernel_impl(std::size_t, const ::plssvm::detail::execu
 template void csvm::run_q_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, std::size_t, std::size_t) const;
 
 template <typename real_type>
-void csvm::run_svm_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const real_type QA_cost, const real_type add, const std::size_t num_data_points_padded, const std::size_t num_features) const {
+void csvm::run_svm_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const ::plssvm::detail::parameter<real_type> &params, const device_ptr_type<real_type> &q_d, device_ptr_type<real_type> &r_d, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &data_d, const real_type QA_cost, const real_type add, const std::size_t num_data_points_padded, const std::size_t num_features, const std::size_t row_offset) const {
     const ::sycl::nd_range execution_range = execution_range_to_native<2>(range, invocation_type_);
     switch (params.kernel_type) {
         case kernel_function_type::linear:
@@ -199,30 +204,28 @@ void csvm::run_svm_kernel_impl(const std::size_t device, const ::plssvm::detail:
             });
             break;
         case kernel_function_type::polynomial:
-            PLSSVM_ASSERT(device == 0, "The polynomial kernel function currently only supports single GPU execution!");
             devices_[device].impl->sycl_queue.submit([&, invocation_type = invocation_type_](::sycl::handler &cgh) {
                 if (invocation_type == sycl::kernel_invocation_type::nd_range) {
-                    cgh.parallel_for(execution_range, sycl::detail::nd_range_device_kernel_polynomial(cgh, q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.degree.value(), params.gamma.value(), params.coef0.value()));
+                    cgh.parallel_for(execution_range, sycl::detail::nd_range_device_kernel_polynomial(cgh, q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.degree.value(), params.gamma.value(), params.coef0.value(), static_cast<kernel_index_type>(row_offset)));
                 } else if (invocation_type == sycl::kernel_invocation_type::hierarchical) {
-                    cgh.parallel_for_work_group(execution_range.get_global_range(), execution_range.get_local_range(), sycl::detail::hierarchical_device_kernel_polynomial(q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.degree.value(), params.gamma.value(), params.coef0.value()));
+                    cgh.parallel_for_work_group(execution_range.get_global_range(), execution_range.get_local_range(), sycl::detail::hierarchical_device_kernel_polynomial(q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.degree.value(), params.gamma.value(), params.coef0.value(), static_cast<kernel_index_type>(row_offset)));
                 }
             });
             break;
         case kernel_function_type::rbf:
-            PLSSVM_ASSERT(device == 0, "The radial basis function kernel function currently only supports single GPU execution!");
             devices_[device].impl->sycl_queue.submit([&, invocation_type = invocation_type_](::sycl::handler &cgh) {
                 if (invocation_type == sycl::kernel_invocation_type::nd_range) {
-                    cgh.parallel_for(execution_range, sycl::detail::nd_range_device_kernel_rbf(cgh, q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.gamma.value()));
+                    cgh.parallel_for(execution_range, sycl::detail::nd_range_device_kernel_rbf(cgh, q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.gamma.value(), static_cast<kernel_index_type>(row_offset)));
                 } else if (invocation_type == sycl::kernel_invocation_type::hierarchical) {
-                    cgh.parallel_for_work_group(execution_range.get_global_range(), execution_range.get_local_range(), sycl::detail::hierarchical_device_kernel_rbf(q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.gamma.value()));
+                    cgh.parallel_for_work_group(execution_range.get_global_range(), execution_range.get_local_range(), sycl::detail::hierarchical_device_kernel_rbf(q_d.get(), r_d.get(), x_d.get(), data_d.get(), QA_cost, 1 / params.cost, static_cast<kernel_index_type>(num_data_points_padded), static_cast<kernel_index_type>(num_features), add, params.gamma.value(), static_cast<kernel_index_type>(row_offset)));
                 }
             });
             break;
     }
 }
 
-template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, float, float, std::size_t, std::size_t) const;
-template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, double, double, std::size_t, std::size_t) const;
+template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, float, float, std::size_t, std::size_t, std::size_t) const;
+template void csvm::run_svm_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, double, double, std::size_t, std::size_t, std::size_t) const;
 
 template <typename real_type>
 void csvm::run_w_kernel_impl(const std::size_t device, [[maybe_unused]] const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &w_d, const device_ptr_type<real_type> &alpha_d, const device_ptr_type<real_type> &data_d, const device_ptr_type<real_type> &data_last_d, const std::size_t num_data_points, const std::size_t num_features) const {
@@ -251,4 +254,42 @@ void csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &rang
 template void csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<float> &, device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, const device_ptr_type<float> &, std::size_t, std::size_t, std::size_t) const;
 template void csvm::run_predict_kernel_impl(const ::plssvm::detail::execution_range &, const ::plssvm::detail::parameter<double> &, device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, const device_ptr_type<double> &, std::size_t, std::size_t, std::size_t) const;
 
+template <typename real_type>
+void csvm::run_axpy_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const real_type alpha, const device_ptr_type<real_type> &x_d, device_ptr_type<real_type> &y_d, const std::size_t size) const {
+    devices_[device].impl->sycl_queue.parallel_for(::sycl::range<1>{ range.grid[0] * range.block[0] }, sycl::detail::device_kernel_axpy(alpha, x_d.get(), y_d.get(), static_cast<kernel_index_type>(size)));
+}
+
+template void csvm::run_axpy_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, float, const device_ptr_type<float> &, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_axpy_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, double, const device_ptr_type<double> &, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void csvm::run_xpby_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const real_type beta, device_ptr_type<real_type> &y_d, const std::size_t size) const {
+    devices_[device].impl->sycl_queue.parallel_for(::sycl::range<1>{ range.grid[0] * range.block[0] }, sycl::detail::device_kernel_xpby(x_d.get(), beta, y_d.get(), static_cast<kernel_index_type>(size)));
+}
+
+template void csvm::run_xpby_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<float> &, float, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_xpby_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<double> &, double, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void csvm::run_dot_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, const device_ptr_type<real_type> &x_d, const device_ptr_type<real_type> &y_d, device_ptr_type<real_type> &partial_sums_d, const std::size_t size) const {
+    const ::sycl::nd_range execution_range = execution_range_to_native<1>(range, sycl::kernel_invocation_type::nd_range);
+    devices_[device].impl->sycl_queue.submit([&](::sycl::handler &cgh) {
+        cgh.parallel_for(execution_range, sycl::detail::device_kernel_dot(cgh, x_d.get(), y_d.get(), partial_sums_d.get(), static_cast<kernel_index_type>(size)));
+    });
+}
+
+template void csvm::run_dot_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<float> &, const device_ptr_type<float> &, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_dot_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, const device_ptr_type<double> &, const device_ptr_type<double> &, device_ptr_type<double> &, std::size_t) const;
+
+template <typename real_type>
+void csvm::run_sum_kernel_impl(const std::size_t device, const ::plssvm::detail::execution_range &range, device_ptr_type<real_type> &partial_sums_d, const std::size_t size) const {
+    const ::sycl::nd_range execution_range = execution_range_to_native<1>(range, sycl::kernel_invocation_type::nd_range);
+    devices_[device].impl->sycl_queue.submit([&](::sycl::handler &cgh) {
+        cgh.parallel_for(execution_range, sycl::detail::device_kernel_sum(cgh, partial_sums_d.get(), static_cast<kernel_index_type>(size)));
+    });
+}
+
+template void csvm::run_sum_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, device_ptr_type<float> &, std::size_t) const;
+template void csvm::run_sum_kernel_impl(std::size_t, const ::plssvm::detail::execution_range &, device_ptr_type<double> &, std::size_t) const;
+
 }  // namespace plssvm::dpcpp
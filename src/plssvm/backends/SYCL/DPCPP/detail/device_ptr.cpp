@@ -30,6 +30,7 @@ device_ptr<T>::device_ptr(const size_type size, const queue &q) :
 template <typename T>
 device_ptr<T>::~device_ptr() {
     if (queue_.impl != nullptr) {
+        this->wait_for_async_copies();
         ::sycl::free(static_cast<void *>(data_), queue_.impl->sycl_queue);
     }
 }
@@ -39,6 +40,8 @@ void device_ptr<T>::memset(const int pattern, const size_type pos, const size_ty
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
     PLSSVM_ASSERT(queue_.impl != nullptr, "Invalid sycl::queue!");
 
+    this->wait_for_async_copies();
+
     if (pos >= size_) {
         throw backend_exception{ fmt::format("Illegal access in memset!: {} >= {}", pos, size_) };
     }
@@ -51,6 +54,8 @@ void device_ptr<T>::fill(const value_type value, const size_type pos, const size
     PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
     PLSSVM_ASSERT(queue_.impl != nullptr, "Invalid sycl::queue!");
 
+    this->wait_for_async_copies();
+
     if (pos >= size_) {
         throw backend_exception{ fmt::format("Illegal access in fill!: {} >= {}", pos, size_) };
     }
@@ -64,6 +69,8 @@ void device_ptr<T>::copy_to_device(const_host_pointer_type data_to_copy, const s
     PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
     PLSSVM_ASSERT(queue_.impl != nullptr, "Invalid sycl::queue!");
 
+    this->wait_for_async_copies();
+
     const size_type rcount = std::min(count, size_ - pos);
     queue_.impl->sycl_queue.copy(data_to_copy, data_ + pos, rcount).wait();
 }
@@ -74,10 +81,29 @@ void device_ptr<T>::copy_to_host(host_pointer_type buffer, const size_type pos,
     PLSSVM_ASSERT(buffer != nullptr, "Invalid host pointer for the data to copy!");
     PLSSVM_ASSERT(queue_.impl != nullptr, "Invalid sycl::queue!");
 
+    this->wait_for_async_copies();
+
     const size_type rcount = std::min(count, size_ - pos);
     queue_.impl->sycl_queue.copy(data_ + pos, buffer, rcount).wait();
 }
 
+template <typename T>
+void device_ptr<T>::copy_to_device_async(const_host_pointer_type data_to_copy, const size_type pos, const size_type count) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+    PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
+    PLSSVM_ASSERT(queue_.impl != nullptr, "Invalid sycl::queue!");
+
+    const size_type rcount = std::min(count, size_ - pos);
+    queue_.impl->transfer_queue.copy(data_to_copy, data_ + pos, rcount);
+}
+
+template <typename T>
+void device_ptr<T>::wait_for_async_copies() const {
+    PLSSVM_ASSERT(queue_.impl != nullptr, "Invalid sycl::queue!");
+
+    queue_.impl->transfer_queue.wait();
+}
+
 template class device_ptr<float>;
 template class device_ptr<double>;
 
@@ -15,6 +15,7 @@
 
 #include "sycl/sycl.hpp"                                       // ::sycl::platform, ::sycl::device, ::sycl::property::queue, ::sycl::info
 
+#include <cstddef>                                             // std::size_t
 #include <map>                                                 // std::multimap
 #include <memory>                                              // std::make_shared
 #include <string>                                              // std::string
@@ -84,6 +85,10 @@ void device_synchronize(const queue &q) {
     q.impl->sycl_queue.wait_and_throw();
 }
 
+std::size_t get_device_memory(const queue &q) {
+    return static_cast<std::size_t>(q.impl->sycl_queue.get_device().get_info<::sycl::info::device::global_mem_size>());
+}
+
 queue get_default_queue() {
     queue q;
     q.impl = std::make_shared<queue::queue_impl>();
@@ -8,7 +8,7 @@
 
 #include "plssvm/backends/gpu_device_ptr.hpp"
 
-// no includes for CUDA and HIP since they both use simple ints
+// no includes for CUDA, HIP, and the OpenMP multi-device C-SVM since they all use simple ints
 
 #if defined(PLSSVM_HAS_OPENCL_BACKEND)
     // used for explicitly instantiating the OpenCL backend
@@ -127,8 +127,32 @@ void gpu_device_ptr<T, queue_t, device_pointer_t>::copy_to_host(host_pointer_typ
     this->copy_to_host(buffer, 0, size_);
 }
 
+template <typename T, typename queue_t, typename device_pointer_t>
+void gpu_device_ptr<T, queue_t, device_pointer_t>::copy_to_device_async(const std::vector<value_type> &data_to_copy) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+
+    this->copy_to_device_async(data_to_copy, 0, size_);
+}
+template <typename T, typename queue_t, typename device_pointer_t>
+void gpu_device_ptr<T, queue_t, device_pointer_t>::copy_to_device_async(const std::vector<value_type> &data_to_copy, const size_type pos, const size_type count) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+
+    const size_type rcount = std::min(count, size_ - pos);
+    if (data_to_copy.size() < rcount) {
+        throw gpu_device_ptr_exception{ fmt::format("Too few data to perform copy (needed: {}, provided: {})!", rcount, data_to_copy.size()) };
+    }
+    this->copy_to_device_async(data_to_copy.data(), pos, rcount);
+}
+template <typename T, typename queue_t, typename device_pointer_t>
+void gpu_device_ptr<T, queue_t, device_pointer_t>::copy_to_device_async(const_host_pointer_type data_to_copy) {
+    PLSSVM_ASSERT(data_ != nullptr, "Invalid data pointer! Maybe *this has been default constructed?");
+    PLSSVM_ASSERT(data_to_copy != nullptr, "Invalid host pointer for the data to copy!");
+
+    this->copy_to_device_async(data_to_copy, 0, size_);
+}
+
 // explicitly instantiate template class depending on available backends
-#if defined(PLSSVM_HAS_CUDA_BACKEND) || defined(PLSSVM_HAS_HIP_BACKEND)
+#if defined(PLSSVM_HAS_CUDA_BACKEND) || defined(PLSSVM_HAS_HIP_BACKEND) || defined(PLSSVM_HAS_OPENMP_BACKEND)
 template class gpu_device_ptr<float, int>;
 template class gpu_device_ptr<double, int>;
 #endif
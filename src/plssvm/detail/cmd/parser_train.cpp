@@ -18,6 +18,7 @@
 #include "plssvm/detail/string_utility.hpp"              // plssvm::detail::as_lower_case
 #include "plssvm/detail/utility.hpp"                     // plssvm::detail::to_underlying
 #include "plssvm/kernel_function_types.hpp"              // plssvm::kernel_type_to_math_string
+#include "plssvm/solver_types.hpp"                       // plssvm::solver_type
 #include "plssvm/target_platforms.hpp"                   // plssvm::list_available_target_platforms
 #include "plssvm/version/version.hpp"                    // plssvm::version::detail::get_version_info
 
@@ -54,6 +55,8 @@ parser_train::parser_train(int argc, char **argv) {
            ("c,cost", "set the parameter C", cxxopts::value<typename decltype(csvm_params.cost)::value_type>()->default_value(fmt::format("{}", csvm_params.cost)))
            ("e,epsilon", "set the tolerance of termination criterion", cxxopts::value<typename decltype(epsilon)::value_type>()->default_value(fmt::format("{}", epsilon)))
            ("i,max_iter", "set the maximum number of CG iterations (default: num_features)", cxxopts::value<long long int>())
+           ("s,solver", "choose the algorithm to solve the system of linear equations: cg|pipelined_cg", cxxopts::value<typename decltype(solver)::value_type>()->default_value(fmt::format("{}", solver)))
+           ("rbf_tolerance", "if greater than 0.0, approximate the rbf kernel matrix-vector multiplications skipping distant data points with the given relative accuracy (OpenMP backend only; effective for few features)", cxxopts::value<decltype(rbf_tolerance)>()->default_value(fmt::format("{}", rbf_tolerance)))
            ("b,backend", fmt::format("choose the backend: {}", fmt::join(list_available_backends(), "|")), cxxopts::value<decltype(backend)>()->default_value(fmt::format("{}", backend)))
            ("p,target_platform", fmt::format("choose the target platform: {}", fmt::join(list_available_target_platforms(), "|")), cxxopts::value<decltype(target)>()->default_value(fmt::format("{}", target)))
 #if defined(PLSSVM_HAS_SYCL_BACKEND)
@@ -63,8 +66,12 @@ parser_train::parser_train(int argc, char **argv) {
 #if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
            ("performance_tracking", "the output YAML file where the performance tracking results are written to; if not provided, the results are dumped to stderr", cxxopts::value<decltype(performance_tracking_filename)>())
 #endif
+           ("checkpoint", "the file the state of the CG algorithm is periodically written to; if not provided, no checkpoints are written", cxxopts::value<decltype(checkpoint_filename)>())
+           ("checkpoint_interval", "set the number of CG iterations after which a checkpoint is written", cxxopts::value<long long int>()->default_value(fmt::format("{}", checkpoint_interval)))
+           ("resume", "resume the CG algorithm from the state stored in the checkpoint file (if it exists)", cxxopts::value<decltype(resume)>()->default_value(fmt::format("{}", resume)))
            ("use_strings_as_labels", "use strings as labels instead of plane numbers", cxxopts::value<decltype(strings_as_labels)>()->default_value(fmt::format("{}", strings_as_labels)))
            ("use_float_as_real_type", "use floats as real types instead of doubles", cxxopts::value<decltype(float_as_real_type)>()->default_value(fmt::format("{}", float_as_real_type)))
+           ("use_mixed_precision", "use single precision kernel matrix-vector multiplications with double precision refinements in the CG algorithm", cxxopts::value<decltype(mixed_precision)>()->default_value(fmt::format("{}", mixed_precision)))
            ("verbosity", fmt::format("choose the level of verbosity: full|timing|libsvm|quiet (default: {})", fmt::format("{}", verbosity)), cxxopts::value<verbosity_level>())
            ("q,quiet", "quiet mode (no outputs regardless the provided verbosity level!)", cxxopts::value<bool>()->default_value(verbosity == verbosity_level::quiet ? "true" : "false"))
            ("h,help", "print this helper message", cxxopts::value<bool>())
@@ -154,6 +161,24 @@ parser_train::parser_train(int argc, char **argv) {
         max_iter = static_cast<typename decltype(max_iter)::value_type>(max_iter_input);
     }
 
+    // parse the solver type
+    if (result.count("solver")) {
+        solver = result["solver"].as<typename decltype(solver)::value_type>();
+    }
+
+    // parse the rbf tolerance
+    if (result.count("rbf_tolerance")) {
+        const auto rbf_tolerance_input = result["rbf_tolerance"].as<decltype(rbf_tolerance)>();
+        // check if the provided rbf_tolerance is legal
+        if (rbf_tolerance_input < decltype(rbf_tolerance_input){ 0.0 }) {
+            std::cerr << fmt::format("rbf_tolerance must be greater or equal than 0.0, but is {}!", rbf_tolerance_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided rbf_tolerance was legal -> override default value
+        rbf_tolerance = rbf_tolerance_input;
+    }
+
     // parse backend_type and cast the value to the respective enum
     backend = result["backend"].as<decltype(backend)>();
 
@@ -190,6 +215,24 @@ parser_train::parser_train(int argc, char **argv) {
     // parse whether floats should be used as real_type
     float_as_real_type = result["use_float_as_real_type"].as<decltype(float_as_real_type)>();
 
+    // parse whether the CG algorithm should use mixed precision
+    mixed_precision = result["use_mixed_precision"].as<decltype(mixed_precision)>();
+
+    // warn if mixed precision is requested but floats are already used as real_type
+    if (float_as_real_type && mixed_precision) {
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: mixed precision only has an effect if double is used as real_type; ignoring --use_mixed_precision")
+                  << std::endl;
+        mixed_precision = false;
+    }
+    // warn if mixed precision is requested together with the pipelined CG algorithm
+    if (mixed_precision && solver == solver_type::pipelined_cg) {
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: mixed precision is currently not supported in combination with the pipelined CG algorithm; ignoring --use_mixed_precision")
+                  << std::endl;
+        mixed_precision = false;
+    }
+
     // parse whether output is quiet or not
     const bool quiet = result["quiet"].as<bool>();
 
@@ -225,6 +268,34 @@ parser_train::parser_train(int argc, char **argv) {
         model_filename = input_path.filename().string() + ".model";
     }
 
+    // parse checkpoint filename
+    if (result.count("checkpoint")) {
+        checkpoint_filename = result["checkpoint"].as<decltype(checkpoint_filename)>();
+    }
+
+    // parse checkpoint interval
+    if (result.count("checkpoint_interval")) {
+        const auto checkpoint_interval_input = result["checkpoint_interval"].as<long long int>();
+        // check if the provided checkpoint_interval is legal
+        if (checkpoint_interval_input <= decltype(checkpoint_interval_input){ 0 }) {
+            std::cerr << fmt::format("checkpoint_interval must be greater than 0, but is {}!", checkpoint_interval_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided checkpoint_interval was legal -> override default value
+        checkpoint_interval = static_cast<decltype(checkpoint_interval)>(checkpoint_interval_input);
+    }
+
+    // parse whether the CG algorithm should be resumed from the checkpoint file
+    resume = result["resume"].as<decltype(resume)>();
+
+    // a checkpoint file is necessary to resume the CG algorithm
+    if (resume && checkpoint_filename.empty()) {
+        std::cerr << "Error missing checkpoint file (--checkpoint) to resume the CG algorithm from!" << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
     // parse performance tracking filename
     if (result.count("performance_tracking")) {
         performance_tracking_filename = result["performance_tracking"].as<decltype(performance_tracking_filename)>();
@@ -247,6 +318,9 @@ std::ostream &operator<<(std::ostream &out, const parser_train &params) {
         } break;
         case kernel_function_type::rbf:
             out << fmt::format("gamma: {}\n", params.csvm_params.gamma);
+            if (params.rbf_tolerance > 0.0) {
+                out << fmt::format("rbf tolerance: {}\n", params.rbf_tolerance);
+            }
             break;
     }
     out << fmt::format("cost: {}{}\n", params.csvm_params.cost.value(), params.csvm_params.cost.is_default() ? " (default)" : "");
@@ -256,17 +330,24 @@ std::ostream &operator<<(std::ostream &out, const parser_train &params) {
     } else {
         out << fmt::format("max_iter: {}\n", params.max_iter.value());
     }
+    out << fmt::format("solver: {}{}\n", params.solver.value(), params.solver.is_default() ? " (default)" : "");
 
     return out << fmt::format(
                "label_type: {}\n"
                "real_type: {}\n"
                "input file (data set): '{}'\n"
                "output file (model): '{}'\n"
+               "checkpoint file: '{}'\n"
+               "checkpoint interval: {}\n"
+               "resume: {}\n"
                "performance tracking file: '{}'\n",
                params.strings_as_labels ? "std::string" : "int (default)",
-               params.float_as_real_type ? "float" : "double (default)",
+               params.float_as_real_type ? "float" : (params.mixed_precision ? "double (mixed precision)" : "double (default)"),
                params.input_filename,
                params.model_filename,
+               params.checkpoint_filename,
+               params.checkpoint_interval,
+               params.resume,
                params.performance_tracking_filename);
 }
 
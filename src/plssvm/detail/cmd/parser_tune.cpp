@@ -0,0 +1,328 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ */
+
+#include "plssvm/detail/cmd/parser_tune.hpp"
+
+#include "plssvm/backend_types.hpp"                      // plssvm::list_available_backends
+#include "plssvm/backends/SYCL/implementation_type.hpp"  // plssvm::sycl_generic::list_available_sycl_implementations
+#include "plssvm/constants.hpp"                          // plssvm::verbose_default, plssvm::verbose
+#include "plssvm/default_value.hpp"                      // plssvm::default_value
+#include "plssvm/detail/assert.hpp"                      // PLSSVM_ASSERT
+#include "plssvm/detail/logger.hpp"                      // plssvm::verbosity
+#include "plssvm/detail/string_utility.hpp"              // plssvm::detail::to_lower_case
+#include "plssvm/kernel_function_types.hpp"              // plssvm::kernel_function_type
+#include "plssvm/target_platforms.hpp"                   // plssvm::list_available_target_platforms
+#include "plssvm/version/version.hpp"                    // plssvm::version::detail::get_version_info
+
+#include "cxxopts.hpp"                                   // cxxopts::Options, cxxopts::value,cxxopts::ParseResult
+#include "fmt/color.h"                                   // fmt::fg, fmt::color::orange
+#include "fmt/core.h"                                    // fmt::format, fmt::join
+#include "fmt/ostream.h"                                 // can use fmt using operator<< overloads
+
+#include <algorithm>                                     // std::any_of
+#include <cstdlib>                                       // std::exit, EXIT_SUCCESS, EXIT_FAILURE
+#include <exception>                                     // std::exception
+#include <filesystem>                                    // std::filesystem::path
+#include <ios>                                           // std::ios::failbit
+#include <iostream>                                      // std::cout, std::cerr, std::clog, std::endl
+#include <istream>                                       // std::istream
+#include <ostream>                                       // std::ostream
+
+namespace plssvm::detail::cmd {
+
+std::ostream &operator<<(std::ostream &out, const search_type search) {
+    switch (search) {
+        case search_type::grid:
+            return out << "grid";
+        case search_type::random:
+            return out << "random";
+        case search_type::successive_halving:
+            return out << "successive_halving";
+    }
+    return out << "unknown";
+}
+
+std::istream &operator>>(std::istream &in, search_type &search) {
+    std::string str;
+    in >> str;
+    detail::to_lower_case(str);
+
+    if (str == "grid") {
+        search = search_type::grid;
+    } else if (str == "random") {
+        search = search_type::random;
+    } else if (str == "successive_halving" || str == "halving") {
+        search = search_type::successive_halving;
+    } else {
+        in.setstate(std::ios::failbit);
+    }
+    return in;
+}
+
+parser_tune::parser_tune(int argc, char **argv) {
+    // check for basic argc and argv correctness
+    PLSSVM_ASSERT(argc >= 1, fmt::format("At least one argument is always given (the executable name), but argc is {}!", argc));
+    PLSSVM_ASSERT(argv != nullptr, "At least one argument is always given (the executable name), but argv is a nullptr!");
+
+    cxxopts::Options options(argv[0], "LS-SVM with multiple (GPU-)backends");
+    options
+        .positional_help("training_set_file [leaderboard_file]")
+        .show_positional_help();
+    options
+        .set_width(150)
+        .set_tab_expansion()
+        // clang-format off
+       .add_options()
+           ("t,kernel_type", "comma separated list of kernel functions to try. \n\t 0 -- linear: u'*v\n\t 1 -- polynomial: (gamma*u'*v + coef0)^degree \n\t 2 -- radial basis function: exp(-gamma*|u-v|^2)", cxxopts::value<decltype(kernel_types)>()->default_value(fmt::format("{}", fmt::join(kernel_types, ","))))
+           ("d,degree", "comma separated list of degrees to try in the kernel function", cxxopts::value<decltype(degrees)>()->default_value(fmt::format("{}", fmt::join(degrees, ","))))
+           ("g,gamma", "comma separated list of gammas to try in the kernel function (default: 1 / num_features)", cxxopts::value<decltype(gammas)>())
+           ("r,coef0", "comma separated list of coef0s to try in the kernel function", cxxopts::value<decltype(coef0s)>()->default_value(fmt::format("{}", fmt::join(coef0s, ","))))
+           ("c,cost", "comma separated list of the parameter C to try", cxxopts::value<decltype(costs)>()->default_value(fmt::format("{}", fmt::join(costs, ","))))
+           ("s,search", "choose the hyper-parameter search strategy: grid|random|successive_halving", cxxopts::value<decltype(search)>()->default_value(fmt::format("{}", search)))
+           ("n,num_trials", "the maximum number of hyper-parameter combinations evaluated in a random search", cxxopts::value<long long int>()->default_value(fmt::format("{}", num_trials)))
+           ("halving_factor", "only keep the best 1/halving_factor hyper-parameter combinations after each round of a successive halving search", cxxopts::value<long long int>()->default_value(fmt::format("{}", halving_factor)))
+           ("seed", "the seed used for the random search", cxxopts::value<decltype(seed)>()->default_value(fmt::format("{}", seed)))
+           ("k,num_folds", "the number of folds used in the cross-validation of each hyper-parameter combination", cxxopts::value<long long int>()->default_value(fmt::format("{}", num_folds)))
+           ("j,num_parallel_trials", "the number of hyper-parameter combinations evaluated concurrently", cxxopts::value<long long int>()->default_value(fmt::format("{}", num_parallel_trials)))
+           ("e,epsilon", "set the tolerance of termination criterion", cxxopts::value<typename decltype(epsilon)::value_type>()->default_value(fmt::format("{}", epsilon)))
+           ("i,max_iter", "set the maximum number of CG iterations (default: num_features)", cxxopts::value<long long int>())
+           ("b,backend", fmt::format("choose the backend: {}", fmt::join(list_available_backends(), "|")), cxxopts::value<decltype(backend)>()->default_value(fmt::format("{}", backend)))
+           ("p,target_platform", fmt::format("choose the target platform: {}", fmt::join(list_available_target_platforms(), "|")), cxxopts::value<decltype(target)>()->default_value(fmt::format("{}", target)))
+#if defined(PLSSVM_HAS_SYCL_BACKEND)
+           ("sycl_kernel_invocation_type", "choose the kernel invocation type when using SYCL as backend: automatic|nd_range|hierarchical", cxxopts::value<decltype(sycl_kernel_invocation_type)>()->default_value(fmt::format("{}", sycl_kernel_invocation_type)))
+           ("sycl_implementation_type", fmt::format("choose the SYCL implementation to be used in the SYCL backend: {}", fmt::join(sycl::list_available_sycl_implementations(), "|")), cxxopts::value<decltype(sycl_implementation_type)>()->default_value(fmt::format("{}", sycl_implementation_type)))
+#endif
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+           ("performance_tracking", "the output YAML file where the performance tracking results are written to; if not provided, the results are dumped to stderr", cxxopts::value<decltype(performance_tracking_filename)>())
+#endif
+           ("use_strings_as_labels", "use strings as labels instead of plane numbers", cxxopts::value<decltype(strings_as_labels)>()->default_value(fmt::format("{}", strings_as_labels)))
+           ("use_float_as_real_type", "use floats as real types instead of doubles", cxxopts::value<decltype(float_as_real_type)>()->default_value(fmt::format("{}", float_as_real_type)))
+           ("verbosity", fmt::format("choose the level of verbosity: full|timing|libsvm|quiet (default: {})", fmt::format("{}", verbosity)), cxxopts::value<verbosity_level>())
+           ("q,quiet", "quiet mode (no outputs regardless the provided verbosity level!)", cxxopts::value<bool>()->default_value(verbosity == verbosity_level::quiet ? "true" : "false"))
+           ("h,help", "print this helper message", cxxopts::value<bool>())
+           ("v,version", "print version information", cxxopts::value<bool>())
+           ("input", "", cxxopts::value<decltype(input_filename)>(), "training_set_file")
+           ("leaderboard", "", cxxopts::value<decltype(leaderboard_filename)>(), "leaderboard_file");
+    // clang-format on
+
+    // parse command line options
+    cxxopts::ParseResult result;
+    try {
+        options.parse_positional({ "input", "leaderboard" });
+        result = options.parse(argc, argv);
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    // print help message and exit
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_SUCCESS);
+    }
+
+    // print version info
+    if (result.count("version")) {
+        std::cout << version::detail::get_version_info("plssvm-tune") << std::endl;
+        std::exit(EXIT_SUCCESS);
+    }
+
+    // check if the number of positional arguments is not too large
+    if (!result.unmatched().empty()) {
+        std::cerr << fmt::format("Only up to two positional options may be given, but {} (\"{}\") additional option(s) where provided!\n", result.unmatched().size(), fmt::join(result.unmatched(), " ")) << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    // parse kernel_types and cast the values to the respective enum
+    kernel_types = result["kernel_type"].as<decltype(kernel_types)>();
+
+    // parse degrees
+    degrees = result["degree"].as<decltype(degrees)>();
+
+    // parse gammas
+    if (result.count("gamma")) {
+        const decltype(gammas) gammas_input = result["gamma"].as<decltype(gammas)>();
+        // check if the provided gammas are legal
+        if (std::any_of(gammas_input.cbegin(), gammas_input.cend(), [](const double gamma) { return gamma <= 0.0; })) {
+            std::cerr << fmt::format("All gammas must be greater than 0.0, but are {}!", fmt::join(gammas_input, ",")) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided gammas were legal -> override default value
+        gammas = gammas_input;
+    }
+
+    // parse coef0s
+    coef0s = result["coef0"].as<decltype(coef0s)>();
+
+    // parse costs
+    costs = result["cost"].as<decltype(costs)>();
+
+    // parse the search strategy and cast the value to the respective enum
+    search = result["search"].as<decltype(search)>();
+
+    // parse the number of trials, the halving factor, the number of folds, and the number of parallel trials
+    const auto parse_positive_integer = [&](const std::string &name, const long long int lower_bound, std::size_t &value) {
+        const auto input = result[name].as<long long int>();
+        // check if the provided value is legal
+        if (input < lower_bound) {
+            std::cerr << fmt::format("{} must be greater or equal than {}, but is {}!", name, lower_bound, input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        value = static_cast<std::size_t>(input);
+    };
+    parse_positive_integer("num_trials", 1, num_trials);
+    parse_positive_integer("halving_factor", 2, halving_factor);
+    parse_positive_integer("num_folds", 2, num_folds);
+    parse_positive_integer("num_parallel_trials", 1, num_parallel_trials);
+
+    // parse the random seed
+    seed = result["seed"].as<decltype(seed)>();
+
+    // parse epsilon
+    if (result.count("epsilon")) {
+        epsilon = result["epsilon"].as<typename decltype(epsilon)::value_type>();
+    }
+
+    // parse max_iter
+    if (result.count("max_iter")) {
+        const auto max_iter_input = result["max_iter"].as<long long int>();
+        // check if the provided max_iter is legal
+        if (max_iter_input <= decltype(max_iter_input){ 0 }) {
+            std::cerr << fmt::format("max_iter must be greater than 0, but is {}!", max_iter_input) << std::endl;
+            std::cout << options.help() << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        // provided max_iter was legal -> override default value
+        max_iter = static_cast<typename decltype(max_iter)::value_type>(max_iter_input);
+    }
+
+    // parse backend_type and cast the value to the respective enum
+    backend = result["backend"].as<decltype(backend)>();
+
+    // parse target_platform and cast the value to the respective enum
+    target = result["target_platform"].as<decltype(target)>();
+
+#if defined(PLSSVM_HAS_SYCL_BACKEND)
+    // parse kernel invocation type when using SYCL as backend
+    sycl_kernel_invocation_type = result["sycl_kernel_invocation_type"].as<decltype(sycl_kernel_invocation_type)>();
+
+    // warn if kernel invocation type nd_range or hierarchical are explicitly set but SYCL isn't the current backend
+    if (backend != backend_type::sycl && sycl_kernel_invocation_type != sycl::kernel_invocation_type::automatic) {
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: explicitly set a SYCL kernel invocation type but the current backend isn't SYCL; ignoring --sycl_kernel_invocation_type={}",
+                                 sycl_kernel_invocation_type)
+                  << std::endl;
+    }
+
+    // parse SYCL implementation used in the SYCL backend
+    sycl_implementation_type = result["sycl_implementation_type"].as<decltype(sycl_implementation_type)>();
+
+    // warn if a SYCL implementation type is explicitly set but SYCL isn't the current backend
+    if (backend != backend_type::sycl && sycl_implementation_type != sycl::implementation_type::automatic) {
+        std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                 "WARNING: explicitly set a SYCL implementation type but the current backend isn't SYCL; ignoring --sycl_implementation_type={}",
+                                 sycl_implementation_type)
+                  << std::endl;
+    }
+#endif
+
+    // parse whether strings should be used as labels
+    strings_as_labels = result["use_strings_as_labels"].as<decltype(strings_as_labels)>();
+
+    // parse whether floats should be used as real_type
+    float_as_real_type = result["use_float_as_real_type"].as<decltype(float_as_real_type)>();
+
+    // parse whether output is quiet or not
+    const bool quiet = result["quiet"].as<bool>();
+
+    // -q/--quiet has precedence over --verbosity
+    if (result["verbosity"].count()) {
+        const verbosity_level verb = result["verbosity"].as<verbosity_level>();
+        if (quiet && verb != verbosity_level::quiet) {
+            std::clog << fmt::format(fmt::fg(fmt::color::orange),
+                                     "WARNING: explicitly set the -q/--quiet flag, but the provided verbosity level isn't \"quiet\"; setting --verbosity={} to --verbosity=quiet",
+                                     verb)
+                      << std::endl;
+            verbosity = verbosity_level::quiet;
+        } else {
+            verbosity = verb;
+        }
+    } else if (quiet) {
+        verbosity = verbosity_level::quiet;
+    }
+
+    // parse input data filename
+    if (!result.count("input")) {
+        std::cerr << "Error missing input file!" << std::endl;
+        std::cout << options.help() << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    input_filename = result["input"].as<decltype(input_filename)>();
+
+    // parse output leaderboard filename
+    if (result.count("leaderboard")) {
+        leaderboard_filename = result["leaderboard"].as<decltype(leaderboard_filename)>();
+    } else {
+        const std::filesystem::path input_path{ input_filename };
+        leaderboard_filename = input_path.filename().string() + ".leaderboard";
+    }
+
+    // parse performance tracking filename
+    if (result.count("performance_tracking")) {
+        performance_tracking_filename = result["performance_tracking"].as<decltype(performance_tracking_filename)>();
+    }
+}
+
+std::ostream &operator<<(std::ostream &out, const parser_tune &params) {
+    out << fmt::format("kernel_types: {}\n", fmt::join(params.kernel_types, ", "));
+    out << fmt::format("degrees: {}\n", fmt::join(params.degrees, ", "));
+    if (params.gammas.empty()) {
+        out << "gammas: 1 / num_features (default)\n";
+    } else {
+        out << fmt::format("gammas: {}\n", fmt::join(params.gammas, ", "));
+    }
+    out << fmt::format("coef0s: {}\n", fmt::join(params.coef0s, ", "));
+    out << fmt::format("costs: {}\n", fmt::join(params.costs, ", "));
+    out << fmt::format("search: {}\n", params.search);
+    switch (params.search) {
+        case search_type::grid:
+            break;
+        case search_type::random:
+            out << fmt::format("num_trials: {}\nseed: {}\n", params.num_trials, params.seed);
+            break;
+        case search_type::successive_halving:
+            out << fmt::format("halving_factor: {}\n", params.halving_factor);
+            break;
+    }
+    out << fmt::format("num_folds: {}\n", params.num_folds);
+    out << fmt::format("num_parallel_trials: {}\n", params.num_parallel_trials);
+    out << fmt::format("epsilon: {}{}\n", params.epsilon.value(), params.epsilon.is_default() ? " (default)" : "");
+    if (params.max_iter.is_default()) {
+        out << "max_iter: num_data_points (default)\n";
+    } else {
+        out << fmt::format("max_iter: {}\n", params.max_iter.value());
+    }
+
+    return out << fmt::format(
+               "label_type: {}\n"
+               "real_type: {}\n"
+               "input file (data set): '{}'\n"
+               "output file (leaderboard): '{}'\n"
+               "performance tracking file: '{}'\n",
+               params.strings_as_labels ? "std::string" : "int (default)",
+               params.float_as_real_type ? "float" : "double (default)",
+               params.input_filename,
+               params.leaderboard_filename,
+               params.performance_tracking_filename);
+}
+
+}  // namespace plssvm::detail::cmd
@@ -117,6 +117,13 @@ void file_reader::open(const std::filesystem::path &filename) {
 bool file_reader::is_open() const noexcept {
     return is_open_;
 }
+bool file_reader::is_memory_mapped() const noexcept {
+#if defined(PLSSVM_HAS_MEMORY_MAPPING)
+    return must_unmap_file_;
+#else
+    return false;
+#endif
+}
 void file_reader::close() {
     if (this->is_open()) {
 #if defined(PLSSVM_HAS_MEMORY_MAPPING_UNIX)
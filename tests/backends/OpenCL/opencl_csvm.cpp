@@ -11,15 +11,18 @@
 #include "plssvm/backend_types.hpp"                // plssvm::csvm_to_backend_type_v
 #include "plssvm/backends/OpenCL/csvm.hpp"         // plssvm::opencl::csvm
 #include "plssvm/backends/OpenCL/exceptions.hpp"   // plssvm::opencl::backend_exception
+#include "plssvm/constants.hpp"                    // plssvm::{THREAD_BLOCK_SIZE, INTERNAL_BLOCK_SIZE}
 #include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
 #include "plssvm/kernel_function_types.hpp"        // plssvm::kernel_function_type
-#include "plssvm/parameter.hpp"                    // plssvm::parameter, plssvm::kernel_type, plssvm::cost
+#include "plssvm/parameter.hpp"                    // plssvm::parameter, plssvm::kernel_type, plssvm::cost, plssvm::{opencl_thread_block_size, opencl_internal_block_size}
 #include "plssvm/target_platforms.hpp"             // plssvm::target_platform
 
 #include "../../custom_test_macros.hpp"            // EXPECT_THROW_WHAT
 #include "../../utility.hpp"                       // util::redirect_output
 #include "../generic_csvm_tests.hpp"               // generic CSVM tests to instantiate
 
+#include "fmt/core.h"                              // fmt::format
+
 #include "gtest/gtest.h"                           // TEST_F, EXPECT_NO_THROW, TYPED_TEST_SUITE, TYPED_TEST, INSTANTIATE_TYPED_TEST_SUITE_P, ::testing::{Test, Types}
 
 #include <tuple>                                   // std::make_tuple
@@ -100,6 +103,26 @@ TEST_F(OpenCLCSVM, construct_target_and_named_args) {
                       "Requested target platform 'gpu_intel' that hasn't been enabled using PLSSVM_TARGET_PLATFORMS!");
 #endif
 }
+TEST_F(OpenCLCSVM, get_block_sizes) {
+    // by default, the compile-time block sizes are used
+    const plssvm::opencl::csvm svm{ plssvm::parameter{} };
+    EXPECT_EQ(svm.get_thread_block_size(), plssvm::THREAD_BLOCK_SIZE);
+    EXPECT_EQ(svm.get_internal_block_size(), plssvm::INTERNAL_BLOCK_SIZE);
+
+    // the block sizes can be provided using named parameters since the OpenCL kernels are compiled at runtime
+    const plssvm::opencl::csvm svm_block_sizes{ plssvm::opencl_thread_block_size = 8, plssvm::opencl_internal_block_size = 4, plssvm::cost = 2.0 };
+    EXPECT_EQ(svm_block_sizes.get_thread_block_size(), 8);
+    EXPECT_EQ(svm_block_sizes.get_internal_block_size(), 4);
+    EXPECT_EQ(svm_block_sizes.get_params().cost, 2.0);
+}
+TEST_F(OpenCLCSVM, construct_invalid_block_sizes) {
+    EXPECT_THROW_WHAT((plssvm::opencl::csvm{ plssvm::opencl_thread_block_size = 0 }),
+                      plssvm::opencl::backend_exception,
+                      fmt::format("The thread block size (0) and the internal block size ({}) must be greater than 0!", plssvm::INTERNAL_BLOCK_SIZE));
+    EXPECT_THROW_WHAT((plssvm::opencl::csvm{ plssvm::opencl_internal_block_size = -1 }),
+                      plssvm::opencl::backend_exception,
+                      fmt::format("The thread block size ({}) and the internal block size (-1) must be greater than 0!", plssvm::THREAD_BLOCK_SIZE));
+}
 
 template <typename T, plssvm::kernel_function_type kernel>
 struct csvm_test_type {
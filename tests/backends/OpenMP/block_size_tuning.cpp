@@ -0,0 +1,157 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the functions used to auto-tune the block size of the OpenMP kernels.
+ */
+
+#include "plssvm/backends/OpenMP/block_size_tuning.hpp"
+
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"   // plssvm::openmp::is_supported_block_size
+#include "plssvm/data_set.hpp"                     // plssvm::data_set
+#include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::invalid_file_format_exception
+#include "plssvm/kernel_function_types.hpp"        // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                    // plssvm::detail::parameter
+
+#include "../../custom_test_macros.hpp"            // EXPECT_THROW_WHAT
+#include "../../naming.hpp"                        // naming::real_type_kernel_function_to_name
+#include "../../types_to_test.hpp"                 // util::real_type_kernel_function_gtest
+#include "../../utility.hpp"                       // util::{redirect_output, temporary_file}
+
+#include "gtest/gtest.h"                           // TEST, TEST_P, TYPED_TEST, INSTANTIATE_TEST_SUITE_P, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, ::testing::{Test, TestWithParam, Values}
+
+#include <filesystem>                              // std::filesystem::{exists, remove}
+#include <fstream>                                 // std::ofstream
+#include <optional>                                // std::optional
+#include <string>                                  // std::string
+#include <utility>                                 // std::pair, std::make_pair
+
+TEST(OpenMPTuningProfile, current_machine_name) {
+    // the machine name must never be empty
+    EXPECT_FALSE(plssvm::openmp::current_machine_name().empty());
+}
+
+TEST(OpenMPTuningProfile, default_construct) {
+    const plssvm::openmp::tuning_profile profile{};
+    EXPECT_EQ(profile.num_entries(), 0);
+    EXPECT_FALSE(profile.get_block_size("node01", plssvm::kernel_function_type::rbf, "double").has_value());
+}
+TEST(OpenMPTuningProfile, construct_missing_file) {
+    // a profile file that doesn't exist results in an empty profile
+    const plssvm::openmp::tuning_profile profile{ "/this/profile/does/not/exist.txt" };
+    EXPECT_EQ(profile.num_entries(), 0);
+}
+TEST(OpenMPTuningProfile, set_block_size) {
+    plssvm::openmp::tuning_profile profile{};
+    profile.set_block_size("node01", plssvm::kernel_function_type::rbf, "double", 32);
+    profile.set_block_size("node01", plssvm::kernel_function_type::rbf, "float", 64);
+    EXPECT_EQ(profile.num_entries(), 2);
+    EXPECT_EQ(profile.get_block_size("node01", plssvm::kernel_function_type::rbf, "double"), std::optional<plssvm::kernel_index_type>{ 32 });
+    EXPECT_EQ(profile.get_block_size("node01", plssvm::kernel_function_type::rbf, "float"), std::optional<plssvm::kernel_index_type>{ 64 });
+    EXPECT_FALSE(profile.get_block_size("node02", plssvm::kernel_function_type::rbf, "double").has_value());
+    EXPECT_FALSE(profile.get_block_size("node01", plssvm::kernel_function_type::linear, "double").has_value());
+
+    // setting an already existing entry overwrites it
+    profile.set_block_size("node01", plssvm::kernel_function_type::rbf, "double", 128);
+    EXPECT_EQ(profile.num_entries(), 2);
+    EXPECT_EQ(profile.get_block_size("node01", plssvm::kernel_function_type::rbf, "double"), std::optional<plssvm::kernel_index_type>{ 128 });
+}
+TEST(OpenMPTuningProfile, save_and_read) {
+    util::temporary_file file{};
+
+    plssvm::openmp::tuning_profile profile{};
+    profile.set_block_size("node01 (AMD EPYC 7742 64-Core Processor)", plssvm::kernel_function_type::polynomial, "double", 16);
+    profile.set_block_size("node02", plssvm::kernel_function_type::linear, "float", 256);
+    profile.save(file.filename);
+
+    // no temporary file may be left behind
+    EXPECT_FALSE(std::filesystem::exists(file.filename + ".tmp"));
+
+    // reading the saved profile must yield the same entries
+    const plssvm::openmp::tuning_profile read_profile{ file.filename };
+    EXPECT_EQ(read_profile.num_entries(), 2);
+    EXPECT_EQ(read_profile.get_block_size("node01 (AMD EPYC 7742 64-Core Processor)", plssvm::kernel_function_type::polynomial, "double"), std::optional<plssvm::kernel_index_type>{ 16 });
+    EXPECT_EQ(read_profile.get_block_size("node02", plssvm::kernel_function_type::linear, "float"), std::optional<plssvm::kernel_index_type>{ 256 });
+}
+TEST(OpenMPTuningProfile, read_comments_and_whitespaces) {
+    util::temporary_file file{};
+    {
+        std::ofstream out{ file.filename };
+        out << "# machine;kernel;real_type;block_size\n\n node01 ; rbf ; float ; 32 \n";
+    }
+
+    const plssvm::openmp::tuning_profile profile{ file.filename };
+    EXPECT_EQ(profile.num_entries(), 1);
+    EXPECT_EQ(profile.get_block_size("node01", plssvm::kernel_function_type::rbf, "float"), std::optional<plssvm::kernel_index_type>{ 32 });
+}
+
+class OpenMPTuningProfileInvalid : public ::testing::TestWithParam<std::pair<std::string, std::string>> {};
+TEST_P(OpenMPTuningProfileInvalid, read_invalid_entry) {
+    const auto &[entry, message] = GetParam();
+
+    util::temporary_file file{};
+    {
+        std::ofstream out{ file.filename };
+        out << entry << '\n';
+    }
+
+    EXPECT_THROW_WHAT(plssvm::openmp::tuning_profile{ file.filename }, plssvm::invalid_file_format_exception, message);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(OpenMPTuningProfile, OpenMPTuningProfileInvalid, ::testing::Values(
+        std::make_pair("node01;rbf;float", "Each entry of the tuning profile must consist of exactly four values separated by ';', but \"node01;rbf;float\" contains 3!"),
+        std::make_pair("node01;foo;float;32", "Invalid kernel function \"foo\" in the tuning profile!"),
+        std::make_pair("node01;rbf;int;32", "Invalid floating point type \"int\" in the tuning profile!"),
+        std::make_pair("node01;rbf;float;0", "The block size in the tuning profile must be greater than 0, but is 0!")));
+// clang-format on
+
+template <typename T>
+class OpenMPBlockSizeTuning : public ::testing::Test, private util::redirect_output<> {};
+TYPED_TEST_SUITE(OpenMPBlockSizeTuning, util::real_type_kernel_function_gtest, naming::real_type_kernel_function_to_name);
+
+TYPED_TEST(OpenMPBlockSizeTuning, tune_block_size) {
+    using real_type = typename TypeParam::real_type;
+
+    const plssvm::detail::parameter<real_type> params{ TypeParam::kernel_type, 2, 0.001, 1.0, 0.1 };
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+
+    // the tuned block size must always be one of the supported block sizes
+    EXPECT_TRUE(plssvm::openmp::is_supported_block_size(plssvm::openmp::tune_block_size(params, data.data(), plssvm::openmp::thread_pinning::none, 128, 1)));
+}
+TYPED_TEST(OpenMPBlockSizeTuning, load_or_tune_block_size) {
+    using real_type = typename TypeParam::real_type;
+
+    const plssvm::detail::parameter<real_type> params{ TypeParam::kernel_type, 2, 0.001, 1.0, 0.1 };
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+    util::temporary_file file{};
+    std::filesystem::remove(file.filename);
+
+    // the tuned block size must be written to the profile file
+    const plssvm::kernel_index_type block_size = plssvm::openmp::load_or_tune_block_size(file.filename, params, data.data());
+    EXPECT_TRUE(plssvm::openmp::is_supported_block_size(block_size));
+    const plssvm::openmp::tuning_profile profile{ file.filename };
+    EXPECT_EQ(profile.num_entries(), 1);
+    EXPECT_EQ(profile.get_block_size(plssvm::openmp::current_machine_name(), TypeParam::kernel_type, plssvm::detail::arithmetic_type_name<real_type>()), std::optional<plssvm::kernel_index_type>{ block_size });
+}
+TYPED_TEST(OpenMPBlockSizeTuning, load_or_tune_block_size_existing_entry) {
+    using real_type = typename TypeParam::real_type;
+
+    const plssvm::detail::parameter<real_type> params{ TypeParam::kernel_type, 2, 0.001, 1.0, 0.1 };
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+    util::temporary_file file{};
+
+    // an already tuned block size must be reused
+    plssvm::openmp::tuning_profile profile{};
+    profile.set_block_size(plssvm::openmp::current_machine_name(), TypeParam::kernel_type, plssvm::detail::arithmetic_type_name<real_type>(), 16);
+    profile.save(file.filename);
+    EXPECT_EQ(plssvm::openmp::load_or_tune_block_size(file.filename, params, data.data()), 16);
+
+    // an unsupported block size is tuned again
+    profile.set_block_size(plssvm::openmp::current_machine_name(), TypeParam::kernel_type, plssvm::detail::arithmetic_type_name<real_type>(), 17);
+    profile.save(file.filename);
+    EXPECT_TRUE(plssvm::openmp::is_supported_block_size(plssvm::openmp::load_or_tune_block_size(file.filename, params, data.data())));
+}
@@ -0,0 +1,224 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the functionality related to the multi-device C-SVM of the OpenMP backend.
+ */
+
+#include "backends/OpenMP/mock_device_csvm.hpp"
+
+#include "plssvm/backend_types.hpp"                // plssvm::csvm_to_backend_type_v
+#include "plssvm/backends/OpenMP/device_csvm.hpp"  // plssvm::openmp::{device_csvm, get_num_numa_nodes}
+#include "plssvm/backends/OpenMP/exceptions.hpp"   // plssvm::openmp::backend_exception
+#include "plssvm/data_set.hpp"                     // plssvm::data_set
+#include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
+#include "plssvm/exceptions/exceptions.hpp"        // plssvm::exception
+#include "plssvm/kernel_function_types.hpp"        // plssvm::kernel_function_type
+#include "plssvm/model.hpp"                        // plssvm::model
+#include "plssvm/parameter.hpp"                    // plssvm::parameter, plssvm::kernel_type, plssvm::cost, plssvm::openmp_num_devices
+#include "plssvm/target_platforms.hpp"             // plssvm::target_platform
+
+#include "../../custom_test_macros.hpp"            // EXPECT_THROW_WHAT, EXPECT_THROW_WHAT_MATCHER
+#include "../../utility.hpp"                       // util::redirect_output
+#include "../generic_csvm_tests.hpp"               // generic CSVM tests to instantiate
+
+#include "fmt/core.h"                              // fmt::format
+#include "fmt/ostream.h"                           // can use fmt using operator<< overloads
+#include "gmock/gmock-matchers.h"                  // ::testing::StartsWith
+#include "gtest/gtest.h"                           // TEST_F, EXPECT_NO_THROW, EXPECT_EQ, EXPECT_GE, INSTANTIATE_TYPED_TEST_SUITE_P, ::testing::{Test, Types}
+
+#include "omp.h"                                   // omp_get_max_threads
+
+#include <algorithm>                               // std::max
+#include <cstddef>                                 // std::size_t
+#include <fstream>                                 // std::ifstream
+#include <iterator>                                // std::istream_iterator
+#include <tuple>                                   // std::make_tuple, std::ignore
+#include <utility>                                 // std::make_pair
+#include <vector>                                  // std::vector
+
+class OpenMPDeviceCSVM : public ::testing::Test, private util::redirect_output<> {};
+
+// check whether the constructor correctly fails when using an incompatible target platform
+TEST_F(OpenMPDeviceCSVM, construct_parameter) {
+#if defined(PLSSVM_HAS_CPU_TARGET)
+    // the automatic target platform must always be available
+    EXPECT_NO_THROW(plssvm::openmp::device_csvm{ plssvm::parameter{} });
+#else
+    EXPECT_THROW_WHAT(plssvm::openmp::device_csvm{ plssvm::parameter{} },
+                      plssvm::openmp::backend_exception,
+                      "Requested target platform 'cpu' that hasn't been enabled using PLSSVM_TARGET_PLATFORMS!");
+#endif
+}
+TEST_F(OpenMPDeviceCSVM, construct_target_and_parameter) {
+    // create parameter struct
+    const plssvm::parameter params{};
+
+#if defined(PLSSVM_HAS_CPU_TARGET)
+    // only automatic or cpu are allowed as target platform for the OpenMP backend
+    EXPECT_NO_THROW((plssvm::openmp::device_csvm{ plssvm::target_platform::automatic, params }));
+    EXPECT_NO_THROW((plssvm::openmp::device_csvm{ plssvm::target_platform::cpu, params }));
+#else
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::target_platform::automatic, params }),
+                      plssvm::openmp::backend_exception,
+                      "Requested target platform 'cpu' that hasn't been enabled using PLSSVM_TARGET_PLATFORMS!");
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::target_platform::cpu, params }),
+                      plssvm::openmp::backend_exception,
+                      "Requested target platform 'cpu' that hasn't been enabled using PLSSVM_TARGET_PLATFORMS!");
+#endif
+
+    // all other target platforms must throw
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::target_platform::gpu_nvidia, params }),
+                      plssvm::openmp::backend_exception,
+                      "Invalid target platform 'gpu_nvidia' for the OpenMP backend!");
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::target_platform::gpu_amd, params }),
+                      plssvm::openmp::backend_exception,
+                      "Invalid target platform 'gpu_amd' for the OpenMP backend!");
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::target_platform::gpu_intel, params }),
+                      plssvm::openmp::backend_exception,
+                      "Invalid target platform 'gpu_intel' for the OpenMP backend!");
+}
+TEST_F(OpenMPDeviceCSVM, construct_target_and_named_args) {
+#if defined(PLSSVM_HAS_CPU_TARGET)
+    // only automatic or cpu are allowed as target platform for the OpenMP backend
+    EXPECT_NO_THROW((plssvm::openmp::device_csvm{ plssvm::target_platform::automatic, plssvm::kernel_type = plssvm::kernel_function_type::linear, plssvm::cost = 2.0 }));
+    EXPECT_NO_THROW((plssvm::openmp::device_csvm{ plssvm::target_platform::cpu, plssvm::cost = 2.0, plssvm::openmp_num_devices = 2 }));
+#else
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::target_platform::automatic, plssvm::kernel_type = plssvm::kernel_function_type::linear, plssvm::cost = 2.0 }),
+                      plssvm::openmp::backend_exception,
+                      "Requested target platform 'cpu' that hasn't been enabled using PLSSVM_TARGET_PLATFORMS!");
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::target_platform::cpu, plssvm::cost = 2.0, plssvm::openmp_num_devices = 2 }),
+                      plssvm::openmp::backend_exception,
+                      "Requested target platform 'cpu' that hasn't been enabled using PLSSVM_TARGET_PLATFORMS!");
+#endif
+
+    // all other target platforms must throw
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::target_platform::gpu_nvidia, plssvm::cost = 2.0 }),
+                      plssvm::openmp::backend_exception,
+                      "Invalid target platform 'gpu_nvidia' for the OpenMP backend!");
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::target_platform::gpu_amd, plssvm::cost = 2.0 }),
+                      plssvm::openmp::backend_exception,
+                      "Invalid target platform 'gpu_amd' for the OpenMP backend!");
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::target_platform::gpu_intel, plssvm::cost = 2.0 }),
+                      plssvm::openmp::backend_exception,
+                      "Invalid target platform 'gpu_intel' for the OpenMP backend!");
+}
+
+TEST_F(OpenMPDeviceCSVM, get_num_numa_nodes) {
+    // there is always at least one NUMA node
+    EXPECT_GE(plssvm::openmp::get_num_numa_nodes(), 1);
+}
+TEST_F(OpenMPDeviceCSVM, construct_default_num_devices) {
+    // by default, one device per NUMA node is used
+    const mock_device_csvm svm{ plssvm::parameter{} };
+    EXPECT_EQ(svm.num_available_devices(), plssvm::openmp::get_num_numa_nodes());
+}
+TEST_F(OpenMPDeviceCSVM, construct_num_devices) {
+    const mock_device_csvm svm{ plssvm::openmp_num_devices = 3 };
+
+    // the devices are the logical IDs [0, 3)
+    ASSERT_EQ(svm.num_available_devices(), 3);
+    for (std::size_t device = 0; device < svm.devices_.size(); ++device) {
+        EXPECT_EQ(svm.devices_[device], static_cast<int>(device));
+    }
+    // the available threads are distributed evenly among the devices
+    EXPECT_EQ(svm.get_num_threads_per_device(), std::max(1, omp_get_max_threads() / 3));
+}
+TEST_F(OpenMPDeviceCSVM, construct_zero_devices) {
+    // at least one device must be used
+    EXPECT_THROW_WHAT((plssvm::openmp::device_csvm{ plssvm::openmp_num_devices = 0 }),
+                      plssvm::openmp::backend_exception,
+                      "The number of devices must be greater than 0!");
+}
+TEST_F(OpenMPDeviceCSVM, device_memory_budget) {
+    mock_device_csvm svm{ plssvm::openmp_num_devices = 2 };
+
+    // by default, the whole device memory may be used
+    EXPECT_EQ(svm.get_device_memory_budget(), 0);
+    EXPECT_EQ(svm.available_device_memory(0), svm.get_device_memory(svm.devices_[0]));
+    // the available device memory is limited by the budget
+    svm.set_device_memory_budget(1024);
+    EXPECT_EQ(svm.get_device_memory_budget(), 1024);
+    EXPECT_EQ(svm.available_device_memory(0), 1024);
+    EXPECT_EQ(svm.available_device_memory(1), 1024);
+}
+TEST_F(OpenMPDeviceCSVM, predict_chunked) {
+    // create data set to be used
+    const plssvm::data_set<double> test_data{ PLSSVM_TEST_PATH "/data/predict/500x200_test.libsvm" };
+    // read ground truth from file
+    std::ifstream prediction_file{ PLSSVM_TEST_PATH "/data/predict/500x200.libsvm.predict" };
+    const std::vector<int> ground_truth{ std::istream_iterator<int>{ prediction_file }, std::istream_iterator<int>{} };
+
+    // the memory budgets are small enough such that the support vectors and data points to predict are split into multiple chunks
+    for (const auto &[kernel, budget] : { std::make_pair(plssvm::kernel_function_type::linear, std::size_t{ 300000 }),
+                                          std::make_pair(plssvm::kernel_function_type::polynomial, std::size_t{ 800000 }),
+                                          std::make_pair(plssvm::kernel_function_type::rbf, std::size_t{ 800000 }) }) {
+        const plssvm::model<double> model{ fmt::format(PLSSVM_TEST_PATH "/data/predict/500x200_{}.libsvm.model", kernel) };
+
+        mock_device_csvm svm{ plssvm::kernel_type = kernel, plssvm::openmp_num_devices = 2 };
+        svm.set_device_memory_budget(budget);
+
+        // the chunked prediction must yield the same result
+        EXPECT_EQ(svm.predict(model, test_data), ground_truth) << fmt::format("kernel: {}", kernel);
+    }
+}
+TEST_F(OpenMPDeviceCSVM, predict_not_enough_device_memory) {
+    const plssvm::data_set<double> test_data{ PLSSVM_TEST_PATH "/data/predict/500x200_test.libsvm" };
+    const plssvm::model<double> model{ PLSSVM_TEST_PATH "/data/predict/500x200_rbf.libsvm.model" };
+
+    mock_device_csvm svm{ plssvm::kernel_type = plssvm::kernel_function_type::rbf };
+    svm.set_device_memory_budget(1024);
+
+    EXPECT_THROW_WHAT(std::ignore = svm.predict(model, test_data),
+                      plssvm::exception,
+                      "Not enough device memory to predict the 500 data points using 214 support vectors: only 1024 bytes are available!");
+}
+TEST_F(OpenMPDeviceCSVM, fit_not_enough_device_memory) {
+    const plssvm::data_set<double> data{ PLSSVM_TEST_PATH "/data/libsvm/500x200.libsvm" };
+
+    mock_device_csvm svm{ plssvm::openmp_num_devices = 2 };
+    svm.set_device_memory_budget(1024);
+
+    // the training data doesn't fit into the device memory
+    EXPECT_THROW_WHAT_MATCHER(std::ignore = svm.fit(data),
+                              plssvm::exception,
+                              ::testing::StartsWith("Not enough memory on device 0 to train the C-SVM: "));
+}
+
+template <typename T, plssvm::kernel_function_type kernel>
+struct csvm_test_type {
+    using mock_csvm_type = mock_device_csvm;
+    using csvm_type = plssvm::openmp::device_csvm;
+    using real_type = T;
+    static constexpr plssvm::kernel_function_type kernel_type = kernel;
+    // always use multiple devices such that the multi-device code paths are tested
+    inline static auto additional_arguments = std::make_tuple(std::make_pair(plssvm::openmp_num_devices, 2));
+};
+
+class csvm_test_type_to_name {
+  public:
+    template <typename T>
+    static std::string GetName(int) {
+        return fmt::format("{}_{}_{}",
+                           plssvm::csvm_to_backend_type_v<typename T::csvm_type>,
+                           plssvm::detail::arithmetic_type_name<typename T::real_type>(),
+                           T::kernel_type);
+    }
+};
+
+using csvm_test_types = ::testing::Types<
+    csvm_test_type<float, plssvm::kernel_function_type::linear>,
+    csvm_test_type<float, plssvm::kernel_function_type::polynomial>,
+    csvm_test_type<float, plssvm::kernel_function_type::rbf>,
+    csvm_test_type<double, plssvm::kernel_function_type::linear>,
+    csvm_test_type<double, plssvm::kernel_function_type::polynomial>,
+    csvm_test_type<double, plssvm::kernel_function_type::rbf>>;
+
+// instantiate type-parameterized tests
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMPDeviceBackend, GenericCSVM, csvm_test_types, csvm_test_type_to_name);
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMPDeviceBackendDeathTest, GenericCSVMDeathTest, csvm_test_types, csvm_test_type_to_name);
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMPDeviceBackend, GenericGPUCSVM, csvm_test_types, csvm_test_type_to_name);
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMPDeviceBackendDeathTest, GenericGPUCSVMDeathTest, csvm_test_types, csvm_test_type_to_name);
@@ -0,0 +1,184 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the distributed C-SVM using the OpenMP backend. Must be run using multiple MPI processes, e.g., `mpirun -np 4`.
+ */
+
+#include "backends/OpenMP/mock_distributed_csvm.hpp"
+#include "backends/OpenMP/mock_openmp_csvm.hpp"
+
+#include "plssvm/backends/OpenMP/distributed_csvm.hpp"  // plssvm::openmp::{distributed_csvm, calculate_distributed_row_range}
+#include "plssvm/cancellation_token.hpp"                // plssvm::cancellation_token
+#include "plssvm/data_set.hpp"                          // plssvm::data_set
+#include "plssvm/detail/solver_control.hpp"             // plssvm::detail::solver_control
+#include "plssvm/iteration_info.hpp"                    // plssvm::iteration_info
+#include "plssvm/kernel_function_types.hpp"             // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                         // plssvm::parameter, plssvm::detail::parameter, plssvm::kernel_type
+
+#include "../../custom_test_macros.hpp"                 // EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS, EXPECT_FLOATING_POINT_NEAR_EPS
+#include "../../naming.hpp"                             // naming::real_type_kernel_function_to_name
+#include "../../types_to_test.hpp"                      // util::real_type_kernel_function_gtest
+#include "../../utility.hpp"                            // util::redirect_output
+
+#include "gtest/gtest.h"                                // TEST_F, TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_LE, EXPECT_FALSE, ::testing::Test
+#include "mpi.h"                                        // MPI_COMM_WORLD, MPI_COMM_SELF, MPI_Comm_rank, MPI_Comm_size
+
+#include <cstddef>                                      // std::size_t
+#include <tuple>                                        // std::ignore
+#include <vector>                                       // std::vector
+
+class DistributedCSVM : public ::testing::Test, private util::redirect_output<> {
+  protected:
+    void SetUp() override {
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
+        MPI_Comm_size(MPI_COMM_WORLD, &num_ranks_);
+    }
+
+    /// The rank of this MPI process in `MPI_COMM_WORLD`.
+    int rank_{ 0 };
+    /// The number of MPI processes in `MPI_COMM_WORLD`.
+    int num_ranks_{ 1 };
+};
+
+TEST_F(DistributedCSVM, construct_parameter) {
+    const plssvm::openmp::distributed_csvm svm{ plssvm::parameter{} };
+
+    // by default, all MPI processes are used
+    EXPECT_EQ(svm.rank(), rank_);
+    EXPECT_EQ(svm.num_ranks(), num_ranks_);
+}
+TEST_F(DistributedCSVM, construct_communicator_and_named_args) {
+    const plssvm::openmp::distributed_csvm svm{ MPI_COMM_SELF, plssvm::kernel_type = plssvm::kernel_function_type::rbf };
+
+    // only this MPI process is used
+    EXPECT_EQ(svm.rank(), 0);
+    EXPECT_EQ(svm.num_ranks(), 1);
+    EXPECT_EQ(svm.get_params().kernel_type, plssvm::kernel_function_type::rbf);
+}
+
+TEST_F(DistributedCSVM, calculate_distributed_row_range) {
+    const std::size_t num_rows = 1000;
+    for (const int num_ranks : { 1, 2, 3, 4, 7 }) {
+        std::size_t expected_first = 0;
+        for (int rank = 0; rank < num_ranks; ++rank) {
+            const auto [first, last] = plssvm::openmp::calculate_distributed_row_range(num_rows, rank, num_ranks);
+            // the row ranges must be consecutive
+            EXPECT_EQ(first, expected_first);
+            EXPECT_LE(first, last);
+            expected_first = last;
+
+            // each process must calculate roughly the same number of entries of the lower triangular kernel matrix (at most one row more or less)
+            const std::size_t num_entries = (last * (last + 1) - first * (first + 1)) / 2;
+            const std::size_t expected_num_entries = num_rows * (num_rows + 1) / 2 / static_cast<std::size_t>(num_ranks);
+            EXPECT_LE(num_entries, expected_num_entries + num_rows);
+            EXPECT_LE(expected_num_entries, num_entries + num_rows);
+        }
+        // all rows must be covered
+        EXPECT_EQ(expected_first, num_rows);
+    }
+}
+TEST_F(DistributedCSVM, calculate_distributed_row_range_more_processes_than_rows) {
+    const std::size_t num_rows = 3;
+    const int num_ranks = 8;
+    std::size_t expected_first = 0;
+    for (int rank = 0; rank < num_ranks; ++rank) {
+        const auto [first, last] = plssvm::openmp::calculate_distributed_row_range(num_rows, rank, num_ranks);
+        // some processes don't get any rows
+        EXPECT_EQ(first, expected_first);
+        EXPECT_LE(first, last);
+        expected_first = last;
+    }
+    EXPECT_EQ(expected_first, num_rows);
+}
+
+template <typename T>
+class DistributedCSVMSolve : public DistributedCSVM {
+  protected:
+    using real_type = typename T::real_type;
+
+    void SetUp() override {
+        DistributedCSVM::SetUp();
+        // use only a subset of the data points: the bias suffers from cancellation, i.e., is sensitive to the different summation order in the distributed kernel
+        const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+        data_ = std::vector<std::vector<real_type>>(data.data().cbegin(), data.data().cbegin() + 64);
+        // the labels must be the same on all MPI processes
+        labels_.resize(data_.size());
+        for (std::size_t i = 0; i < labels_.size(); ++i) {
+            labels_[i] = i % 3 == 0 ? real_type{ -1.0 } : real_type{ 1.0 };
+        }
+    }
+
+    /// The data points used for training.
+    std::vector<std::vector<real_type>> data_{};
+    /// The labels of the data points.
+    std::vector<real_type> labels_{};
+};
+TYPED_TEST_SUITE(DistributedCSVMSolve, util::real_type_kernel_function_gtest, naming::real_type_kernel_function_to_name);
+
+TYPED_TEST(DistributedCSVMSolve, solve_system_of_linear_equations) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ TypeParam::kernel_type, 2, 0.001, 1.0, 0.1 };
+
+    // create C-SVMs: must be done using the mock classes, since solve_system_of_linear_equations is protected
+    const mock_openmp_csvm svm{ params };
+    const mock_distributed_csvm distributed_svm{ params };
+
+    // solve the system of linear equations using only this MPI process and distributed across all MPI processes
+    const auto [ground_truth_alpha, ground_truth_rho] = svm.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), this->data_, this->labels_, real_type{ 1e-6 }, 2, plssvm::detail::solver_control<real_type>{});
+    const auto [alpha, rho] = distributed_svm.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), this->data_, this->labels_, real_type{ 1e-6 }, 2, plssvm::detail::solver_control<real_type>{});
+
+    // check the calculated result for correctness
+    EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(alpha, ground_truth_alpha, real_type{ 1.0e6 });
+    EXPECT_FLOATING_POINT_NEAR_EPS(rho, ground_truth_rho, real_type{ 1.0e6 });
+}
+TYPED_TEST(DistributedCSVMSolve, iteration_callback_stop_on_single_process) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ TypeParam::kernel_type, 2, 0.001, 1.0, 0.1 };
+    const mock_distributed_csvm svm{ params };
+
+    // only the first MPI process requests to stop after the first iteration
+    int num_calls = 0;
+    plssvm::detail::solver_control<real_type> control{};
+    control.iteration_callback = [&](const plssvm::iteration_info &) {
+        ++num_calls;
+        return this->rank_ != 0;
+    };
+    std::ignore = svm.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), this->data_, this->labels_, real_type{ 1e-10 }, 10, control);
+
+    // all MPI processes must have stopped after the first iteration
+    EXPECT_EQ(num_calls, 1);
+    EXPECT_FALSE(control.converged);
+}
+TYPED_TEST(DistributedCSVMSolve, cancellation_on_single_process) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ TypeParam::kernel_type, 2, 0.001, 1.0, 0.1 };
+    const mock_distributed_csvm svm{ params };
+
+    // only the first MPI process cancels the CG algorithm
+    plssvm::cancellation_token token{};
+    if (this->rank_ == 0) {
+        token.cancel();
+    }
+    int num_calls = 0;
+    plssvm::detail::solver_control<real_type> control{};
+    control.cancellation = token;
+    control.iteration_callback = [&num_calls](const plssvm::iteration_info &) {
+        ++num_calls;
+        return true;
+    };
+    std::ignore = svm.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), this->data_, this->labels_, real_type{ 1e-10 }, 10, control);
+
+    // all MPI processes must have stopped before the first iteration has been finished
+    EXPECT_EQ(num_calls, 0);
+    EXPECT_FALSE(control.converged);
+}
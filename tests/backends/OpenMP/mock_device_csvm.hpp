@@ -0,0 +1,50 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief MOCK class for the multi-device C-SVM class using the OpenMP backend.
+ */
+
+#ifndef PLSSVM_TESTS_BACKENDS_OPENMP_MOCK_DEVICE_CSVM_HPP_
+#define PLSSVM_TESTS_BACKENDS_OPENMP_MOCK_DEVICE_CSVM_HPP_
+#pragma once
+
+#include "plssvm/backends/OpenMP/device_csvm.hpp"  // plssvm::openmp::device_csvm
+#include "plssvm/parameter.hpp"                    // plssvm::parameter
+
+/**
+ * @brief GTest mock class for the OpenMP multi-device CSVM.
+ */
+class mock_device_csvm final : public plssvm::openmp::device_csvm {
+    using base_type = plssvm::openmp::device_csvm;
+
+  public:
+    using base_type::device_ptr_type;
+
+    template <typename... Args>
+    explicit mock_device_csvm(Args&&... args) :
+        base_type{ std::forward<Args>(args)... } {}
+
+    // make protected member functions public
+    using base_type::available_device_memory;
+    using base_type::calculate_w;
+    using base_type::device_axpy;
+    using base_type::device_dot;
+    using base_type::device_reduction;
+    using base_type::device_xpby;
+    using base_type::generate_q;
+    using base_type::get_device_memory;
+    using base_type::predict_values;
+    using base_type::run_device_kernel;
+    using base_type::select_num_used_devices;
+    using base_type::setup_data_on_device;
+    using base_type::solve_system_of_linear_equations;
+
+    using base_type::devices_;
+};
+
+#endif  // PLSSVM_TESTS_BACKENDS_OPENMP_MOCK_DEVICE_CSVM_HPP_
\ No newline at end of file
@@ -0,0 +1,35 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief MOCK class for the distributed C-SVM class using the OpenMP backend.
+ */
+
+#ifndef PLSSVM_TESTS_BACKENDS_OPENMP_MOCK_DISTRIBUTED_CSVM_HPP_
+#define PLSSVM_TESTS_BACKENDS_OPENMP_MOCK_DISTRIBUTED_CSVM_HPP_
+#pragma once
+
+#include "plssvm/backends/OpenMP/distributed_csvm.hpp"  // plssvm::openmp::distributed_csvm
+
+#include <utility>                                      // std::forward
+
+/**
+ * @brief GTest mock class for the distributed OpenMP CSVM.
+ */
+class mock_distributed_csvm final : public plssvm::openmp::distributed_csvm {
+    using base_type = plssvm::openmp::distributed_csvm;
+
+  public:
+    template <typename... Args>
+    explicit mock_distributed_csvm(Args &&...args) :
+        base_type{ std::forward<Args>(args)... } {}
+
+    // make protected member functions public
+    using base_type::solve_system_of_linear_equations;
+};
+
+#endif  // PLSSVM_TESTS_BACKENDS_OPENMP_MOCK_DISTRIBUTED_CSVM_HPP_
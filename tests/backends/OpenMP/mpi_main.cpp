@@ -0,0 +1,33 @@
+/**
+ * @file
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Contains the googletest main function for the tests using multiple MPI processes.
+ */
+
+#include "gtest/gtest.h"  // RUN_ALL_TESTS, ::testing::{InitGoogleTest, UnitTest, TestEventListeners}
+#include "mpi.h"          // MPI_Init, MPI_Finalize, MPI_Comm_rank, MPI_Allreduce, MPI_COMM_WORLD, MPI_IN_PLACE, MPI_INT, MPI_MAX
+
+int main(int argc, char **argv) {
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleTest(&argc, argv);
+
+    // only the first MPI process prints the test results
+    int rank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    if (rank != 0) {
+        ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+        delete listeners.Release(listeners.default_result_printer());
+    }
+
+    // the tests fail if they failed on any MPI process
+    int result = RUN_ALL_TESTS();
+    MPI_Allreduce(MPI_IN_PLACE, &result, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+
+    MPI_Finalize();
+    return result;
+}
@@ -10,26 +10,47 @@
 
 #include "backends/OpenMP/mock_openmp_csvm.hpp"
 
-#include "plssvm/backend_types.hpp"                // plssvm::csvm_to_backend_type_v
-#include "plssvm/backends/OpenMP/csvm.hpp"         // plssvm::openmp::csvm
-#include "plssvm/backends/OpenMP/exceptions.hpp"   // plssvm::openmp::backend_exception
-#include "plssvm/data_set.hpp"                     // plssvm::data_set
-#include "plssvm/detail/arithmetic_type_name.hpp"  // plssvm::detail::arithmetic_type_name
-#include "plssvm/kernel_function_types.hpp"        // plssvm::kernel_function_type
-#include "plssvm/parameter.hpp"                    // plssvm::parameter, plssvm::detail::parameter, plssvm::kernel_type, plssvm::cost
-#include "plssvm/target_platforms.hpp"             // plssvm::target_platform
-
-#include "../../custom_test_macros.hpp"            // EXPECT_THROW_WHAT, EXPECT_FLOATING_POINT_VECTOR_NEAR
-#include "../../naming.hpp"                        // naming::{real_type_kernel_function_to_name, real_type_to_name}
-#include "../../types_to_test.hpp"                 // util::{real_type_kernel_function_gtest, real_type_gtest}
-#include "../../utility.hpp"                       // util::{redirect_output, generate_random_vector}
-#include "../compare.hpp"                          // compare::{generate_q, calculate_w, kernel_function, device_kernel_function}
-#include "../generic_csvm_tests.hpp"               // generic::{test_solve_system_of_linear_equations, test_predict_values, test_predict, test_score}
-
-#include "gtest/gtest.h"                           // TEST_F, EXPECT_NO_THROW, TYPED_TEST_SUITE, TYPED_TEST, ::testing::Test
-
-#include <tuple>                                   // std::make_tuple
-#include <vector>                                  // std::vector
+#include "plssvm/backend_types.hpp"                       // plssvm::csvm_to_backend_type_v
+#include "plssvm/backends/OpenMP/block_size_tuning.hpp"   // plssvm::openmp::tuning_profile
+#include "plssvm/backends/OpenMP/csvm.hpp"                // plssvm::openmp::csvm
+#include "plssvm/backends/OpenMP/exceptions.hpp"          // plssvm::openmp::backend_exception
+#include "plssvm/backends/OpenMP/out_of_core_kernel.hpp"  // plssvm::openmp::{device_kernel_q_out_of_core_*, device_kernel_out_of_core_*}
+#include "plssvm/backends/OpenMP/svm_kernel.hpp"          // plssvm::openmp::supported_block_sizes
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"      // plssvm::openmp::thread_pinning
+#include "plssvm/constants.hpp"                           // plssvm::{kernel_index_type, OPENMP_BLOCK_SIZE}
+#include "plssvm/data_set.hpp"                            // plssvm::data_set
+#include "plssvm/detail/arithmetic_type_name.hpp"         // plssvm::detail::arithmetic_type_name
+#include "plssvm/detail/io/binary_data_file.hpp"          // plssvm::detail::io::{binary_data_file, write_binary_data_file}
+#include "plssvm/detail/solver_control.hpp"               // plssvm::detail::solver_control
+#include "plssvm/iteration_info.hpp"                      // plssvm::iteration_info
+#include "plssvm/exceptions/exceptions.hpp"               // plssvm::invalid_parameter_exception
+#include "plssvm/kernel_function_types.hpp"               // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"                           // plssvm::parameter, plssvm::detail::parameter, plssvm::kernel_type, plssvm::cost, plssvm::{epsilon, max_iter, memory_budget, openmp_thread_pinning, openmp_num_threads, openmp_cpu_set, openmp_block_size, openmp_tuning_profile}
+#include "plssvm/target_platforms.hpp"                    // plssvm::target_platform
+
+#include "../../custom_test_macros.hpp"                   // EXPECT_THROW_WHAT, EXPECT_FLOATING_POINT_VECTOR_NEAR, EXPECT_FLOATING_POINT_VECTOR_EQ, EXPECT_FLOATING_POINT_NEAR_EPS
+#include "../../naming.hpp"                               // naming::{real_type_kernel_function_to_name, real_type_to_name}
+#include "../../types_to_test.hpp"                        // util::{real_type_kernel_function_gtest, real_type_gtest}
+#include "../../utility.hpp"                              // util::{redirect_output, generate_random_vector, temporary_file}
+#include "../compare.hpp"                                 // compare::{generate_q, calculate_w, kernel_function, device_kernel_function}
+#include "../generic_csvm_tests.hpp"                      // generic::{test_solve_system_of_linear_equations, test_predict_values, test_predict, test_score}
+
+#include "fmt/core.h"                                     // fmt::format
+#include "fmt/format.h"                                   // fmt::join
+
+#include "gtest/gtest.h"                                  // TEST_F, EXPECT_NO_THROW, TYPED_TEST_SUITE, TYPED_TEST, ::testing::Test
+
+#include "omp.h"                                          // omp_get_max_threads
+
+#if defined(__linux__)
+    #include <sched.h>                                    // sched_getcpu
+#endif
+
+#include <cstddef>                                        // std::size_t
+#include <functional>                                     // std::function
+#include <string>                                         // std::string
+#include <tuple>                                          // std::make_tuple, std::ignore
+#include <vector>                                         // std::vector
 
 class OpenMPCSVM : public ::testing::Test, private util::redirect_output<> {};
 
@@ -97,6 +118,71 @@ TEST_F(OpenMPCSVM, construct_target_and_named_args) {
                       plssvm::openmp::backend_exception,
                       "Invalid target platform 'gpu_intel' for the OpenMP backend!");
 }
+TEST_F(OpenMPCSVM, get_thread_pinning) {
+    // by default, the threads aren't pinned
+    const plssvm::openmp::csvm svm{ plssvm::parameter{} };
+    EXPECT_EQ(svm.get_thread_pinning(), plssvm::openmp::thread_pinning::none);
+
+    // the thread pinning policy can be provided using a named parameter
+    const plssvm::openmp::csvm svm_pinned{ plssvm::openmp_thread_pinning = plssvm::openmp::thread_pinning::spread, plssvm::cost = 2.0 };
+    EXPECT_EQ(svm_pinned.get_thread_pinning(), plssvm::openmp::thread_pinning::spread);
+    EXPECT_EQ(svm_pinned.get_params().cost, 2.0);
+}
+TEST_F(OpenMPCSVM, get_num_threads) {
+    // by default, the number of threads is determined by the OpenMP runtime
+    const plssvm::openmp::csvm svm{ plssvm::parameter{} };
+    EXPECT_EQ(svm.get_num_threads(), 0);
+
+    // the number of threads can be provided using a named parameter
+    const plssvm::openmp::csvm svm_threads{ plssvm::openmp_num_threads = 2, plssvm::cost = 2.0 };
+    EXPECT_EQ(svm_threads.get_num_threads(), 2);
+    EXPECT_EQ(svm_threads.get_params().cost, 2.0);
+}
+TEST_F(OpenMPCSVM, construct_negative_num_threads) {
+    EXPECT_THROW_WHAT((plssvm::openmp::csvm{ plssvm::openmp_num_threads = -1 }),
+                      plssvm::openmp::backend_exception,
+                      "The number of OpenMP threads must be greater or equal than 0, but is -1!");
+}
+TEST_F(OpenMPCSVM, get_cpu_set) {
+    // by default, the threads aren't bound to specific CPUs
+    const plssvm::openmp::csvm svm{ plssvm::parameter{} };
+    EXPECT_TRUE(svm.get_cpu_set().empty());
+
+#if defined(__linux__)
+    // the CPU set can be provided using a named parameter; the CPU the calling thread is running on is always available
+    const std::vector<int> cpu_set{ sched_getcpu() };
+    const plssvm::openmp::csvm svm_cpu_set{ plssvm::openmp_cpu_set = cpu_set, plssvm::openmp_num_threads = 2 };
+    EXPECT_EQ(svm_cpu_set.get_cpu_set(), cpu_set);
+    EXPECT_EQ(svm_cpu_set.get_num_threads(), 2);
+#endif
+}
+TEST_F(OpenMPCSVM, construct_thread_pinning_and_cpu_set) {
+    // the thread pinning policy and the CPU set are mutually exclusive
+    EXPECT_THROW_WHAT((plssvm::openmp::csvm{ plssvm::openmp_thread_pinning = plssvm::openmp::thread_pinning::close, plssvm::openmp_cpu_set = std::vector<int>{ 0 } }),
+                      plssvm::openmp::backend_exception,
+                      "The thread pinning policy 'close' can't be combined with an explicit CPU set!");
+}
+TEST_F(OpenMPCSVM, get_block_size) {
+    // by default, the compile-time block size is used
+    const plssvm::openmp::csvm svm{ plssvm::parameter{} };
+    EXPECT_EQ(svm.get_block_size(), plssvm::OPENMP_BLOCK_SIZE);
+    EXPECT_TRUE(svm.get_tuning_profile().empty());
+
+    // the block size can be provided using a named parameter
+    const plssvm::openmp::csvm svm_block_size{ plssvm::openmp_block_size = 16, plssvm::cost = 2.0 };
+    EXPECT_EQ(svm_block_size.get_block_size(), 16);
+    EXPECT_EQ(svm_block_size.get_params().cost, 2.0);
+}
+TEST_F(OpenMPCSVM, construct_unsupported_block_size) {
+    EXPECT_THROW_WHAT((plssvm::openmp::csvm{ plssvm::openmp_block_size = 17 }),
+                      plssvm::openmp::backend_exception,
+                      fmt::format("Unsupported OpenMP block size 17! Supported block sizes are: [{}].", fmt::join(plssvm::openmp::supported_block_sizes(), ", ")));
+}
+TEST_F(OpenMPCSVM, get_tuning_profile) {
+    // the tuning profile can be provided using a named parameter
+    const plssvm::openmp::csvm svm{ plssvm::openmp_tuning_profile = std::string{ "profile.txt" } };
+    EXPECT_EQ(svm.get_tuning_profile(), "profile.txt");
+}
 
 template <typename T, plssvm::kernel_function_type kernel>
 struct csvm_test_type {
@@ -212,4 +298,354 @@ TYPED_TEST(OpenMPCSVMRunDeviceKernel, run_device_kernel) {
         // check the calculated result for correctness
         EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated, ground_truth);
     }
-}
\ No newline at end of file
+}
+TYPED_TEST(OpenMPCSVMRunDeviceKernel, run_device_kernel_stop_requested) {
+    using real_type = typename TypeParam::real_type;
+    const plssvm::kernel_function_type kernel_type = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::detail::parameter<real_type> params{ kernel_type, 2, 0.001, 1.0, 0.1 };
+
+    // create the data that should be used
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+    const std::vector<real_type> rhs = util::generate_random_vector<real_type>(data.num_data_points() - 1, real_type{ 1.0 }, real_type{ 2.0 });
+    const std::vector<real_type> q = compare::generate_q(params, data.data());
+    const real_type QA_cost = compare::kernel_function(params, data.data().back(), data.data().back()) + 1 / params.cost;
+
+    // create C-SVM: must be done using the mock class, since plssvm::openmp::csvm::calculate_w is protected
+    const mock_openmp_csvm svm{};
+
+    // the stop has already been requested -> all blocks must be skipped
+    std::vector<real_type> calculated(data.num_data_points() - 1);
+    svm.run_device_kernel(params, q, calculated, rhs, data.data(), QA_cost, real_type{ 1.0 }, []() { return true; });
+
+    // the result vector must be unchanged
+    EXPECT_FLOATING_POINT_VECTOR_EQ(calculated, std::vector<real_type>(data.num_data_points() - 1));
+}
+TYPED_TEST(OpenMPCSVMRunDeviceKernel, run_device_kernel_row_ranges) {
+    using real_type = typename TypeParam::real_type;
+    const plssvm::kernel_function_type kernel_type = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::detail::parameter<real_type> params{ kernel_type, 2, 0.001, 1.0, 0.1 };
+
+    // create the data that should be used
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+    const std::vector<real_type> rhs = util::generate_random_vector<real_type>(data.num_data_points() - 1, real_type{ 1.0 }, real_type{ 2.0 });
+    const std::vector<real_type> q = compare::generate_q(params, data.data());
+    const real_type QA_cost = compare::kernel_function(params, data.data().back(), data.data().back()) + 1 / params.cost;
+
+    // create C-SVM: must be done using the mock class, since plssvm::openmp::csvm::run_device_kernel is protected
+    const mock_openmp_csvm svm{};
+
+    // calculate the correct device function result
+    const std::vector<real_type> ground_truth = compare::device_kernel_function(params, data.data(), rhs, q, QA_cost, real_type{ 1.0 });
+
+    // summing up the results of disjoint row ranges (including an empty one) must yield the result of all rows
+    const std::size_t num_rows = data.num_data_points() - 1;
+    std::vector<real_type> calculated(num_rows);
+    svm.run_device_kernel(params, q, calculated, rhs, data.data(), QA_cost, real_type{ 1.0 }, 0, num_rows / 3);
+    svm.run_device_kernel(params, q, calculated, rhs, data.data(), QA_cost, real_type{ 1.0 }, num_rows / 3, num_rows / 3);
+    svm.run_device_kernel(params, q, calculated, rhs, data.data(), QA_cost, real_type{ 1.0 }, num_rows / 3, num_rows);
+
+    // check the calculated result for correctness
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated, ground_truth);
+}
+TYPED_TEST(OpenMPCSVMRunDeviceKernel, run_device_kernel_block_size) {
+    using real_type = typename TypeParam::real_type;
+    const plssvm::kernel_function_type kernel_type = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::detail::parameter<real_type> params{ kernel_type, 2, 0.001, 1.0, 0.1 };
+
+    // create the data that should be used
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+    const std::vector<real_type> rhs = util::generate_random_vector<real_type>(data.num_data_points() - 1, real_type{ 1.0 }, real_type{ 2.0 });
+    const std::vector<real_type> q = compare::generate_q(params, data.data());
+    const real_type QA_cost = compare::kernel_function(params, data.data().back(), data.data().back()) + 1 / params.cost;
+
+    // calculate the correct device function result
+    const std::vector<real_type> ground_truth = compare::device_kernel_function(params, data.data(), rhs, q, QA_cost, real_type{ 1.0 });
+
+    for (const plssvm::kernel_index_type block_size : plssvm::openmp::supported_block_sizes()) {
+        // create C-SVM: must be done using the mock class, since plssvm::openmp::csvm::run_device_kernel is protected
+        const mock_openmp_csvm svm{ plssvm::openmp_block_size = block_size };
+
+        // the block size of the C-SVM must be used
+        std::vector<real_type> calculated(data.num_data_points() - 1);
+        svm.run_device_kernel(params, q, calculated, rhs, data.data(), QA_cost, real_type{ 1.0 });
+        EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated, ground_truth);
+
+        // the block size can be overwritten per call
+        std::vector<real_type> calculated_explicit(data.num_data_points() - 1);
+        svm.run_device_kernel(params, q, calculated_explicit, rhs, data.data(), QA_cost, real_type{ 1.0 }, std::function<bool()>{}, plssvm::OPENMP_BLOCK_SIZE);
+        EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated_explicit, ground_truth);
+    }
+}
+TYPED_TEST(OpenMPCSVMRunDeviceKernel, solve_system_of_linear_equations_tuning_profile) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ TypeParam::kernel_type, 2, 0.001, 1.0, 0.1 };
+
+    // use only a subset of the data points: the bias suffers from cancellation, i.e., is sensitive to the different summation order of the tuned block size
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+    const std::vector<std::vector<real_type>> A(data.data().cbegin(), data.data().cbegin() + 64);
+    std::vector<real_type> labels(A.size());
+    for (std::size_t i = 0; i < labels.size(); ++i) {
+        labels[i] = i % 3 == 0 ? real_type{ -1.0 } : real_type{ 1.0 };
+    }
+
+    // create C-SVMs: must be done using the mock classes, since solve_system_of_linear_equations is protected
+    util::temporary_file profile_file{};
+    const mock_openmp_csvm svm{ params };
+    mock_openmp_csvm svm_tuned{ plssvm::openmp_tuning_profile = profile_file.filename };
+    svm_tuned.set_params(params);
+
+    // the auto-tuned block size must yield the same result
+    const auto [ground_truth_alpha, ground_truth_rho] = svm.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), A, labels, real_type{ 1e-6 }, 2, plssvm::detail::solver_control<real_type>{});
+    const auto [alpha, rho] = svm_tuned.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), A, labels, real_type{ 1e-6 }, 2, plssvm::detail::solver_control<real_type>{});
+    EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(alpha, ground_truth_alpha, real_type{ 1.0e6 });
+    EXPECT_FLOATING_POINT_NEAR_EPS(rho, ground_truth_rho, real_type{ 1.0e6 });
+
+    // the tuned block size must have been added to the profile file
+    const plssvm::openmp::tuning_profile profile{ profile_file.filename };
+    EXPECT_EQ(profile.num_entries(), 1);
+}
+TYPED_TEST(OpenMPCSVMRunDeviceKernel, run_device_kernel_thread_pinning) {
+    using real_type = typename TypeParam::real_type;
+    const plssvm::kernel_function_type kernel_type = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::detail::parameter<real_type> params{ kernel_type, 2, 0.001, 1.0, 0.1 };
+
+    // create the data that should be used
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+    const std::vector<real_type> rhs = util::generate_random_vector<real_type>(data.num_data_points() - 1, real_type{ 1.0 }, real_type{ 2.0 });
+    const std::vector<real_type> q = compare::generate_q(params, data.data());
+    const real_type QA_cost = compare::kernel_function(params, data.data().back(), data.data().back()) + 1 / params.cost;
+
+    for (const plssvm::openmp::thread_pinning pinning : { plssvm::openmp::thread_pinning::close, plssvm::openmp::thread_pinning::spread }) {
+        // create C-SVM: must be done using the mock class, since plssvm::openmp::csvm::run_device_kernel is protected
+        const mock_openmp_csvm svm{ plssvm::openmp_thread_pinning = pinning };
+
+        for (const real_type add : { real_type{ -1.0 }, real_type{ 1.0 } }) {
+            // calculate the correct device function result
+            const std::vector<real_type> ground_truth = compare::device_kernel_function(params, data.data(), rhs, q, QA_cost, add);
+
+            // the fixed row blocks of the pinned threads must yield the same result
+            std::vector<real_type> calculated(data.num_data_points() - 1);
+            svm.run_device_kernel(params, q, calculated, rhs, data.data(), QA_cost, add);
+
+            // check the calculated result for correctness
+            EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated, ground_truth);
+        }
+    }
+}
+TYPED_TEST(OpenMPCSVMRunDeviceKernel, solve_system_of_linear_equations_thread_pinning) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ TypeParam::kernel_type, 2, 0.001, 1.0, 0.1 };
+
+    // use only a subset of the data points: the bias suffers from cancellation, i.e., is sensitive to the different summation order of the pinned threads
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+    const std::vector<std::vector<real_type>> A(data.data().cbegin(), data.data().cbegin() + 64);
+    std::vector<real_type> labels(A.size());
+    for (std::size_t i = 0; i < labels.size(); ++i) {
+        labels[i] = i % 3 == 0 ? real_type{ -1.0 } : real_type{ 1.0 };
+    }
+
+    // create C-SVMs: must be done using the mock classes, since solve_system_of_linear_equations is protected
+    const mock_openmp_csvm svm{ params };
+    mock_openmp_csvm svm_pinned{ plssvm::openmp_thread_pinning = plssvm::openmp::thread_pinning::close };
+    svm_pinned.set_params(params);
+
+    // the data points copied to the NUMA nodes of the pinned threads must yield the same result
+    const auto [ground_truth_alpha, ground_truth_rho] = svm.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), A, labels, real_type{ 1e-6 }, 2, plssvm::detail::solver_control<real_type>{});
+    const auto [alpha, rho] = svm_pinned.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), A, labels, real_type{ 1e-6 }, 2, plssvm::detail::solver_control<real_type>{});
+
+    // check the calculated result for correctness
+    EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(alpha, ground_truth_alpha, real_type{ 1.0e6 });
+    EXPECT_FLOATING_POINT_NEAR_EPS(rho, ground_truth_rho, real_type{ 1.0e6 });
+}
+TYPED_TEST(OpenMPCSVMRunDeviceKernel, solve_system_of_linear_equations_num_threads) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ TypeParam::kernel_type, 2, 0.001, 1.0, 0.1 };
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+    std::vector<real_type> labels(data.num_data_points(), real_type{ 1.0 });
+    labels.front() = real_type{ -1.0 };
+
+    // create C-SVM using a different number of threads than the calling thread: must be done using the mock class, since solve_system_of_linear_equations is protected
+    const int previous_num_threads = omp_get_max_threads();
+    const int num_threads = previous_num_threads + 1;
+    mock_openmp_csvm svm{ plssvm::openmp_num_threads = num_threads };
+    svm.set_params(params);
+
+    // the number of threads of the C-SVM must be used while solving the system of linear equations
+    int num_threads_in_callback = 0;
+    plssvm::detail::solver_control<real_type> control{};
+    control.iteration_callback = [&num_threads_in_callback](const plssvm::iteration_info &) {
+        num_threads_in_callback = omp_get_max_threads();
+        return false;
+    };
+    std::ignore = svm.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), data.data(), labels, real_type{ 1e-10 }, 10, control);
+    EXPECT_EQ(num_threads_in_callback, num_threads);
+
+    // afterwards, the previous number of threads must be restored
+    EXPECT_EQ(omp_get_max_threads(), previous_num_threads);
+}
+
+TYPED_TEST(OpenMPCSVMRunDeviceKernel, solve_system_of_linear_equations_rbf_tolerance) {
+    using real_type = typename TypeParam::real_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ TypeParam::kernel_type, 2, 0.001, 1.0, 0.1 };
+
+    // use only a subset of the data points: the bias suffers from cancellation, i.e., is sensitive to the different summation order
+    const plssvm::data_set<real_type> data{ PLSSVM_TEST_FILE };
+    const std::vector<std::vector<real_type>> A(data.data().cbegin(), data.data().cbegin() + 64);
+    std::vector<real_type> labels(A.size());
+    for (std::size_t i = 0; i < labels.size(); ++i) {
+        labels[i] = i % 3 == 0 ? real_type{ -1.0 } : real_type{ 1.0 };
+    }
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations is protected
+    const mock_openmp_csvm svm{ params };
+
+    // approximating the rbf kernel matrix-vector multiplications with a small tolerance must yield (nearly) the same result; all other kernel functions ignore the tolerance
+    plssvm::detail::solver_control<real_type> control{};
+    control.rbf_tolerance = real_type{ 1e-10 };
+    const auto [ground_truth_alpha, ground_truth_rho] = svm.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), A, labels, real_type{ 1e-6 }, 2, plssvm::detail::solver_control<real_type>{});
+    const auto [alpha, rho] = svm.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), A, labels, real_type{ 1e-6 }, 2, control);
+
+    // check the calculated result for correctness
+    EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(alpha, ground_truth_alpha, real_type{ 1.0e6 });
+    EXPECT_FLOATING_POINT_NEAR_EPS(rho, ground_truth_rho, real_type{ 1.0e6 });
+}
+
+template <typename T>
+class OpenMPCSVMOutOfCore : public OpenMPCSVM {
+  protected:
+    using real_type = typename T::real_type;
+
+    void SetUp() override {
+        // write the data points to the binary data file used in the out-of-core training
+        plssvm::detail::io::write_binary_data_file(file_.filename, data_.data());
+    }
+
+    /// The data points used for training.
+    const plssvm::data_set<real_type> data_{ PLSSVM_TEST_FILE };
+    /// The temporary binary data file.
+    util::temporary_file file_{};
+};
+TYPED_TEST_SUITE(OpenMPCSVMOutOfCore, util::real_type_kernel_function_gtest, naming::real_type_kernel_function_to_name);
+
+TYPED_TEST(OpenMPCSVMOutOfCore, device_kernel) {
+    using real_type = typename TypeParam::real_type;
+    const plssvm::kernel_function_type kernel_type = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::detail::parameter<real_type> params{ kernel_type, 2, 0.001, 1.0, 0.1 };
+
+    // create the data that should be used
+    const std::vector<std::vector<real_type>> &data = this->data_.data();
+    const plssvm::detail::io::binary_data_file<real_type> file{ this->file_.filename };
+    const std::vector<real_type> rhs = util::generate_random_vector<real_type>(data.size() - 1, real_type{ 1.0 }, real_type{ 2.0 });
+    const std::vector<real_type> q_ground_truth = compare::generate_q(params, data);
+    const real_type QA_cost = compare::kernel_function(params, data.back(), data.back()) + 1 / params.cost;
+
+    // use a block size that doesn't evenly divide the number of data points, a single data point, and all data points at once
+    for (const std::size_t block_size : { std::size_t{ 1 }, std::size_t{ 37 }, data.size() }) {
+        // calculate the q vector streaming the data points
+        std::vector<real_type> q(data.size() - 1);
+        switch (kernel_type) {
+            case plssvm::kernel_function_type::linear:
+                plssvm::openmp::device_kernel_q_out_of_core_linear(q, file, block_size);
+                break;
+            case plssvm::kernel_function_type::polynomial:
+                plssvm::openmp::device_kernel_q_out_of_core_polynomial(q, file, params.degree.value(), params.gamma.value(), params.coef0.value(), block_size);
+                break;
+            case plssvm::kernel_function_type::rbf:
+                plssvm::openmp::device_kernel_q_out_of_core_rbf(q, file, params.gamma.value(), block_size);
+                break;
+        }
+        EXPECT_FLOATING_POINT_VECTOR_NEAR(q, q_ground_truth);
+
+        for (const real_type add : { real_type{ -1.0 }, real_type{ 1.0 } }) {
+            // calculate the correct device function result
+            const std::vector<real_type> ground_truth = compare::device_kernel_function(params, data, rhs, q_ground_truth, QA_cost, add);
+
+            // perform the kernel calculation streaming the data points
+            std::vector<real_type> calculated(data.size() - 1);
+            switch (kernel_type) {
+                case plssvm::kernel_function_type::linear:
+                    plssvm::openmp::device_kernel_out_of_core_linear(q_ground_truth, calculated, rhs, file, QA_cost, 1 / params.cost, add, block_size);
+                    break;
+                case plssvm::kernel_function_type::polynomial:
+                    plssvm::openmp::device_kernel_out_of_core_polynomial(q_ground_truth, calculated, rhs, file, QA_cost, 1 / params.cost, add, params.degree.value(), params.gamma.value(), params.coef0.value(), block_size);
+                    break;
+                case plssvm::kernel_function_type::rbf:
+                    plssvm::openmp::device_kernel_out_of_core_rbf(q_ground_truth, calculated, rhs, file, QA_cost, 1 / params.cost, add, params.gamma.value(), block_size);
+                    break;
+            }
+
+            // check the calculated result for correctness
+            EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated, ground_truth);
+        }
+    }
+}
+TYPED_TEST(OpenMPCSVMOutOfCore, fit_out_of_core) {
+    using real_type = typename TypeParam::real_type;
+    const plssvm::kernel_function_type kernel_type = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ kernel_type, 2, 0.001, 1.0, 0.1 };
+
+    // create C-SVM: must be done using the mock class, since plssvm::openmp::csvm::solve_system_of_linear_equations is protected
+    const mock_openmp_csvm svm{ params };
+
+    // use only a subset of the data points: the bias suffers from cancellation, i.e., is sensitive to the different summation order in the out-of-core kernel
+    const std::vector<std::vector<real_type>> data(this->data_.data().cbegin(), this->data_.data().cbegin() + 64);
+    const util::temporary_file file{};
+    plssvm::detail::io::write_binary_data_file(file.filename, data);
+
+    // create fixed labels: random labels may result in a bias close to zero, i.e., a relative comparison would be meaningless
+    std::vector<real_type> labels(data.size());
+    for (std::size_t i = 0; i < labels.size(); ++i) {
+        labels[i] = i % 3 == 0 ? real_type{ -1.0 } : real_type{ 1.0 };
+    }
+
+    // solve the system of linear equations in-core
+    const auto [ground_truth_alpha, ground_truth_rho] = svm.solve_system_of_linear_equations(static_cast<plssvm::detail::parameter<real_type>>(params), data, labels, real_type{ 1e-6 }, 2, plssvm::detail::solver_control<real_type>{});
+
+    // solve the system of linear equations out-of-core using a memory budget of only 10 data points per block
+    const std::size_t memory_budget = 3 * 10 * this->data_.num_features() * sizeof(real_type);
+    const auto [alpha, rho] = svm.fit_out_of_core(file.filename, labels, plssvm::epsilon = real_type{ 1e-6 }, plssvm::max_iter = 2, plssvm::memory_budget = memory_budget);
+
+    // check the calculated result for correctness
+    EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(alpha, ground_truth_alpha, real_type{ 1.0e6 });
+    EXPECT_FLOATING_POINT_NEAR_EPS(rho, ground_truth_rho, real_type{ 1.0e6 });
+}
+TYPED_TEST(OpenMPCSVMOutOfCore, fit_out_of_core_invalid_memory_budget) {
+    using real_type = typename TypeParam::real_type;
+
+    const plssvm::openmp::csvm svm{ plssvm::kernel_type = TypeParam::kernel_type };
+    const std::vector<real_type> labels(this->data_.num_data_points(), real_type{ 1.0 });
+
+    EXPECT_THROW_WHAT(std::ignore = svm.fit_out_of_core(this->file_.filename, labels, plssvm::memory_budget = 0),
+                      plssvm::invalid_parameter_exception,
+                      "memory_budget must be greater than 0, but is 0!");
+}
+TYPED_TEST(OpenMPCSVMOutOfCore, fit_out_of_core_invalid_number_of_labels) {
+    using real_type = typename TypeParam::real_type;
+
+    const plssvm::openmp::csvm svm{ plssvm::kernel_type = TypeParam::kernel_type };
+    const std::vector<real_type> labels(this->data_.num_data_points() - 1, real_type{ 1.0 });
+
+    EXPECT_THROW_WHAT(std::ignore = svm.fit_out_of_core(this->file_.filename, labels),
+                      plssvm::invalid_parameter_exception,
+                      fmt::format("The number of labels ({}) must match the number of data points ({}) in the binary data file '{}'!", labels.size(), this->data_.num_data_points(), this->file_.filename));
+}
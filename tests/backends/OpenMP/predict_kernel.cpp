@@ -0,0 +1,138 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the blocked functions predicting the values of multiple data points using the OpenMP backend.
+ */
+
+#include "plssvm/backends/OpenMP/predict_kernel.hpp"
+
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type, plssvm::kernel_function
+
+#include "../../custom_test_macros.hpp"      // EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS
+#include "../../naming.hpp"                  // naming::real_type_to_name
+#include "../../types_to_test.hpp"           // util::real_type_gtest
+#include "../../utility.hpp"                 // util::generate_random_vector
+
+#include "gmock/gmock-matchers.h"            // ::testing::HasSubstr
+#include "gtest/gtest.h"                     // TYPED_TEST, TYPED_TEST_SUITE, EXPECT_LE, EXPECT_GT, EXPECT_DEATH, ::testing::Test
+
+#include <cstddef>                           // std::size_t
+#include <tuple>                             // std::tuple, std::make_tuple
+#include <vector>                            // std::vector
+
+template <typename real_type>
+[[nodiscard]] std::vector<std::vector<real_type>> generate_random_matrix(const std::size_t num_rows, const std::size_t num_cols) {
+    std::vector<std::vector<real_type>> matrix(num_rows);
+    for (std::vector<real_type> &row : matrix) {
+        row = util::generate_random_vector<real_type>(num_cols);
+    }
+    return matrix;
+}
+
+template <typename T>
+class OpenMPPredictKernel : public ::testing::Test {
+  protected:
+    /// The number of support vectors, data points to predict, and features; chosen such that full and partial tiles are present.
+    const std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> sizes_{
+        std::make_tuple(1, 1, 1),
+        std::make_tuple(64, 8, 128),
+        std::make_tuple(101, 37, 300)
+    };
+};
+TYPED_TEST_SUITE(OpenMPPredictKernel, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(OpenMPPredictKernel, polynomial) {
+    using real_type = TypeParam;
+
+    const int degree = 3;
+    const real_type gamma{ 0.1 };
+    const real_type coef0{ 1.0 };
+
+    for (const auto &[num_support_vectors, num_predict_points, num_features] : this->sizes_) {
+        const std::vector<std::vector<real_type>> support_vectors = generate_random_matrix<real_type>(num_support_vectors, num_features);
+        // note: positive weights avoid cancellation in the sums, i.e., the result doesn't depend on the summation order
+        const std::vector<real_type> alpha = util::generate_random_vector<real_type>(num_support_vectors, real_type{ 0.1 }, real_type{ 1.0 });
+        const std::vector<std::vector<real_type>> predict_points = generate_random_matrix<real_type>(num_predict_points, num_features);
+
+        // calculate the ground truth
+        std::vector<real_type> ground_truth(num_predict_points, real_type{ 1.0 });
+        for (std::size_t point = 0; point < num_predict_points; ++point) {
+            for (std::size_t sv = 0; sv < num_support_vectors; ++sv) {
+                ground_truth[point] += alpha[sv] * plssvm::kernel_function<plssvm::kernel_function_type::polynomial>(support_vectors[sv], predict_points[point], degree, gamma, coef0);
+            }
+        }
+
+        // the values must be added to the already present values
+        std::vector<real_type> out(num_predict_points, real_type{ 1.0 });
+        plssvm::openmp::device_kernel_predict_polynomial(out, support_vectors, alpha, predict_points, degree, gamma, coef0);
+        EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(out, ground_truth, real_type{ 1.0e3 });
+    }
+}
+TYPED_TEST(OpenMPPredictKernel, rbf) {
+    using real_type = TypeParam;
+
+    const real_type gamma{ 0.01 };
+
+    for (const auto &[num_support_vectors, num_predict_points, num_features] : this->sizes_) {
+        const std::vector<std::vector<real_type>> support_vectors = generate_random_matrix<real_type>(num_support_vectors, num_features);
+        // note: positive weights avoid cancellation in the sums, i.e., the result doesn't depend on the summation order
+        const std::vector<real_type> alpha = util::generate_random_vector<real_type>(num_support_vectors, real_type{ 0.1 }, real_type{ 1.0 });
+        const std::vector<std::vector<real_type>> predict_points = generate_random_matrix<real_type>(num_predict_points, num_features);
+
+        // calculate the ground truth
+        std::vector<real_type> ground_truth(num_predict_points, real_type{ 1.0 });
+        for (std::size_t point = 0; point < num_predict_points; ++point) {
+            for (std::size_t sv = 0; sv < num_support_vectors; ++sv) {
+                ground_truth[point] += alpha[sv] * plssvm::kernel_function<plssvm::kernel_function_type::rbf>(support_vectors[sv], predict_points[point], gamma);
+            }
+        }
+
+        // the values must be added to the already present values
+        std::vector<real_type> out(num_predict_points, real_type{ 1.0 });
+        plssvm::openmp::device_kernel_predict_rbf(out, support_vectors, alpha, predict_points, gamma);
+        EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(out, ground_truth, real_type{ 1.0e3 });
+    }
+}
+TYPED_TEST(OpenMPPredictKernel, rbf_identical_points) {
+    using real_type = TypeParam;
+
+    // the squared distance of identical points must never become negative, i.e., the kernel function value must not exceed 1
+    const std::vector<std::vector<real_type>> support_vectors = generate_random_matrix<real_type>(1, 50);
+    const std::vector<real_type> alpha{ real_type{ 1.0 } };
+
+    std::vector<real_type> out(1, real_type{ 0.0 });
+    plssvm::openmp::device_kernel_predict_rbf(out, support_vectors, alpha, support_vectors, real_type{ 1.0 });
+    EXPECT_LE(out.front(), real_type{ 1.0 });
+    EXPECT_GT(out.front(), real_type{ 0.99 });
+}
+
+template <typename T>
+class OpenMPPredictKernelDeathTest : public ::testing::Test {};
+TYPED_TEST_SUITE(OpenMPPredictKernelDeathTest, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(OpenMPPredictKernelDeathTest, polynomial) {
+    using real_type = TypeParam;
+
+    const std::vector<std::vector<real_type>> support_vectors = generate_random_matrix<real_type>(2, 2);
+    const std::vector<real_type> alpha(2, real_type{ 1.0 });
+    const std::vector<std::vector<real_type>> predict_points = generate_random_matrix<real_type>(3, 2);
+
+    // the out vector must contain one value per data point to predict
+    std::vector<real_type> out(2);
+    EXPECT_DEATH(plssvm::openmp::device_kernel_predict_polynomial(out, support_vectors, alpha, predict_points, 3, real_type{ 0.1 }, real_type{ 1.0 }), ::testing::HasSubstr("Sizes mismatch!: 2 != 3"));
+}
+TYPED_TEST(OpenMPPredictKernelDeathTest, rbf) {
+    using real_type = TypeParam;
+
+    const std::vector<std::vector<real_type>> support_vectors = generate_random_matrix<real_type>(2, 2);
+    const std::vector<real_type> alpha(1, real_type{ 1.0 });
+    const std::vector<std::vector<real_type>> predict_points = generate_random_matrix<real_type>(3, 2);
+
+    // the number of weights must match the number of support vectors
+    std::vector<real_type> out(3);
+    EXPECT_DEATH(plssvm::openmp::device_kernel_predict_rbf(out, support_vectors, alpha, predict_points, real_type{ 0.1 }), ::testing::HasSubstr("Sizes mismatch!: 2 != 1"));
+}
@@ -10,13 +10,170 @@
 
 #include "plssvm/backends/OpenMP/svm_kernel.hpp"
 
-#include "../../naming.hpp"         // naming::real_type_to_name
-#include "../../types_to_test.hpp"  // util::real_type_gtest
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"  // plssvm::openmp::thread_pinning
+#include "plssvm/constants.hpp"                       // plssvm::{kernel_index_type, OPENMP_BLOCK_SIZE}
+#include "plssvm/detail/ball_tree.hpp"                // plssvm::detail::ball_tree
 
-#include "gmock/gmock-matchers.h"   // ::testing::HasSubstr
-#include "gtest/gtest.h"            // TYPED_TEST, TYPED_TEST_SUITE, EXPECT_DEATH, ::testing::Test
+#include "../../custom_test_macros.hpp"               // EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS
+#include "../../naming.hpp"                           // naming::real_type_to_name
+#include "../../types_to_test.hpp"                    // util::real_type_gtest
+#include "../../utility.hpp"                          // util::generate_random_vector
 
-#include <vector>                   // std::vector
+#include "gmock/gmock-matchers.h"                     // ::testing::HasSubstr
+#include "gtest/gtest.h"                              // TEST, TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_NE, EXPECT_LE, EXPECT_TRUE, EXPECT_FALSE, EXPECT_DEATH, ::testing::Test
+
+#include <algorithm>                                  // std::{is_sorted, adjacent_find, find}
+#include <cmath>                                      // std::abs
+#include <cstddef>                                    // std::size_t
+#include <limits>                                     // std::numeric_limits
+#include <tuple>                                      // std::ignore
+#include <vector>                                     // std::vector
+
+TEST(OpenMPSVMKernel, calculate_kernel_row_range) {
+    for (const std::size_t row_begin : { std::size_t{ 0 }, std::size_t{ 300 } }) {
+        const std::size_t row_end = 1000;
+        // the number of entries in the rows [row_begin, row_end) of the lower triangular matrix
+        const std::size_t total_num_entries = (row_end * (row_end + 1) - row_begin * (row_begin + 1)) / 2;
+        for (const int num_parts : { 1, 2, 3, 4, 7 }) {
+            std::size_t expected_first = row_begin;
+            for (int part = 0; part < num_parts; ++part) {
+                const auto [first, last] = plssvm::openmp::calculate_kernel_row_range(row_begin, row_end, part, num_parts);
+                // the row ranges must be consecutive
+                EXPECT_EQ(first, expected_first);
+                EXPECT_LE(first, last);
+                expected_first = last;
+
+                // each part must contain roughly the same number of entries of the lower triangular kernel matrix (at most one row more or less)
+                const std::size_t num_entries = (last * (last + 1) - first * (first + 1)) / 2;
+                const std::size_t expected_num_entries = total_num_entries / static_cast<std::size_t>(num_parts);
+                EXPECT_LE(num_entries, expected_num_entries + row_end);
+                EXPECT_LE(expected_num_entries, num_entries + row_end);
+            }
+            // all rows must be covered
+            EXPECT_EQ(expected_first, row_end);
+        }
+    }
+}
+TEST(OpenMPSVMKernel, calculate_kernel_row_range_more_parts_than_rows) {
+    const int num_parts = 8;
+    std::size_t expected_first = 0;
+    for (int part = 0; part < num_parts; ++part) {
+        const auto [first, last] = plssvm::openmp::calculate_kernel_row_range(0, 3, part, num_parts);
+        // some parts don't contain any rows
+        EXPECT_EQ(first, expected_first);
+        EXPECT_LE(first, last);
+        expected_first = last;
+    }
+    EXPECT_EQ(expected_first, 3);
+}
+
+TEST(OpenMPSVMKernel, supported_block_sizes) {
+    const std::vector<plssvm::kernel_index_type> block_sizes = plssvm::openmp::supported_block_sizes();
+    // the block sizes must be sorted, unique, and contain the default block size
+    EXPECT_TRUE(std::is_sorted(block_sizes.cbegin(), block_sizes.cend()));
+    EXPECT_EQ(std::adjacent_find(block_sizes.cbegin(), block_sizes.cend()), block_sizes.cend());
+    EXPECT_NE(std::find(block_sizes.cbegin(), block_sizes.cend(), plssvm::OPENMP_BLOCK_SIZE), block_sizes.cend());
+    for (const plssvm::kernel_index_type block_size : block_sizes) {
+        EXPECT_TRUE(plssvm::openmp::is_supported_block_size(block_size));
+    }
+}
+TEST(OpenMPSVMKernel, is_supported_block_size) {
+    EXPECT_TRUE(plssvm::openmp::is_supported_block_size(plssvm::OPENMP_BLOCK_SIZE));
+    EXPECT_FALSE(plssvm::openmp::is_supported_block_size(0));
+    EXPECT_FALSE(plssvm::openmp::is_supported_block_size(-64));
+    EXPECT_FALSE(plssvm::openmp::is_supported_block_size(17));
+}
+
+template <typename T>
+class OpenMPSVMKernelBlockSize : public ::testing::Test {};
+TYPED_TEST_SUITE(OpenMPSVMKernelBlockSize, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(OpenMPSVMKernelBlockSize, device_kernel) {
+    using real_type = TypeParam;
+
+    // use a number of data points that isn't a multiple of any block size
+    std::vector<std::vector<real_type>> data(301);
+    for (std::vector<real_type> &point : data) {
+        point = util::generate_random_vector<real_type>(7);
+    }
+    const std::vector<real_type> q = util::generate_random_vector<real_type>(data.size() - 1);
+    const std::vector<real_type> d = util::generate_random_vector<real_type>(data.size() - 1);
+    const real_type QA_cost{ 0.5 };
+    const real_type cost{ 1.0 };
+    const real_type add{ 1.0 };
+
+    // calculate the results using the default block size
+    std::vector<real_type> ground_truth_linear(data.size() - 1);
+    plssvm::openmp::device_kernel_linear(q, ground_truth_linear, d, data, QA_cost, cost, add);
+    std::vector<real_type> ground_truth_rbf(data.size() - 1);
+    plssvm::openmp::device_kernel_rbf(q, ground_truth_rbf, d, data, QA_cost, cost, add, real_type{ 0.1 });
+
+    // all supported block sizes must yield the same results (up to the different summation order)
+    for (const plssvm::kernel_index_type block_size : plssvm::openmp::supported_block_sizes()) {
+        std::vector<real_type> linear(data.size() - 1);
+        plssvm::openmp::device_kernel_linear(q, linear, d, data, QA_cost, cost, add, 0, linear.size(), {}, plssvm::openmp::thread_pinning::none, block_size);
+        EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(linear, ground_truth_linear, real_type{ 1.0e6 });
+
+        std::vector<real_type> rbf(data.size() - 1);
+        plssvm::openmp::device_kernel_rbf(q, rbf, d, data, QA_cost, cost, add, 0, rbf.size(), real_type{ 0.1 }, {}, plssvm::openmp::thread_pinning::none, block_size);
+        EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(rbf, ground_truth_rbf, real_type{ 1.0e6 });
+    }
+}
+
+template <typename T>
+class OpenMPSVMKernelBallTree : public ::testing::Test {};
+TYPED_TEST_SUITE(OpenMPSVMKernelBallTree, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(OpenMPSVMKernelBallTree, device_kernel_rbf_ball_tree) {
+    using real_type = TypeParam;
+
+    // the ball tree is only effective for data with few features
+    std::vector<std::vector<real_type>> data(1001);
+    for (std::vector<real_type> &point : data) {
+        point = util::generate_random_vector<real_type>(3, real_type{ -10.0 }, real_type{ 10.0 });
+    }
+    const std::vector<real_type> q = util::generate_random_vector<real_type>(data.size() - 1);
+    const std::vector<real_type> d = util::generate_random_vector<real_type>(data.size() - 1);
+    const real_type QA_cost{ 0.5 };
+    const real_type cost{ 1.0 };
+    const real_type gamma{ 1.0 };
+    real_type d_abs_sum{ 0.0 };
+    for (const real_type val : d) {
+        d_abs_sum += std::abs(val);
+    }
+
+    plssvm::detail::ball_tree<real_type> tree{ data, std::vector<real_type>(data.size()) };
+    for (const real_type add : { real_type{ -1.0 }, real_type{ 1.0 } }) {
+        std::vector<real_type> ground_truth(data.size() - 1);
+        plssvm::openmp::device_kernel_rbf(q, ground_truth, d, data, QA_cost, cost, add, gamma);
+
+        // the error of each entry must be within the reported error bound (plus rounding errors) which may never exceed the tolerance
+        for (const real_type tolerance : { real_type{ 1.0e-6 }, real_type{ 1.0e-3 }, real_type{ 1.0e-1 } }) {
+            std::vector<real_type> approximated(data.size() - 1);
+            const real_type error_bound = plssvm::openmp::device_kernel_rbf_ball_tree(q, approximated, d, data, tree, QA_cost, cost, add, gamma, tolerance);
+            EXPECT_LE(error_bound, tolerance * d_abs_sum);
+            for (std::size_t i = 0; i < approximated.size(); ++i) {
+                EXPECT_LE(std::abs(approximated[i] - ground_truth[i]), error_bound + real_type{ 1.0e3 } * std::numeric_limits<real_type>::epsilon() * d_abs_sum);
+            }
+        }
+    }
+}
+TYPED_TEST(OpenMPSVMKernelBallTree, device_kernel_rbf_ball_tree_stop_requested) {
+    using real_type = TypeParam;
+
+    std::vector<std::vector<real_type>> data(101);
+    for (std::vector<real_type> &point : data) {
+        point = util::generate_random_vector<real_type>(2);
+    }
+    const std::vector<real_type> q = util::generate_random_vector<real_type>(data.size() - 1);
+    const std::vector<real_type> d = util::generate_random_vector<real_type>(data.size() - 1);
+    plssvm::detail::ball_tree<real_type> tree{ data, std::vector<real_type>(data.size()) };
+
+    // if the calculation should be stopped, all rows are skipped
+    std::vector<real_type> ret(data.size() - 1);
+    std::ignore = plssvm::openmp::device_kernel_rbf_ball_tree(q, ret, d, data, tree, real_type{ 0.5 }, real_type{ 1.0 }, real_type{ 1.0 }, real_type{ 1.0 }, real_type{ 1.0e-3 }, []() { return true; });
+    EXPECT_EQ(ret, std::vector<real_type>(data.size() - 1, real_type{ 0.0 }));
+}
 
 template <typename T>
 class OpenMPSVMKernelDeathTest : public ::testing::Test {};
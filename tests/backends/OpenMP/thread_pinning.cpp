@@ -0,0 +1,47 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for functions related to the different OpenMP thread pinning policies.
+ */
+
+#include "plssvm/backends/OpenMP/thread_pinning.hpp"  // plssvm::openmp::thread_pinning
+
+#include "../../custom_test_macros.hpp"               // EXPECT_CONVERSION_TO_STRING, EXPECT_CONVERSION_FROM_STRING
+
+#include "gtest/gtest.h"                              // TEST, EXPECT_TRUE
+
+#include <sstream>                                    // std::istringstream
+
+// check whether the plssvm::openmp::thread_pinning -> std::string conversions are correct
+TEST(OpenMPThreadPinning, to_string) {
+    // check conversions to std::string
+    EXPECT_CONVERSION_TO_STRING(plssvm::openmp::thread_pinning::none, "none");
+    EXPECT_CONVERSION_TO_STRING(plssvm::openmp::thread_pinning::close, "close");
+    EXPECT_CONVERSION_TO_STRING(plssvm::openmp::thread_pinning::spread, "spread");
+}
+TEST(OpenMPThreadPinning, to_string_unknown) {
+    // check conversions to std::string from unknown thread_pinning
+    EXPECT_CONVERSION_TO_STRING(static_cast<plssvm::openmp::thread_pinning>(3), "unknown");
+}
+
+// check whether the std::string -> plssvm::openmp::thread_pinning conversions are correct
+TEST(OpenMPThreadPinning, from_string) {
+    // check conversion from std::string
+    EXPECT_CONVERSION_FROM_STRING("none", plssvm::openmp::thread_pinning::none);
+    EXPECT_CONVERSION_FROM_STRING("NONE", plssvm::openmp::thread_pinning::none);
+    EXPECT_CONVERSION_FROM_STRING("close", plssvm::openmp::thread_pinning::close);
+    EXPECT_CONVERSION_FROM_STRING("CLOSE", plssvm::openmp::thread_pinning::close);
+    EXPECT_CONVERSION_FROM_STRING("spread", plssvm::openmp::thread_pinning::spread);
+    EXPECT_CONVERSION_FROM_STRING("SPREAD", plssvm::openmp::thread_pinning::spread);
+}
+TEST(OpenMPThreadPinning, from_string_unknown) {
+    // foo isn't a valid thread_pinning
+    std::istringstream input{ "foo" };
+    plssvm::openmp::thread_pinning pinning{};
+    input >> pinning;
+    EXPECT_TRUE(input.fail());
+}
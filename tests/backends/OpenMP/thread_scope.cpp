@@ -0,0 +1,155 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the RAII guard restricting the OpenMP threads to a number of threads and a set of CPUs.
+ */
+
+#include "plssvm/backends/OpenMP/exceptions.hpp"    // plssvm::openmp::backend_exception
+#include "plssvm/backends/OpenMP/thread_scope.hpp"  // plssvm::openmp::thread_scope
+
+#include "../../custom_test_macros.hpp"             // EXPECT_THROW_WHAT
+
+#include "fmt/core.h"                               // fmt::format
+#include "gtest/gtest.h"                            // TEST, EXPECT_EQ, EXPECT_TRUE, ASSERT_EQ
+
+#include "omp.h"                                    // omp_get_max_threads, omp_get_num_threads, omp_get_thread_num
+
+#if defined(__linux__)
+    #include <sched.h>                              // cpu_set_t, CPU_SETSIZE, CPU_EQUAL, sched_getcpu, sched_getaffinity
+#endif
+
+#include <cstddef>                                  // std::size_t
+#include <thread>                                   // std::thread
+#include <vector>                                   // std::vector
+
+namespace {
+
+/**
+ * @brief Return the number of threads in a team of a new OpenMP parallel region started by the calling thread.
+ * @return the number of threads (`[[nodiscard]]`)
+ */
+[[nodiscard]] int team_size() {
+    int num_threads = 0;
+    #pragma omp parallel default(none) shared(num_threads)
+    {
+        #pragma omp master
+        num_threads = omp_get_num_threads();
+    }
+    return num_threads;
+}
+
+}  // namespace
+
+TEST(OpenMPThreadScope, num_threads) {
+    const int previous_num_threads = omp_get_max_threads();
+    {
+        const plssvm::openmp::thread_scope scope{ previous_num_threads + 2 };
+        EXPECT_EQ(scope.num_threads(), previous_num_threads + 2);
+        // all parallel regions started by the calling thread must use the number of threads of the scope
+        EXPECT_EQ(omp_get_max_threads(), previous_num_threads + 2);
+        EXPECT_EQ(team_size(), previous_num_threads + 2);
+    }
+    // the previous number of threads must be restored
+    EXPECT_EQ(omp_get_max_threads(), previous_num_threads);
+}
+TEST(OpenMPThreadScope, num_threads_default) {
+    // if no number of threads is provided, the current number of threads is used
+    const int previous_num_threads = omp_get_max_threads();
+    const plssvm::openmp::thread_scope scope{ 0 };
+    EXPECT_EQ(scope.num_threads(), previous_num_threads);
+    EXPECT_EQ(omp_get_max_threads(), previous_num_threads);
+}
+TEST(OpenMPThreadScope, num_threads_negative) {
+    const int previous_num_threads = omp_get_max_threads();
+    EXPECT_THROW_WHAT(plssvm::openmp::thread_scope{ -1 },
+                      plssvm::openmp::backend_exception,
+                      "The number of OpenMP threads must be greater or equal than 0, but is -1!");
+    EXPECT_EQ(omp_get_max_threads(), previous_num_threads);
+}
+TEST(OpenMPThreadScope, num_threads_concurrent) {
+    // the number of threads only affects the calling thread, i.e., concurrent scopes don't interfere
+    std::vector<int> team_sizes(2);
+    const auto worker = [&team_sizes](const int id) {
+        const plssvm::openmp::thread_scope scope{ id + 2 };
+        // repeatedly start parallel regions while the other worker is running
+        for (int i = 0; i < 100; ++i) {
+            if (team_size() != id + 2) {
+                return;
+            }
+        }
+        team_sizes[static_cast<std::size_t>(id)] = team_size();
+    };
+    std::thread first{ worker, 0 };
+    std::thread second{ worker, 1 };
+    first.join();
+    second.join();
+
+    EXPECT_EQ(team_sizes[0], 2);
+    EXPECT_EQ(team_sizes[1], 3);
+}
+
+#if defined(__linux__)
+
+TEST(OpenMPThreadScope, cpu_set) {
+    // remember the affinity of the calling thread
+    cpu_set_t previous_mask;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &previous_mask), 0);
+
+    // the CPU the calling thread is running on is always available
+    const int cpu = sched_getcpu();
+    {
+        const plssvm::openmp::thread_scope scope{ 0, { cpu } };
+        // by default, one thread per CPU is used
+        EXPECT_EQ(scope.num_threads(), 1);
+    }
+    {
+        const plssvm::openmp::thread_scope scope{ 3, { cpu } };
+        EXPECT_EQ(scope.num_threads(), 3);
+
+        // all threads must run on the CPU of the CPU set
+        std::vector<int> cpus(3, -1);
+        #pragma omp parallel default(none) shared(cpus)
+        cpus[static_cast<std::size_t>(omp_get_thread_num())] = sched_getcpu();
+        EXPECT_EQ(cpus, (std::vector<int>(3, cpu)));
+    }
+
+    // the previous affinity must be restored
+    cpu_set_t mask;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &mask), 0);
+    EXPECT_TRUE(CPU_EQUAL(&mask, &previous_mask));
+}
+TEST(OpenMPThreadScope, cpu_set_invalid_cpu) {
+    EXPECT_THROW_WHAT((plssvm::openmp::thread_scope{ 0, { 0, -1 } }),
+                      plssvm::openmp::backend_exception,
+                      "Invalid CPU -1 in the CPU set [0, -1]!");
+}
+TEST(OpenMPThreadScope, cpu_set_unavailable_cpu) {
+    const int previous_num_threads = omp_get_max_threads();
+    cpu_set_t previous_mask;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &previous_mask), 0);
+
+    // the last possible CPU isn't available on any test system
+    EXPECT_THROW_WHAT((plssvm::openmp::thread_scope{ 2, { CPU_SETSIZE - 1 } }),
+                      plssvm::openmp::backend_exception,
+                      fmt::format("Can't bind the OpenMP threads to the CPU set [{}]!", CPU_SETSIZE - 1));
+
+    // all changes must have been undone
+    EXPECT_EQ(omp_get_max_threads(), previous_num_threads);
+    cpu_set_t mask;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &mask), 0);
+    EXPECT_TRUE(CPU_EQUAL(&mask, &previous_mask));
+}
+
+#else
+
+TEST(OpenMPThreadScope, cpu_set_unsupported) {
+    EXPECT_THROW_WHAT((plssvm::openmp::thread_scope{ 0, { 0 } }),
+                      plssvm::openmp::backend_exception,
+                      "Binding the OpenMP threads to a CPU set is currently only supported on Linux!");
+}
+
+#endif
@@ -31,7 +31,10 @@ class mock_dpcpp_csvm final : public plssvm::dpcpp::csvm {
 
     // make protected member functions public
     using base_type::calculate_w;
+    using base_type::device_axpy;
+    using base_type::device_dot;
     using base_type::device_reduction;
+    using base_type::device_xpby;
     using base_type::generate_q;
     using base_type::predict_values;
     using base_type::run_device_kernel;
@@ -13,16 +13,20 @@
 #define PLSSVM_TESTS_BACKENDS_GENERIC_TESTS_HPP_
 #pragma once
 
+#include "plssvm/cancellation_token.hpp"     // plssvm::cancellation_token
 #include "plssvm/constants.hpp"              // plssvm::THREAD_BLOCK_SIZE, plssvm::INTERNAL_BLOCK_SIZE;
 #include "plssvm/data_set.hpp"               // plssvm::data_set
 #include "plssvm/detail/layout.hpp"          // plssvm::detail::{layout_type, transform_to_layout}
 #include "plssvm/detail/operators.hpp"       // operators namespace
+#include "plssvm/detail/solver_control.hpp"  // plssvm::detail::solver_control
+#include "plssvm/iteration_info.hpp"         // plssvm::iteration_info
 #include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type
 #include "plssvm/model.hpp"                  // plssvm::model
 #include "plssvm/parameter.hpp"              // plssvm::cost, plssvm::kernel_type, plssvm::parameter, plssvm::detail::parameter
+#include "plssvm/solver_types.hpp"           // plssvm::solver_type
 
 #include "../custom_test_macros.hpp"         // EXPECT_FLOATING_POINT_NEAR, EXPECT_FLOATING_POINT_VECTOR_NEAR, EXPECT_FLOATING_POINT_VECTOR_EQ
-#include "../utility.hpp"                    // util::{redirect_output, generate_random_vector, construct_from_tuple}
+#include "../utility.hpp"                    // util::{redirect_output, generate_random_vector, construct_from_tuple, temporary_file}
 #include "compare.hpp"                       // compare::{generate_q, calculate_w, kernel_function, device_kernel_function}
 
 #include "fmt/format.h"                      // fmt::format
@@ -31,6 +35,8 @@
 #include "gtest/gtest.h"                     // ASSERT_EQ, EXPECT_EQ, EXPECT_NE, EXPECT_TRUE, TYPED_TEST_SUITE_P, TYPED_TEST_P, REGISTER_TYPED_TEST_SUITE_P,
                                              // ::testing::Test
 
+#include <algorithm>                         // std::is_sorted
+#include <chrono>                            // std::chrono::{steady_clock, milliseconds}
 #include <cmath>                             // std::sqrt, std::abs
 #include <cstddef>                           // std::size_t
 #include <fstream>                           // std::ifstream
@@ -128,7 +134,7 @@ TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_trivial) {
     // | Q  1 |  *  | a |  =  | y |
     // | 1  0 |     | b |     | 0 |
     // with Q = A^TA
-    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size());
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), plssvm::detail::solver_control<real_type>{});
 
     // check the calculated result for correctness
     EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated_x, rhs);
@@ -136,6 +142,375 @@ TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_trivial) {
     EXPECT_FLOATING_POINT_NEAR(std::abs(calculated_rho) - std::numeric_limits<real_type>::epsilon(), std::numeric_limits<real_type>::epsilon());
 }
 
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_warm_start) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel, plssvm::cost = 2.0 };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 1.0;
+        params.gamma = 1.0;
+        params.coef0 = 0.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        GTEST_SKIP() << "solve_system_of_linear_equations_warm_start currently doesn't work with the rbf kernel!";
+    }
+
+    // create the data that should be used
+    // Matrix with 1-1/cost on main diagonal. Thus, the diagonal entries become one with the additional addition of 1/cost
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) } },
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 } };
+
+    // the initial guess used to warm start the CG algorithm (one value less than data points due to the dimensional reduction)
+    plssvm::detail::solver_control<real_type> control{};
+    control.initial_guess = std::vector<real_type>{ real_type{ 0.5 }, real_type{ -0.5 }, real_type{ 0.5 } };
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations_impl is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    // solve the system of linear equations using the warm started CG algorithm
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), control);
+
+    // check the calculated result for correctness
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated_x, rhs);
+    EXPECT_NEAR(calculated_rho, real_type{ 0.0 }, real_type{ 10.0 } * std::numeric_limits<real_type>::epsilon());
+}
+
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_pipelined) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel, plssvm::cost = 2.0 };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 1.0;
+        params.gamma = 1.0;
+        params.coef0 = 0.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        GTEST_SKIP() << "solve_system_of_linear_equations_pipelined currently doesn't work with the rbf kernel!";
+    }
+
+    // create the data that should be used
+    // Matrix with 1-1/cost on main diagonal. Thus, the diagonal entries become one with the additional addition of 1/cost
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) } },
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 } };
+
+    // use the pipelined CG algorithm
+    plssvm::detail::solver_control<real_type> control{};
+    control.solver = plssvm::solver_type::pipelined_cg;
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations_impl is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    // solve the system of linear equations using the pipelined CG algorithm
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), control);
+
+    // check the calculated result for correctness
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated_x, rhs);
+    EXPECT_NEAR(calculated_rho, real_type{ 0.0 }, real_type{ 10.0 } * std::numeric_limits<real_type>::epsilon());
+}
+
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_iteration_callback) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel, plssvm::cost = 2.0 };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 1.0;
+        params.gamma = 1.0;
+        params.coef0 = 0.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        GTEST_SKIP() << "solve_system_of_linear_equations_iteration_callback currently doesn't work with the rbf kernel!";
+    }
+
+    // create the data that should be used
+    // Matrix with 1-1/cost on main diagonal. Thus, the diagonal entries become one with the additional addition of 1/cost
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) } },
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 } };
+
+    // record the information passed to the iteration callback
+    std::vector<plssvm::iteration_info> infos{};
+    plssvm::detail::solver_control<real_type> control{};
+    control.iteration_callback = [&infos](const plssvm::iteration_info &info) {
+        infos.push_back(info);
+        return true;
+    };
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations_impl is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    // solve the system of linear equations
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), control);
+
+    // check the calculated result for correctness
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated_x, rhs);
+    EXPECT_NEAR(calculated_rho, real_type{ 0.0 }, real_type{ 10.0 } * std::numeric_limits<real_type>::epsilon());
+
+    // the iteration callback must have been called once per CG iteration
+    ASSERT_FALSE(infos.empty());
+    for (std::size_t i = 0; i < infos.size(); ++i) {
+        EXPECT_EQ(infos[i].iteration, i + 1);
+        EXPECT_EQ(infos[i].max_iter, A.front().size());
+        EXPECT_GE(infos[i].elapsed_time, infos[i].iteration_time);
+        EXPECT_GE(infos[i].iteration_time, infos[i].matrix_vector_time);
+    }
+    // the last iteration must have reached the target residual
+    EXPECT_LE(infos.back().residual, infos.back().target_residual);
+    EXPECT_TRUE(control.converged);
+}
+
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_iteration_callback_stop) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel, plssvm::cost = 2.0 };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 1.0;
+        params.gamma = 1.0;
+        params.coef0 = 0.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        GTEST_SKIP() << "solve_system_of_linear_equations_iteration_callback_stop currently doesn't work with the rbf kernel!";
+    }
+
+    // create the data that should be used
+    // Matrix with 1-1/cost on main diagonal. Thus, the diagonal entries become one with the additional addition of 1/cost
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) } },
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 } };
+
+    // stop the CG algorithm after the first iteration
+    unsigned long long num_calls = 0;
+    plssvm::detail::solver_control<real_type> control{};
+    control.iteration_callback = [&num_calls](const plssvm::iteration_info &info) {
+        ++num_calls;
+        EXPECT_EQ(info.iteration, 1);
+        return false;
+    };
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations_impl is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    // solve the system of linear equations
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), control);
+
+    // the iteration callback must have been called exactly once
+    EXPECT_EQ(num_calls, 1);
+    EXPECT_EQ(calculated_x.size(), rhs.size());
+}
+
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_cancellation) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel, plssvm::cost = 2.0 };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 1.0;
+        params.gamma = 1.0;
+        params.coef0 = 0.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        GTEST_SKIP() << "solve_system_of_linear_equations_cancellation currently doesn't work with the rbf kernel!";
+    }
+
+    // create the data that should be used
+    // Matrix with 1-1/cost on main diagonal. Thus, the diagonal entries become one with the additional addition of 1/cost
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) } },
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 } };
+
+    // cancel the CG algorithm before it has been started
+    plssvm::cancellation_token token{};
+    token.cancel();
+    plssvm::detail::solver_control<real_type> control{};
+    control.cancellation = token;
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations_impl is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    // solve the system of linear equations
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), control);
+
+    // the CG algorithm must have been stopped before the first iteration -> the initial guess (all ones) is returned and flagged as not converged
+    EXPECT_FALSE(control.converged);
+    EXPECT_EQ(calculated_x.size(), rhs.size());
+    EXPECT_FLOATING_POINT_VECTOR_EQ(calculated_x, (std::vector<real_type>{ real_type{ 1.0 }, real_type{ 1.0 }, real_type{ 1.0 }, real_type{ -3.0 } }));
+}
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_deadline) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel, plssvm::cost = 2.0 };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 1.0;
+        params.gamma = 1.0;
+        params.coef0 = 0.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        GTEST_SKIP() << "solve_system_of_linear_equations_deadline currently doesn't work with the rbf kernel!";
+    }
+
+    // create the data that should be used
+    // Matrix with 1-1/cost on main diagonal. Thus, the diagonal entries become one with the additional addition of 1/cost
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) } },
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 } };
+
+    // the deadline has already been exceeded before the CG algorithm has been started
+    plssvm::detail::solver_control<real_type> control{};
+    control.deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds{ 1 };
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations_impl is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    // solve the system of linear equations
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), control);
+
+    // the CG algorithm must have been stopped before the first iteration -> the initial guess (all ones) is returned and flagged as not converged
+    EXPECT_FALSE(control.converged);
+    EXPECT_EQ(calculated_x.size(), rhs.size());
+    EXPECT_FLOATING_POINT_VECTOR_EQ(calculated_x, (std::vector<real_type>{ real_type{ 1.0 }, real_type{ 1.0 }, real_type{ 1.0 }, real_type{ -3.0 } }));
+}
+
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_checkpoint_resume) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel, plssvm::cost = 2.0 };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 1.0;
+        params.gamma = 1.0;
+        params.coef0 = 0.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        GTEST_SKIP() << "solve_system_of_linear_equations_checkpoint_resume currently doesn't work with the rbf kernel!";
+    }
+
+    // create the data that should be used
+    // Matrix with distinct values on the main diagonal such that the CG algorithm needs more than one iteration
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ std::sqrt(real_type(2.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(3.0) - 1 / params.cost) }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(4.0) - 1 / params.cost) } },
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 } };
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations_impl is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    for (const plssvm::solver_type solver : { plssvm::solver_type::cg, plssvm::solver_type::pipelined_cg }) {
+        // solve the system of linear equations without any interruption as reference
+        plssvm::detail::solver_control<real_type> reference_control{};
+        reference_control.solver = solver;
+        const auto [correct_x, correct_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), reference_control);
+
+        // stop the CG algorithm after the first iteration -> the state must be written to the checkpoint file
+        const util::temporary_file checkpoint_file{};
+        plssvm::detail::solver_control<real_type> control{};
+        control.solver = solver;
+        control.checkpoint_file = checkpoint_file.filename;
+        control.checkpoint_interval = 1;
+        control.iteration_callback = [](const plssvm::iteration_info &) { return false; };
+        std::ignore = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), control);
+        ASSERT_FALSE(control.converged);
+
+        // resume the CG algorithm from the checkpoint -> the first iteration must not be repeated
+        std::vector<unsigned long long> iterations{};
+        control.resume = true;
+        control.iteration_callback = [&iterations](const plssvm::iteration_info &info) {
+            iterations.push_back(info.iteration);
+            return true;
+        };
+        const auto [calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), control);
+
+        // check the calculated result for correctness
+        EXPECT_TRUE(control.converged);
+        ASSERT_FALSE(iterations.empty());
+        EXPECT_EQ(iterations.front(), 2);
+        EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated_x, correct_x);
+        EXPECT_FLOATING_POINT_NEAR(calculated_rho, correct_rho);
+    }
+}
+
+TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations_mixed_precision) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    plssvm::detail::parameter<real_type> params{ plssvm::kernel_type = kernel, plssvm::cost = 2.0 };
+    if constexpr (kernel == plssvm::kernel_function_type::polynomial) {
+        params.degree = 1.0;
+        params.gamma = 1.0;
+        params.coef0 = 0.0;
+    } else if constexpr (kernel == plssvm::kernel_function_type::rbf) {
+        GTEST_SKIP() << "solve_system_of_linear_equations_mixed_precision currently doesn't work with the rbf kernel!";
+    }
+
+    // create the data that should be used
+    // Matrix with 1-1/cost on main diagonal. Thus, the diagonal entries become one with the additional addition of 1/cost
+    const std::vector<std::vector<real_type>> A = {
+        { real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) }, real_type{ 0.0 } },
+        { real_type{ 0.0 }, real_type{ 0.0 }, real_type{ 0.0 }, real_type{ std::sqrt(real_type(1.0) - 1 / params.cost) } },
+    };
+    const std::vector<real_type> rhs{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 }, real_type{ -1.0 } };
+
+    // perform the kernel matrix-vector multiplications in single precision (only has an effect if real_type is double)
+    plssvm::detail::solver_control<real_type> control{};
+    control.mixed_precision = true;
+
+    // create C-SVM: must be done using the mock class, since solve_system_of_linear_equations_impl is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(params, TypeParam::additional_arguments);
+
+    // solve the system of linear equations using the mixed precision CG algorithm
+    const auto &[calculated_x, calculated_rho] = svm.solve_system_of_linear_equations(params, A, rhs, real_type{ 0.00001 }, A.front().size(), control);
+
+    // the kernel matrix is only represented in single precision -> the solution is only exact up to the requested relative residual
+    ASSERT_EQ(calculated_x.size(), rhs.size());
+    for (std::size_t i = 0; i < rhs.size(); ++i) {
+        EXPECT_NEAR(calculated_x[i], rhs[i], real_type{ 0.00001 }) << fmt::format("values at [{}] are not equal enough", i);
+    }
+    EXPECT_NEAR(calculated_rho, real_type{ 0.0 }, real_type{ 0.00001 });
+}
+
 TYPED_TEST_P(GenericCSVM, solve_system_of_linear_equations) {
     GTEST_SKIP() << "currently not implemented";
     // TODO: add non-trivial test
@@ -250,7 +625,7 @@ TYPED_TEST_P(GenericCSVM, score) {
 REGISTER_TYPED_TEST_SUITE_P(GenericCSVM,
                             move_constructor, move_assignment,
                             get_target_platform,
-                            solve_system_of_linear_equations_trivial, solve_system_of_linear_equations, solve_system_of_linear_equations_with_correction,
+                            solve_system_of_linear_equations_trivial, solve_system_of_linear_equations_warm_start, solve_system_of_linear_equations_mixed_precision, solve_system_of_linear_equations_pipelined, solve_system_of_linear_equations_iteration_callback, solve_system_of_linear_equations_iteration_callback_stop, solve_system_of_linear_equations_cancellation, solve_system_of_linear_equations_deadline, solve_system_of_linear_equations_checkpoint_resume, solve_system_of_linear_equations, solve_system_of_linear_equations_with_correction,
                             predict_values, predict, score);
 // clang-format on
 
@@ -277,13 +652,13 @@ TYPED_TEST_P(GenericCSVMDeathTest, solve_system_of_linear_equations) {
     const std::vector<real_type> b{ real_type{ 1.0 }, real_type{ 2.0 } };
 
     // empty data is not allowed
-    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{}, b, real_type{ 0.1 }, 2),
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{}, b, real_type{ 0.1 }, 2, plssvm::detail::solver_control<real_type>{}),
                  "The data must not be empty!");
     // empty features are not allowed
-    EXPECT_DEATH(std::ignore = (svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{ std::vector<real_type>{} }, b, real_type{ 0.1 }, 2)),
+    EXPECT_DEATH(std::ignore = (svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{ std::vector<real_type>{} }, b, real_type{ 0.1 }, 2, plssvm::detail::solver_control<real_type>{})),
                  "The data points must contain at least one feature!");
     // all data points must have the same number of features
-    EXPECT_DEATH(std::ignore = (svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{ std::vector<real_type>{ real_type{ 1.0 } }, std::vector<real_type>{ real_type{ 1.0 }, real_type{ 2.0 } } }, b, real_type{ 0.1 }, 2)),
+    EXPECT_DEATH(std::ignore = (svm.solve_system_of_linear_equations(params, std::vector<std::vector<real_type>>{ std::vector<real_type>{ real_type{ 1.0 } }, std::vector<real_type>{ real_type{ 1.0 }, real_type{ 2.0 } } }, b, real_type{ 0.1 }, 2, plssvm::detail::solver_control<real_type>{})),
                  "All data points must have the same number of features!");
 
     const std::vector<std::vector<real_type>> data = {
@@ -292,16 +667,21 @@ TYPED_TEST_P(GenericCSVMDeathTest, solve_system_of_linear_equations) {
     };
 
     // the number of data points and values in b must be the same
-    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, std::vector<real_type>{}, 0.1, 2),
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, std::vector<real_type>{}, 0.1, 2, plssvm::detail::solver_control<real_type>{}),
                  ::testing::HasSubstr("The number of data points in the matrix A (2) and the values in the right hand side vector (0) must be the same!"));
     // the stopping criterion must be greater than zero
-    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ 0.0 }, 2),
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ 0.0 }, 2, plssvm::detail::solver_control<real_type>{}),
                  "The stopping criterion in the CG algorithm must be greater than 0.0, but is 0!");
-    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ -0.1 }, 2),
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ -0.1 }, 2, plssvm::detail::solver_control<real_type>{}),
                  "The stopping criterion in the CG algorithm must be greater than 0.0, but is -0.1!");
     // at least one CG iteration must be performed
-    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ 0.1 }, 0),
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ 0.1 }, 0, plssvm::detail::solver_control<real_type>{}),
                  "The number of CG iterations must be greater than 0!");
+    // the initial guess must either be empty or contain exactly one value less than data points are present
+    plssvm::detail::solver_control<real_type> control{};
+    control.initial_guess = std::vector<real_type>(3);
+    EXPECT_DEATH(std::ignore = svm.solve_system_of_linear_equations(params, data, b, real_type{ 0.1 }, 2, control),
+                 ::testing::HasSubstr("The initial guess must either be empty or contain exactly one value less than data points are present!: 3 != 1"));
 }
 
 TYPED_TEST_P(GenericCSVMDeathTest, predict_values) {
@@ -386,10 +766,10 @@ TYPED_TEST_P(GenericGPUCSVM, generate_q) {
     // perform the data setup on the device
     constexpr auto boundary_size = static_cast<std::size_t>(plssvm::THREAD_BLOCK_SIZE * plssvm::INTERNAL_BLOCK_SIZE);
     const std::size_t num_used_devices = svm.select_num_used_devices(params.kernel_type, data.num_features());
-    auto [data_d, data_last_d, feature_ranges] = svm.setup_data_on_device(data.data(), data.num_data_points() - 1, data.num_features(), boundary_size, num_used_devices);
+    auto [data_d, data_last_d, device_ranges] = svm.setup_data_on_device(data.data(), data.num_data_points() - 1, data.num_features(), boundary_size, num_used_devices, params.kernel_type);
 
     // calculate the q vector using a GPU backend
-    const std::vector<real_type> calculated = svm.generate_q(params, data_d, data_last_d, data.num_data_points() - 1, feature_ranges, boundary_size);
+    const std::vector<real_type> calculated = svm.generate_q(params, data_d, data_last_d, data.num_data_points() - 1, device_ranges, boundary_size);
 
     // calculate correct q vector (ground truth)
     const std::vector<real_type> ground_truth = compare::generate_q(params, data.data(), num_used_devices);
@@ -401,7 +781,6 @@ TYPED_TEST_P(GenericGPUCSVM, generate_q) {
 TYPED_TEST_P(GenericGPUCSVM, calculate_w) {
     using mock_csvm_type = typename TypeParam::mock_csvm_type;
     using real_type = typename TypeParam::real_type;
-    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
 
     using device_ptr_type = typename mock_csvm_type::template device_ptr_type<real_type>;
     using queue_type = typename mock_csvm_type::queue_type;
@@ -419,8 +798,9 @@ TYPED_TEST_P(GenericGPUCSVM, calculate_w) {
     // perform the data setup on the device
     constexpr auto boundary_size = static_cast<std::size_t>(plssvm::THREAD_BLOCK_SIZE * plssvm::INTERNAL_BLOCK_SIZE);
     const std::size_t num_support_vectors = support_vectors.num_data_points();
-    const std::size_t num_used_devices = svm.select_num_used_devices(kernel, support_vectors.num_features());
-    auto [data_d, data_last_d, feature_ranges] = svm.setup_data_on_device(support_vectors.data(), num_support_vectors - 1, support_vectors.num_features(), boundary_size, num_used_devices);
+    // note: the w vector is only used together with the linear kernel, i.e., the features must be split across the devices
+    const std::size_t num_used_devices = svm.select_num_used_devices(plssvm::kernel_function_type::linear, support_vectors.num_features());
+    auto [data_d, data_last_d, feature_ranges] = svm.setup_data_on_device(support_vectors.data(), num_support_vectors - 1, support_vectors.num_features(), boundary_size, num_used_devices, plssvm::kernel_function_type::linear);
 
     std::vector<device_ptr_type> alpha_d(num_used_devices);
     for (typename std::vector<queue_type>::size_type device = 0; device < num_used_devices; ++device) {
@@ -460,7 +840,7 @@ TYPED_TEST_P(GenericGPUCSVM, run_device_kernel) {
     // perform the data setup on the device
     constexpr auto boundary_size = static_cast<std::size_t>(plssvm::THREAD_BLOCK_SIZE * plssvm::INTERNAL_BLOCK_SIZE);
     const std::size_t num_used_devices = svm.select_num_used_devices(kernel, data.num_features());
-    auto [data_d, data_last_d, feature_ranges] = svm.setup_data_on_device(data.data(), dept, data.num_features(), boundary_size, num_used_devices);
+    auto [data_d, data_last_d, device_ranges] = svm.setup_data_on_device(data.data(), dept, data.num_features(), boundary_size, num_used_devices, kernel);
     std::vector<device_ptr_type> q_d{};
     std::vector<device_ptr_type> x_d{};
     std::vector<device_ptr_type> r_d{};
@@ -478,7 +858,7 @@ TYPED_TEST_P(GenericGPUCSVM, run_device_kernel) {
 
         // perform the kernel calculation on the device
         for (std::size_t device = 0; device < num_used_devices; ++device) {
-            svm.run_device_kernel(device, params, q_d[device], r_d[device], x_d[device], data_d[device], feature_ranges, QA_cost, add, dept, boundary_size);
+            svm.run_device_kernel(device, params, q_d[device], r_d[device], x_d[device], data_d[device], device_ranges, QA_cost, add, dept, boundary_size);
         }
         std::vector<real_type> calculated(dept);
         svm.device_reduction(r_d, calculated);
@@ -539,6 +919,98 @@ TYPED_TEST_P(GenericGPUCSVM, device_reduction) {
     EXPECT_FLOATING_POINT_VECTOR_NEAR(device_data, data);
 }
 
+TYPED_TEST_P(GenericGPUCSVM, device_axpy) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+
+    using device_ptr_type = typename mock_csvm_type::template device_ptr_type<real_type>;
+
+    // create C-SVM: must be done using the mock class, since plssvm::detail::gpu_csvm::device_axpy is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(TypeParam::additional_arguments);
+
+    // the vectors span multiple blocks and are NOT a multiple of the block size
+    const std::vector<real_type> x = util::generate_random_vector<real_type>(1'000);
+    const std::vector<real_type> y = util::generate_random_vector<real_type>(1'000);
+    device_ptr_type x_d{ x.size(), svm.devices_[0] };
+    x_d.copy_to_device(x);
+    device_ptr_type y_d{ y.size(), svm.devices_[0] };
+    y_d.copy_to_device(y);
+
+    // only update the first 999 values
+    svm.device_axpy(0, real_type{ 2.0 }, x_d, y_d, x.size() - 1);
+
+    // the last value must not have been changed
+    std::vector<real_type> correct{ y };
+    for (std::size_t i = 0; i < y.size() - 1; ++i) {
+        correct[i] = y[i] + real_type{ 2.0 } * x[i];
+    }
+
+    std::vector<real_type> calculated(y.size());
+    y_d.copy_to_host(calculated);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated, correct);
+}
+
+TYPED_TEST_P(GenericGPUCSVM, device_xpby) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+
+    using device_ptr_type = typename mock_csvm_type::template device_ptr_type<real_type>;
+
+    // create C-SVM: must be done using the mock class, since plssvm::detail::gpu_csvm::device_xpby is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(TypeParam::additional_arguments);
+
+    // the vectors span multiple blocks and are NOT a multiple of the block size
+    const std::vector<real_type> x = util::generate_random_vector<real_type>(1'000);
+    const std::vector<real_type> y = util::generate_random_vector<real_type>(1'000);
+    device_ptr_type x_d{ x.size(), svm.devices_[0] };
+    x_d.copy_to_device(x);
+    device_ptr_type y_d{ y.size(), svm.devices_[0] };
+    y_d.copy_to_device(y);
+
+    // only update the first 999 values
+    svm.device_xpby(0, x_d, real_type{ 0.5 }, y_d, x.size() - 1);
+
+    // the last value must not have been changed
+    std::vector<real_type> correct{ y };
+    for (std::size_t i = 0; i < y.size() - 1; ++i) {
+        correct[i] = x[i] + real_type{ 0.5 } * y[i];
+    }
+
+    std::vector<real_type> calculated(y.size());
+    y_d.copy_to_host(calculated);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(calculated, correct);
+}
+
+TYPED_TEST_P(GenericGPUCSVM, device_dot) {
+    using mock_csvm_type = typename TypeParam::mock_csvm_type;
+    using real_type = typename TypeParam::real_type;
+
+    using device_ptr_type = typename mock_csvm_type::template device_ptr_type<real_type>;
+
+    // create C-SVM: must be done using the mock class, since plssvm::detail::gpu_csvm::device_dot is protected
+    const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(TypeParam::additional_arguments);
+
+    device_ptr_type partial_sums_d{ static_cast<std::size_t>(plssvm::THREAD_BLOCK_SIZE * plssvm::THREAD_BLOCK_SIZE), svm.devices_[0] };
+
+    // test a vector smaller than a single block, a vector spanning multiple blocks, and a vector larger than the maximum number of blocks
+    for (const std::size_t size : { std::size_t{ 7 }, std::size_t{ 1'000 }, std::size_t{ 70'000 } }) {
+        const std::vector<real_type> x = util::generate_random_vector<real_type>(size, real_type{ 0.0 }, real_type{ 1.0 });
+        const std::vector<real_type> y = util::generate_random_vector<real_type>(size, real_type{ 0.0 }, real_type{ 1.0 });
+        device_ptr_type x_d{ size, svm.devices_[0] };
+        x_d.copy_to_device(x);
+        device_ptr_type y_d{ size, svm.devices_[0] };
+        y_d.copy_to_device(y);
+
+        real_type correct{ 0.0 };
+        for (std::size_t i = 0; i < size; ++i) {
+            correct += x[i] * y[i];
+        }
+
+        // the summation order differs from the sequential one
+        EXPECT_FLOATING_POINT_NEAR_EPS(svm.device_dot(0, x_d, y_d, partial_sums_d, size), correct, real_type{ 1e4 });
+    }
+}
+
 TYPED_TEST_P(GenericGPUCSVM, select_num_used_devices) {
     using mock_csvm_type = typename TypeParam::mock_csvm_type;
     constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
@@ -546,15 +1018,15 @@ TYPED_TEST_P(GenericGPUCSVM, select_num_used_devices) {
     // create C-SVM: must be done using the mock class, since plssvm::detail::gpu_csvm::select_num_used_devices is protected
     const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(TypeParam::additional_arguments);
 
+    // all kernel functions are compatible with at least one device
+    EXPECT_GE(svm.select_num_used_devices(kernel, 1'204), 1);
     if (kernel == plssvm::kernel_function_type::linear) {
-        // the linear kernel function is compatible with at least one device
-        EXPECT_GE(svm.select_num_used_devices(kernel, 1'204), 1);
+        // if only a single feature is provided, only a single device may ever be used
+        EXPECT_EQ(svm.select_num_used_devices(kernel, 1), 1);
     } else {
-        // the other kernel functions are compatible only with exactly one device
-        EXPECT_EQ(svm.select_num_used_devices(kernel, 1'204), 1);
+        // the other kernel functions split the rows of the kernel matrix, i.e., all devices may be used
+        EXPECT_EQ(svm.select_num_used_devices(kernel, 1), svm.num_available_devices());
     }
-    // if only a single feature is provided, only a single device may ever be used
-    EXPECT_EQ(svm.select_num_used_devices(kernel, 1), 1);
 }
 
 TYPED_TEST_P(GenericGPUCSVM, setup_data_on_device_minimal) {
@@ -572,7 +1044,7 @@ TYPED_TEST_P(GenericGPUCSVM, setup_data_on_device_minimal) {
     const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(TypeParam::additional_arguments);
 
     // perform data setup on the device
-    auto [data_d, data_last_d, feature_ranges] = svm.setup_data_on_device(input, input.size(), input.front().size(), 0, 1);
+    auto [data_d, data_last_d, feature_ranges] = svm.setup_data_on_device(input, input.size(), input.front().size(), 0, 1, plssvm::kernel_function_type::linear);
 
     // check returned values
     // the "big" data vector
@@ -605,7 +1077,7 @@ TYPED_TEST_P(GenericGPUCSVM, setup_data_on_device) {
     const std::size_t num_devices = svm.select_num_used_devices(kernel, std::numeric_limits<std::size_t>::max());
 
     // minimal example
-    std::vector<std::vector<real_type>> input(3);
+    std::vector<std::vector<real_type>> input(3 * num_devices * boundary_size);
     for (std::size_t row = 0; row < input.size(); ++row) {
         std::vector<real_type> column(num_devices * 2);
         for (std::size_t col = 0; col < column.size(); ++col) {
@@ -618,39 +1090,52 @@ TYPED_TEST_P(GenericGPUCSVM, setup_data_on_device) {
     const std::size_t num_features = input.front().size();
 
     // perform setup
-    auto [data_d, data_last_d, feature_ranges] = svm.setup_data_on_device(input, num_data_points - 1, num_features - 1, boundary_size, num_devices);
+    auto [data_d, data_last_d, device_ranges] = svm.setup_data_on_device(input, num_data_points - 1, num_features - 1, boundary_size, num_devices, kernel);
 
     // check returned values
-    // the feature ranges
-    ASSERT_EQ(feature_ranges.size(), num_devices + 1);
-    for (std::size_t i = 0; i <= num_devices; ++i) {
-        EXPECT_EQ(feature_ranges[i], i * (num_features - 1) / num_devices);
+    // the feature ranges (linear kernel) or row ranges (polynomial and rbf kernel)
+    ASSERT_EQ(device_ranges.size(), num_devices + 1);
+    EXPECT_TRUE(std::is_sorted(device_ranges.cbegin(), device_ranges.cend()));
+    EXPECT_EQ(device_ranges.front(), 0);
+    if (kernel == plssvm::kernel_function_type::linear) {
+        for (std::size_t i = 0; i <= num_devices; ++i) {
+            EXPECT_EQ(device_ranges[i], i * (num_features - 1) / num_devices);
+        }
+    } else {
+        // the row ranges must be aligned to the boundary size
+        for (std::size_t i = 0; i < num_devices; ++i) {
+            EXPECT_EQ(device_ranges[i] % boundary_size, 0);
+        }
+        EXPECT_EQ(device_ranges.back(), num_data_points - 1);
     }
 
+    // for the polynomial and rbf kernel, each device holds all features
+    const auto first_feature = [&, &device_ranges = device_ranges](const std::size_t device) { return kernel == plssvm::kernel_function_type::linear ? device_ranges[device] : 0; };
+    const auto num_features_on_device = [&, &device_ranges = device_ranges](const std::size_t device) { return kernel == plssvm::kernel_function_type::linear ? device_ranges[device + 1] - device_ranges[device] : num_features - 1; };
+
     const std::vector<real_type> transformed_data = plssvm::detail::transform_to_layout(plssvm::detail::layout_type::soa, input, boundary_size, num_data_points - 1);
 
     // the "big" data vector
     ASSERT_EQ(data_d.size(), num_devices);
     for (std::size_t device = 0; device < num_devices; ++device) {
-        const std::size_t expected_size = (feature_ranges[device + 1] - feature_ranges[device]) * (num_data_points - 1 + boundary_size);
-        ASSERT_EQ(data_d[device].size(), expected_size) << fmt::format("for device {}: [{}, {}]", device, feature_ranges[device], feature_ranges[device + 1]);
+        const std::size_t expected_size = num_features_on_device(device) * (num_data_points - 1 + boundary_size);
+        ASSERT_EQ(data_d[device].size(), expected_size) << fmt::format("for device {}: [{}, {}]", device, device_ranges[device], device_ranges[device + 1]);
         std::vector<real_type> data(expected_size);
         data_d[device].copy_to_host(data);
 
-        const std::size_t device_data_size = (feature_ranges[device + 1] - feature_ranges[device]) * (num_data_points - 1 + boundary_size);
-        const std::vector<real_type> ground_truth(transformed_data.data() + feature_ranges[device] * (num_data_points - 1 + boundary_size),
-                                                  transformed_data.data() + feature_ranges[device] * (num_data_points - 1 + boundary_size) + device_data_size);
+        const std::vector<real_type> ground_truth(transformed_data.data() + first_feature(device) * (num_data_points - 1 + boundary_size),
+                                                  transformed_data.data() + first_feature(device) * (num_data_points - 1 + boundary_size) + expected_size);
         EXPECT_FLOATING_POINT_VECTOR_EQ(data, ground_truth);
     }
     // the last row in the original data
     ASSERT_EQ(data_last_d.size(), num_devices);
     for (std::size_t device = 0; device < num_devices; ++device) {
-        const std::size_t expected_size = feature_ranges[device + 1] - feature_ranges[device] + boundary_size;
+        const std::size_t expected_size = num_features_on_device(device) + boundary_size;
         ASSERT_EQ(data_last_d[device].size(), expected_size);
         std::vector<real_type> data_last(expected_size);
         data_last_d[device].copy_to_host(data_last);
 
-        std::vector<real_type> ground_truth(input.back().data() + feature_ranges[device], input.back().data() + feature_ranges[device] + (feature_ranges[device + 1] - feature_ranges[device]));
+        std::vector<real_type> ground_truth(input.back().data() + first_feature(device), input.back().data() + first_feature(device) + num_features_on_device(device));
         ground_truth.resize(ground_truth.size() + boundary_size, real_type{ 0.0 });
         EXPECT_FLOATING_POINT_VECTOR_EQ(data_last, ground_truth);
     }
@@ -667,10 +1152,54 @@ TYPED_TEST_P(GenericGPUCSVM, num_available_devices) {
     EXPECT_GE(svm.num_available_devices(), 1);
 }
 
+TYPED_TEST_P(GenericGPUCSVM, fit_data_cache) {
+    using csvm_type = typename TypeParam::csvm_type;
+    using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
+
+    // create parameter struct
+    const plssvm::parameter params{ plssvm::kernel_type = kernel };
+
+    // create C-SVM
+    const csvm_type svm = util::construct_from_tuple<csvm_type>(params, TypeParam::additional_arguments);
+    EXPECT_FALSE(svm.has_cached_data());
+
+    {
+        // create data set to be used
+        const plssvm::data_set<real_type> data{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
+
+        // the data points are kept on the device(s) after the first fit
+        const plssvm::model<real_type> model = svm.fit(data);
+        EXPECT_TRUE(svm.has_cached_data());
+
+        // fitting a copy of the same data set reuses the data points on the device(s) and must yield the same model
+        const plssvm::data_set<real_type> data_copy{ data };
+        const plssvm::model<real_type> cached_model = svm.fit(data_copy);
+        EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(cached_model.weights(), model.weights(), real_type{ 1.0e6 });
+        EXPECT_FLOATING_POINT_NEAR_EPS(cached_model.rho(), model.rho(), real_type{ 1.0e6 });
+
+        // fitting a different data set with the same shape must not reuse the cached data points
+        const plssvm::data_set<real_type> scaled_data{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm", typename plssvm::data_set<real_type>::scaling{ real_type{ -1.0 }, real_type{ 1.0 } } };
+        const plssvm::model<real_type> scaled_model = svm.fit(scaled_data);
+        const plssvm::model<real_type> ground_truth_model = util::construct_from_tuple<csvm_type>(params, TypeParam::additional_arguments).fit(scaled_data);
+        EXPECT_FLOATING_POINT_VECTOR_NEAR_EPS(scaled_model.weights(), ground_truth_model.weights(), real_type{ 1.0e6 });
+        EXPECT_FLOATING_POINT_NEAR_EPS(scaled_model.rho(), ground_truth_model.rho(), real_type{ 1.0e6 });
+
+        // the cached data points can be released explicitly
+        svm.clear_data_cache();
+        EXPECT_FALSE(svm.has_cached_data());
+        std::ignore = svm.fit(data);
+        EXPECT_TRUE(svm.has_cached_data());
+    }
+
+    // the data set has been destroyed, i.e., the cached data points may never be reused
+    EXPECT_FALSE(svm.has_cached_data());
+}
+
 // clang-format off
 REGISTER_TYPED_TEST_SUITE_P(GenericGPUCSVM,
-                            generate_q, calculate_w, run_device_kernel, device_reduction,
-                            select_num_used_devices, setup_data_on_device_minimal, setup_data_on_device, num_available_devices);
+                            generate_q, calculate_w, run_device_kernel, device_reduction, device_axpy, device_xpby, device_dot,
+                            select_num_used_devices, setup_data_on_device_minimal, setup_data_on_device, num_available_devices, fit_data_cache);
 // clang-format on
 
 //*************************************************************************************************************************************//
@@ -722,12 +1251,12 @@ TYPED_TEST_P(GenericGPUCSVMDeathTest, generate_q) {
     // the number of data points must be greater than zero
     EXPECT_DEATH(std::ignore = svm.generate_q(params, vec1, vec1, 0, feature_range, 0),
                  "At least one data point must be used to calculate q!");
-    // the number of elements in the feature_ranges vector must be one greater than the number of used devices
+    // the number of elements in the device_ranges vector must be one greater than the number of used devices
     EXPECT_DEATH(std::ignore = svm.generate_q(params, vec1, vec1, 1, std::vector<std::size_t>{}, 0),
-                 ::testing::HasSubstr("The number of values in the feature_range vector must be exactly one more than the number of used devices!: 0 != 1 + 1"));
-    // the values in the feature_ranges vector must be monotonically increasing
+                 ::testing::HasSubstr("The number of values in the device_ranges vector must be exactly one more than the number of used devices!: 0 != 1 + 1"));
+    // the values in the device_ranges vector must be monotonically increasing
     EXPECT_DEATH(std::ignore = svm.generate_q(params, vec1, vec1, 1, { 1, 0 }, 0),
-                 "The feature ranges are not monotonically increasing!");
+                 "The device ranges are not monotonically increasing!");
 }
 
 TYPED_TEST_P(GenericGPUCSVMDeathTest, calculate_w) {
@@ -821,9 +1350,9 @@ TYPED_TEST_P(GenericGPUCSVMDeathTest, run_device_kernel) {
     EXPECT_DEATH(svm.run_device_kernel(0, params, ptr, ptr, ptr, empty_ptr, feature_range, real_type{ 0.0 }, real_type{ 1.0 }, 1, 0),
                  "The data_d device_ptr may not be empty!");
 
-    // the values in the feature_ranges vector must be monotonically increasing
+    // the values in the device_ranges vector must be monotonically increasing
     EXPECT_DEATH(svm.run_device_kernel(0, params, ptr, ptr, ptr, ptr, { 1, 0 }, real_type{ 0.0 }, real_type{ 0.0 }, 1, 0),
-                 "The feature ranges are not monotonically increasing!");
+                 "The device ranges are not monotonically increasing!");
 
     // add must either be -1.0 or 1.0
     EXPECT_DEATH(svm.run_device_kernel(0, params, ptr, ptr, ptr, ptr, feature_range, real_type{ 0.0 }, real_type{ 0.0 }, 1, 0),
@@ -876,16 +1405,17 @@ TYPED_TEST_P(GenericGPUCSVMDeathTest, select_num_used_devices) {
 TYPED_TEST_P(GenericGPUCSVMDeathTest, setup_data_on_device) {
     using mock_csvm_type = typename TypeParam::mock_csvm_type;
     using real_type = typename TypeParam::real_type;
+    constexpr plssvm::kernel_function_type kernel = TypeParam::kernel_type;
 
     // create C-SVM: must be done using the mock class, since plssvm::detail::gpu_csvm::setup_data_on_device is protected
     const mock_csvm_type svm = util::construct_from_tuple<mock_csvm_type>(TypeParam::additional_arguments);
 
     // empty data is not allowed
-    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(std::vector<std::vector<real_type>>{}, 1, 1, 0, 1), "The data must not be empty!");
+    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(std::vector<std::vector<real_type>>{}, 1, 1, 0, 1, kernel), "The data must not be empty!");
     // empty features are not allowed
-    EXPECT_DEATH(std::ignore = (svm.setup_data_on_device(std::vector<std::vector<real_type>>{ std::vector<real_type>{} }, 1, 1, 0, 1)), "The data points must contain at least one feature!");
+    EXPECT_DEATH(std::ignore = (svm.setup_data_on_device(std::vector<std::vector<real_type>>{ std::vector<real_type>{} }, 1, 1, 0, 1, kernel)), "The data points must contain at least one feature!");
     // all data points must have the same number of features
-    EXPECT_DEATH(std::ignore = (svm.setup_data_on_device(std::vector<std::vector<real_type>>{ std::vector<real_type>{ real_type{ 1.0 } }, std::vector<real_type>{ real_type{ 1.0 }, real_type{ 2.0 } } }, 1, 1, 0, 1)),
+    EXPECT_DEATH(std::ignore = (svm.setup_data_on_device(std::vector<std::vector<real_type>>{ std::vector<real_type>{ real_type{ 1.0 } }, std::vector<real_type>{ real_type{ 1.0 }, real_type{ 2.0 } } }, 1, 1, 0, 1, kernel)),
                  "All data points must have the same number of features!");
 
     const std::vector<std::vector<real_type>> data = {
@@ -894,16 +1424,16 @@ TYPED_TEST_P(GenericGPUCSVMDeathTest, setup_data_on_device) {
     };
 
     // at least one data point must be copied to the device
-    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(data, 0, 1, 0, 1), "At least one data point must be copied to the device!");
+    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(data, 0, 1, 0, 1, kernel), "At least one data point must be copied to the device!");
     // at most two data point can be copied to the device
-    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(data, 3, 1, 0, 1), "Can't copy more data points to the device than are present!: 3 <= 2");
+    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(data, 3, 1, 0, 1, kernel), "Can't copy more data points to the device than are present!: 3 <= 2");
     // at least one feature must be copied to the device
-    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(data, 1, 0, 0, 1), "At least one feature must be copied to the device!");
+    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(data, 1, 0, 0, 1, kernel), "At least one feature must be copied to the device!");
     // at most two features can be copied to the device
-    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(data, 1, 3, 0, 1), "Can't copy more features to the device than are present!: 3 <= 2");
+    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(data, 1, 3, 0, 1, kernel), "Can't copy more features to the device than are present!: 3 <= 2");
 
     // can't use more than the available device
-    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(data, 1, 1, 0, svm.num_available_devices() + 1),
+    EXPECT_DEATH(std::ignore = svm.setup_data_on_device(data, 1, 1, 0, svm.num_available_devices() + 1, kernel),
                  fmt::format("Can't use more devices than are available!: {} <= {}", svm.num_available_devices() + 1, svm.num_available_devices()));
 }
 
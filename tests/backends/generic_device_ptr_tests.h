@@ -503,6 +503,91 @@ TYPED_TEST_P(DevicePtr, copy_ptr_with_count_copy_to_too_many) {
     EXPECT_EQ(result, (std::vector<value_type>{ value_type{ 0.0 }, value_type{ 0.0 }, value_type{ 42.0 }, value_type{ 42.0 }, value_type{ 42.0 }, value_type{ 42.0 } }));
 }
 
+TYPED_TEST_P(DevicePtr, copy_vector_async) {
+    using device_ptr_type = typename TypeParam::device_ptr_type;
+    using value_type = typename device_ptr_type::value_type;
+    using queue_type = typename TypeParam::queue_type;
+    const queue_type &queue = TypeParam::default_queue();
+
+    // construct device_ptr
+    device_ptr_type ptr{ 10, queue };
+    ptr.memset(0);
+
+    // create data to copy to the device
+    const std::vector<value_type> data(14, 42);
+
+    // copy data asynchronously to the device and wait for the copy to finish
+    ptr.copy_to_device_async(data);
+    ptr.wait_for_async_copies();
+    // copy data back to the host
+    std::vector<value_type> result(ptr.size());
+    ptr.copy_to_host(result);
+
+    // check values for correctness
+    EXPECT_EQ(result, std::vector<value_type>(10, 42));
+}
+TYPED_TEST_P(DevicePtr, copy_vector_with_count_async) {
+    using device_ptr_type = typename TypeParam::device_ptr_type;
+    using value_type = typename device_ptr_type::value_type;
+    using queue_type = typename TypeParam::queue_type;
+    const queue_type &queue = TypeParam::default_queue();
+
+    // construct device_ptr
+    device_ptr_type ptr{ 6, queue };
+    ptr.memset(0);
+
+    // create data to copy to the device
+    const std::vector<value_type> data(6, 42);
+
+    // copy data asynchronously to the device
+    ptr.copy_to_device_async(data, 1, 3);
+
+    // copy data back to the host (implicitly waits for the asynchronous copy)
+    std::vector<value_type> result(ptr.size());
+    ptr.copy_to_host(result);
+    // check values for correctness
+    EXPECT_EQ(result, (std::vector<value_type>{ value_type{ 0.0 }, value_type{ 42.0 }, value_type{ 42.0 }, value_type{ 42.0 }, value_type{ 0.0 }, value_type{ 0.0 } }));
+}
+TYPED_TEST_P(DevicePtr, copy_ptr_async_multiple) {
+    using device_ptr_type = typename TypeParam::device_ptr_type;
+    using value_type = typename device_ptr_type::value_type;
+    using queue_type = typename TypeParam::queue_type;
+    const queue_type &queue = TypeParam::default_queue();
+
+    // construct device_ptr
+    device_ptr_type ptr{ 6, queue };
+    ptr.memset(0);
+
+    // create data to copy to the device
+    const std::vector<value_type> data1(3, 42);
+    const std::vector<value_type> data2(3, 1);
+
+    // copy data asynchronously to the device in two parts and wait for both copies to finish
+    ptr.copy_to_device_async(data1.data(), 0, 3);
+    ptr.copy_to_device_async(data2.data(), 2, 3);
+    ptr.wait_for_async_copies();
+
+    // copy data back to the host
+    std::vector<value_type> result(ptr.size());
+    ptr.copy_to_host(result.data());
+    // check values for correctness
+    EXPECT_EQ(result, (std::vector<value_type>{ value_type{ 42.0 }, value_type{ 42.0 }, value_type{ 1.0 }, value_type{ 1.0 }, value_type{ 1.0 }, value_type{ 0.0 } }));
+}
+TYPED_TEST_P(DevicePtr, copy_vector_async_too_few_host_elements) {
+    using device_ptr_type = typename TypeParam::device_ptr_type;
+    using value_type = typename device_ptr_type::value_type;
+    using queue_type = typename TypeParam::queue_type;
+    const queue_type &queue = TypeParam::default_queue();
+
+    // construct device_ptr
+    device_ptr_type ptr{ 10, queue };
+
+    // try copying data asynchronously to the device with too few elements
+    const std::vector<value_type> data(8, 42);
+    EXPECT_THROW_WHAT(ptr.copy_to_device_async(data), plssvm::gpu_device_ptr_exception, "Too few data to perform copy (needed: 10, provided: 8)!");
+    EXPECT_THROW_WHAT(ptr.copy_to_device_async(data, 0, 10), plssvm::gpu_device_ptr_exception, "Too few data to perform copy (needed: 10, provided: 8)!");
+}
+
 // clang-format off
 REGISTER_TYPED_TEST_SUITE_P(DevicePtr,
                             default_construct, construct, move_construct, move_assign,
@@ -511,7 +596,8 @@ REGISTER_TYPED_TEST_SUITE_P(DevicePtr,
                             fill, fill_with_count, fill_invalid_pos,
                             copy_vector, copy_vector_with_count_copy_back_all, copy_vector_with_count_copy_back_some, copy_vector_with_count_copy_to_too_many,
                             copy_vector_too_few_host_elements, copy_vector_too_few_buffer_elements, copy_vector_with_count_too_few_host_elements, copy_vector_with_count_too_few_buffer_elements,
-                            copy_ptr, copy_ptr_with_count_copy_back_all, copy_ptr_with_count_copy_back_some, copy_ptr_with_count_copy_to_too_many);
+                            copy_ptr, copy_ptr_with_count_copy_back_all, copy_ptr_with_count_copy_back_some, copy_ptr_with_count_copy_to_too_many,
+                            copy_vector_async, copy_vector_with_count_async, copy_ptr_async_multiple, copy_vector_async_too_few_host_elements);
 // clang-format on
 
 template <typename T>
@@ -595,11 +681,38 @@ TYPED_TEST_P(DevicePtrDeathTest, copy_ptr_with_count_invalid_device_ptr) {
     EXPECT_DEATH(def.copy_to_host(data, 0, 0), ::testing::HasSubstr("Invalid data pointer! Maybe *this has been default constructed?"));
 }
 
+TYPED_TEST_P(DevicePtrDeathTest, copy_ptr_async_invalid_host_ptr) {
+    using device_ptr_type = typename TypeParam::device_ptr_type;
+    using queue_type = typename TypeParam::queue_type;
+    const queue_type &queue = TypeParam::default_queue();
+
+    // construct device_ptr
+    device_ptr_type ptr{ 10, queue };
+
+    // copy with invalid data pointer
+    EXPECT_DEATH(ptr.copy_to_device_async(nullptr), ::testing::HasSubstr("Invalid host pointer for the data to copy!"));
+    EXPECT_DEATH(ptr.copy_to_device_async(nullptr, 0, 10), ::testing::HasSubstr("Invalid host pointer for the data to copy!"));
+}
+TYPED_TEST_P(DevicePtrDeathTest, copy_ptr_async_invalid_device_ptr) {
+    using device_ptr_type = typename TypeParam::device_ptr_type;
+    using value_type = typename device_ptr_type::value_type;
+
+    // construct default device_ptr
+    device_ptr_type def{};
+
+    // copy with invalid device pointer
+    std::vector<value_type> data(def.size());
+    EXPECT_DEATH(def.copy_to_device_async(data.data()), ::testing::HasSubstr("Invalid data pointer! Maybe *this has been default constructed?"));
+    EXPECT_DEATH(def.copy_to_device_async(data.data(), 0, 0), ::testing::HasSubstr("Invalid data pointer! Maybe *this has been default constructed?"));
+    EXPECT_DEATH(def.copy_to_device_async(data), ::testing::HasSubstr("Invalid data pointer! Maybe *this has been default constructed?"));
+}
+
 // clang-format off
 REGISTER_TYPED_TEST_SUITE_P(DevicePtrDeathTest,
                             memset, fill,
                             copy_ptr_invalid_host_ptr, copy_ptr_invalid_device_ptr,
-                            copy_ptr_with_count_invalid_host_ptr, copy_ptr_with_count_invalid_device_ptr);
+                            copy_ptr_with_count_invalid_host_ptr, copy_ptr_with_count_invalid_device_ptr,
+                            copy_ptr_async_invalid_host_ptr, copy_ptr_async_invalid_device_ptr);
 // clang-format on
 
 #endif  // PLSSVM_TESTS_BACKENDS_GENERIC_DEVICE_PTR_TESTS_HPP_
@@ -0,0 +1,47 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the token used to cooperatively cancel a running fit.
+ */
+
+#include "plssvm/cancellation_token.hpp"
+
+#include "gtest/gtest.h"  // TEST, EXPECT_TRUE, EXPECT_FALSE
+
+#include <thread>         // std::thread
+
+TEST(CancellationToken, default_construct) {
+    // a default constructed token must not be cancelled
+    const plssvm::cancellation_token token{};
+    EXPECT_FALSE(token.is_cancelled());
+}
+TEST(CancellationToken, cancel) {
+    plssvm::cancellation_token token{};
+    token.cancel();
+    EXPECT_TRUE(token.is_cancelled());
+    // cancelling an already cancelled token has no effect
+    token.cancel();
+    EXPECT_TRUE(token.is_cancelled());
+}
+TEST(CancellationToken, copies_share_state) {
+    plssvm::cancellation_token token{};
+    const plssvm::cancellation_token copy{ token };
+    const plssvm::cancellation_token other{};
+
+    // cancelling the original token must also cancel its copies, but not unrelated tokens
+    token.cancel();
+    EXPECT_TRUE(copy.is_cancelled());
+    EXPECT_FALSE(other.is_cancelled());
+}
+TEST(CancellationToken, cancel_from_other_thread) {
+    plssvm::cancellation_token token{};
+
+    // cancel the token from another thread
+    std::thread t{ [token]() mutable { token.cancel(); } };
+    t.join();
+    EXPECT_TRUE(token.is_cancelled());
+}
@@ -10,7 +10,7 @@
 
 #include "mock_csvm.hpp"                     // mock_csvm
 
-#include "plssvm/core.hpp"                   // necessary for type_traits, plssvm::csvm_backend_exists, plssvm::csvm_backend_exists_v
+#include "plssvm/core.hpp"                   // necessary for type_traits, plssvm::csvm_backend_exists, plssvm::csvm_backend_exists_v, plssvm::cross_validation_result, plssvm::cancellation_token
 #include "plssvm/data_set.hpp"               // plssvm::data_set
 #include "plssvm/exceptions/exceptions.hpp"  // plssvm::invalid_parameter_exception
 #include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type
@@ -22,14 +22,17 @@
 #include "types_to_test.hpp"                 // util::{real_type_label_type_combination_gtest, real_type_label_type_combination_gtest}
 #include "utility.hpp"                       // util::{redirect_output, temporary_file, instantiate_template_file, get_distinct_label}
 
+#include "gmock/gmock.h"                     // ::testing::{Field, ElementsAre, ElementsAreArray, IsEmpty, InSequence, Each, AnyOf, Truly, Lt, Ne}
 #include "gtest/gtest.h"                     // TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_CALL, ::testing::{Test, An}
 
+#include <chrono>                            // std::chrono::{milliseconds, steady_clock}
 #include <iostream>                          // std::clog
+#include <optional>                          // std::nullopt
 #include <sstream>                           // std::stringstream
 #include <streambuf>                         // std::streambuf
 #include <string>                            // std::string
 #include <tuple>                             // std::ignore
-#include <utility>                           // std::pair
+#include <utility>                           // std::pair, std::make_pair, std::move
 #include <vector>                            // std::vector
 
 class BaseCSVM : public ::testing::Test {};
@@ -207,7 +210,8 @@ TYPED_TEST(BaseCSVMFit, fit) {
                           ::testing::An<const std::vector<std::vector<real_type>> &>(),
                           ::testing::An<std::vector<real_type>>(),
                           ::testing::An<real_type>(),
-                          ::testing::An<unsigned long long>())).Times(1);
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(1);
     // clang-format on
 
     // create data set
@@ -240,7 +244,8 @@ TYPED_TEST(BaseCSVMFit, fit_named_parameters) {
                           ::testing::An<const std::vector<std::vector<real_type>> &>(),
                           ::testing::An<std::vector<real_type>>(),
                           ::testing::An<real_type>(),
-                          ::testing::An<unsigned long long>())).Times(1);
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(1);
     // clang-format on
 
     // create data set
@@ -259,6 +264,264 @@ TYPED_TEST(BaseCSVMFit, fit_named_parameters) {
     EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
     EXPECT_FLOATING_POINT_EQ(model.rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
 }
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_mixed_precision) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function: the mixed precision flag must be forwarded to the solver
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solver_control<real_type>::mixed_precision, true))).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::epsilon = 0.1, plssvm::mixed_precision = true);
+
+    // check whether the model has been created correctly
+    EXPECT_EQ(model.num_support_vectors(), 5);
+    EXPECT_EQ(model.num_features(), 4);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_rbf_tolerance) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function: the rbf tolerance must be forwarded to the solver
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solver_control<real_type>::rbf_tolerance, real_type{ 0.125 }))).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::epsilon = 0.1, plssvm::rbf_tolerance = 0.125);
+
+    // check whether the model has been created correctly
+    EXPECT_EQ(model.num_support_vectors(), 5);
+    EXPECT_EQ(model.num_features(), 4);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_solver) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function: the solver type must be forwarded to the solver
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solver_control<real_type>::solver, plssvm::solver_type::pipelined_cg))).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::epsilon = 0.1, plssvm::solver = plssvm::solver_type::pipelined_cg);
+
+    // check whether the model has been created correctly
+    EXPECT_EQ(model.num_support_vectors(), 5);
+    EXPECT_EQ(model.num_features(), 4);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_iteration_callback) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function: the iteration callback must be forwarded to the solver
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solver_control<real_type>::iteration_callback, ::testing::Truly([](const plssvm::iteration_callback_type &callback) { return static_cast<bool>(callback); })))).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::epsilon = 0.1, plssvm::iteration_callback = [](const plssvm::iteration_info &) { return true; });
+
+    // check whether the model has been created correctly
+    EXPECT_EQ(model.num_support_vectors(), 5);
+    EXPECT_EQ(model.num_features(), 4);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_time_budget) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function: the time budget must be forwarded to the solver as deadline
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solver_control<real_type>::deadline, ::testing::Lt(std::chrono::steady_clock::time_point::max())))).Times(1);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::epsilon = 0.1, plssvm::time_budget = std::chrono::milliseconds{ 1000 });
+
+    // check whether the model has been created correctly
+    EXPECT_EQ(model.num_support_vectors(), 5);
+    EXPECT_EQ(model.num_features(), 4);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_cancellation) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function: the cancellation token must be forwarded to the solver
+    // the solver signals that it has been stopped early
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solver_control<real_type>::cancellation, ::testing::Ne(std::nullopt))))
+        .WillOnce([](const auto &, const auto &, const auto &, const auto &, const auto &, const plssvm::detail::solver_control<real_type> &control) {
+            EXPECT_TRUE(control.stop_requested());
+            control.converged = false;
+            return solve_system_of_linear_equations_fake_return<real_type>;
+        });
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // cancel the token before calling fit
+    plssvm::cancellation_token token{};
+    token.cancel();
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::epsilon = 0.1, plssvm::cancellation = token);
+
+    // check whether the model has been created correctly and is flagged as not converged
+    EXPECT_EQ(model.num_support_vectors(), 5);
+    EXPECT_EQ(model.num_features(), 4);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+    EXPECT_FALSE(model.converged());
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_checkpoint) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function: the checkpoint parameters must be forwarded to the solver
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::AllOf(::testing::Field(&plssvm::detail::solver_control<real_type>::checkpoint_file, ::testing::StrEq("data.checkpoint")),
+                                           ::testing::Field(&plssvm::detail::solver_control<real_type>::checkpoint_interval, ::testing::Eq(5)),
+                                           ::testing::Field(&plssvm::detail::solver_control<real_type>::resume, ::testing::IsTrue()))))
+        .WillOnce(::testing::Return(solve_system_of_linear_equations_fake_return<real_type>));
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.fit(training_data, plssvm::checkpoint_file = "data.checkpoint", plssvm::checkpoint_interval = 5, plssvm::resume = true);
+
+    // check whether the model has been created correctly
+    EXPECT_EQ(model.num_support_vectors(), 5);
+    EXPECT_EQ(model.num_features(), 4);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_mixed_precision_pipelined_cg) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mixed precision only has an effect (and is only rejected together with the pipelined CG algorithm) if real_type is double
+    const int num_calls = std::is_same_v<real_type, double> ? 0 : 1;
+
+    // mock the solve_system_of_linear_equations function
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(num_calls);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // calling the function with mixed precision and the pipelined CG algorithm should throw if real_type is double
+    if constexpr (std::is_same_v<real_type, double>) {
+        EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::mixed_precision = true, plssvm::solver = plssvm::solver_type::pipelined_cg)),
+                          plssvm::invalid_parameter_exception,
+                          "Mixed precision is currently not supported in combination with the pipelined CG algorithm!");
+    } else {
+        std::ignore = csvm.fit(training_data, plssvm::mixed_precision = true, plssvm::solver = plssvm::solver_type::pipelined_cg);
+    }
+}
 TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_epsilon) {
     using real_type = typename TypeParam::real_type;
     using label_type = typename TypeParam::label_type;
@@ -273,19 +536,386 @@ TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_epsilon) {
                           ::testing::An<const std::vector<std::vector<real_type>> &>(),
                           ::testing::An<std::vector<real_type>>(),
                           ::testing::An<real_type>(),
-                          ::testing::An<unsigned long long>())).Times(0);
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // calling the function with an invalid epsilon should throw
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::epsilon = 0.0)),
+                      plssvm::invalid_parameter_exception,
+                      "epsilon must be less than 0.0, but is 0!");
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_max_iter) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // calling the function with an invalid max_iter should throw
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::max_iter = 0)),
+                      plssvm::invalid_parameter_exception,
+                      "max_iter must be greater than 0, but is 0!");
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_time_budget) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // calling the function with an invalid time budget should throw
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::time_budget = std::chrono::milliseconds{ 0 })),
+                      plssvm::invalid_parameter_exception,
+                      "time_budget must be greater than 0ms, but is 0ms!");
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_checkpoint_interval) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // calling the function with an invalid checkpoint interval should throw
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::checkpoint_file = "data.checkpoint", plssvm::checkpoint_interval = 0)),
+                      plssvm::invalid_parameter_exception,
+                      "checkpoint_interval must be greater than 0, but is 0!");
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_rbf_tolerance) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // calling the function with a negative tolerance should throw
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::rbf_tolerance = -0.5)),
+                      plssvm::invalid_parameter_exception,
+                      "rbf_tolerance must be greater or equal than 0.0, but is -0.5!");
+}
+TYPED_TEST(BaseCSVMFit, fit_named_parameters_resume_without_checkpoint_file) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+
+    // resuming without a checkpoint file should throw
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::resume = true)),
+                      plssvm::invalid_parameter_exception,
+                      "Can't resume the CG algorithm without a checkpoint_file!");
+}
+TYPED_TEST(BaseCSVMFit, fit_no_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> training_data{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm" };
+
+    // in order to call fit, the provided data set must contain labels
+    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data)),
+                      plssvm::invalid_parameter_exception,
+                      "No labels given for training! Maybe the data is only usable for prediction?");
+}
+
+TYPED_TEST(BaseCSVMFit, update) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // read a previously learned from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> learned_model{ model_file.filename };
+
+    // create data set containing the new data points
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
+    const plssvm::data_set<real_type, label_type> new_data{ this->filename };
+
+    // the CG algorithm must be warm started using the previously learned weights and zeros for the new data points
+    std::vector<real_type> initial_guess = learned_model.weights();
+    initial_guess.resize(learned_model.num_support_vectors() + new_data.num_data_points() - 1, real_type{ 0.0 });
+
+    // mock the solve_system_of_linear_equations function
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::Field(&plssvm::detail::solver_control<real_type>::initial_guess, ::testing::ElementsAreArray(initial_guess)))).Times(1);
+    // clang-format on
+
+    // call function
+    const plssvm::model<real_type, label_type> model = csvm.update(learned_model, new_data);
+
+    // check whether the model has been created correctly
+    EXPECT_EQ(model.num_support_vectors(), 10);
+    EXPECT_EQ(model.num_features(), 4);
+    EXPECT_TRUE(model.get_params().equivalent(learned_model.get_params()));
+    std::vector<std::vector<real_type>> support_vectors{ learned_model.support_vectors() };
+    support_vectors.insert(support_vectors.end(), new_data.data().cbegin(), new_data.data().cend());
+    EXPECT_FLOATING_POINT_2D_VECTOR_EQ(model.support_vectors(), support_vectors);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(model.weights(), solve_system_of_linear_equations_fake_return<real_type>.first);
+    EXPECT_FLOATING_POINT_EQ(model.rho(), solve_system_of_linear_equations_fake_return<real_type>.second);
+}
+TYPED_TEST(BaseCSVMFit, update_no_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
+    // clang-format on
+
+    // read a previously learned from a model file
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", this->filename);
+    const plssvm::model<real_type, label_type> learned_model{ this->filename };
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> new_data{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm" };
+
+    // in order to call update, the provided data set must contain labels
+    EXPECT_THROW_WHAT((std::ignore = csvm.update(learned_model, new_data)),
+                      plssvm::invalid_parameter_exception,
+                      "No labels given for the new data points! Maybe the data is only usable for prediction?");
+}
+TYPED_TEST(BaseCSVMFit, update_num_features_mismatch) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
+    // clang-format on
+
+    // read a previously learned from a model file
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", this->filename);
+    const plssvm::model<real_type, label_type> learned_model{ this->filename };
+
+    // create data set with a mismatching number of features
+    const plssvm::data_set<real_type, label_type> new_data{
+        std::vector<std::vector<real_type>>{ { real_type{ 1.0 }, real_type{ 2.0 } }, { real_type{ 3.0 }, real_type{ 4.0 } } },
+        std::vector<label_type>{ util::get_distinct_label<label_type>().first, util::get_distinct_label<label_type>().second }
+    };
+
+    // calling the function with mismatching number of features should throw
+    EXPECT_THROW_WHAT((std::ignore = csvm.update(learned_model, new_data)),
+                      plssvm::invalid_parameter_exception,
+                      "Number of features per new data point (2) must match the number of features per support vector of the provided model (4)!");
+}
+
+template <typename T>
+class BaseCSVMCrossValidate : public BaseCSVM, private util::redirect_output<>, protected util::temporary_file {};
+TYPED_TEST_SUITE(BaseCSVMCrossValidate, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(BaseCSVMCrossValidate, cross_validate) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // the learned weights are the mapped labels of the training data points
+    const auto fake_solve = [](const plssvm::detail::parameter<real_type> &, const std::vector<std::vector<real_type>> &, std::vector<real_type> b, real_type, unsigned long long, const plssvm::detail::solver_control<real_type> &) {
+        return std::make_pair(std::move(b), real_type{ 0.0 });
+    };
+    // always predict the second label
+    const auto fake_predict = [](const plssvm::detail::parameter<real_type> &, const std::vector<std::vector<real_type>> &, const std::vector<real_type> &, real_type, std::vector<real_type> &, const std::vector<std::vector<real_type>> &predict_points) {
+        return std::vector<real_type>(predict_points.size(), real_type{ 1.0 });
+    };
+
+    // mock the solve_system_of_linear_equations function
+    // the folds are: { 0, 3 }, { 1, 4 }, and { 2 } -> each CG algorithm (except the first) is warm started using the weights learned in the previous folds
+    // clang-format off
+    {
+        const ::testing::InSequence seq;
+        EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                              ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                              ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                              ::testing::An<std::vector<real_type>>(),
+                              ::testing::An<real_type>(),
+                              ::testing::An<unsigned long long>(),
+                              ::testing::Field(&plssvm::detail::solver_control<real_type>::initial_guess, ::testing::IsEmpty()))).WillOnce(fake_solve);
+        EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                              ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                              ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                              ::testing::An<std::vector<real_type>>(),
+                              ::testing::An<real_type>(),
+                              ::testing::An<unsigned long long>(),
+                              ::testing::Field(&plssvm::detail::solver_control<real_type>::initial_guess, ::testing::ElementsAre(real_type{ 0.0 }, real_type{ 1.0 })))).WillOnce(fake_solve);
+        EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                              ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                              ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                              ::testing::An<std::vector<real_type>>(),
+                              ::testing::An<real_type>(),
+                              ::testing::An<unsigned long long>(),
+                              ::testing::Field(&plssvm::detail::solver_control<real_type>::initial_guess, ::testing::ElementsAre(real_type{ -1.0 }, real_type{ -1.0 }, real_type{ 1.0 })))).WillOnce(fake_solve);
+    }
+    EXPECT_CALL(csvm, predict_values(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<const std::vector<real_type> &>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<std::vector<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>())).Times(3).WillRepeatedly(fake_predict);
     // clang-format on
 
     // create data set
     util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
-    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+    const plssvm::data_set<real_type, label_type> data{ this->filename };
 
-    // calling the function with an invalid epsilon should throw
-    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::epsilon = 0.0)),
+    // call function
+    const plssvm::cross_validation_result<real_type> result = csvm.cross_validate(data, 3);
+
+    // check the per-fold results
+    EXPECT_EQ(result.num_folds(), 3);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(result.accuracies, (std::vector<real_type>{ real_type{ 0.5 }, real_type{ 0.5 }, real_type{ 1.0 } }));
+    EXPECT_FLOATING_POINT_EQ(result.mean_accuracy(), real_type{ 2.0 } / real_type{ 3.0 });
+    EXPECT_EQ(result.fit_times.size(), 3);
+    EXPECT_EQ(result.predict_times.size(), 3);
+}
+TYPED_TEST(BaseCSVMCrossValidate, cross_validate_no_label) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the solve_system_of_linear_equations function -> since an exception should be triggered, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<std::vector<real_type>>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
+    // clang-format on
+
+    // create data set without labels
+    const plssvm::data_set<real_type, label_type> data{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm" };
+
+    // in order to call cross_validate, the provided data set must contain labels
+    EXPECT_THROW_WHAT((std::ignore = csvm.cross_validate(data, 2)),
                       plssvm::invalid_parameter_exception,
-                      "epsilon must be less than 0.0, but is 0!");
+                      "No labels given for cross-validation! Maybe the data is only usable for prediction?");
 }
-TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_max_iter) {
+TYPED_TEST(BaseCSVMCrossValidate, cross_validate_invalid_num_folds) {
     using real_type = typename TypeParam::real_type;
     using label_type = typename TypeParam::label_type;
 
@@ -299,19 +929,65 @@ TYPED_TEST(BaseCSVMFit, fit_named_parameters_invalid_max_iter) {
                           ::testing::An<const std::vector<std::vector<real_type>> &>(),
                           ::testing::An<std::vector<real_type>>(),
                           ::testing::An<real_type>(),
-                          ::testing::An<unsigned long long>())).Times(0);
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
     // clang-format on
 
     // create data set
     util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", this->filename);
-    const plssvm::data_set<real_type, label_type> training_data{ this->filename };
+    const plssvm::data_set<real_type, label_type> data{ this->filename };
 
-    // calling the function with an invalid max_iter should throw
-    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data, plssvm::max_iter = 0)),
+    // at least two folds are necessary
+    EXPECT_THROW_WHAT((std::ignore = csvm.cross_validate(data, 1)),
                       plssvm::invalid_parameter_exception,
-                      "max_iter must be greater than 0, but is 0!");
+                      "The number of folds must be in the range [2, 5], but is 1!");
+    // each fold must contain at least one data point
+    EXPECT_THROW_WHAT((std::ignore = csvm.cross_validate(data, 6)),
+                      plssvm::invalid_parameter_exception,
+                      "The number of folds must be in the range [2, 5], but is 6!");
 }
-TYPED_TEST(BaseCSVMFit, fit_no_label) {
+
+template <typename T>
+class BaseCSVMEstimateLOOError : public BaseCSVM, private util::redirect_output<>, protected util::temporary_file {};
+TYPED_TEST_SUITE(BaseCSVMEstimateLOOError, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
+
+TYPED_TEST(BaseCSVMEstimateLOOError, estimate_loo_error) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // H^-1 is mocked as 0.1 * I -> the estimated diagonal is exactly 0.1 (since z_i * z_i = 1 for all Rademacher probe vectors)
+    const auto fake_solve = [](const plssvm::detail::parameter<real_type> &, const std::vector<std::vector<real_type>> &, std::vector<real_type> b, real_type, unsigned long long, const plssvm::detail::solver_control<real_type> &) {
+        for (real_type &b_i : b) {
+            b_i *= real_type{ 0.1 };
+        }
+        return std::make_pair(std::move(b), real_type{ 0.0 });
+    };
+
+    // mock the solve_system_of_linear_equations function -> each probe vector must be a Rademacher vector
+    // clang-format off
+    EXPECT_CALL(csvm, solve_system_of_linear_equations(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::Each(::testing::AnyOf(real_type{ -1.0 }, real_type{ 1.0 })),
+                          ::testing::An<real_type>(),
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(4).WillRepeatedly(fake_solve);
+    // clang-format on
+
+    // read a previously learned from a model file
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", this->filename);
+    const plssvm::model<real_type, label_type> learned_model{ this->filename };
+
+    // call function
+    const real_type loo_error = csvm.estimate_loo_error(learned_model, 4);
+
+    // the LOO decision values are y_i - 10 * alpha_i -> only the first data point is misclassified
+    EXPECT_FLOATING_POINT_EQ(loo_error, real_type{ 0.2 });
+}
+TYPED_TEST(BaseCSVMEstimateLOOError, estimate_loo_error_invalid_num_probes) {
     using real_type = typename TypeParam::real_type;
     using label_type = typename TypeParam::label_type;
 
@@ -325,16 +1001,18 @@ TYPED_TEST(BaseCSVMFit, fit_no_label) {
                           ::testing::An<const std::vector<std::vector<real_type>> &>(),
                           ::testing::An<std::vector<real_type>>(),
                           ::testing::An<real_type>(),
-                          ::testing::An<unsigned long long>())).Times(0);
+                          ::testing::An<unsigned long long>(),
+                          ::testing::An<const plssvm::detail::solver_control<real_type> &>())).Times(0);
     // clang-format on
 
-    // create data set without labels
-    const plssvm::data_set<real_type, label_type> training_data{ PLSSVM_TEST_PATH "/data/libsvm/3x2_without_label.libsvm" };
+    // read a previously learned from a model file
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", this->filename);
+    const plssvm::model<real_type, label_type> learned_model{ this->filename };
 
-    // in order to call fit, the provided data set must contain labels
-    EXPECT_THROW_WHAT((std::ignore = csvm.fit(training_data)),
+    // at least one probe vector is necessary
+    EXPECT_THROW_WHAT((std::ignore = csvm.estimate_loo_error(learned_model, 0)),
                       plssvm::invalid_parameter_exception,
-                      "No labels given for training! Maybe the data is only usable for prediction?");
+                      "At least one probe vector must be used to estimate the leave-one-out error!");
 }
 
 template <typename T>
@@ -408,6 +1086,96 @@ TYPED_TEST(BaseCSVMPredict, predict_num_feature_mismatch) {
                       "Number of features per data point (2) must match the number of features per support vector of the provided model (4)!");
 }
 
+TYPED_TEST(BaseCSVMPredict, predict_rbf_tolerance) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the predict_values function -> since the rbf predictions are approximated using a ball tree, the mocked function should never be called
+    // clang-format off
+    EXPECT_CALL(csvm, predict_values(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<const std::vector<real_type> &>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<std::vector<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>())).Times(0);
+    // clang-format on
+
+    // create data set
+    const util::temporary_file data_set_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_set_file.filename);
+    const plssvm::data_set<real_type, label_type> data_to_predict{ data_set_file.filename };
+
+    // read a previously learned from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_rbf_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> learned_model{ model_file.filename };
+
+    // call function twice: the first call builds the ball tree, the second one reuses it
+    const std::vector<label_type> prediction = csvm.predict(learned_model, data_to_predict, plssvm::rbf_tolerance = 0.01);
+    EXPECT_EQ(csvm.predict(learned_model, data_to_predict, plssvm::rbf_tolerance = 0.01), prediction);
+
+    // check return value; all exact predicted values are less than -0.28
+    const std::pair<label_type, label_type> labels = util::get_distinct_label<label_type>();
+    EXPECT_EQ(prediction, std::vector<label_type>(5, labels.first));
+}
+TYPED_TEST(BaseCSVMPredict, predict_rbf_tolerance_linear_kernel) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // mock the predict_values function -> the rbf_tolerance is ignored for all other kernel functions
+    // clang-format off
+    EXPECT_CALL(csvm, predict_values(
+                          ::testing::An<const plssvm::detail::parameter<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>(),
+                          ::testing::An<const std::vector<real_type> &>(),
+                          ::testing::An<real_type>(),
+                          ::testing::An<std::vector<real_type> &>(),
+                          ::testing::An<const std::vector<std::vector<real_type>> &>())).Times(1);
+    // clang-format on
+
+    // create data set
+    const util::temporary_file data_set_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_set_file.filename);
+    const plssvm::data_set<real_type, label_type> data_to_predict{ data_set_file.filename };
+
+    // read a previously learned from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> learned_model{ model_file.filename };
+
+    // call function
+    std::ignore = csvm.predict(learned_model, data_to_predict, plssvm::rbf_tolerance = 0.01);
+}
+TYPED_TEST(BaseCSVMPredict, predict_invalid_rbf_tolerance) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // create mock_csvm (since plssvm::csvm is pure virtual!)
+    const mock_csvm csvm{};
+
+    // create data set
+    const util::temporary_file data_set_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/libsvm/5x4_TEMPLATE.libsvm", data_set_file.filename);
+    const plssvm::data_set<real_type, label_type> data_to_predict{ data_set_file.filename };
+
+    // read a previously learned from a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_rbf_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> learned_model{ model_file.filename };
+
+    // calling the function with a negative tolerance should throw
+    EXPECT_THROW_WHAT(std::ignore = csvm.predict(learned_model, data_to_predict, plssvm::rbf_tolerance = -0.01),
+                      plssvm::invalid_parameter_exception,
+                      "rbf_tolerance must be greater or equal than 0.0, but is -0.01!");
+}
+
 template <typename T>
 class BaseCSVMScore : public BaseCSVM, private util::redirect_output<> {};
 TYPED_TEST_SUITE(BaseCSVMScore, util::real_type_label_type_combination_gtest, naming::real_type_label_type_combination_to_name);
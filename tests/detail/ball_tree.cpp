@@ -0,0 +1,143 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the ball tree used to approximate the predictions using the rbf kernel function.
+ */
+
+#include "plssvm/detail/ball_tree.hpp"       // plssvm::detail::ball_tree
+
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type, plssvm::kernel_function
+
+#include "../custom_test_macros.hpp"         // EXPECT_FLOATING_POINT_NEAR_EPS
+#include "../naming.hpp"                     // naming::real_type_to_name
+#include "../types_to_test.hpp"              // util::real_type_gtest
+#include "../utility.hpp"                    // util::generate_random_vector
+
+#include "gmock/gmock-matchers.h"            // ::testing::HasSubstr
+#include "gtest/gtest.h"                     // TYPED_TEST_SUITE, TYPED_TEST, EXPECT_EQ, EXPECT_LE, EXPECT_GE, EXPECT_LT, EXPECT_DEATH, ::testing::Test
+
+#include <cmath>                             // std::abs
+#include <cstddef>                           // std::size_t
+#include <limits>                            // std::numeric_limits
+#include <tuple>                             // std::ignore
+#include <vector>                            // std::vector
+
+template <typename real_type>
+[[nodiscard]] std::vector<std::vector<real_type>> generate_random_points(const std::size_t num_points, const std::size_t num_features) {
+    std::vector<std::vector<real_type>> points(num_points);
+    for (std::vector<real_type> &point : points) {
+        point = util::generate_random_vector<real_type>(num_features, real_type{ -10.0 }, real_type{ 10.0 });
+    }
+    return points;
+}
+
+template <typename real_type>
+[[nodiscard]] real_type exact_rbf_weighted_sum(const std::vector<std::vector<real_type>> &points, const std::vector<real_type> &weights, const std::vector<real_type> &query, const real_type gamma) {
+    real_type sum{ 0.0 };
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        sum += weights[i] * plssvm::kernel_function<plssvm::kernel_function_type::rbf>(points[i], query, gamma);
+    }
+    return sum;
+}
+
+template <typename T>
+class BallTree : public ::testing::Test {};
+TYPED_TEST_SUITE(BallTree, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(BallTree, construct) {
+    using real_type = TypeParam;
+
+    const std::vector<std::vector<real_type>> points = generate_random_points<real_type>(100, 3);
+    const std::vector<real_type> weights = util::generate_random_vector<real_type>(100);
+
+    const plssvm::detail::ball_tree<real_type> tree{ points, weights, 10 };
+    EXPECT_EQ(tree.num_points(), 100);
+    EXPECT_EQ(tree.num_features(), 3);
+    // 100 points are recursively halved until at most 10 points remain: 1 + 2 + 4 + 8 + 16 nodes
+    EXPECT_EQ(tree.num_nodes(), 31);
+}
+TYPED_TEST(BallTree, construct_single_leaf) {
+    using real_type = TypeParam;
+
+    const std::vector<std::vector<real_type>> points = generate_random_points<real_type>(5, 2);
+    const std::vector<real_type> weights = util::generate_random_vector<real_type>(5);
+
+    const plssvm::detail::ball_tree<real_type> tree{ points, weights };
+    EXPECT_EQ(tree.num_points(), 5);
+    EXPECT_EQ(tree.num_features(), 2);
+    EXPECT_EQ(tree.num_nodes(), 1);
+}
+TYPED_TEST(BallTree, rbf_weighted_sum_exact) {
+    using real_type = TypeParam;
+
+    const std::vector<std::vector<real_type>> points = generate_random_points<real_type>(200, 4);
+    // note: positive weights avoid cancellation in the sums, i.e., the result doesn't depend on the summation order
+    const std::vector<real_type> weights = util::generate_random_vector<real_type>(200, real_type{ 0.1 }, real_type{ 1.0 });
+    const plssvm::detail::ball_tree<real_type> tree{ points, weights, 8 };
+
+    // a tolerance of zero must never skip a support vector
+    for (const std::vector<real_type> &query : generate_random_points<real_type>(10, 4)) {
+        const auto [value, error_bound] = tree.rbf_weighted_sum(query, real_type{ 0.1 }, real_type{ 0.0 });
+        EXPECT_FLOATING_POINT_NEAR_EPS(value, exact_rbf_weighted_sum(points, weights, query, real_type{ 0.1 }), real_type{ 1.0e3 });
+        EXPECT_EQ(error_bound, real_type{ 0.0 });
+    }
+}
+TYPED_TEST(BallTree, rbf_weighted_sum_approximated) {
+    using real_type = TypeParam;
+
+    const std::vector<std::vector<real_type>> points = generate_random_points<real_type>(1000, 2);
+    const std::vector<real_type> weights = util::generate_random_vector<real_type>(1000);
+    const plssvm::detail::ball_tree<real_type> tree{ points, weights };
+
+    for (const real_type tolerance : { real_type{ 1.0e-4 }, real_type{ 1.0e-2 }, real_type{ 1.0 } }) {
+        for (const std::vector<real_type> &query : generate_random_points<real_type>(10, 2)) {
+            const auto [value, error_bound] = tree.rbf_weighted_sum(query, real_type{ 1.0 }, tolerance);
+            // the reported error bound may never exceed the requested tolerance
+            EXPECT_GE(error_bound, real_type{ 0.0 });
+            EXPECT_LE(error_bound, tolerance);
+            // the actual error must be within the reported error bound (plus rounding errors)
+            EXPECT_LE(std::abs(value - exact_rbf_weighted_sum(points, weights, query, real_type{ 1.0 })), error_bound + real_type{ 1.0e-3 } * tolerance + real_type{ 100.0 } * std::numeric_limits<real_type>::epsilon());
+        }
+    }
+}
+TYPED_TEST(BallTree, rbf_weighted_sum_distant_query) {
+    using real_type = TypeParam;
+
+    const std::vector<std::vector<real_type>> points = generate_random_points<real_type>(100, 2);
+    const std::vector<real_type> weights = util::generate_random_vector<real_type>(100);
+    const plssvm::detail::ball_tree<real_type> tree{ points, weights };
+
+    // all support vectors are far away from the query point, i.e., the whole tree is pruned
+    const auto [value, error_bound] = tree.rbf_weighted_sum(std::vector<real_type>{ real_type{ 1000.0 }, real_type{ 1000.0 } }, real_type{ 1.0 }, real_type{ 1.0e-6 });
+    EXPECT_EQ(value, real_type{ 0.0 });
+    EXPECT_LT(error_bound, real_type{ 1.0e-6 });
+}
+
+template <typename T>
+class BallTreeDeathTest : public ::testing::Test {};
+TYPED_TEST_SUITE(BallTreeDeathTest, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(BallTreeDeathTest, construct) {
+    using real_type = TypeParam;
+
+    const std::vector<std::vector<real_type>> points = generate_random_points<real_type>(4, 2);
+
+    // the number of weights must match the number of points
+    EXPECT_DEATH((plssvm::detail::ball_tree<real_type>{ points, std::vector<real_type>(3) }), ::testing::HasSubstr("Sizes mismatch!: 4 != 3"));
+    // the leaf size must be positive
+    EXPECT_DEATH((plssvm::detail::ball_tree<real_type>{ points, std::vector<real_type>(4), 0 }), "The leaf size must be greater than 0!");
+}
+TYPED_TEST(BallTreeDeathTest, rbf_weighted_sum) {
+    using real_type = TypeParam;
+
+    const plssvm::detail::ball_tree<real_type> tree{ generate_random_points<real_type>(4, 2), std::vector<real_type>(4, real_type{ 1.0 }) };
+
+    // the query point must have the same number of features
+    EXPECT_DEATH(std::ignore = tree.rbf_weighted_sum(std::vector<real_type>(3), real_type{ 1.0 }, real_type{ 0.1 }), ::testing::HasSubstr("Sizes mismatch!: 3 != 2"));
+    // the tolerance must not be negative
+    EXPECT_DEATH(std::ignore = tree.rbf_weighted_sum(std::vector<real_type>(2), real_type{ 1.0 }, real_type{ -0.1 }), ::testing::HasSubstr("The tolerance must be greater or equal than 0"));
+}
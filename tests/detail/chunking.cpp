@@ -0,0 +1,73 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the functions used to split data into chunks fitting into the device memory.
+ */
+
+#include "plssvm/detail/chunking.hpp"  // plssvm::detail::{calculate_chunk_size, calculate_chunk_bounds}
+
+#include "gtest/gtest.h"               // TEST, EXPECT_EQ, EXPECT_DEATH
+
+#include <cstddef>                     // std::size_t
+#include <tuple>                       // std::ignore
+#include <vector>                      // std::vector
+
+TEST(Chunking, calculate_chunk_size_all_points_fit) {
+    // all data points fit into a single chunk
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 0, 8, 1, 100), 100);
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 224, 8, 1, 100), 100);
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 0, 4, 2, 128, 32), 128);
+}
+TEST(Chunking, calculate_chunk_size) {
+    // only a part of the data points fits into a chunk
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 0, 8, 1, 1000), 128);
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 224, 8, 1, 1000), 100);
+    // double buffering halves the chunk size
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 224, 8, 2, 1000), 50);
+}
+TEST(Chunking, calculate_chunk_size_alignment) {
+    // the chunk size is rounded down to a multiple of the alignment
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 224, 8, 1, 1000, 16), 96);
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 224, 8, 2, 1000, 16), 48);
+    // if less data points than the alignment fit, the alignment is ignored
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 224, 8, 2, 1000, 64), 50);
+}
+TEST(Chunking, calculate_chunk_size_nothing_fits) {
+    // the fixed number of bytes already exceeds the memory budget
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 1024, 8, 1, 1000), 0);
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 2048, 8, 1, 1000), 0);
+    // not even a single data point fits
+    EXPECT_EQ(plssvm::detail::calculate_chunk_size(1024, 1020, 8, 1, 1000), 0);
+}
+
+TEST(Chunking, calculate_chunk_bounds_single_chunk) {
+    EXPECT_EQ(plssvm::detail::calculate_chunk_bounds(10, 10), (std::vector<std::size_t>{ 0, 10 }));
+    EXPECT_EQ(plssvm::detail::calculate_chunk_bounds(10, 20), (std::vector<std::size_t>{ 0, 10 }));
+}
+TEST(Chunking, calculate_chunk_bounds) {
+    // the chunks evenly split the data points
+    EXPECT_EQ(plssvm::detail::calculate_chunk_bounds(10, 5), (std::vector<std::size_t>{ 0, 5, 10 }));
+    EXPECT_EQ(plssvm::detail::calculate_chunk_bounds(12, 4), (std::vector<std::size_t>{ 0, 4, 8, 12 }));
+}
+TEST(Chunking, calculate_chunk_bounds_balanced) {
+    // the chunks have nearly the same size and never exceed the chunk size
+    EXPECT_EQ(plssvm::detail::calculate_chunk_bounds(10, 4), (std::vector<std::size_t>{ 0, 3, 6, 10 }));
+    EXPECT_EQ(plssvm::detail::calculate_chunk_bounds(9, 8), (std::vector<std::size_t>{ 0, 4, 9 }));
+    EXPECT_EQ(plssvm::detail::calculate_chunk_bounds(5, 1), (std::vector<std::size_t>{ 0, 1, 2, 3, 4, 5 }));
+}
+
+TEST(ChunkingDeathTest, calculate_chunk_size) {
+    // the number of bytes per data point, the number of buffers, and the alignment must be greater than 0
+    EXPECT_DEATH(std::ignore = plssvm::detail::calculate_chunk_size(1024, 0, 0, 1, 100), "Each data point must need at least one byte!");
+    EXPECT_DEATH(std::ignore = plssvm::detail::calculate_chunk_size(1024, 0, 8, 0, 100), "At least one buffer must be used!");
+    EXPECT_DEATH(std::ignore = plssvm::detail::calculate_chunk_size(1024, 0, 8, 1, 100, 0), "The alignment must be greater than 0!");
+}
+TEST(ChunkingDeathTest, calculate_chunk_bounds) {
+    // the number of data points and the chunk size must be greater than 0
+    EXPECT_DEATH(std::ignore = plssvm::detail::calculate_chunk_bounds(0, 10), "At least one data point must be split into chunks!");
+    EXPECT_DEATH(std::ignore = plssvm::detail::calculate_chunk_bounds(10, 0), "The chunk size must be greater than 0!");
+}
@@ -10,6 +10,7 @@
 
 #include "plssvm/detail/cmd/parser_train.hpp"
 #include "plssvm/detail/logger.hpp"      // plssvm::verbosity
+#include "plssvm/solver_types.hpp"       // plssvm::solver_type
 
 #include "../../custom_test_macros.hpp"  // EXPECT_CONVERSION_TO_STRING
 #include "../../naming.hpp"              // naming::{pretty_print_parameter_flag_and_value, pretty_print_parameter_flag}
@@ -42,14 +43,20 @@ TEST_F(ParserTrain, minimal) {
     EXPECT_DOUBLE_EQ(parser.epsilon.value(), 0.001);
     EXPECT_TRUE(parser.max_iter.is_default());
     EXPECT_EQ(parser.max_iter.value(), 0);
+    EXPECT_TRUE(parser.solver.is_default());
+    EXPECT_EQ(parser.solver.value(), plssvm::solver_type::cg);
     EXPECT_EQ(parser.backend, plssvm::backend_type::automatic);
     EXPECT_EQ(parser.target, plssvm::target_platform::automatic);
     EXPECT_EQ(parser.sycl_kernel_invocation_type, plssvm::sycl::kernel_invocation_type::automatic);
     EXPECT_EQ(parser.sycl_implementation_type, plssvm::sycl::implementation_type::automatic);
     EXPECT_FALSE(parser.strings_as_labels);
     EXPECT_FALSE(parser.float_as_real_type);
+    EXPECT_FALSE(parser.mixed_precision);
     EXPECT_EQ(parser.input_filename, "data.libsvm");
     EXPECT_EQ(parser.model_filename, "data.libsvm.model");
+    EXPECT_EQ(parser.checkpoint_filename, "");
+    EXPECT_EQ(parser.checkpoint_interval, 10);
+    EXPECT_FALSE(parser.resume);
     EXPECT_EQ(parser.performance_tracking_filename, "");
 }
 TEST_F(ParserTrain, minimal_output) {
@@ -65,17 +72,21 @@ TEST_F(ParserTrain, minimal_output) {
         "cost: 1 (default)\n"
         "epsilon: 0.001 (default)\n"
         "max_iter: num_data_points (default)\n"
+        "solver: cg (default)\n"
         "label_type: int (default)\n"
         "real_type: double (default)\n"
         "input file (data set): 'data.libsvm'\n"
         "output file (model): 'data.libsvm.model'\n"
+        "checkpoint file: ''\n"
+        "checkpoint interval: 10\n"
+        "resume: false\n"
         "performance tracking file: ''\n";
     EXPECT_CONVERSION_TO_STRING(parser, correct);
 }
 
 TEST_F(ParserTrain, all_arguments) {
     // create artificial command line arguments in test fixture
-    std::vector<std::string> cmd_args = { "./plssvm-train", "--kernel_type", "1", "--degree", "2", "--gamma", "1.5", "--coef0", "-1.5", "--cost", "2", "--epsilon", "1e-10", "--max_iter", "100", "--backend", "cuda", "--target_platform", "gpu_nvidia", "--use_strings_as_labels", "--use_float_as_real_type", "--verbosity", "libsvm" };
+    std::vector<std::string> cmd_args = { "./plssvm-train", "--kernel_type", "1", "--degree", "2", "--gamma", "1.5", "--coef0", "-1.5", "--cost", "2", "--epsilon", "1e-10", "--max_iter", "100", "--solver", "pipelined_cg", "--backend", "cuda", "--target_platform", "gpu_nvidia", "--use_strings_as_labels", "--use_float_as_real_type", "--checkpoint", "data.checkpoint", "--checkpoint_interval", "5", "--resume", "--verbosity", "libsvm" };
 #if defined(PLSSVM_HAS_SYCL_BACKEND)
     cmd_args.insert(cmd_args.end(), { "--sycl_kernel_invocation_type", "nd_range", "--sycl_implementation_type", "dpcpp" });
 #endif
@@ -99,6 +110,8 @@ TEST_F(ParserTrain, all_arguments) {
     EXPECT_DOUBLE_EQ(parser.epsilon.value(), 1e-10);
     EXPECT_FALSE(parser.max_iter.is_default());
     EXPECT_EQ(parser.max_iter.value(), 100);
+    EXPECT_FALSE(parser.solver.is_default());
+    EXPECT_EQ(parser.solver.value(), plssvm::solver_type::pipelined_cg);
     EXPECT_EQ(parser.backend, plssvm::backend_type::cuda);
     EXPECT_EQ(parser.target, plssvm::target_platform::gpu_nvidia);
 #if defined(PLSSVM_HAS_SYCL_BACKEND)
@@ -112,6 +125,9 @@ TEST_F(ParserTrain, all_arguments) {
     EXPECT_TRUE(parser.float_as_real_type);
     EXPECT_EQ(parser.input_filename, "data.libsvm");
     EXPECT_EQ(parser.model_filename, "data.libsvm.model");
+    EXPECT_EQ(parser.checkpoint_filename, "data.checkpoint");
+    EXPECT_EQ(parser.checkpoint_interval, 5);
+    EXPECT_TRUE(parser.resume);
 #if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
     EXPECT_EQ(parser.performance_tracking_filename, "tracking.yaml");
 #else
@@ -121,7 +137,7 @@ TEST_F(ParserTrain, all_arguments) {
 }
 TEST_F(ParserTrain, all_arguments_output) {
     // create artificial command line arguments in test fixture
-    std::vector<std::string> cmd_args = { "./plssvm-train", "--kernel_type", "1", "--degree", "2", "--gamma", "1.5", "--coef0", "-1.5", "--cost", "2", "--epsilon", "1e-10", "--max_iter", "100", "--backend", "cuda", "--target_platform", "gpu_nvidia", "--use_strings_as_labels", "--use_float_as_real_type", "--verbosity", "libsvm" };
+    std::vector<std::string> cmd_args = { "./plssvm-train", "--kernel_type", "1", "--degree", "2", "--gamma", "1.5", "--coef0", "-1.5", "--cost", "2", "--epsilon", "1e-10", "--max_iter", "100", "--solver", "pipelined_cg", "--backend", "cuda", "--target_platform", "gpu_nvidia", "--use_strings_as_labels", "--use_float_as_real_type", "--checkpoint", "data.checkpoint", "--checkpoint_interval", "5", "--resume", "--verbosity", "libsvm" };
 #if defined(PLSSVM_HAS_SYCL_BACKEND)
     cmd_args.insert(cmd_args.end(), { "--sycl_kernel_invocation_type", "nd_range", "--sycl_implementation_type", "dpcpp" });
 #endif
@@ -143,10 +159,14 @@ TEST_F(ParserTrain, all_arguments_output) {
         "cost: 2\n"
         "epsilon: 1e-10\n"
         "max_iter: 100\n"
+        "solver: pipelined_cg\n"
         "label_type: std::string\n"
         "real_type: float\n"
         "input file (data set): 'data.libsvm'\n"
         "output file (model): 'data.libsvm.model'\n"
+        "checkpoint file: 'data.checkpoint'\n"
+        "checkpoint interval: 5\n"
+        "resume: true\n"
 #if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
         "performance tracking file: 'tracking.yaml'\n";
 #else
@@ -316,6 +336,36 @@ INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainMaxIterDeathTest, ::te
                 naming::pretty_print_parameter_flag_and_value<ParserTrainMaxIterDeathTest>);
 // clang-format on
 
+class ParserTrainSolver : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainSolver, parsing) {
+    const auto &[flag, value] = GetParam();
+    // convert string to solver_type
+    const auto solver = util::convert_from_string<plssvm::solver_type>(value);
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_FALSE(parser.solver.is_default());
+    EXPECT_EQ(parser.solver.value(), solver);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainSolver, ::testing::Combine(
+                ::testing::Values("-s", "--solver"),
+                ::testing::Values("cg", "pipelined_cg", "CG", "pipelined")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainSolver>);
+// clang-format on
+
+TEST_F(ParserTrain, mixed_precision_with_pipelined_cg) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--solver", "pipelined_cg", "--use_mixed_precision", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // mixed precision must be ignored in combination with the pipelined CG algorithm
+    EXPECT_EQ(parser.solver.value(), plssvm::solver_type::pipelined_cg);
+    EXPECT_FALSE(parser.mixed_precision);
+}
+
 class ParserTrainBackend : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
 TEST_P(ParserTrainBackend, parsing) {
     const auto &[flag, value] = GetParam();
@@ -417,6 +467,111 @@ INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainPerformanceTrackingFilename, ::
 
 #endif  // PLSSVM_PERFORMANCE_TRACKER_ENABLED
 
+class ParserTrainRBFTolerance : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainRBFTolerance, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_DOUBLE_EQ(parser.rbf_tolerance, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainRBFTolerance, ::testing::Combine(
+                ::testing::Values("--rbf_tolerance"),
+                ::testing::Values(0.0, 1e-6, 0.5)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainRBFTolerance>);
+// clang-format on
+
+class ParserTrainRBFToleranceDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, double>> {};
+TEST_P(ParserTrainRBFToleranceDeathTest, rbf_tolerance_explicit_less_than_zero) {
+    const auto &[flag, rbf_tolerance] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", rbf_tolerance), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("rbf_tolerance must be greater or equal than 0.0, but is {}!", rbf_tolerance)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainRBFToleranceDeathTest, ::testing::Combine(
+                ::testing::Values("--rbf_tolerance"),
+                ::testing::Values(-1.0, -1e-6)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainRBFToleranceDeathTest>);
+// clang-format on
+
+class ParserTrainCheckpointFilename : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTrainCheckpointFilename, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.checkpoint_filename, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainCheckpointFilename, ::testing::Combine(
+                ::testing::Values("--checkpoint"),
+                ::testing::Values("data.checkpoint", "test.bin")),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCheckpointFilename>);
+// clang-format on
+
+class ParserTrainCheckpointInterval : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
+TEST_P(ParserTrainCheckpointInterval, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.checkpoint_interval, static_cast<std::size_t>(value));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainCheckpointInterval, ::testing::Combine(
+                ::testing::Values("--checkpoint_interval"),
+                ::testing::Values(1, 10, 42)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCheckpointInterval>);
+// clang-format on
+
+class ParserTrainCheckpointIntervalDeathTest : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, long long int>> {};
+TEST_P(ParserTrainCheckpointIntervalDeathTest, checkpoint_interval_explicit_less_or_equal_to_zero) {
+    const auto &[flag, checkpoint_interval] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", flag, fmt::format("{}", checkpoint_interval), "data.libsvm" });
+    // create parameter object
+    EXPECT_DEATH((plssvm::detail::cmd::parser_train{ this->argc, this->argv }), ::testing::HasSubstr(fmt::format("checkpoint_interval must be greater than 0, but is {}!", checkpoint_interval)));
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrainDeathTest, ParserTrainCheckpointIntervalDeathTest, ::testing::Combine(
+                ::testing::Values("--checkpoint_interval"),
+                ::testing::Values(-10, -1, 0)),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainCheckpointIntervalDeathTest>);
+// clang-format on
+
+class ParserTrainResume : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
+TEST_P(ParserTrainResume, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--checkpoint", "data.checkpoint", fmt::format("{}={}", flag, value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.resume, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainResume, ::testing::Combine(
+                ::testing::Values("--resume"),
+                ::testing::Bool()),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainResume>);
+// clang-format on
+
+TEST_F(ParserTrainDeathTest, resume_without_checkpoint) {
+    this->CreateCMDArgs({ "./plssvm-train", "--resume", "data.libsvm" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_train{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr("Error missing checkpoint file (--checkpoint) to resume the CG algorithm from!"));
+}
+
 class ParserTrainUseStringsAsLabels : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
 TEST_P(ParserTrainUseStringsAsLabels, parsing) {
     const auto &[flag, value] = GetParam();
@@ -451,6 +606,33 @@ INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainUseFloatAsRealType, ::testing::
                 naming::pretty_print_parameter_flag_and_value<ParserTrainUseFloatAsRealType>);
 // clang-format on
 
+class ParserTrainUseMixedPrecision : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, bool>> {};
+TEST_P(ParserTrainUseMixedPrecision, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", fmt::format("{}={}", flag, value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.mixed_precision, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTrain, ParserTrainUseMixedPrecision, ::testing::Combine(
+                ::testing::Values("--use_mixed_precision"),
+                ::testing::Bool()),
+                naming::pretty_print_parameter_flag_and_value<ParserTrainUseMixedPrecision>);
+// clang-format on
+
+TEST_F(ParserTrain, mixed_precision_with_float_as_real_type) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-train", "--use_float_as_real_type", "--use_mixed_precision", "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_train parser{ this->argc, this->argv };
+    // mixed precision must be ignored if float is used as real_type
+    EXPECT_TRUE(parser.float_as_real_type);
+    EXPECT_FALSE(parser.mixed_precision);
+}
+
 class ParserTrainVerbosity : public ParserTrain, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
 TEST_P(ParserTrainVerbosity, parsing) {
     const auto &[flag, value] = GetParam();
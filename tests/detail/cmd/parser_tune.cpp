@@ -0,0 +1,377 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the tune cmd parameter parsing.
+ */
+
+#include "plssvm/detail/cmd/parser_tune.hpp"
+#include "plssvm/backend_types.hpp"          // plssvm::backend_type
+#include "plssvm/detail/logger.hpp"          // plssvm::verbosity
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type
+#include "plssvm/target_platforms.hpp"       // plssvm::target_platform
+
+#include "../../custom_test_macros.hpp"      // EXPECT_CONVERSION_TO_STRING, EXPECT_CONVERSION_FROM_STRING
+#include "../../naming.hpp"                  // naming::{pretty_print_parameter_flag_and_value, pretty_print_parameter_flag}
+#include "utility.hpp"                       // util::ParameterBase
+
+#include "fmt/core.h"                        // fmt::format, fmt::join
+#include "gmock/gmock-matchers.h"            // ::testing::{StartsWith, HasSubstr, ElementsAre}
+#include "gtest/gtest.h"                     // TEST, TEST_F, TEST_P, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_EXIT, EXPECT_DEATH, EXPECT_THAT, INSTANTIATE_TEST_SUITE_P,
+                                             // ::testing::WithParamInterface, ::testing::Combine, ::testing::Values, ::testing::ExitedWithCode
+
+#include <cstddef>                           // std::size_t
+#include <cstdlib>                           // EXIT_SUCCESS, EXIT_FAILURE
+#include <sstream>                           // std::istringstream
+#include <string>                            // std::string
+#include <tuple>                             // std::tuple
+#include <vector>                            // std::vector
+
+// check whether the plssvm::detail::cmd::search_type -> std::string conversions are correct
+TEST(SearchType, to_string) {
+    EXPECT_CONVERSION_TO_STRING(plssvm::detail::cmd::search_type::grid, "grid");
+    EXPECT_CONVERSION_TO_STRING(plssvm::detail::cmd::search_type::random, "random");
+    EXPECT_CONVERSION_TO_STRING(plssvm::detail::cmd::search_type::successive_halving, "successive_halving");
+}
+TEST(SearchType, to_string_unknown) {
+    // check conversions to std::string from unknown search_type
+    EXPECT_CONVERSION_TO_STRING(static_cast<plssvm::detail::cmd::search_type>(3), "unknown");
+}
+
+// check whether the std::string -> plssvm::detail::cmd::search_type conversions are correct
+TEST(SearchType, from_string) {
+    EXPECT_CONVERSION_FROM_STRING("grid", plssvm::detail::cmd::search_type::grid);
+    EXPECT_CONVERSION_FROM_STRING("GRID", plssvm::detail::cmd::search_type::grid);
+    EXPECT_CONVERSION_FROM_STRING("random", plssvm::detail::cmd::search_type::random);
+    EXPECT_CONVERSION_FROM_STRING("Random", plssvm::detail::cmd::search_type::random);
+    EXPECT_CONVERSION_FROM_STRING("successive_halving", plssvm::detail::cmd::search_type::successive_halving);
+    EXPECT_CONVERSION_FROM_STRING("halving", plssvm::detail::cmd::search_type::successive_halving);
+}
+TEST(SearchType, from_string_unknown) {
+    // foo isn't a valid search_type
+    std::istringstream input{ "foo" };
+    plssvm::detail::cmd::search_type search{};
+    input >> search;
+    EXPECT_TRUE(input.fail());
+}
+
+class ParserTune : public util::ParameterBase {};
+class ParserTuneDeathTest : public util::ParameterBase {};
+
+TEST_F(ParserTune, minimal) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-tune", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_tune parser{ this->argc, this->argv };
+
+    // check default values
+    EXPECT_THAT(parser.kernel_types, ::testing::ElementsAre(plssvm::kernel_function_type::linear));
+    EXPECT_THAT(parser.degrees, ::testing::ElementsAre(3));
+    EXPECT_TRUE(parser.gammas.empty());
+    EXPECT_THAT(parser.coef0s, ::testing::ElementsAre(0.0));
+    EXPECT_THAT(parser.costs, ::testing::ElementsAre(1.0));
+    EXPECT_EQ(parser.search, plssvm::detail::cmd::search_type::grid);
+    EXPECT_EQ(parser.num_trials, 10);
+    EXPECT_EQ(parser.halving_factor, 2);
+    EXPECT_EQ(parser.seed, 42);
+    EXPECT_EQ(parser.num_folds, 5);
+    EXPECT_EQ(parser.num_parallel_trials, 1);
+    EXPECT_TRUE(parser.epsilon.is_default());
+    EXPECT_DOUBLE_EQ(parser.epsilon.value(), 0.001);
+    EXPECT_TRUE(parser.max_iter.is_default());
+    EXPECT_EQ(parser.max_iter.value(), 0);
+    EXPECT_EQ(parser.backend, plssvm::backend_type::automatic);
+    EXPECT_EQ(parser.target, plssvm::target_platform::automatic);
+    EXPECT_FALSE(parser.strings_as_labels);
+    EXPECT_FALSE(parser.float_as_real_type);
+    EXPECT_EQ(parser.input_filename, "data.libsvm");
+    EXPECT_EQ(parser.leaderboard_filename, "data.libsvm.leaderboard");
+    EXPECT_EQ(parser.performance_tracking_filename, "");
+}
+TEST_F(ParserTune, minimal_output) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-tune", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_tune parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_types: linear\n"
+        "degrees: 3\n"
+        "gammas: 1 / num_features (default)\n"
+        "coef0s: 0\n"
+        "costs: 1\n"
+        "search: grid\n"
+        "num_folds: 5\n"
+        "num_parallel_trials: 1\n"
+        "epsilon: 0.001 (default)\n"
+        "max_iter: num_data_points (default)\n"
+        "label_type: int (default)\n"
+        "real_type: double (default)\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (leaderboard): 'data.libsvm.leaderboard'\n"
+        "performance tracking file: ''\n";
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+}
+
+TEST_F(ParserTune, all_arguments) {
+    // create artificial command line arguments in test fixture
+    std::vector<std::string> cmd_args = { "./plssvm-tune", "-t", "1,2", "-d", "2,4", "-g", "0.1,1", "-r", "-1,1", "-c", "0.5,2,8", "-s", "random", "-n", "3", "--halving_factor", "4", "--seed", "1337", "-k", "3", "-j", "2", "-e", "0.01", "-i", "100", "-b", "openmp", "-p", "cpu" };
+#if defined(PLSSVM_HAS_SYCL_BACKEND)
+    cmd_args.insert(cmd_args.end(), { "--sycl_kernel_invocation_type", "nd_range", "--sycl_implementation_type", "dpcpp" });
+#endif
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+    cmd_args.insert(cmd_args.end(), { "--performance_tracking", "tracking.yaml" });
+#endif
+    cmd_args.insert(cmd_args.end(), { "--use_strings_as_labels", "--use_float_as_real_type", "--verbosity", "libsvm", "data.libsvm", "data.libsvm.board" });
+    this->CreateCMDArgs(cmd_args);
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_tune parser{ this->argc, this->argv };
+
+    // check parsed values
+    EXPECT_THAT(parser.kernel_types, ::testing::ElementsAre(plssvm::kernel_function_type::polynomial, plssvm::kernel_function_type::rbf));
+    EXPECT_THAT(parser.degrees, ::testing::ElementsAre(2, 4));
+    EXPECT_THAT(parser.gammas, ::testing::ElementsAre(0.1, 1.0));
+    EXPECT_THAT(parser.coef0s, ::testing::ElementsAre(-1.0, 1.0));
+    EXPECT_THAT(parser.costs, ::testing::ElementsAre(0.5, 2.0, 8.0));
+    EXPECT_EQ(parser.search, plssvm::detail::cmd::search_type::random);
+    EXPECT_EQ(parser.num_trials, 3);
+    EXPECT_EQ(parser.halving_factor, 4);
+    EXPECT_EQ(parser.seed, 1337);
+    EXPECT_EQ(parser.num_folds, 3);
+    EXPECT_EQ(parser.num_parallel_trials, 2);
+    EXPECT_FALSE(parser.epsilon.is_default());
+    EXPECT_DOUBLE_EQ(parser.epsilon.value(), 0.01);
+    EXPECT_FALSE(parser.max_iter.is_default());
+    EXPECT_EQ(parser.max_iter.value(), 100);
+    EXPECT_EQ(parser.backend, plssvm::backend_type::openmp);
+    EXPECT_EQ(parser.target, plssvm::target_platform::cpu);
+    EXPECT_TRUE(parser.strings_as_labels);
+    EXPECT_TRUE(parser.float_as_real_type);
+    EXPECT_EQ(parser.input_filename, "data.libsvm");
+    EXPECT_EQ(parser.leaderboard_filename, "data.libsvm.board");
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+    EXPECT_EQ(parser.performance_tracking_filename, "tracking.yaml");
+#else
+    EXPECT_EQ(parser.performance_tracking_filename, "");
+#endif
+    EXPECT_EQ(plssvm::verbosity, plssvm::verbosity_level::libsvm);
+}
+TEST_F(ParserTune, all_arguments_output) {
+    // create artificial command line arguments in test fixture
+    std::vector<std::string> cmd_args = { "./plssvm-tune", "-t", "1,2", "-d", "2,4", "-g", "0.1,1", "-r", "-1,1", "-c", "0.5,2,8", "-s", "random", "-n", "3", "--seed", "1337", "-k", "3", "-j", "2", "-e", "0.01", "-i", "100" };
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+    cmd_args.insert(cmd_args.end(), { "--performance_tracking", "tracking.yaml" });
+#endif
+    cmd_args.insert(cmd_args.end(), { "--use_strings_as_labels", "--use_float_as_real_type", "--verbosity", "libsvm", "data.libsvm", "data.libsvm.board" });
+    this->CreateCMDArgs(cmd_args);
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_tune parser{ this->argc, this->argv };
+
+    // test output string
+    const std::string correct =
+        "kernel_types: polynomial, rbf\n"
+        "degrees: 2, 4\n"
+        "gammas: 0.1, 1\n"
+        "coef0s: -1, 1\n"
+        "costs: 0.5, 2, 8\n"
+        "search: random\n"
+        "num_trials: 3\n"
+        "seed: 1337\n"
+        "num_folds: 3\n"
+        "num_parallel_trials: 2\n"
+        "epsilon: 0.01\n"
+        "max_iter: 100\n"
+        "label_type: std::string\n"
+        "real_type: float\n"
+        "input file (data set): 'data.libsvm'\n"
+        "output file (leaderboard): 'data.libsvm.board'\n"
+#if defined(PLSSVM_PERFORMANCE_TRACKER_ENABLED)
+        "performance tracking file: 'tracking.yaml'\n";
+#else
+        "performance tracking file: ''\n";
+#endif
+    EXPECT_CONVERSION_TO_STRING(parser, correct);
+    EXPECT_EQ(plssvm::verbosity, plssvm::verbosity_level::libsvm);
+}
+TEST_F(ParserTune, successive_halving_output) {
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-tune", "--search", "successive_halving", "--halving_factor", "3", "data.libsvm" });
+
+    // create parameter object
+    const plssvm::detail::cmd::parser_tune parser{ this->argc, this->argv };
+
+    // only the halving factor should be additionally printed
+    const std::string output = fmt::format("{}", parser);
+    EXPECT_THAT(output, ::testing::HasSubstr("search: successive_halving\nhalving_factor: 3\nnum_folds: 5\n"));
+}
+
+// test all command line parameter separately
+class ParserTuneKernel : public ParserTune, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTuneKernel, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-tune", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_tune parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(fmt::format("{}", fmt::join(parser.kernel_types, ",")), value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTune, ParserTuneKernel, ::testing::Combine(
+                ::testing::Values("-t", "--kernel_type"),
+                ::testing::Values("linear", "polynomial", "rbf", "linear,rbf", "linear,polynomial,rbf")),
+                naming::pretty_print_parameter_flag_and_value<ParserTuneKernel>);
+// clang-format on
+
+class ParserTuneCost : public ParserTune, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTuneCost, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-tune", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_tune parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(fmt::format("{}", fmt::join(parser.costs, ",")), value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTune, ParserTuneCost, ::testing::Combine(
+                ::testing::Values("-c", "--cost"),
+                ::testing::Values("0.01", "1,10", "0.5,2.5,100")),
+                naming::pretty_print_parameter_flag_and_value<ParserTuneCost>);
+// clang-format on
+
+class ParserTuneSearch : public ParserTune, public ::testing::WithParamInterface<std::tuple<std::string, std::string>> {};
+TEST_P(ParserTuneSearch, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-tune", flag, value, "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_tune parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(fmt::format("{}", parser.search), value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTune, ParserTuneSearch, ::testing::Combine(
+                ::testing::Values("-s", "--search"),
+                ::testing::Values("grid", "random", "successive_halving")),
+                naming::pretty_print_parameter_flag_and_value<ParserTuneSearch>);
+// clang-format on
+
+class ParserTuneNumFolds : public ParserTune, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserTuneNumFolds, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-tune", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_tune parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.num_folds, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTune, ParserTuneNumFolds, ::testing::Combine(
+                ::testing::Values("-k", "--num_folds"),
+                ::testing::Values(2, 5, 10)),
+                naming::pretty_print_parameter_flag_and_value<ParserTuneNumFolds>);
+// clang-format on
+
+class ParserTuneNumParallelTrials : public ParserTune, public ::testing::WithParamInterface<std::tuple<std::string, std::size_t>> {};
+TEST_P(ParserTuneNumParallelTrials, parsing) {
+    const auto &[flag, value] = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-tune", flag, fmt::format("{}", value), "data.libsvm" });
+    // create parameter object
+    const plssvm::detail::cmd::parser_tune parser{ this->argc, this->argv };
+    // test for correctness
+    EXPECT_EQ(parser.num_parallel_trials, value);
+}
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(ParserTune, ParserTuneNumParallelTrials, ::testing::Combine(
+                ::testing::Values("-j", "--num_parallel_trials"),
+                ::testing::Values(1, 4, 16)),
+                naming::pretty_print_parameter_flag_and_value<ParserTuneNumParallelTrials>);
+// clang-format on
+
+class ParserTuneHelp : public ParserTune, public ::testing::WithParamInterface<std::string> {};
+TEST_P(ParserTuneHelp, parsing) {
+    const std::string &flag = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-tune", flag });
+    // create parameter object
+    EXPECT_EXIT((plssvm::detail::cmd::parser_tune{ this->argc, this->argv }), ::testing::ExitedWithCode(EXIT_SUCCESS), "");
+}
+INSTANTIATE_TEST_SUITE_P(ParserTune, ParserTuneHelp, ::testing::Values("-h", "--help"), naming::pretty_print_parameter_flag<ParserTuneHelp>);
+
+class ParserTuneVersion : public ParserTune, public ::testing::WithParamInterface<std::string> {};
+TEST_P(ParserTuneVersion, parsing) {
+    const std::string &flag = GetParam();
+    // create artificial command line arguments in test fixture
+    this->CreateCMDArgs({ "./plssvm-tune", flag });
+    // create parameter object
+    EXPECT_EXIT((plssvm::detail::cmd::parser_tune{ this->argc, this->argv }), ::testing::ExitedWithCode(EXIT_SUCCESS), "");
+}
+INSTANTIATE_TEST_SUITE_P(ParserTune, ParserTuneVersion, ::testing::Values("-v", "--version"), naming::pretty_print_parameter_flag<ParserTuneVersion>);
+
+TEST_F(ParserTuneDeathTest, no_positional_argument) {
+    this->CreateCMDArgs({ "./plssvm-tune" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_tune{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::StartsWith("Error missing input file!"));
+}
+TEST_F(ParserTuneDeathTest, too_many_positional_arguments) {
+    this->CreateCMDArgs({ "./plssvm-tune", "p1", "p2", "p3", "p4" });
+    EXPECT_EXIT((plssvm::detail::cmd::parser_tune{ this->argc, this->argv }),
+                ::testing::ExitedWithCode(EXIT_FAILURE),
+                ::testing::HasSubstr(R"(Only up to two positional options may be given, but 2 ("p3 p4") additional option(s) where provided!)"));
+}
+
+// test whether nonsensical cmd arguments trigger the assertions
+TEST_F(ParserTuneDeathTest, too_few_argc) {
+    EXPECT_DEATH((plssvm::detail::cmd::parser_tune{ 0, nullptr }),
+                 ::testing::HasSubstr("At least one argument is always given (the executable name), but argc is 0!"));
+}
+TEST_F(ParserTuneDeathTest, nullptr_argv) {
+    EXPECT_DEATH((plssvm::detail::cmd::parser_tune{ 1, nullptr }),
+                 ::testing::HasSubstr("At least one argument is always given (the executable name), but argv is a nullptr!"));
+}
+TEST_F(ParserTuneDeathTest, illegal_gamma) {
+    // a gamma value of zero is illegal
+    this->CreateCMDArgs({ "./plssvm-tune", "-g", "0.1,0.0", "data.libsvm" });
+    EXPECT_DEATH((plssvm::detail::cmd::parser_tune{ this->argc, this->argv }),
+                 ::testing::HasSubstr("All gammas must be greater than 0.0, but are 0.1,0!"));
+}
+TEST_F(ParserTuneDeathTest, illegal_num_folds) {
+    // at least two folds are necessary for a cross-validation
+    this->CreateCMDArgs({ "./plssvm-tune", "-k", "1", "data.libsvm" });
+    EXPECT_DEATH((plssvm::detail::cmd::parser_tune{ this->argc, this->argv }),
+                 ::testing::HasSubstr("num_folds must be greater or equal than 2, but is 1!"));
+}
+TEST_F(ParserTuneDeathTest, illegal_halving_factor) {
+    // a halving factor of one would never discard any hyper-parameter combination
+    this->CreateCMDArgs({ "./plssvm-tune", "--halving_factor", "1", "data.libsvm" });
+    EXPECT_DEATH((plssvm::detail::cmd::parser_tune{ this->argc, this->argv }),
+                 ::testing::HasSubstr("halving_factor must be greater or equal than 2, but is 1!"));
+}
+TEST_F(ParserTuneDeathTest, illegal_num_parallel_trials) {
+    // at least one trial must be evaluated at a time
+    this->CreateCMDArgs({ "./plssvm-tune", "-j", "0", "data.libsvm" });
+    EXPECT_DEATH((plssvm::detail::cmd::parser_tune{ this->argc, this->argv }),
+                 ::testing::HasSubstr("num_parallel_trials must be greater or equal than 1, but is 0!"));
+}
+TEST_F(ParserTuneDeathTest, illegal_max_iter) {
+    // max_iter must be positive
+    this->CreateCMDArgs({ "./plssvm-tune", "-i", "0", "data.libsvm" });
+    EXPECT_DEATH((plssvm::detail::cmd::parser_tune{ this->argc, this->argv }),
+                 ::testing::HasSubstr("max_iter must be greater than 0, but is 0!"));
+}
+TEST_F(ParserTuneDeathTest, unrecognized_option) {
+    this->CreateCMDArgs({ "./plssvm-tune", "--foo", "bar" });
+    EXPECT_DEATH((plssvm::detail::cmd::parser_tune{ this->argc, this->argv }), "");
+}
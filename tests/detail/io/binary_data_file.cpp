@@ -0,0 +1,142 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the memory mapped binary data file used in the out-of-core training.
+ */
+
+#include "plssvm/detail/io/binary_data_file.hpp"
+
+#include "plssvm/detail/io/cg_checkpoint.hpp"  // plssvm::detail::io::calculate_data_fingerprint
+#include "plssvm/exceptions/exceptions.hpp"    // plssvm::file_not_found_exception, plssvm::invalid_file_format_exception
+
+#include "../../custom_test_macros.hpp"        // EXPECT_FLOATING_POINT_VECTOR_EQ, EXPECT_THROW_WHAT
+#include "../../naming.hpp"                    // naming::real_type_to_name
+#include "../../types_to_test.hpp"             // util::real_type_gtest
+#include "../../utility.hpp"                   // util::temporary_file
+
+#include "fmt/core.h"                          // fmt::format
+#include "gtest/gtest.h"                       // TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, ASSERT_EQ, ::testing::Test
+
+#include <cstddef>                             // std::size_t
+#include <fstream>                             // std::ofstream, std::ios
+#include <type_traits>                         // std::conditional_t, std::is_same_v
+#include <vector>                              // std::vector
+
+template <typename T>
+class BinaryDataFile : public ::testing::Test {
+  protected:
+    using real_type = T;
+
+    /// The data points written to the binary data file.
+    const std::vector<std::vector<real_type>> data_{
+        { real_type{ -1.5 }, real_type{ 0.0 }, real_type{ 2.25 } },
+        { real_type{ 3.0 }, real_type{ -4.0 }, real_type{ 0.5 } },
+        { real_type{ 0.0 }, real_type{ 1.0 }, real_type{ -0.75 } },
+        { real_type{ 8.0 }, real_type{ 9.5 }, real_type{ 10.0 } }
+    };
+    /// The temporary binary data file.
+    util::temporary_file file_{};
+};
+TYPED_TEST_SUITE(BinaryDataFile, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(BinaryDataFile, write_read) {
+    using real_type = TypeParam;
+
+    // write the data points
+    plssvm::detail::io::write_binary_data_file(this->file_.filename, this->data_);
+
+    // read the data points back
+    const plssvm::detail::io::binary_data_file<real_type> file{ this->file_.filename };
+
+    // check for correctness
+    ASSERT_EQ(file.num_data_points(), this->data_.size());
+    ASSERT_EQ(file.num_features(), this->data_.front().size());
+    for (std::size_t i = 0; i < file.num_data_points(); ++i) {
+        const std::vector<real_type> data_point(file.data_point(i), file.data_point(i) + file.num_features());
+        EXPECT_FLOATING_POINT_VECTOR_EQ(data_point, this->data_[i]);
+    }
+}
+TYPED_TEST(BinaryDataFile, copy_data_points) {
+    using real_type = TypeParam;
+
+    plssvm::detail::io::write_binary_data_file(this->file_.filename, this->data_);
+    const plssvm::detail::io::binary_data_file<real_type> file{ this->file_.filename };
+
+    // copy the two middle data points into a buffer that is larger than necessary
+    std::vector<std::vector<real_type>> buffer(3, std::vector<real_type>(file.num_features()));
+    file.prefetch(1, 3);
+    file.copy_data_points(1, 3, buffer);
+    file.release(1, 3);
+
+    // check for correctness
+    EXPECT_FLOATING_POINT_VECTOR_EQ(buffer[0], this->data_[1]);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(buffer[1], this->data_[2]);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(buffer[2], std::vector<real_type>(file.num_features()));
+
+    // the released data points must still be accessible
+    const std::vector<real_type> data_point(file.data_point(2), file.data_point(2) + file.num_features());
+    EXPECT_FLOATING_POINT_VECTOR_EQ(data_point, this->data_[2]);
+}
+TYPED_TEST(BinaryDataFile, data_fingerprint) {
+    using real_type = TypeParam;
+
+    plssvm::detail::io::write_binary_data_file(this->file_.filename, this->data_);
+    const plssvm::detail::io::binary_data_file<real_type> file{ this->file_.filename };
+    const std::vector<real_type> b{ real_type{ 1.0 }, real_type{ -1.0 }, real_type{ 1.0 } };
+
+    // the fingerprint must be the same as for the data points in memory
+    EXPECT_EQ(plssvm::detail::io::calculate_data_fingerprint(file, b), plssvm::detail::io::calculate_data_fingerprint(this->data_, b));
+}
+
+TYPED_TEST(BinaryDataFile, read_non_existing_file) {
+    using real_type = TypeParam;
+
+    EXPECT_THROW_WHAT(plssvm::detail::io::binary_data_file<real_type>{ this->file_.filename + ".foo" },
+                      plssvm::file_not_found_exception,
+                      fmt::format("Couldn't find file: '{}.foo'!", this->file_.filename));
+}
+TYPED_TEST(BinaryDataFile, read_invalid_magic) {
+    using real_type = TypeParam;
+
+    {
+        std::ofstream out{ this->file_.filename };
+        out << "definitely not a binary data file, but long enough to contain a complete header";
+    }
+    EXPECT_THROW_WHAT(plssvm::detail::io::binary_data_file<real_type>{ this->file_.filename },
+                      plssvm::invalid_file_format_exception,
+                      fmt::format("The file '{}' isn't a valid binary data file!", this->file_.filename));
+}
+TYPED_TEST(BinaryDataFile, read_different_real_type) {
+    using real_type = TypeParam;
+    using other_real_type = std::conditional_t<std::is_same_v<real_type, float>, double, float>;
+
+    // write the data points using the other real_type
+    std::vector<std::vector<other_real_type>> data(this->data_.size());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = std::vector<other_real_type>(this->data_[i].cbegin(), this->data_[i].cend());
+    }
+    plssvm::detail::io::write_binary_data_file(this->file_.filename, data);
+
+    EXPECT_THROW_WHAT(plssvm::detail::io::binary_data_file<real_type>{ this->file_.filename },
+                      plssvm::invalid_file_format_exception,
+                      fmt::format("The binary data file '{}' has been written using a real_type with {} bytes, but the current real_type has {} bytes!", this->file_.filename, sizeof(other_real_type), sizeof(real_type)));
+}
+TYPED_TEST(BinaryDataFile, read_invalid_size) {
+    using real_type = TypeParam;
+
+    plssvm::detail::io::write_binary_data_file(this->file_.filename, this->data_);
+    // append an additional byte
+    {
+        std::ofstream out{ this->file_.filename, std::ios::binary | std::ios::app };
+        out.put('\0');
+    }
+    const std::size_t num_bytes = plssvm::detail::io::binary_data_file_header_size + this->data_.size() * this->data_.front().size() * sizeof(real_type) + 1;
+
+    EXPECT_THROW_WHAT(plssvm::detail::io::binary_data_file<real_type>{ this->file_.filename },
+                      plssvm::invalid_file_format_exception,
+                      fmt::format("The binary data file '{}' should contain 4 data points with 3 features each, but has a size of {} bytes!", this->file_.filename, num_bytes));
+}
@@ -0,0 +1,193 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for functions related to writing and reading checkpoints of the CG algorithm.
+ */
+
+#include "plssvm/detail/io/cg_checkpoint.hpp"
+
+#include "plssvm/detail/solver_control.hpp"  // plssvm::detail::solver_control
+#include "plssvm/exceptions/exceptions.hpp"  // plssvm::file_not_found_exception, plssvm::invalid_file_format_exception
+#include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type
+#include "plssvm/parameter.hpp"              // plssvm::detail::parameter
+#include "plssvm/solver_types.hpp"           // plssvm::solver_type
+
+#include "../../custom_test_macros.hpp"      // EXPECT_FLOATING_POINT_EQ, EXPECT_FLOATING_POINT_VECTOR_EQ, EXPECT_THROW_WHAT
+#include "../../naming.hpp"                  // naming::real_type_to_name
+#include "../../types_to_test.hpp"           // util::real_type_gtest
+#include "../../utility.hpp"                 // util::temporary_file
+
+#include "fmt/core.h"                        // fmt::format
+#include "gtest/gtest.h"                     // TYPED_TEST, TYPED_TEST_SUITE, EXPECT_EQ, EXPECT_NE, EXPECT_TRUE, EXPECT_FALSE, ASSERT_TRUE, ::testing::Test
+
+#include <cstdint>                           // std::uint64_t
+#include <fstream>                           // std::ofstream
+#include <optional>                          // std::optional
+#include <tuple>                             // std::ignore
+#include <vector>                            // std::vector
+
+template <typename T>
+class CGCheckpoint : public ::testing::Test, private util::redirect_output<> {
+  protected:
+    using real_type = T;
+
+    void SetUp() override {
+        params_.kernel_type = plssvm::kernel_function_type::rbf;
+        params_.gamma = real_type{ 0.5 };
+        params_.cost = real_type{ 2.0 };
+
+        checkpoint_.params = params_;
+        checkpoint_.solver = plssvm::solver_type::pipelined_cg;
+        checkpoint_.data_fingerprint = 42;
+        checkpoint_.iteration = 7;
+        checkpoint_.delta0 = real_type{ 10.0 };
+        checkpoint_.delta = real_type{ 0.5 };
+        checkpoint_.delta_old = real_type{ 0.75 };
+        checkpoint_.alpha_old = real_type{ 0.25 };
+        checkpoint_.x = { real_type{ 1.0 }, real_type{ 2.0 }, real_type{ 3.0 } };
+        checkpoint_.r = { real_type{ -0.1 }, real_type{ 0.2 }, real_type{ -0.3 } };
+        checkpoint_.d = { real_type{ 0.4 }, real_type{ -0.5 }, real_type{ 0.6 } };
+    }
+
+    /// The SVM parameters used to write the checkpoint.
+    plssvm::detail::parameter<real_type> params_{};
+    /// The checkpoint to write.
+    plssvm::detail::io::cg_checkpoint<real_type> checkpoint_{};
+    /// The temporary checkpoint file.
+    util::temporary_file file_{};
+};
+TYPED_TEST_SUITE(CGCheckpoint, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(CGCheckpoint, data_fingerprint) {
+    using real_type = TypeParam;
+
+    const std::vector<std::vector<real_type>> A{ { real_type{ 1.0 }, real_type{ 2.0 } }, { real_type{ 3.0 }, real_type{ 4.0 } } };
+    const std::vector<real_type> b{ real_type{ 1.0 }, real_type{ -1.0 } };
+
+    // the fingerprint must be deterministic
+    EXPECT_EQ(plssvm::detail::io::calculate_data_fingerprint(A, b), plssvm::detail::io::calculate_data_fingerprint(A, b));
+    // the fingerprint must change if the data points or the right-hand side change
+    std::vector<std::vector<real_type>> A_changed{ A };
+    A_changed[1][0] = real_type{ 3.5 };
+    EXPECT_NE(plssvm::detail::io::calculate_data_fingerprint(A, b), plssvm::detail::io::calculate_data_fingerprint(A_changed, b));
+    const std::vector<real_type> b_changed{ real_type{ -1.0 }, real_type{ 1.0 } };
+    EXPECT_NE(plssvm::detail::io::calculate_data_fingerprint(A, b), plssvm::detail::io::calculate_data_fingerprint(A, b_changed));
+}
+
+TYPED_TEST(CGCheckpoint, write_read) {
+    // write the checkpoint
+    plssvm::detail::io::write_cg_checkpoint(this->file_.filename, this->checkpoint_);
+
+    // read the checkpoint back
+    const auto checkpoint = plssvm::detail::io::read_cg_checkpoint(this->file_.filename, this->params_, plssvm::solver_type::pipelined_cg, 42, 3);
+
+    // check for correctness
+    EXPECT_TRUE(checkpoint.params.equivalent(this->params_));
+    EXPECT_EQ(checkpoint.solver, plssvm::solver_type::pipelined_cg);
+    EXPECT_EQ(checkpoint.data_fingerprint, 42);
+    EXPECT_EQ(checkpoint.iteration, 7);
+    EXPECT_FLOATING_POINT_EQ(checkpoint.delta0, this->checkpoint_.delta0);
+    EXPECT_FLOATING_POINT_EQ(checkpoint.delta, this->checkpoint_.delta);
+    EXPECT_FLOATING_POINT_EQ(checkpoint.delta_old, this->checkpoint_.delta_old);
+    EXPECT_FLOATING_POINT_EQ(checkpoint.alpha_old, this->checkpoint_.alpha_old);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(checkpoint.x, this->checkpoint_.x);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(checkpoint.r, this->checkpoint_.r);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(checkpoint.d, this->checkpoint_.d);
+}
+TYPED_TEST(CGCheckpoint, write_overwrite) {
+    // write the checkpoint twice with a different state
+    plssvm::detail::io::write_cg_checkpoint(this->file_.filename, this->checkpoint_);
+    this->checkpoint_.iteration = 14;
+    plssvm::detail::io::write_cg_checkpoint(this->file_.filename, this->checkpoint_);
+
+    // only the last state must be present
+    const auto checkpoint = plssvm::detail::io::read_cg_checkpoint(this->file_.filename, this->params_, plssvm::solver_type::pipelined_cg, 42, 3);
+    EXPECT_EQ(checkpoint.iteration, 14);
+}
+
+TYPED_TEST(CGCheckpoint, read_non_existing_file) {
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::read_cg_checkpoint(this->file_.filename + ".foo", this->params_, plssvm::solver_type::pipelined_cg, 42, 3)),
+                      plssvm::file_not_found_exception,
+                      fmt::format("Couldn't find file: '{}.foo'!", this->file_.filename));
+}
+TYPED_TEST(CGCheckpoint, read_invalid_magic) {
+    {
+        std::ofstream out{ this->file_.filename };
+        out << "definitely not a checkpoint file";
+    }
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::read_cg_checkpoint(this->file_.filename, this->params_, plssvm::solver_type::pipelined_cg, 42, 3)),
+                      plssvm::invalid_file_format_exception,
+                      fmt::format("The file '{}' isn't a valid checkpoint file!", this->file_.filename));
+}
+TYPED_TEST(CGCheckpoint, read_different_params) {
+    using real_type = TypeParam;
+
+    plssvm::detail::io::write_cg_checkpoint(this->file_.filename, this->checkpoint_);
+
+    plssvm::detail::parameter<real_type> params{ this->params_ };
+    params.gamma = real_type{ 0.1 };
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::read_cg_checkpoint(this->file_.filename, params, plssvm::solver_type::pipelined_cg, 42, 3)),
+                      plssvm::invalid_file_format_exception,
+                      fmt::format("The checkpoint file '{}' has been written using different SVM parameters!", this->file_.filename));
+}
+TYPED_TEST(CGCheckpoint, read_different_solver) {
+    plssvm::detail::io::write_cg_checkpoint(this->file_.filename, this->checkpoint_);
+
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::read_cg_checkpoint(this->file_.filename, this->params_, plssvm::solver_type::cg, 42, 3)),
+                      plssvm::invalid_file_format_exception,
+                      fmt::format("The checkpoint file '{}' has been written using the pipelined_cg solver, but the cg solver has been requested!", this->file_.filename));
+}
+TYPED_TEST(CGCheckpoint, read_different_data_fingerprint) {
+    plssvm::detail::io::write_cg_checkpoint(this->file_.filename, this->checkpoint_);
+
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::read_cg_checkpoint(this->file_.filename, this->params_, plssvm::solver_type::pipelined_cg, 43, 3)),
+                      plssvm::invalid_file_format_exception,
+                      fmt::format("The checkpoint file '{}' has been written for a different data set!", this->file_.filename));
+}
+TYPED_TEST(CGCheckpoint, read_different_num_rows) {
+    plssvm::detail::io::write_cg_checkpoint(this->file_.filename, this->checkpoint_);
+
+    EXPECT_THROW_WHAT((std::ignore = plssvm::detail::io::read_cg_checkpoint(this->file_.filename, this->params_, plssvm::solver_type::pipelined_cg, 42, 4)),
+                      plssvm::invalid_file_format_exception,
+                      fmt::format("The checkpoint file '{}' contains a vector with 3 values, but 4 were expected!", this->file_.filename));
+}
+
+TYPED_TEST(CGCheckpoint, resume_not_requested) {
+    using real_type = TypeParam;
+
+    plssvm::detail::io::write_cg_checkpoint(this->file_.filename, this->checkpoint_);
+
+    plssvm::detail::solver_control<real_type> control{};
+    control.solver = plssvm::solver_type::pipelined_cg;
+    control.checkpoint_file = this->file_.filename;
+    // resume hasn't been requested -> start from scratch
+    EXPECT_FALSE(plssvm::detail::io::resume_from_cg_checkpoint(control, this->params_, 42, 3).has_value());
+}
+TYPED_TEST(CGCheckpoint, resume_non_existing_file) {
+    using real_type = TypeParam;
+
+    plssvm::detail::solver_control<real_type> control{};
+    control.solver = plssvm::solver_type::pipelined_cg;
+    control.checkpoint_file = this->file_.filename + ".foo";
+    control.resume = true;
+    // the checkpoint file doesn't exist -> start from scratch
+    EXPECT_FALSE(plssvm::detail::io::resume_from_cg_checkpoint(control, this->params_, 42, 3).has_value());
+}
+TYPED_TEST(CGCheckpoint, resume) {
+    using real_type = TypeParam;
+
+    plssvm::detail::io::write_cg_checkpoint(this->file_.filename, this->checkpoint_);
+
+    plssvm::detail::solver_control<real_type> control{};
+    control.solver = plssvm::solver_type::pipelined_cg;
+    control.checkpoint_file = this->file_.filename;
+    control.resume = true;
+    const std::optional<plssvm::detail::io::cg_checkpoint<real_type>> checkpoint = plssvm::detail::io::resume_from_cg_checkpoint(control, this->params_, 42, 3);
+    ASSERT_TRUE(checkpoint.has_value());
+    EXPECT_EQ(checkpoint->iteration, 7);
+    EXPECT_FLOATING_POINT_VECTOR_EQ(checkpoint->x, this->checkpoint_.x);
+}
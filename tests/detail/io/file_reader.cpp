@@ -188,6 +188,23 @@ TEST(FileReader, is_open) {
     EXPECT_FALSE(reader.is_open());
 }
 
+TEST(FileReader, is_memory_mapped) {
+    // create a new default constructed file_reader
+    plssvm::detail::io::file_reader reader{};
+    // no file must be open, i.e., no file can be memory mapped
+    EXPECT_FALSE(reader.is_memory_mapped());
+    // open a non-empty file
+    reader.open(PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm");
+#if defined(PLSSVM_HAS_MEMORY_MAPPING)
+    EXPECT_TRUE(reader.is_memory_mapped());
+#else
+    EXPECT_FALSE(reader.is_memory_mapped());
+#endif
+    // close the file
+    reader.close();
+    EXPECT_FALSE(reader.is_memory_mapped());
+}
+
 TEST(FileReader, close) {
     // create a new file_reader and associate it to a file
     plssvm::detail::io::file_reader reader{ PLSSVM_TEST_PATH "/data/libsvm/5x4.libsvm" };
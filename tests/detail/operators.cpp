@@ -314,6 +314,58 @@ TYPED_TEST(OperatorsDeathTest, operator_squared_euclidean_dist) {
     EXPECT_DEATH(std::ignore = squared_euclidean_dist(this->b, this->a), "Sizes mismatch!: 2 != 4");
 }
 
+TYPED_TEST(Operators, operator_axpy) {
+    // calculate b = scalar * a + b in-place
+    axpy(this->scalar, this->a, this->b);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(this->b, (std::vector<TypeParam>{ 3, 5.5, 8, 10.5, 13 }));
+}
+TYPED_TEST(Operators, operator_axpy_dot) {
+    // calculate b = scalar * a + b in-place and the squared norm of the updated b
+    EXPECT_FLOATING_POINT_NEAR(axpy_dot(this->scalar, this->a, this->b), 382.5);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(this->b, (std::vector<TypeParam>{ 3, 5.5, 8, 10.5, 13 }));
+}
+TYPED_TEST(Operators, operator_axpy_empty) {
+    axpy(this->scalar, this->empty, this->empty);
+    EXPECT_FLOATING_POINT_NEAR(axpy_dot(this->scalar, this->empty, this->empty), 0);
+    EXPECT_TRUE(this->empty.empty());
+}
+TYPED_TEST(OperatorsDeathTest, operator_axpy) {
+    // try to update a vector with a vector of different size
+    EXPECT_DEATH(axpy(TypeParam{ 1.5 }, this->a, this->b), "Sizes mismatch!: 4 != 2");
+    EXPECT_DEATH(axpy(TypeParam{ 1.5 }, this->b, this->a), "Sizes mismatch!: 2 != 4");
+}
+TYPED_TEST(OperatorsDeathTest, operator_axpy_dot) {
+    // try to update a vector with a vector of different size
+    EXPECT_DEATH(std::ignore = axpy_dot(TypeParam{ 1.5 }, this->a, this->b), "Sizes mismatch!: 4 != 2");
+    EXPECT_DEATH(std::ignore = axpy_dot(TypeParam{ 1.5 }, this->b, this->a), "Sizes mismatch!: 2 != 4");
+}
+
+TYPED_TEST(Operators, operator_xpby) {
+    // calculate b = a + scalar * b in-place
+    xpby(this->a, this->scalar, this->b);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(this->b, (std::vector<TypeParam>{ 3.25, 5.75, 8.25, 10.75, 13.25 }));
+}
+TYPED_TEST(Operators, operator_xpby_dot) {
+    // calculate b = a + scalar * b in-place and the squared norm of the updated b
+    EXPECT_FLOATING_POINT_NEAR(xpby_dot(this->a, this->scalar, this->b), 402.8125);
+    EXPECT_FLOATING_POINT_VECTOR_NEAR(this->b, (std::vector<TypeParam>{ 3.25, 5.75, 8.25, 10.75, 13.25 }));
+}
+TYPED_TEST(Operators, operator_xpby_empty) {
+    xpby(this->empty, this->scalar, this->empty);
+    EXPECT_FLOATING_POINT_NEAR(xpby_dot(this->empty, this->scalar, this->empty), 0);
+    EXPECT_TRUE(this->empty.empty());
+}
+TYPED_TEST(OperatorsDeathTest, operator_xpby) {
+    // try to update a vector with a vector of different size
+    EXPECT_DEATH(xpby(this->a, TypeParam{ 1.5 }, this->b), "Sizes mismatch!: 4 != 2");
+    EXPECT_DEATH(xpby(this->b, TypeParam{ 1.5 }, this->a), "Sizes mismatch!: 2 != 4");
+}
+TYPED_TEST(OperatorsDeathTest, operator_xpby_dot) {
+    // try to update a vector with a vector of different size
+    EXPECT_DEATH(std::ignore = xpby_dot(this->a, TypeParam{ 1.5 }, this->b), "Sizes mismatch!: 4 != 2");
+    EXPECT_DEATH(std::ignore = xpby_dot(this->b, TypeParam{ 1.5 }, this->a), "Sizes mismatch!: 2 != 4");
+}
+
 TYPED_TEST(Operators, operator_sign_positive) {
     EXPECT_FLOATING_POINT_EQ(sign(TypeParam{ 1.6 }), TypeParam{ 1 });
     EXPECT_FLOATING_POINT_EQ(sign(TypeParam{ 3 }), TypeParam{ 1 });
@@ -0,0 +1,122 @@
+/**
+ * @author Alexander Van Craen
+ * @author Marcel Breyer
+ * @copyright 2018-today The PLSSVM project - All Rights Reserved
+ * @license This file is part of the PLSSVM project which is released under the MIT license.
+ *          See the LICENSE.md file in the project root for full license information.
+ *
+ * @brief Tests for the adaptive residual replacement strategy used in the CG algorithms.
+ */
+
+#include "plssvm/detail/residual_replacement.hpp"  // plssvm::detail::residual_replacement
+
+#include "../custom_test_macros.hpp"               // EXPECT_FLOATING_POINT_EQ
+#include "../naming.hpp"                           // naming::real_type_to_name
+#include "../types_to_test.hpp"                    // util::real_type_gtest
+
+#include "gtest/gtest.h"                           // TYPED_TEST_SUITE, TYPED_TEST, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, EXPECT_DEATH, ::testing::Test
+
+#include <limits>                                  // std::numeric_limits
+
+template <typename T>
+class ResidualReplacement : public ::testing::Test {};
+TYPED_TEST_SUITE(ResidualReplacement, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(ResidualReplacement, construct) {
+    using real_type = TypeParam;
+
+    const plssvm::detail::residual_replacement<real_type> replacement{ real_type{ 0.25 }, real_type{ 2.0 } };
+
+    // the deviation is initialized with the rounding error of the initial residual
+    EXPECT_FLOATING_POINT_EQ(replacement.deviation(), real_type{ 0.5 });
+    EXPECT_FLOATING_POINT_EQ(replacement.matrix_norm(), real_type{ 0.0 });
+    EXPECT_EQ(replacement.num_replacements(), 0);
+}
+TYPED_TEST(ResidualReplacement, update_matrix_norm) {
+    using real_type = TypeParam;
+
+    plssvm::detail::residual_replacement<real_type> replacement{ std::numeric_limits<real_type>::epsilon(), real_type{ 1.0 } };
+
+    // the matrix norm is estimated by the largest Rayleigh quotient
+    replacement.update_matrix_norm(real_type{ 4.0 }, real_type{ 2.0 });
+    EXPECT_FLOATING_POINT_EQ(replacement.matrix_norm(), real_type{ 2.0 });
+    replacement.update_matrix_norm(real_type{ 1.0 }, real_type{ 2.0 });
+    EXPECT_FLOATING_POINT_EQ(replacement.matrix_norm(), real_type{ 2.0 });
+    replacement.update_matrix_norm(real_type{ 9.0 }, real_type{ 3.0 });
+    EXPECT_FLOATING_POINT_EQ(replacement.matrix_norm(), real_type{ 3.0 });
+    // a vanishing search direction must be ignored
+    replacement.update_matrix_norm(real_type{ 1.0 }, real_type{ 0.0 });
+    EXPECT_FLOATING_POINT_EQ(replacement.matrix_norm(), real_type{ 3.0 });
+}
+TYPED_TEST(ResidualReplacement, update) {
+    using real_type = TypeParam;
+
+    // use a large machine epsilon to easily trigger a replacement
+    plssvm::detail::residual_replacement<real_type> replacement{ real_type{ 0.01 }, real_type{ 1.0 } };
+    replacement.update_matrix_norm(real_type{ 2.0 }, real_type{ 1.0 });
+
+    // the deviation is negligible compared to the residual
+    EXPECT_FALSE(replacement.update(real_type{ 1.0 }, real_type{ 1.0 }));
+    EXPECT_FLOATING_POINT_EQ(replacement.deviation(), real_type{ 0.04 });
+    // the residual became small enough such that the accumulated deviation is no longer negligible
+    EXPECT_TRUE(replacement.update(real_type{ 1.0 }, real_type{ 0.1 }));
+    EXPECT_FLOATING_POINT_EQ(replacement.deviation(), real_type{ 0.061 });
+    // no replacement has been performed yet
+    EXPECT_EQ(replacement.num_replacements(), 0);
+}
+TYPED_TEST(ResidualReplacement, update_already_not_negligible) {
+    using real_type = TypeParam;
+
+    plssvm::detail::residual_replacement<real_type> replacement{ real_type{ 0.01 }, real_type{ 1.0 } };
+    replacement.update_matrix_norm(real_type{ 2.0 }, real_type{ 1.0 });
+    EXPECT_TRUE(replacement.update(real_type{ 1.0 }, real_type{ 0.1 }));
+
+    // the deviation already wasn't negligible in the previous iteration -> the residual reached the level of the rounding errors
+    EXPECT_FALSE(replacement.update(real_type{ 1.0 }, real_type{ 0.1 }));
+    EXPECT_FLOATING_POINT_EQ(replacement.deviation(), real_type{ 0.052 });
+}
+TYPED_TEST(ResidualReplacement, update_replace_repeatedly) {
+    using real_type = TypeParam;
+
+    plssvm::detail::residual_replacement<real_type> replacement{ real_type{ 0.01 }, real_type{ 1.0 }, true };
+    replacement.update_matrix_norm(real_type{ 2.0 }, real_type{ 1.0 });
+    EXPECT_TRUE(replacement.update(real_type{ 1.0 }, real_type{ 0.1 }));
+
+    // the residual must be replaced again, although the deviation already wasn't negligible in the previous iteration
+    EXPECT_TRUE(replacement.update(real_type{ 1.0 }, real_type{ 0.1 }));
+    EXPECT_FLOATING_POINT_EQ(replacement.deviation(), real_type{ 0.052 });
+}
+TYPED_TEST(ResidualReplacement, update_no_growth) {
+    using real_type = TypeParam;
+
+    // the deviation is not negligible compared to the residual, but didn't grow since the last replacement
+    plssvm::detail::residual_replacement<real_type> replacement{ real_type{ 0.01 }, real_type{ 100.0 } };
+    EXPECT_FALSE(replacement.update(real_type{ 0.0 }, real_type{ 0.01 }));
+}
+TYPED_TEST(ResidualReplacement, replaced) {
+    using real_type = TypeParam;
+
+    plssvm::detail::residual_replacement<real_type> replacement{ real_type{ 0.01 }, real_type{ 1.0 } };
+    replacement.update_matrix_norm(real_type{ 2.0 }, real_type{ 1.0 });
+    EXPECT_TRUE(replacement.update(real_type{ 1.0 }, real_type{ 0.1 }));
+
+    // replacing the residual resets the deviation estimate
+    replacement.replaced(real_type{ 1.0 }, real_type{ 0.1 });
+    EXPECT_FLOATING_POINT_EQ(replacement.deviation(), real_type{ 0.021 });
+    EXPECT_EQ(replacement.num_replacements(), 1);
+
+    // the deviation must grow noticeably before the next replacement is triggered
+    EXPECT_FALSE(replacement.update(real_type{ 0.0 }, real_type{ 0.1 }));
+    replacement.replaced(real_type{ 1.0 }, real_type{ 0.1 });
+    EXPECT_EQ(replacement.num_replacements(), 2);
+}
+
+template <typename T>
+class ResidualReplacementDeathTest : public ::testing::Test {};
+TYPED_TEST_SUITE(ResidualReplacementDeathTest, util::real_type_gtest, naming::real_type_to_name);
+
+TYPED_TEST(ResidualReplacementDeathTest, invalid_machine_epsilon) {
+    using real_type = TypeParam;
+
+    EXPECT_DEATH((plssvm::detail::residual_replacement<real_type>{ real_type{ 0.0 }, real_type{ 1.0 } }), "The machine epsilon must be greater than 0.0, but is 0!");
+}
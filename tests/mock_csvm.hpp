@@ -14,6 +14,7 @@
 #pragma once
 
 #include "plssvm/csvm.hpp"                   // plssvm::csvm
+#include "plssvm/detail/solver_control.hpp"  // plssvm::detail::solver_control
 #include "plssvm/kernel_function_types.hpp"  // plssvm::kernel_function_type
 #include "plssvm/parameter.hpp"              // plssvm::parameter, plssvm::detail::parameter
 
@@ -44,8 +45,8 @@ class mock_csvm final : public plssvm::csvm {
     }
 
     // mock pure virtual functions
-    MOCK_METHOD((std::pair<std::vector<float>, float>), solve_system_of_linear_equations, (const plssvm::detail::parameter<float> &, const std::vector<std::vector<float>> &, std::vector<float>, float, unsigned long long), (const, override));
-    MOCK_METHOD((std::pair<std::vector<double>, double>), solve_system_of_linear_equations, (const plssvm::detail::parameter<double> &, const std::vector<std::vector<double>> &, std::vector<double>, double, unsigned long long), (const, override));
+    MOCK_METHOD((std::pair<std::vector<float>, float>), solve_system_of_linear_equations, (const plssvm::detail::parameter<float> &, const std::vector<std::vector<float>> &, std::vector<float>, float, unsigned long long, const plssvm::detail::solver_control<float> &), (const, override));
+    MOCK_METHOD((std::pair<std::vector<double>, double>), solve_system_of_linear_equations, (const plssvm::detail::parameter<double> &, const std::vector<std::vector<double>> &, std::vector<double>, double, unsigned long long, const plssvm::detail::solver_control<double> &), (const, override));
     MOCK_METHOD(std::vector<float>, predict_values, (const plssvm::detail::parameter<float> &, const std::vector<std::vector<float>> &, const std::vector<float> &, float, std::vector<float> &, const std::vector<std::vector<float>> &), (const, override));
     MOCK_METHOD(std::vector<double>, predict_values, (const plssvm::detail::parameter<double> &, const std::vector<std::vector<double>> &, const std::vector<double> &, double, std::vector<double> &, const std::vector<std::vector<double>> &), (const, override));
 
@@ -57,14 +58,16 @@ class mock_csvm final : public plssvm::csvm {
                            ::testing::An<const std::vector<std::vector<float>> &>(),
                            ::testing::An<std::vector<float>>(),
                            ::testing::An<float>(),
-                           ::testing::An<unsigned long long>())).WillByDefault(::testing::Return(solve_system_of_linear_equations_fake_return<float>));
+                           ::testing::An<unsigned long long>(),
+                           ::testing::An<const plssvm::detail::solver_control<float> &>())).WillByDefault(::testing::Return(solve_system_of_linear_equations_fake_return<float>));
 
         ON_CALL(*this, solve_system_of_linear_equations(
                            ::testing::An<const plssvm::detail::parameter<double> &>(),
                            ::testing::An<const std::vector<std::vector<double>> &>(),
                            ::testing::An<std::vector<double>>(),
                            ::testing::An<double>(),
-                           ::testing::An<unsigned long long>())).WillByDefault(::testing::Return(solve_system_of_linear_equations_fake_return<double>));
+                           ::testing::An<unsigned long long>(),
+                           ::testing::An<const plssvm::detail::solver_control<double> &>())).WillByDefault(::testing::Return(solve_system_of_linear_equations_fake_return<double>));
 
         ON_CALL(*this, predict_values(
                            ::testing::An<const plssvm::detail::parameter<float> &>(),
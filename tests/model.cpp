@@ -200,6 +200,18 @@ TYPED_TEST(Model, rho) {
     // test for the correct rho (bias) value
     EXPECT_FLOATING_POINT_EQ(model.rho(), real_type{ 0.37330625882191915 });
 }
+TYPED_TEST(Model, converged) {
+    using real_type = typename TypeParam::real_type;
+    using label_type = typename TypeParam::label_type;
+
+    // instantiate a model file
+    const util::temporary_file model_file;
+    util::instantiate_template_file<label_type>(PLSSVM_TEST_PATH "/data/model/5x4_linear_TEMPLATE.libsvm.model", model_file.filename);
+    const plssvm::model<real_type, label_type> model{ model_file.filename };
+
+    // a model read from a file is always assumed to be converged
+    EXPECT_TRUE(model.converged());
+}
 
 class ModelSave : public ::testing::TestWithParam<std::string>, private util::redirect_output<>, protected util::temporary_file {};
 TEST_P(ModelSave, save) {